@@ -78,6 +78,7 @@ indent_message ( "1" "Install Prefix      : ${CMAKE_INSTALL_PREFIX}" )
 indent_message ( "1" "Library Type        : ${SCAI_LIBRARY_TYPE}" )
 indent_message ( "1" "Numeric Types       : ${INST_LIST}" )
 indent_message ( "1" "IndexType           : ${SCAI_INDEX_TYPE}" )
+indent_message ( "1" "LocalIndexType      : ${SCAI_LOCAL_INDEX_TYPE}" )
 indent_message ( "1" "ASSERT Level        : ${SCAI_ASSERT_LEVEL} ( -DSCAI_ASSERT_LEVEL_${SCAI_ASSERT_LEVEL} )" )
 indent_message ( "1" "LOG Level           : ${SCAI_LOG_LEVEL} ( -DSCAI_LOG_LEVEL_${SCAI_LOG_LEVEL} )" ) 
 indent_message ( "1" "TRACE               : ${SCAI_TRACE} ( -DSCAI_TRACE_${SCAI_TRACE} )" )
@@ -29,6 +29,8 @@
 
 #pragma once
 
+#include <scai/common/Complex.hpp>
+
 #ifdef _OPENMP
 
 #include <omp.h>
@@ -101,6 +103,28 @@ inline void atomicAdd( int& sharedResult, const int& threadResult )
     sharedResult += threadResult;
 }
 
+template<>
+inline void atomicAdd( long double& sharedResult, const long double& threadResult )
+{
+    #pragma omp atomic
+    sharedResult += threadResult;
+}
+
+/** atomicAdd for complex values updates real and imaginary part as two independent lanes.
+ *
+ *  The sum is correct after all threads have finished, but a concurrent reader might
+ *  see a complex value where only one part has been updated. This is the same as
+ *  for the corresponding CUDA implementation.
+ */
+template<typename ValueType>
+inline void atomicAdd( scai::common::Complex<ValueType>& sharedResult, const scai::common::Complex<ValueType>& threadResult )
+{
+    ValueType* lanes = reinterpret_cast<ValueType*>( &sharedResult );
+
+    atomicAdd( lanes[0], threadResult.real() );
+    atomicAdd( lanes[1], threadResult.imag() );
+}
+
 /* --------------------------------------------------------------------------- */
 
 template<typename ValueType>
@@ -250,7 +250,7 @@ void Stencil<ValueType>::addPoint( const int relpos[], const ValueType val )
 
     for ( IndexType i = 0; i < mNDims; ++i )
     {
-        mValues.push_back( relpos[i] );
+        mPositions.push_back( relpos[i] );
     }
 }
 
@@ -58,4 +58,26 @@ BOOST_AUTO_TEST_CASE_TEMPLATE( atomicAddTest, ValueType, scai_numeric_test_types
     BOOST_CHECK_EQUAL( globalResult, res );
 }
 
+/* -------------------------------------------------------------------------------- */
+
+typedef boost::mpl::list<ComplexFloat, ComplexDouble, ComplexLongDouble> scai_complex_test_types;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( atomicAddComplexTest, ValueType, scai_complex_test_types )
+{
+    // real and imaginary part are updated separately, so both must be checked
+
+    int size = 100;
+    ValueType globalResult = 0;
+    #pragma omp parallel for
+
+    for ( int i = 0; i < size; ++i )
+    {
+        ValueType localResult( i + 1, -2 * ( i + 1 ) );
+        atomicAdd( globalResult, localResult );
+    }
+
+    ValueType res( ( size * ( size + 1 ) ) / 2, -( size * ( size + 1 ) ) );
+    BOOST_CHECK_EQUAL( globalResult, res );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -37,6 +37,8 @@
 #include <scai/tasking/NoSyncToken.hpp>
 
 #include <scai/tracing.hpp>
+#include <scai/tracing/TraceConfig.hpp>
+#include <scai/tracing/Counters.hpp>
 #include <scai/common/Settings.hpp>
 #include <scai/utilskernel/HArrayUtils.hpp>
 
@@ -839,6 +841,31 @@ bool Communicator::all( const bool flag ) const
 
 /* -------------------------------------------------------------------------- */
 
+void Communicator::synchronizeTraceClock() const
+{
+    tracing::TraceConfig& traceConfig = tracing::TraceConfig::getInstance();
+
+    if ( !traceConfig.isEventTraceEnabled() )
+    {
+        return;
+    }
+
+    // all processors take their time stamp as close as possible after the barrier
+
+    synchronize();
+
+    long localStamp = static_cast<long>( tracing::timestamp() );
+    long rootStamp = localStamp;
+
+    bcast( &rootStamp, 1, 0 );
+
+    SCAI_LOG_INFO( logger, *this << ": clock offset for trace events = " << rootStamp - localStamp )
+
+    traceConfig.setClockOffset( rootStamp - localStamp );
+}
+
+/* -------------------------------------------------------------------------- */
+
 bool Communicator::any( const bool flag ) const
 {
     IndexType val = flag ? 1 : 0; //  1 if flag is true
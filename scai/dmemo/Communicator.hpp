@@ -585,6 +585,14 @@ public:
     virtual bool all( const bool flag ) const;
     virtual bool any( const bool flag ) const;
 
+    /** @brief Align the clocks used for trace events of all processors to the clock of processor 0.
+     *
+     *  After a barrier each processor takes a time stamp, the one of the first processor is 
+     *  broadcast and the difference is set as offset for the trace events. The routine
+     *  does nothing if trace events are not recorded.
+     */
+    void synchronizeTraceClock() const;
+
     /* @brief Broadcast a typed array from root to all other processors.
      *
      *  @tparam ValueType  is the data type
@@ -31,6 +31,7 @@
 #include <scai/dmemo/HaloExchangePlan.hpp>
 
 #include <scai/hmemo/HostReadAccess.hpp>
+#include <scai/hmemo/HostWriteOnlyAccess.hpp>
 #include <scai/utilskernel/HArrayUtils.hpp>
 #include <scai/utilskernel/TransferUtils.hpp>
 
@@ -355,6 +356,54 @@ void HaloExchangePlan::updateHalo(
 
 /* ---------------------------------------------------------------------- */
 
+template<typename ValueType>
+void HaloExchangePlan::updateHaloN(
+    HArray<ValueType>& haloArray,
+    const HArray<ValueType>& localArray,
+    const IndexType n,
+    const Communicator& comm,
+    HArray<ValueType>& tmpSendValues ) const
+{
+    if ( n == 1 )
+    {
+        updateHalo( haloArray, localArray, comm, tmpSendValues );
+        return;
+    }
+
+    SCAI_REGION( "HaloExchangePlan.updateHaloN" )
+
+    // positions of all n values of each local entry required by other processors
+
+    HArray<IndexType> blockIndexes;
+
+    {
+        const IndexType numIndexes = mLocalIndexes.size();
+
+        auto rLocalIndexes = hostReadAccess( mLocalIndexes );
+        auto wBlockIndexes = hostWriteOnlyAccess( blockIndexes, numIndexes * n );
+
+        for ( IndexType i = 0; i < numIndexes; ++i )
+        {
+            for ( IndexType k = 0; k < n; ++k )
+            {
+                wBlockIndexes[i * n + k] = rLocalIndexes[i] * n + k;
+            }
+        }
+    }
+
+    utilskernel::HArrayUtils::gather( tmpSendValues, localArray, blockIndexes, common::BinaryOp::COPY );
+
+    CommunicationPlan haloCommPlanN( mHaloCommPlan );
+    CommunicationPlan localCommPlanN( mLocalCommPlan );
+
+    haloCommPlanN.multiplyConst( n );
+    localCommPlanN.multiplyConst( n );
+
+    comm.exchangeByPlan( haloArray, haloCommPlanN, tmpSendValues, localCommPlanN );
+}
+
+/* ---------------------------------------------------------------------- */
+
 template<typename ValueType>
 HArray<ValueType> HaloExchangePlan::updateHaloF(
     const HArray<ValueType>& localArray,
@@ -444,6 +493,14 @@ void HaloExchangePlan::updateByHalo(
         HArray<_type>& ) const;                                     \
                                                                     \
     template COMMON_DLL_IMPORTEXPORT                                \
+    void HaloExchangePlan::updateHaloN(                             \
+        HArray<_type>&,                                             \
+        const HArray<_type>&,                                       \
+        const IndexType,                                            \
+        const Communicator& comm,                                   \
+        HArray<_type>& ) const;                                     \
+                                                                    \
+    template COMMON_DLL_IMPORTEXPORT                                \
     HArray<_type> HaloExchangePlan::updateHaloF(                    \
         const HArray<_type>&,                                       \
         const Communicator& comm ) const;                           \
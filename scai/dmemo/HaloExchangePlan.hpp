@@ -173,6 +173,20 @@ public:
         const Communicator& comm,
         hmemo::HArray<ValueType>& tmp ) const;
 
+    /**
+     *  Same as updateHalo but each entry of the arrays is a contiguous block of n values,
+     *  e.g. a row of a row-major multi-vector with n columns.
+     *
+     *  All n values for one partner processor are packed into one single message.
+     */
+    template<typename ValueType>
+    void updateHaloN(
+        hmemo::HArray<ValueType>& haloArray,
+        const hmemo::HArray<ValueType>& sourceArray,
+        const IndexType n,
+        const Communicator& comm,
+        hmemo::HArray<ValueType>& tmp ) const;
+
     /** 
      *  Update halo data directly with the send data that is the gathered local data.
      *
@@ -224,6 +224,10 @@ void MPICommunicator::initialize( int& argc, char** & argv )
     // tracing of MPI calls for getting node data can already be traced
 
     setNodeData(); // determine mNodeRank, mNodeSize
+
+    // trace events of all processes should use the same time line
+
+    synchronizeTraceClock();
 }
 
 #ifdef SCAI_COMPLEX_SUPPORTED
@@ -0,0 +1,288 @@
+/**
+ * @file MultiVector.cpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Implementation of methods for the distributed multi-vector.
+ * @author Thomas Brandes
+ * @date 19.10.2026
+ */
+
+// hpp
+#include <scai/lama/MultiVector.hpp>
+
+// internal scai libraries
+#include <scai/dmemo/NoDistribution.hpp>
+#include <scai/utilskernel/HArrayUtils.hpp>
+#include <scai/utilskernel/LAMAKernel.hpp>
+#include <scai/blaskernel/BLASKernelTrait.hpp>
+
+#include <scai/common/macros/instantiate.hpp>
+
+#include <scai/tracing.hpp>
+
+namespace scai
+{
+
+using namespace hmemo;
+
+using utilskernel::HArrayUtils;
+
+namespace lama
+{
+
+/* ------------------------------------------------------------------------- */
+
+SCAI_LOG_DEF_TEMPLATE_LOGGER( template<typename ValueType>, MultiVector<ValueType>::logger, "MultiVector" )
+
+/* ------------------------------------------------------------------------- */
+
+template<typename ValueType>
+MultiVector<ValueType>::MultiVector( ContextPtr context ) :
+
+    Distributed( std::make_shared<dmemo::NoDistribution>( 0 ) ),
+    mNumColumns( 0 ),
+    mContext( context )
+{
+}
+
+template<typename ValueType>
+MultiVector<ValueType>::MultiVector(
+    dmemo::DistributionPtr dist,
+    const IndexType numColumns,
+    const ValueType value,
+    ContextPtr context ) :
+
+    Distributed( dist ),
+    mNumColumns( numColumns ),
+    mContext( context )
+{
+    HArrayUtils::setSameValue( mLocalValues, dist->getLocalSize() * numColumns, value, mContext );
+}
+
+template<typename ValueType>
+MultiVector<ValueType>::~MultiVector()
+{
+}
+
+/* ------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void MultiVector<ValueType>::setSameValue( dmemo::DistributionPtr dist, const IndexType numColumns, const ValueType value )
+{
+    setDistributionPtr( dist );
+    mNumColumns = numColumns;
+    HArrayUtils::setSameValue( mLocalValues, dist->getLocalSize() * numColumns, value, mContext );
+}
+
+/* ------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void MultiVector<ValueType>::setColumn( const IndexType j, const DenseVector<ValueType>& column )
+{
+    SCAI_ASSERT_VALID_INDEX_ERROR( j, mNumColumns, "illegal column index" )
+    SCAI_ASSERT_EQ_ERROR( getDistribution(), column.getDistribution(), "column has illegal distribution" )
+
+    const IndexType numLocalRows = getDistribution().getLocalSize();
+
+    HArrayUtils::setArraySection( mLocalValues, j, mNumColumns,
+                                  column.getLocalValues(), 0, 1, numLocalRows,
+                                  common::BinaryOp::COPY, mContext );
+}
+
+template<typename ValueType>
+void MultiVector<ValueType>::getColumn( DenseVector<ValueType>& column, const IndexType j ) const
+{
+    SCAI_ASSERT_VALID_INDEX_ERROR( j, mNumColumns, "illegal column index" )
+
+    const IndexType numLocalRows = getDistribution().getLocalSize();
+
+    column.allocate( getDistributionPtr() );
+
+    HArrayUtils::setArraySection( column.getLocalValues(), 0, 1,
+                                  mLocalValues, j, mNumColumns, numLocalRows,
+                                  common::BinaryOp::COPY, mContext );
+}
+
+/* ------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void MultiVector<ValueType>::matrixTimesMultiVector(
+    const ValueType alpha,
+    const SparseMatrix<ValueType>& A,
+    const MultiVector<ValueType>& x,
+    const ValueType beta,
+    const MultiVector<ValueType>& y )
+{
+    SCAI_REGION( "MultiVector.matrixTimes" )
+
+    SCAI_ASSERT_NE_ERROR( this, &x, "alias of result and x not supported" )
+    SCAI_ASSERT_EQ_ERROR( A.getColDistribution(), x.getDistribution(), "size/dist mismatch of A and x" )
+
+    const IndexType k = x.getNumColumns();
+
+    const bool hasY = beta != common::Constants::ZERO;
+
+    if ( hasY )
+    {
+        SCAI_ASSERT_EQ_ERROR( A.getRowDistribution(), y.getDistribution(), "size/dist mismatch of A and y" )
+        SCAI_ASSERT_EQ_ERROR( k, y.getNumColumns(), "number of columns of x and y differ" )
+    }
+
+    SCAI_LOG_INFO( logger, "matrixTimesMultiVector: result = " << alpha << " * " << A << " * " << x
+                            << " + " << beta << " * " << y )
+
+    const MatrixStorage<ValueType>& localStorage = A.getLocalStorage();
+    const MatrixStorage<ValueType>& haloStorage  = A.getHaloStorage();
+
+    const dmemo::Communicator& comm = A.getColDistribution().getCommunicator();
+
+    // halo update is collective, all columns of one row are sent together
+
+    A.getHaloExchangePlan().updateHaloN( mHaloValues, x.getLocalValues(), k, comm, mSendValues );
+
+    const HArray<ValueType>& localY = hasY ? y.getLocalValues() : mLocalValues;
+
+    const IndexType numLocalRows = localStorage.getNumRows();
+
+    // resize is a no-op if this is an alias of y
+
+    mLocalValues.resize( numLocalRows * k );
+
+    localStorage.matrixTimesVectorN( mLocalValues, k, alpha, x.getLocalValues(), hasY ? beta : ValueType( 0 ), localY );
+
+    if ( haloStorage.getNumColumns() > 0 )
+    {
+        haloStorage.matrixTimesVectorN( mLocalValues, k, alpha, mHaloValues, ValueType( 1 ), mLocalValues );
+    }
+
+    setDistributionPtr( A.getRowDistributionPtr() );
+    mNumColumns = k;
+}
+
+/* ------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void MultiVector<ValueType>::dot( HArray<ValueType>& result, const MultiVector<ValueType>& other ) const
+{
+    SCAI_REGION( "MultiVector.dot" )
+
+    SCAI_ASSERT_EQ_ERROR( getDistribution(), other.getDistribution(), "dot: multi-vectors have different distributions" )
+
+    const IndexType m = mNumColumns;
+    const IndexType n = other.getNumColumns();
+    const IndexType numLocalRows = getDistribution().getLocalSize();
+
+    if ( numLocalRows == 0 || m == 0 || n == 0 )
+    {
+        HArrayUtils::setSameValue( result, m * n, ValueType( 0 ) );
+    }
+    else
+    {
+        // result = conj( this )^T * other, conj is applied explicitly as gemm does not support it in all implementations
+
+        HArray<ValueType> conjValues;
+
+        const bool isComplex = common::isComplex( common::TypeTraits<ValueType>::stype );
+
+        if ( isComplex )
+        {
+            HArrayUtils::unaryOp( conjValues, mLocalValues, common::UnaryOp::CONJ, mContext );
+        }
+
+        const HArray<ValueType>& a = isComplex ? conjValues : mLocalValues;
+
+        static utilskernel::LAMAKernel<blaskernel::BLASKernelTrait::gemm<ValueType> > gemm;
+
+        ContextPtr loc = mContext;
+
+        gemm.getSupportedContext( loc );
+
+        SCAI_CONTEXT_ACCESS( loc )
+
+        ReadAccess<ValueType> rA( a, loc );
+        ReadAccess<ValueType> rB( other.getLocalValues(), loc );
+        WriteOnlyAccess<ValueType> wResult( result, loc, m * n );
+
+        gemm[loc]( common::MatrixOp::TRANSPOSE, common::MatrixOp::NORMAL, m, n, numLocalRows,
+                   ValueType( 1 ), rA.get(), m, rB.get(), n, ValueType( 0 ), wResult.get(), n );
+    }
+
+    // one single reduction for all m x n dot products
+
+    getDistribution().getCommunicator().sumArray( result );
+}
+
+/* ------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void MultiVector<ValueType>::axpy( const ValueType alpha, const MultiVector<ValueType>& x, const HArray<ValueType>& b )
+{
+    SCAI_REGION( "MultiVector.axpy" )
+
+    SCAI_ASSERT_EQ_ERROR( getDistribution(), x.getDistribution(), "axpy: multi-vectors have different distributions" )
+
+    const IndexType m = getDistribution().getLocalSize();
+    const IndexType n = mNumColumns;
+    const IndexType k = x.getNumColumns();
+
+    SCAI_ASSERT_EQ_ERROR( b.size(), k * n, "axpy: b must have size " << k << " x " << n )
+
+    if ( m == 0 || n == 0 || k == 0 )
+    {
+        return;
+    }
+
+    static utilskernel::LAMAKernel<blaskernel::BLASKernelTrait::gemm<ValueType> > gemm;
+
+    ContextPtr loc = mContext;
+
+    gemm.getSupportedContext( loc );
+
+    SCAI_CONTEXT_ACCESS( loc )
+
+    ReadAccess<ValueType> rX( x.getLocalValues(), loc );
+    ReadAccess<ValueType> rB( b, loc );
+    WriteAccess<ValueType> wThis( mLocalValues, loc );
+
+    gemm[loc]( common::MatrixOp::NORMAL, common::MatrixOp::NORMAL, m, n, k,
+               alpha, rX.get(), k, rB.get(), n, ValueType( 1 ), wThis.get(), n );
+}
+
+/* ------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void MultiVector<ValueType>::writeAt( std::ostream& stream ) const
+{
+    stream << "MultiVector<" << common::TypeTraits<ValueType>::id() << ">( " << getNumRows()
+           << " x " << mNumColumns << ", dist = " << getDistribution() << " )";
+}
+
+/* ========================================================================= */
+/*       Template instantiations                                             */
+/* ========================================================================= */
+
+SCAI_COMMON_INST_CLASS( MultiVector, SCAI_NUMERIC_TYPES_HOST )
+
+} /* end namespace lama */
+
+} /* end namespace scai */
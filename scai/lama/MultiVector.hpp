@@ -0,0 +1,210 @@
+/**
+ * @file MultiVector.hpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Definition of a distributed block of dense vectors stored row-wise.
+ * @author Thomas Brandes
+ * @date 19.10.2026
+ */
+
+#pragma once
+
+// for dll_import
+#include <scai/common/config.hpp>
+
+// base classes
+#include <scai/dmemo/Distributed.hpp>
+
+// local library
+#include <scai/lama/DenseVector.hpp>
+#include <scai/lama/matrix/SparseMatrix.hpp>
+
+// internal scai libraries
+#include <scai/hmemo/HArray.hpp>
+#include <scai/logging.hpp>
+
+namespace scai
+{
+
+namespace lama
+{
+
+/**
+ * @brief A MultiVector is a block of k dense vectors that have all the same distribution.
+ *
+ * The local part is stored row-major, i.e. the k values of one row are contiguous in memory.
+ * This is the layout required for the multiplication of a sparse matrix with the whole block (SpMM),
+ * where each matrix entry is read only once for all k vectors, and for the halo exchange where
+ * all k values of a row are sent in the same message.
+ *
+ * \code
+ *     MultiVector<double> X( A.getColDistributionPtr(), k, 1.0 );
+ *     MultiVector<double> Y;
+ *     Y.matrixTimesMultiVector( 1.0, A, X, 0.0, Y );    // Y = A * X
+ *     HArray<double> G;
+ *     X.dot( G, Y );                                     // G = X' * Y, k x k
+ *     Y.axpy( -1.0, X, G );                              // Y = Y - X * G
+ * \endcode
+ */
+template<typename ValueType>
+class COMMON_DLL_IMPORTEXPORT MultiVector:
+
+    public dmemo::Distributed
+
+{
+public:
+
+    /** Constructor of an empty multi-vector. */
+
+    explicit MultiVector( hmemo::ContextPtr context = hmemo::Context::getContextPtr() );
+
+    /** Constructor of a multi-vector with numColumns vectors, all elements get the same value. */
+
+    MultiVector(
+        dmemo::DistributionPtr dist,
+        const IndexType numColumns,
+        const ValueType value,
+        hmemo::ContextPtr context = hmemo::Context::getContextPtr() );
+
+    MultiVector( const MultiVector<ValueType>& other ) = default;
+
+    virtual ~MultiVector();
+
+    /** Reset the multi-vector, all elements get the same value. */
+
+    void setSameValue( dmemo::DistributionPtr dist, const IndexType numColumns, const ValueType value );
+
+    /** Number of vectors in this block. */
+
+    inline IndexType getNumColumns() const;
+
+    /** Global size of each vector. */
+
+    inline IndexType getNumRows() const;
+
+    /** Local part, row-major array of size getDistribution().getLocalSize() * getNumColumns() */
+
+    inline hmemo::HArray<ValueType>& getLocalValues();
+
+    inline const hmemo::HArray<ValueType>& getLocalValues() const;
+
+    inline hmemo::ContextPtr getContextPtr() const;
+
+    /** Set column j of this multi-vector, the vector must have the same distribution. */
+
+    void setColumn( const IndexType j, const DenseVector<ValueType>& column );
+
+    /** Get column j of this multi-vector as a dense vector. */
+
+    void getColumn( DenseVector<ValueType>& column, const IndexType j ) const;
+
+    /**
+     *  @brief this = alpha * A * x + beta * y, sparse matrix times multi-vector
+     *
+     *  The local and the halo part of A are multiplied with all columns of x at once. The halo
+     *  exchange for x sends all columns of the required rows in one message.
+     *
+     *  y might be an alias of this, x must not be an alias of this.
+     */
+    void matrixTimesMultiVector(
+        const ValueType alpha,
+        const SparseMatrix<ValueType>& A,
+        const MultiVector<ValueType>& x,
+        const ValueType beta,
+        const MultiVector<ValueType>& y );
+
+    /**
+     *  @brief Block dot product, result = this' * other
+     *
+     *  @param[out] result is a row-major array of size getNumColumns() x other.getNumColumns()
+     *  @param[in]  other  must have the same distribution
+     *
+     *  result[ i * other.getNumColumns() + j ] is the dot product of column i of this and column j of other.
+     *  All values are reduced with one single communication.
+     */
+    void dot( hmemo::HArray<ValueType>& result, const MultiVector<ValueType>& other ) const;
+
+    /**
+     *  @brief Block axpy, this = this + alpha * x * b
+     *
+     *  @param[in] alpha scaling factor
+     *  @param[in] x     multi-vector with the same distribution
+     *  @param[in] b     row-major array of size x.getNumColumns() x getNumColumns(), replicated
+     */
+    void axpy( const ValueType alpha, const MultiVector<ValueType>& x, const hmemo::HArray<ValueType>& b );
+
+    virtual void writeAt( std::ostream& stream ) const;
+
+protected:
+
+    SCAI_LOG_DECL_STATIC_LOGGER( logger )
+
+private:
+
+    IndexType mNumColumns;  //!< number of vectors
+
+    hmemo::HArray<ValueType> mLocalValues;  //!< local rows, row-major
+
+    hmemo::ContextPtr mContext;  //!< preferred context for operations
+
+    mutable hmemo::HArray<ValueType> mHaloValues;  //!< temporary array for halo rows of x
+    mutable hmemo::HArray<ValueType> mSendValues;  //!< temporary array for send buffer of halo exchange
+};
+
+/* ------------------------------------------------------------------------- */
+/*   Implementation of inline methods                                        */
+/* ------------------------------------------------------------------------- */
+
+template<typename ValueType>
+IndexType MultiVector<ValueType>::getNumColumns() const
+{
+    return mNumColumns;
+}
+
+template<typename ValueType>
+IndexType MultiVector<ValueType>::getNumRows() const
+{
+    return getDistribution().getGlobalSize();
+}
+
+template<typename ValueType>
+hmemo::HArray<ValueType>& MultiVector<ValueType>::getLocalValues()
+{
+    return mLocalValues;
+}
+
+template<typename ValueType>
+const hmemo::HArray<ValueType>& MultiVector<ValueType>::getLocalValues() const
+{
+    return mLocalValues;
+}
+
+template<typename ValueType>
+hmemo::ContextPtr MultiVector<ValueType>::getContextPtr() const
+{
+    return mContext;
+}
+
+} /* end namespace lama */
+
+} /* end namespace scai */
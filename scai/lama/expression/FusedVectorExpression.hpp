@@ -0,0 +1,600 @@
+/**
+ * @file FusedVectorExpression.hpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Lazy element-wise vector expressions of arbitrary depth evaluated in one fused loop
+ * @author Thomas Brandes
+ * @date 19.10.2026
+ */
+
+#pragma once
+
+#include <scai/lama/DenseVector.hpp>
+
+#include <scai/hmemo/ReadAccess.hpp>
+#include <scai/hmemo/WriteAccess.hpp>
+
+#include <scai/common/BinaryOp.hpp>
+#include <scai/common/UnaryOp.hpp>
+#include <scai/common/OpenMP.hpp>
+#include <scai/common/Math.hpp>
+#include <scai/common/TypeTraits.hpp>
+#include <scai/common/macros/assert.hpp>
+
+#include <memory>
+#include <type_traits>
+
+namespace scai
+{
+
+namespace lama
+{
+
+/**
+ * @brief Namespace for lazy element-wise vector expressions that are evaluated in a single loop.
+ *
+ * The expressions of VectorExpressions.hpp only support a fixed set of shapes, e.g.
+ * alpha * x + beta * y, each of them evaluated by one kernel. More complex expressions need
+ * several passes over the data and temporary vectors. The expression templates here can be
+ * nested arbitrarily. They are only evaluated when assigned to a target vector, and evaluation
+ * is a single OpenMP loop over the local elements. A reduction can be fused into the same loop.
+ *
+ * \code
+ *     using namespace fused;
+ *
+ *     assign( x, vec( x ) + alpha * vec( p ) );                        // x = x + alpha * p
+ *     assign( x, a * vec( y ) + b * vec( z ) + c * vec( w ) );
+ *     ValueType rr = assignDot( r, vec( b ) - vec( ax ) );            // r = b - ax, rr = r' * r
+ *     ValueType s  = reduce( abs( vec( x ) - vec( y ) ), common::BinaryOp::MAX );
+ * \endcode
+ *
+ * All vector operands and the target must have the same distribution. Evaluation is done on the host.
+ * Operands that are not dense vectors are converted to a temporary dense vector, and a target that is not
+ * a dense vector gets the values of a temporary dense vector. Both use the conversion kernels.
+ * The target might also appear as an operand as long as it is only accessed element-wise.
+ */
+namespace fused
+{
+
+/* ------------------------------------------------------------------------- */
+/*   VectorLeaf: vector operand                                              */
+/* ------------------------------------------------------------------------- */
+
+/** Leaf of a fused expression for a vector operand. */
+
+template<typename ValueType>
+class VectorLeaf
+{
+public:
+
+    typedef ValueType ExpValueType;
+
+    explicit VectorLeaf( const Vector<ValueType>& v ) :
+
+        mData( nullptr )
+    {
+        if ( v.getVectorKind() == VectorKind::DENSE )
+        {
+            mVector = &static_cast<const DenseVector<ValueType>&>( v );
+        }
+        else
+        {
+            // fallback for non-dense operands
+
+            auto tmp = std::make_shared<DenseVector<ValueType>>( v.getContextPtr() );
+            *tmp = v;
+            mTmpVector = tmp;
+            mVector = tmp.get();
+        }
+    }
+
+    void checkDistribution( dmemo::DistributionPtr& dist ) const
+    {
+        if ( !dist )
+        {
+            dist = mVector->getDistributionPtr();
+        }
+        else
+        {
+            SCAI_ASSERT_EQ_ERROR( *dist, mVector->getDistribution(), "fused expression: operands have different distributions" )
+        }
+    }
+
+    /** Get access to the local data, if it is the target the write pointer is used */
+
+    void acquire( const hmemo::HArray<ValueType>& target, ValueType* targetData ) const
+    {
+        const hmemo::HArray<ValueType>& localValues = mVector->getLocalValues();
+
+        if ( &localValues == &target )
+        {
+            mData = targetData;
+        }
+        else
+        {
+            mAccess.reset( new hmemo::ReadAccess<ValueType>( localValues, hmemo::Context::getHostPtr() ) );
+            mData = mAccess->get();
+        }
+    }
+
+    void release() const
+    {
+        mAccess.reset();
+        mData = nullptr;
+    }
+
+    inline ValueType operator[]( const IndexType i ) const
+    {
+        return mData[i];
+    }
+
+private:
+
+    const DenseVector<ValueType>* mVector;
+
+    std::shared_ptr<DenseVector<ValueType>> mTmpVector;   // only used for non-dense operand
+
+    mutable std::shared_ptr<hmemo::ReadAccess<ValueType>> mAccess;
+    mutable const ValueType* mData;
+};
+
+/* ------------------------------------------------------------------------- */
+/*   ScalarLeaf: scalar operand                                              */
+/* ------------------------------------------------------------------------- */
+
+/** Leaf of a fused expression for a scalar operand, same value for all elements. */
+
+template<typename ValueType>
+class ScalarLeaf
+{
+public:
+
+    typedef ValueType ExpValueType;
+
+    explicit ScalarLeaf( const ValueType value ) : mValue( value )
+    {
+    }
+
+    void checkDistribution( dmemo::DistributionPtr& ) const
+    {
+    }
+
+    void acquire( const hmemo::HArray<ValueType>&, ValueType* ) const
+    {
+    }
+
+    void release() const
+    {
+    }
+
+    inline ValueType operator[]( const IndexType ) const
+    {
+        return mValue;
+    }
+
+private:
+
+    ValueType mValue;
+};
+
+/* ------------------------------------------------------------------------- */
+/*   BinaryNode, UnaryNode                                                   */
+/* ------------------------------------------------------------------------- */
+
+/** Element-wise binary operation, the operation is a template argument so it is resolved at compile time. */
+
+template<typename E1, typename E2, common::BinaryOp op>
+class BinaryNode
+{
+public:
+
+    typedef typename E1::ExpValueType ExpValueType;
+
+    BinaryNode( const E1& e1, const E2& e2 ) : mE1( e1 ), mE2( e2 )
+    {
+    }
+
+    void checkDistribution( dmemo::DistributionPtr& dist ) const
+    {
+        mE1.checkDistribution( dist );
+        mE2.checkDistribution( dist );
+    }
+
+    void acquire( const hmemo::HArray<ExpValueType>& target, ExpValueType* targetData ) const
+    {
+        mE1.acquire( target, targetData );
+        mE2.acquire( target, targetData );
+    }
+
+    void release() const
+    {
+        mE1.release();
+        mE2.release();
+    }
+
+    inline ExpValueType operator[]( const IndexType i ) const
+    {
+        return common::applyBinary( mE1[i], op, mE2[i] );
+    }
+
+private:
+
+    E1 mE1;
+    E2 mE2;
+};
+
+/** Element-wise unary function, the function is a template argument so it is resolved at compile time. */
+
+template<typename E, common::UnaryOp op>
+class UnaryNode
+{
+public:
+
+    typedef typename E::ExpValueType ExpValueType;
+
+    explicit UnaryNode( const E& e ) : mE( e )
+    {
+    }
+
+    void checkDistribution( dmemo::DistributionPtr& dist ) const
+    {
+        mE.checkDistribution( dist );
+    }
+
+    void acquire( const hmemo::HArray<ExpValueType>& target, ExpValueType* targetData ) const
+    {
+        mE.acquire( target, targetData );
+    }
+
+    void release() const
+    {
+        mE.release();
+    }
+
+    inline ExpValueType operator[]( const IndexType i ) const
+    {
+        return common::applyUnary( op, mE[i] );
+    }
+
+private:
+
+    E mE;
+};
+
+/* ------------------------------------------------------------------------- */
+/*   Building expressions                                                    */
+/* ------------------------------------------------------------------------- */
+
+/** Use a vector as operand in a fused expression. */
+
+template<typename ValueType>
+inline VectorLeaf<ValueType> vec( const Vector<ValueType>& v )
+{
+    return VectorLeaf<ValueType>( v );
+}
+
+/** Type trait to restrict the operators to the fused expression classes. */
+
+template<typename T> struct IsFused { static const bool value = false; };
+template<typename V> struct IsFused<VectorLeaf<V> > { static const bool value = true; };
+template<typename V> struct IsFused<ScalarLeaf<V> > { static const bool value = true; };
+template<typename E1, typename E2, common::BinaryOp op> struct IsFused<BinaryNode<E1, E2, op> > { static const bool value = true; };
+template<typename E, common::UnaryOp op> struct IsFused<UnaryNode<E, op> > { static const bool value = true; };
+
+/*  Note: the operators are only found by argument dependent lookup for the fused expression classes.
+ *        The scalar arguments use a non-deduced type so any value convertible to the value type is accepted.
+ */
+
+#define SCAI_FUSED_BINARY_OPERATOR( opSymbol, binaryOp )                                                           \
+                                                                                                                   \
+    template<typename E1, typename E2,                                                                             \
+             typename std::enable_if<IsFused<E1>::value && IsFused<E2>::value, int>::type = 0>                     \
+    inline BinaryNode<E1, E2, binaryOp> operator opSymbol( const E1& e1, const E2& e2 )                            \
+    {                                                                                                              \
+        return BinaryNode<E1, E2, binaryOp>( e1, e2 );                                                             \
+    }                                                                                                              \
+                                                                                                                   \
+    template<typename E, typename std::enable_if<IsFused<E>::value, int>::type = 0>                                \
+    inline BinaryNode<ScalarLeaf<typename E::ExpValueType>, E, binaryOp> operator opSymbol(                        \
+        const typename E::ExpValueType alpha, const E& e )                                                         \
+    {                                                                                                              \
+        return BinaryNode<ScalarLeaf<typename E::ExpValueType>, E, binaryOp>(                                      \
+                   ScalarLeaf<typename E::ExpValueType>( alpha ), e );                                             \
+    }                                                                                                              \
+                                                                                                                   \
+    template<typename E, typename std::enable_if<IsFused<E>::value, int>::type = 0>                                \
+    inline BinaryNode<E, ScalarLeaf<typename E::ExpValueType>, binaryOp> operator opSymbol(                        \
+        const E& e, const typename E::ExpValueType alpha )                                                         \
+    {                                                                                                              \
+        return BinaryNode<E, ScalarLeaf<typename E::ExpValueType>, binaryOp>(                                      \
+                   e, ScalarLeaf<typename E::ExpValueType>( alpha ) );                                             \
+    }
+
+SCAI_FUSED_BINARY_OPERATOR( +, common::BinaryOp::ADD )
+SCAI_FUSED_BINARY_OPERATOR( -, common::BinaryOp::SUB )
+SCAI_FUSED_BINARY_OPERATOR( *, common::BinaryOp::MULT )
+SCAI_FUSED_BINARY_OPERATOR( /, common::BinaryOp::DIVIDE )
+
+#undef SCAI_FUSED_BINARY_OPERATOR
+
+/** Unary minus */
+
+template<typename E, typename std::enable_if<IsFused<E>::value, int>::type = 0>
+inline UnaryNode<E, common::UnaryOp::MINUS> operator-( const E& e )
+{
+    return UnaryNode<E, common::UnaryOp::MINUS>( e );
+}
+
+/** Apply any unary function element-wise, e.g. apply<common::UnaryOp::RECIPROCAL>( vec( x ) ) */
+
+template<common::UnaryOp op, typename E, typename std::enable_if<IsFused<E>::value, int>::type = 0>
+inline UnaryNode<E, op> apply( const E& e )
+{
+    return UnaryNode<E, op>( e );
+}
+
+#define SCAI_FUSED_UNARY_FUNCTION( name, unaryOp )                                                                 \
+                                                                                                                   \
+    template<typename E, typename std::enable_if<IsFused<E>::value, int>::type = 0>                                \
+    inline UnaryNode<E, unaryOp> name( const E& e )                                                                \
+    {                                                                                                              \
+        return UnaryNode<E, unaryOp>( e );                                                                         \
+    }
+
+SCAI_FUSED_UNARY_FUNCTION( conj, common::UnaryOp::CONJ )
+SCAI_FUSED_UNARY_FUNCTION( abs, common::UnaryOp::ABS )
+SCAI_FUSED_UNARY_FUNCTION( sqrt, common::UnaryOp::SQRT )
+SCAI_FUSED_UNARY_FUNCTION( exp, common::UnaryOp::EXP )
+SCAI_FUSED_UNARY_FUNCTION( log, common::UnaryOp::LOG )
+SCAI_FUSED_UNARY_FUNCTION( sin, common::UnaryOp::SIN )
+SCAI_FUSED_UNARY_FUNCTION( cos, common::UnaryOp::COS )
+
+#undef SCAI_FUSED_UNARY_FUNCTION
+
+/* ------------------------------------------------------------------------- */
+/*   Evaluation                                                              */
+/* ------------------------------------------------------------------------- */
+
+namespace intern
+{
+
+/** Combine the partial reductions of all processors. */
+
+template<typename ValueType>
+inline ValueType reduceAll( const dmemo::Distribution& dist, const ValueType localValue, const common::BinaryOp reduceOp )
+{
+    const dmemo::Communicator& comm = dist.getCommunicator();
+
+    if ( reduceOp == common::BinaryOp::ABS_MAX )
+    {
+        // partial results of ABS_MAX are already absolute values, so real values are reduced
+
+        return comm.max( common::Math::real( localValue ) );
+    }
+
+    ValueType globalValue = localValue;
+
+    comm.reduceImpl( &globalValue, &localValue, 1, common::TypeTraits<ValueType>::stype, reduceOp );
+
+    return globalValue;
+}
+
+/** Reduction result of an element, either the element itself or its squared absolute value */
+
+template<typename ValueType>
+inline ValueType reduceElem( const ValueType v, const bool squared )
+{
+    return squared ? common::Math::conj( v ) * v : v;
+}
+
+/**
+ *  Single loop that evaluates the expression for all local elements, stores the values in target
+ *  (if not NULL) and reduces them.
+ */
+template<typename ValueType, typename E>
+ValueType evaluate(
+    ValueType target[],
+    const E& expr,
+    const IndexType n,
+    const common::BinaryOp reduceOp,
+    const bool squared,
+    const bool hasReduce )
+{
+    const ValueType zero = common::zeroBinary<ValueType>( hasReduce ? reduceOp : common::BinaryOp::ADD );
+
+    ValueType result = zero;
+
+    if ( !hasReduce )
+    {
+        #pragma omp parallel for
+
+        for ( IndexType i = 0; i < n; ++i )
+        {
+            target[i] = expr[i];
+        }
+
+        return result;
+    }
+
+    #pragma omp parallel
+    {
+        ValueType threadResult = zero;
+
+        #pragma omp for
+
+        for ( IndexType i = 0; i < n; ++i )
+        {
+            const ValueType v = expr[i];
+
+            if ( target != NULL )
+            {
+                target[i] = v;
+            }
+
+            threadResult = common::applyBinary( threadResult, reduceOp, reduceElem( v, squared ) );
+        }
+
+        #pragma omp critical
+        {
+            result = common::applyBinary( result, reduceOp, threadResult );
+        }
+    }
+
+    return result;
+}
+
+/** Evaluate the expression into a dense vector and reduce the values */
+
+template<typename ValueType, typename E>
+ValueType assignImpl(
+    DenseVector<ValueType>& target,
+    const E& expr,
+    const common::BinaryOp reduceOp,
+    const bool squared,
+    const bool hasReduce )
+{
+    dmemo::DistributionPtr dist;
+
+    expr.checkDistribution( dist );
+
+    SCAI_ASSERT_ERROR( dist, "fused expression has no vector operand" )
+
+    hmemo::HArray<ValueType>& localValues = target.getLocalValues();
+
+    if ( target.getDistribution() != *dist )
+    {
+        // the target is not an operand here as it has another distribution
+
+        target.allocate( dist );
+    }
+
+    const IndexType n = dist->getLocalSize();
+
+    ValueType localResult;
+
+    {
+        hmemo::WriteAccess<ValueType> wTarget( localValues, hmemo::Context::getHostPtr() );
+        wTarget.resize( n );
+
+        expr.acquire( localValues, wTarget.get() );
+
+        localResult = evaluate( wTarget.get(), expr, n, reduceOp, squared, hasReduce );
+
+        expr.release();
+    }
+
+    if ( !hasReduce )
+    {
+        return localResult;
+    }
+
+    return reduceAll( *dist, localResult, reduceOp );
+}
+
+/** Evaluate the expression into any vector, non-dense targets get the values by a temporary dense vector. */
+
+template<typename ValueType, typename E>
+ValueType assignImpl(
+    Vector<ValueType>& target,
+    const E& expr,
+    const common::BinaryOp reduceOp,
+    const bool squared,
+    const bool hasReduce )
+{
+    if ( target.getVectorKind() == VectorKind::DENSE )
+    {
+        return assignImpl( static_cast<DenseVector<ValueType>&>( target ), expr, reduceOp, squared, hasReduce );
+    }
+
+    DenseVector<ValueType> tmp( target.getContextPtr() );
+
+    ValueType result = assignImpl( tmp, expr, reduceOp, squared, hasReduce );
+
+    target = tmp;
+
+    return result;
+}
+
+}
+
+/** target = expr, evaluated in a single loop */
+
+template<typename ValueType, typename E, typename std::enable_if<IsFused<E>::value, int>::type = 0>
+inline void assign( Vector<ValueType>& target, const E& expr )
+{
+    intern::assignImpl( target, expr, common::BinaryOp::ADD, false, false );
+}
+
+/** target = expr, returns the reduction of all elements of target, evaluated in a single loop */
+
+template<typename ValueType, typename E, typename std::enable_if<IsFused<E>::value, int>::type = 0>
+inline ValueType assignReduce( Vector<ValueType>& target, const E& expr, const common::BinaryOp reduceOp )
+{
+    return intern::assignImpl( target, expr, reduceOp, false, true );
+}
+
+/** target = expr, returns target.dotProduct( target ), evaluated in a single loop */
+
+template<typename ValueType, typename E, typename std::enable_if<IsFused<E>::value, int>::type = 0>
+inline ValueType assignDot( Vector<ValueType>& target, const E& expr )
+{
+    return intern::assignImpl( target, expr, common::BinaryOp::ADD, true, true );
+}
+
+/** Reduction of all elements of the expression without storing it, reduceOp is ADD, MIN, MAX or ABS_MAX */
+
+template<typename E, typename std::enable_if<IsFused<E>::value, int>::type = 0>
+inline typename E::ExpValueType reduce( const E& expr, const common::BinaryOp reduceOp )
+{
+    typedef typename E::ExpValueType ValueType;
+
+    dmemo::DistributionPtr dist;
+
+    expr.checkDistribution( dist );
+
+    SCAI_ASSERT_ERROR( dist, "fused expression has no vector operand" )
+
+    hmemo::HArray<ValueType> noTarget;
+
+    expr.acquire( noTarget, NULL );
+
+    ValueType localResult = intern::evaluate<ValueType>( NULL, expr, dist->getLocalSize(), reduceOp, false, true );
+
+    expr.release();
+
+    return intern::reduceAll( *dist, localResult, reduceOp );
+}
+
+/** Dot product of two expressions, sum( conj( e1 ) * e2 ), without storing any of them */
+
+template<typename E1, typename E2, typename std::enable_if<IsFused<E1>::value && IsFused<E2>::value, int>::type = 0>
+inline typename E1::ExpValueType dot( const E1& e1, const E2& e2 )
+{
+    return reduce( conj( e1 ) * e2, common::BinaryOp::ADD );
+}
+
+} /* end namespace fused */
+
+} /* end namespace lama */
+
+} /* end namespace scai */
@@ -32,10 +32,19 @@
 #include <scai/lama/matrix/DenseMatrix.hpp>
 #include <scai/dmemo/NoDistribution.hpp>
 #include <scai/dmemo/BlockDistribution.hpp>
+#include <scai/dmemo/GridDistribution.hpp>
 #include <scai/utilskernel/FFTUtils.hpp>
+#include <scai/utilskernel/HArrayUtils.hpp>
+#include <scai/hmemo/HostWriteAccess.hpp>
+#include <scai/hmemo/HostReadAccess.hpp>
+#include <scai/hmemo/HostWriteOnlyAccess.hpp>
 
 #include <scai/tracing.hpp>
 
+#include <vector>
+#include <memory>
+#include <cmath>
+
 namespace scai
 {
 
@@ -44,19 +53,200 @@ namespace lama
 
 #ifdef SCAI_COMPLEX_SUPPORTED
 
+template<typename ComplexType>
+void fft1D( DenseVector<ComplexType>& denseVector, const int direction );
+
+/**
+ *  @brief Redistribute a vector with a grid distribution so that one dimension is no more distributed
+ *
+ *  The processors of this dimension are moved to the dimension with most elements per processor.
+ *  It is a global transpose of the data that requires an all-to-all communication.
+ */
+template<typename ComplexType>
+void localizeGridDim( DenseVector<ComplexType>& x, const IndexType dim )
+{
+    const dmemo::GridDistribution* gridDist = dynamic_cast<const dmemo::GridDistribution*>( x.getDistributionPtr().get() );
+
+    SCAI_ASSERT_ERROR( gridDist, "vector has no grid distribution: " << x.getDistribution() )
+
+    const common::Grid& grid = gridDist->getGlobalGrid();
+    const common::Grid& procGrid = gridDist->getProcGrid();
+
+    SCAI_ASSERT_VALID_INDEX_ERROR( dim, grid.nDims(), "illegal dim for grid " << grid )
+
+    if ( procGrid.size( dim ) == 1 )
+    {
+        return;   // dimension is already local
+    }
+
+    SCAI_ASSERT_GT_ERROR( grid.nDims(), 1, "dimension of a one-dimensional grid cannot be localized" )
+
+    IndexType newDim = invalidIndex;
+
+    double maxLocalSize = -1;
+
+    for ( IndexType d = 0; d < grid.nDims(); ++d )
+    {
+        if ( d == dim )
+        {
+            continue;
+        }
+
+        double localSize = double( grid.size( d ) ) / double( procGrid.size( d ) * procGrid.size( dim ) );
+
+        if ( localSize > maxLocalSize )
+        {
+            maxLocalSize = localSize;
+            newDim = d;
+        }
+    }
+
+    common::Grid newProcGrid( procGrid );
+
+    newProcGrid.setSize( newDim, procGrid.size( newDim ) * procGrid.size( dim ) );
+    newProcGrid.setSize( dim, 1 );
+
+    SCAI_REGION( "Vector.transposeGrid" )
+
+    x.redistribute( std::make_shared<dmemo::GridDistribution>( grid, gridDist->getCommunicatorPtr(), newProcGrid ) );
+}
+
+/**
+ *  @brief Apply FFT along one dimension of a vector with a grid distribution, e.g. a GridVector
+ *
+ *  @param[in,out] x is the vector, must have a grid distribution
+ *  @param[in] dim is the dimension along which the FFT is applied
+ *  @param[in] direction is either 1 (forward) or -1 (backward)
+ *  @param[in] keepTransposed if true the vector keeps the distribution where dim is not distributed
+ *
+ *  If the dimension is distributed, the data is transposed before so that the FFT can be
+ *  applied locally.
+ */
+template<typename ComplexType>
+void fftDim( DenseVector<ComplexType>& x, const IndexType dim, const int direction, const bool keepTransposed = false )
+{
+    const dmemo::GridDistribution* gridDist = dynamic_cast<const dmemo::GridDistribution*>( x.getDistributionPtr().get() );
+
+    SCAI_ASSERT_ERROR( gridDist, "vector has no grid distribution: " << x.getDistribution() )
+
+    if ( gridDist->getGlobalGrid().nDims() == 1 )
+    {
+        fft1D( x, direction );
+        return;
+    }
+
+    dmemo::DistributionPtr saveDist = x.getDistributionPtr();
+
+    localizeGridDim( x, dim );
+
+    gridDist = dynamic_cast<const dmemo::GridDistribution*>( x.getDistributionPtr().get() );
+
+    {
+        SCAI_REGION( "Vector.fftDim" )
+
+        utilskernel::FFTUtils::fftGrid<RealType<ComplexType>>( x.getLocalValues(), gridDist->getLocalGrid(), dim, direction, x.getContextPtr() );
+    }
+
+    if ( !keepTransposed && x.getDistributionPtr() != saveDist )
+    {
+        x.redistribute( saveDist );
+    }
+}
+
+/**
+ *  @brief Apply FFT in all dimensions of a vector with a grid distribution, e.g. a GridVector
+ *
+ *  @param[in,out] x is the vector, must have a grid distribution
+ *  @param[in] direction is either 1 (forward) or -1 (backward)
+ *  @param[in] keepTransposed if true the vector keeps the distribution of the last transpose
+ *
+ *  The FFT is applied in the dimensions that are not distributed first. For the other ones
+ *  the data is transposed (slab or pencil decomposition). With keepTransposed the final
+ *  transpose back to the original distribution is skipped. This is useful if the data
+ *  is transformed back later, as the inverse FFT works with any grid distribution.
+ */
+template<typename ComplexType>
+void fftGrid( DenseVector<ComplexType>& x, const int direction, const bool keepTransposed = false )
+{
+    const dmemo::GridDistribution* gridDist = dynamic_cast<const dmemo::GridDistribution*>( x.getDistributionPtr().get() );
+
+    SCAI_ASSERT_ERROR( gridDist, "vector has no grid distribution: " << x.getDistribution() )
+
+    const common::Grid& procGrid = gridDist->getProcGrid();
+
+    const IndexType nDims = procGrid.nDims();
+
+    if ( nDims == 1 )
+    {
+        fft1D( x, direction );
+        return;
+    }
+
+    // dimensions that are not distributed first
+
+    std::vector<IndexType> dims;
+
+    for ( IndexType d = nDims; d-- > 0; )
+    {
+        if ( procGrid.size( d ) == 1 )
+        {
+            dims.push_back( d );
+        }
+    }
+
+    for ( IndexType d = nDims; d-- > 0; )
+    {
+        if ( procGrid.size( d ) > 1 )
+        {
+            dims.push_back( d );
+        }
+    }
+
+    dmemo::DistributionPtr saveDist = x.getDistributionPtr();
+
+    for ( size_t i = 0; i < dims.size(); ++i )
+    {
+        fftDim( x, dims[i], direction, true );
+    }
+
+    if ( !keepTransposed && x.getDistributionPtr() != saveDist )
+    {
+        x.redistribute( saveDist );
+    }
+}
+
 /** 
  *  @brief Apply FFT to a one-dimensional vector
  *
  *  - FFT can only be applied to complex vectors
- *  - The size must be a power of 2
+ *  - The size can be any number, power of 2 or products of small primes are most efficient
  *  - use resize function to fill up or truncate matrices
+ *
+ *  A distributed vector of size n = n1 * n2 is considered as a n1 x n2 matrix (four step algorithm):
+ *  FFTs on the columns, multiplication with twiddle factors, FFTs on the rows and a final transpose.
+ *  The distribution of the vector remains unchanged.
  */
 template<typename ComplexType>
 void fft1D( DenseVector<ComplexType>& denseVector, const int direction )
 {
-    if (  !denseVector.getDistribution().isReplicated() )
+    const dmemo::Distribution& dist = denseVector.getDistribution();
+
+    const IndexType n = dist.getGlobalSize();
+
+    const PartitionId np = dist.getNumPartitions();
+
+    // factorization n = n1 * n2, n1 <= n2, for the four step algorithm
+
+    IndexType n1 = static_cast<IndexType>( std::sqrt( double( n ) ) );
+
+    while ( n1 > 1 && n % n1 != 0 )
     {
-        // FFT not available yet for distributed vectors, so replicate it
+        n1--;
+    }
+
+    if ( !dist.isReplicated() && n1 < np )
+    {
+        // vector cannot be split in enough parts, so replicate it
 
         auto repDist = std::make_shared<dmemo::NoDistribution>( denseVector.size() );
         auto saveDist = denseVector.getDistributionPtr();
@@ -66,6 +256,73 @@ void fft1D( DenseVector<ComplexType>& denseVector, const int direction )
         return;
     }
 
+    if ( !dist.isReplicated() )
+    {
+        SCAI_REGION( "Vector.fft1D" )
+
+        const IndexType n2 = n / n1;
+
+        dmemo::CommunicatorPtr comm = dist.getCommunicatorPtr();
+
+        auto saveDist = denseVector.getDistributionPtr();
+
+        common::Grid2D grid( n1, n2 );
+
+        // distributed columns, FFT along the columns is local
+
+        denseVector.redistribute( std::make_shared<dmemo::GridDistribution>( grid, comm, common::Grid2D( 1, np ) ) );
+
+        fftDim( denseVector, 0, direction, true );
+
+        // multiply element ( k1, j2 ) with twiddle factor exp( -2 pi i direction * k1 * j2 / n )
+
+        {
+            const dmemo::GridDistribution& gridDist = dynamic_cast<const dmemo::GridDistribution&>( denseVector.getDistribution() );
+
+            const IndexType lb = gridDist.localLB()[1];
+            const IndexType nLocal = gridDist.getLocalGrid().size( 1 );
+
+            auto wX = hmemo::hostWriteAccess( denseVector.getLocalValues() );
+
+            const double PI_2 = 6.283185307179586476925286766559;
+
+            #pragma omp parallel for
+            for ( IndexType k1 = 0; k1 < n1; ++k1 )
+            {
+                for ( IndexType j = 0; j < nLocal; ++j )
+                {
+                    const long long e = ( static_cast<long long>( k1 ) * ( lb + j ) ) % n;
+                    const double angle = PI_2 * double( e ) / double( n );
+                    const ComplexType w( static_cast<RealType<ComplexType>>( std::cos( angle ) ),
+                                         static_cast<RealType<ComplexType>>( -direction * std::sin( angle ) ) );
+                    wX[k1 * nLocal + j] *= w;
+                }
+            }
+        }
+
+        // FFT along the rows, transposes the data
+
+        fftDim( denseVector, 1, direction, true );
+
+        // result ( k1, k2 ) is X[ k1 + n1 * k2 ], so transpose to a distributed n2 x n1 grid
+
+        denseVector.redistribute( std::make_shared<dmemo::GridDistribution>( grid, comm, common::Grid2D( 1, np ) ) );
+
+        const dmemo::GridDistribution& gridDist = dynamic_cast<const dmemo::GridDistribution&>( denseVector.getDistribution() );
+
+        const IndexType nLocal = gridDist.getLocalGrid().size( 1 );
+
+        hmemo::HArray<ComplexType> localX;
+
+        utilskernel::HArrayUtils::transpose( localX, nLocal, n1, denseVector.getLocalValues(), false, denseVector.getContextPtr() );
+
+        denseVector.swap( localX, std::make_shared<dmemo::GridDistribution>( common::Grid2D( n2, n1 ), comm, common::Grid2D( np, 1 ) ) );
+
+        denseVector.redistribute( saveDist );
+
+        return;
+    }
+
     hmemo::ContextPtr ctx = denseVector.getContextPtr();   // preferred location for FFT
     
     hmemo::HArray<ComplexType>& localData = denseVector.getLocalValues();
@@ -73,9 +330,6 @@ void fft1D( DenseVector<ComplexType>& denseVector, const int direction )
     const IndexType size = localData.size();
 
     IndexType m = common::Math::nextpow2( size );
-    IndexType n2 = 1 << m;
-
-    SCAI_ASSERT_EQ_ERROR( n2, size, "FFT vector size must be power of 2" )
 
     const IndexType many = 1;   // one single vector only
 
@@ -85,7 +339,7 @@ void fft1D( DenseVector<ComplexType>& denseVector, const int direction )
 /** 
  *  @brief Apply forward FFT to a one-dimensional vector
  *
- *  @param[in,out] denseVector vector to which (forward) FFT is applied to, size must be a power of 2
+ *  @param[in,out] denseVector vector to which (forward) FFT is applied to
  *
  */
 template<typename ComplexType>
@@ -97,7 +351,7 @@ void fft( DenseVector<ComplexType>& denseVector )
 /** 
  *  @brief Apply inverse FFT to a one-dimensional vector
  *
- *  @param[in,out] denseVector vector to which (backward) FFT is applied to, size must be a power of 2
+ *  @param[in,out] denseVector vector to which (backward) FFT is applied to
  *
  */
 template<typename ComplexType>
@@ -106,11 +360,435 @@ void ifft( DenseVector<ComplexType>& denseVector )
     fft1D( denseVector, -1 );
 }
 
+/**
+ *  @brief Build a distributed index vector with index[i] = f( i ), used for the global permutations
+ */
+template<typename Function>
+DenseVector<IndexType> fftIndexes( dmemo::DistributionPtr dist, Function f )
+{
+    hmemo::HArray<IndexType> indexes;
+
+    dist->getOwnedIndexes( indexes );
+
+    {
+        auto wIndexes = hmemo::hostWriteAccess( indexes );
+
+        for ( IndexType i = 0; i < indexes.size(); ++i )
+        {
+            wIndexes[i] = f( wIndexes[i] );
+        }
+    }
+
+    DenseVector<IndexType> index;
+    index.swap( indexes, dist );
+    return index;
+}
+
+/**
+ *  @brief Twiddle factor exp( -2 pi i k / n ) used for splitting/joining the FFT of real vectors
+ */
+template<typename ValueType>
+common::Complex<ValueType> fftRoot( const IndexType k, const IndexType n )
+{
+    const long double PI_2 = 6.283185307179586476925286766559005768L;
+
+    const long double angle = PI_2 * static_cast<long double>( k ) / static_cast<long double>( n );
+
+    return common::Complex<ValueType>( static_cast<ValueType>( std::cos( angle ) ), static_cast<ValueType>( -std::sin( angle ) ) );
+}
+
+/** 
+ *  @brief Apply forward FFT to a real vector
+ *
+ *  @param[out] result is the transformed vector, size is n / 2 + 1
+ *  @param[in]  x is the real vector of size n
+ *
+ *  As the FFT of a real vector is Hermitian, i.e. X[n-k] = conj( X[k] ), only the first n / 2 + 1
+ *  values are computed (Hermitian-packed). This saves half of the memory and of the work
+ *  compared to the FFT of the corresponding complex vector.
+ *
+ *  The result is replicated if x is replicated, otherwise it is block distributed. For
+ *  a distributed vector of even size the real values are packed into a complex vector of half 
+ *  the size to which the distributed FFT is applied.
+ */
+template<typename ValueType>
+void fft( DenseVector<common::Complex<ValueType>>& result, const DenseVector<ValueType>& x )
+{
+    typedef common::Complex<ValueType> ComplexType;
+
+    const IndexType n  = x.size();
+    const IndexType nc = n / 2 + 1;
+
+    const dmemo::Distribution& dist = x.getDistribution();
+
+    if ( dist.isReplicated() )
+    {
+        SCAI_REGION( "Vector.fft_r2c" )
+
+        hmemo::HArray<ComplexType> resultValues;
+
+        utilskernel::FFTUtils::fft_r2c( resultValues, x.getLocalValues(), 1, n, x.getContextPtr() );
+
+        result.swap( resultValues, std::make_shared<dmemo::NoDistribution>( nc ) );
+
+        return;
+    }
+
+    SCAI_REGION( "Vector.fft_r2cDist" )
+
+    dmemo::CommunicatorPtr comm = dist.getCommunicatorPtr();
+
+    auto ncDist = dmemo::blockDistribution( nc, comm );
+
+    if ( n % 2 == 1 )
+    {
+        // odd size: complex FFT of the whole vector, only first half is kept
+
+        DenseVector<ComplexType> z;
+        z.assign( x );
+        fft( z );
+        result.gatherInto( z, fftIndexes( ncDist, []( IndexType k ) { return k; } ) );
+        return;
+    }
+
+    const IndexType h = n / 2;
+
+    // z[j] = x[2j] + i * x[2j+1], distributed FFT of half size
+
+    auto hDist = dmemo::blockDistribution( h, comm );
+
+    DenseVector<ValueType> xEven;
+    DenseVector<ValueType> xOdd;
+
+    xEven.gatherInto( x, fftIndexes( hDist, []( IndexType j ) { return 2 * j; } ) );
+    xOdd.gatherInto( x, fftIndexes( hDist, []( IndexType j ) { return 2 * j + 1; } ) );
+
+    DenseVector<ComplexType> z( hDist, ComplexType( 0 ), x.getContextPtr() );
+
+    {
+        auto rEven = hmemo::hostReadAccess( xEven.getLocalValues() );
+        auto rOdd  = hmemo::hostReadAccess( xOdd.getLocalValues() );
+        auto wZ    = hmemo::hostWriteAccess( z.getLocalValues() );
+
+        for ( IndexType j = 0; j < wZ.size(); ++j )
+        {
+            wZ[j] = ComplexType( rEven[j], rOdd[j] );
+        }
+    }
+
+    xEven.clear();
+    xOdd.clear();
+
+    fft( z );
+
+    // X[k] = E[k] + w^k * O[k], E[k] = ( z[k] + conj( z[h-k] ) ) / 2, O[k] = ( z[k] - conj( z[h-k] ) ) / 2i 
+
+    DenseVector<ComplexType> zk;
+    DenseVector<ComplexType> zm;
+
+    zk.gatherInto( z, fftIndexes( ncDist, [h]( IndexType k ) { return k % h; } ) );
+    zm.gatherInto( z, fftIndexes( ncDist, [h]( IndexType k ) { return ( h - k % h ) % h; } ) );
+
+    hmemo::HArray<ComplexType> resultValues;
+
+    {
+        auto rZk = hmemo::hostReadAccess( zk.getLocalValues() );
+        auto rZm = hmemo::hostReadAccess( zm.getLocalValues() );
+        auto wResult = hmemo::hostWriteOnlyAccess( resultValues, ncDist->getLocalSize() );
+
+        const IndexType lb = ncDist->lb();
+
+        const ComplexType half( ValueType( 0.5 ), 0 );
+        const ComplexType minusHalfI( 0, ValueType( -0.5 ) );
+
+        for ( IndexType i = 0; i < wResult.size(); ++i )
+        {
+            const ComplexType a = rZk[i];
+            const ComplexType b = common::Math::conj( rZm[i] );
+            wResult[i] = half * ( a + b ) + fftRoot<ValueType>( lb + i, n ) * minusHalfI * ( a - b );
+        }
+    }
+
+    result.swap( resultValues, ncDist );
+}
+
+/** 
+ *  @brief Apply backward FFT to a Hermitian-packed vector with a real result, inverse of fft( result, x )
+ *
+ *  @param[out] result is the real result vector, size is n
+ *  @param[in]  x is the Hermitian-packed vector, size must be n / 2 + 1
+ *  @param[in]  n is the size of the result, must be given as n / 2 + 1 is the same for even n and n + 1
+ *
+ *  Like ifft the result is not normalized, i.e. it is scaled by n. The result is replicated if x is 
+ *  replicated, otherwise it is block distributed.
+ */
+template<typename ValueType>
+void ifft( DenseVector<ValueType>& result, const DenseVector<common::Complex<ValueType>>& x, const IndexType n )
+{
+    typedef common::Complex<ValueType> ComplexType;
+
+    const IndexType nc = n / 2 + 1;
+
+    SCAI_ASSERT_EQ_ERROR( x.size(), nc, "size of packed vector does not match size n = " << n << " of real vector" )
+
+    const dmemo::Distribution& dist = x.getDistribution();
+
+    if ( dist.isReplicated() )
+    {
+        SCAI_REGION( "Vector.fft_c2r" )
+
+        hmemo::HArray<ValueType> resultValues;
+
+        utilskernel::FFTUtils::fft_c2r( resultValues, x.getLocalValues(), 1, n, x.getContextPtr() );
+
+        result.swap( resultValues, std::make_shared<dmemo::NoDistribution>( n ) );
+
+        return;
+    }
+
+    SCAI_REGION( "Vector.fft_c2rDist" )
+
+    dmemo::CommunicatorPtr comm = dist.getCommunicatorPtr();
+
+    auto nDist = dmemo::blockDistribution( n, comm );
+
+    if ( n % 2 == 1 )
+    {
+        // odd size: complete the Hermitian vector and apply complex FFT
+
+        DenseVector<ComplexType> z;
+
+        z.gatherInto( x, fftIndexes( nDist, [n, nc]( IndexType k ) { return k < nc ? k : n - k; } ) );
+
+        {
+            auto wZ = hmemo::hostWriteAccess( z.getLocalValues() );
+
+            for ( IndexType i = 0; i < wZ.size(); ++i )
+            {
+                if ( nDist->local2Global( i ) >= nc )
+                {
+                    wZ[i] = common::Math::conj( wZ[i] );
+                }
+            }
+        }
+
+        ifft( z );
+
+        hmemo::HArray<ValueType> resultValues;
+
+        {
+            auto rZ = hmemo::hostReadAccess( z.getLocalValues() );
+            auto wResult = hmemo::hostWriteOnlyAccess( resultValues, rZ.size() );
+
+            for ( IndexType i = 0; i < rZ.size(); ++i )
+            {
+                wResult[i] = rZ[i].real();
+            }
+        }
+
+        result.swap( resultValues, nDist );
+        return;
+    }
+
+    const IndexType h = n / 2;
+
+    auto hDist = dmemo::blockDistribution( h, comm );
+
+    // z[k] = ( x[k] + conj( x[h-k] ) ) + i * w^-k ( x[k] - conj( x[h-k] ) ), then z = ifft( z )
+
+    DenseVector<ComplexType> z;
+    DenseVector<ComplexType> xm;
+
+    z.gatherInto( x, fftIndexes( hDist, []( IndexType k ) { return k; } ) );
+    xm.gatherInto( x, fftIndexes( hDist, [h]( IndexType k ) { return h - k; } ) );
+
+    {
+        auto rXm = hmemo::hostReadAccess( xm.getLocalValues() );
+        auto wZ = hmemo::hostWriteAccess( z.getLocalValues() );
+
+        const IndexType lb = hDist->lb();
+
+        const ComplexType imagUnit( 0, 1 );
+
+        for ( IndexType i = 0; i < wZ.size(); ++i )
+        {
+            const ComplexType a = wZ[i];
+            const ComplexType b = common::Math::conj( rXm[i] );
+            wZ[i] = ( a + b ) + imagUnit * ( a - b ) * common::Math::conj( fftRoot<ValueType>( lb + i, n ) );
+        }
+    }
+
+    xm.clear();
+
+    ifft( z );
+
+    // result[2j] = real( z[j] ), result[2j+1] = imag( z[j] )
+
+    DenseVector<ComplexType> zz;
+
+    zz.gatherInto( z, fftIndexes( nDist, []( IndexType j ) { return j / 2; } ) );
+
+    hmemo::HArray<ValueType> resultValues;
+
+    {
+        auto rZ = hmemo::hostReadAccess( zz.getLocalValues() );
+        auto wResult = hmemo::hostWriteOnlyAccess( resultValues, rZ.size() );
+
+        const IndexType lb = nDist->lb();
+
+        for ( IndexType i = 0; i < rZ.size(); ++i )
+        {
+            wResult[i] = ( lb + i ) % 2 == 0 ? rZ[i].real() : rZ[i].imag();
+        }
+    }
+
+    result.swap( resultValues, nDist );
+}
+
+/**
+ *  @brief Apply the forward FFT along one dimension of a real vector with a grid distribution, e.g. a GridVector
+ *
+ *  @param[out] result is the Hermitian-packed transform, its grid has size n / 2 + 1 in dimension dim
+ *  @param[in] x is the real vector with grid distribution
+ *  @param[in] dim is the dimension along which the FFT is applied, n = x.size( dim )
+ *
+ *  This is a batched FFT of all real vectors along the dimension dim. 
+ *  The result has a grid distribution with the same processor grid as x.
+ */
+template<typename ValueType>
+void fftDim( DenseVector<common::Complex<ValueType>>& result, const DenseVector<ValueType>& x, const IndexType dim )
+{
+    const dmemo::GridDistribution* gridDist = dynamic_cast<const dmemo::GridDistribution*>( x.getDistributionPtr().get() );
+
+    SCAI_ASSERT_ERROR( gridDist, "vector has no grid distribution: " << x.getDistribution() )
+
+    const common::Grid& grid = gridDist->getGlobalGrid();
+    const common::Grid& procGrid = gridDist->getProcGrid();
+
+    SCAI_ASSERT_VALID_INDEX_ERROR( dim, grid.nDims(), "illegal dim for grid " << grid )
+
+    dmemo::CommunicatorPtr comm = gridDist->getCommunicatorPtr();
+
+    common::Grid resultGrid( grid );
+    resultGrid.setSize( dim, grid.size( dim ) / 2 + 1 );
+
+    auto resultDist = std::make_shared<dmemo::GridDistribution>( resultGrid, comm, procGrid );
+
+    if ( procGrid.size( dim ) > 1 && grid.nDims() == 1 )
+    {
+        fft( result, x );
+        result.redistribute( resultDist );
+        return;
+    }
+
+    // x is transposed if the dimension is distributed
+
+    std::unique_ptr<DenseVector<ValueType>> xT;
+
+    const DenseVector<ValueType>* localX = &x;
+
+    if ( procGrid.size( dim ) > 1 )
+    {
+        xT.reset( new DenseVector<ValueType>( x ) );
+        localizeGridDim( *xT, dim );
+        localX = xT.get();
+    }
+
+    const dmemo::GridDistribution& localDist = dynamic_cast<const dmemo::GridDistribution&>( localX->getDistribution() );
+
+    hmemo::HArray<common::Complex<ValueType>> resultValues;
+
+    {
+        SCAI_REGION( "Vector.fftDim_r2c" )
+
+        utilskernel::FFTUtils::fftGrid_r2c( resultValues, localX->getLocalValues(), localDist.getLocalGrid(), dim, x.getContextPtr() );
+    }
+
+    xT.reset();
+
+    result.swap( resultValues, std::make_shared<dmemo::GridDistribution>( resultGrid, comm, localDist.getProcGrid() ) );
+
+    if ( procGrid.size( dim ) > 1 )
+    {
+        result.redistribute( resultDist );
+    }
+}
+
+/**
+ *  @brief Apply the backward FFT along one dimension of a Hermitian-packed vector with a grid distribution
+ *
+ *  @param[out] result is the real result, its grid has size n in dimension dim
+ *  @param[in] x is the Hermitian-packed vector with grid distribution, must have size n / 2 + 1 in dimension dim
+ *  @param[in] dim is the dimension along which the FFT is applied
+ *  @param[in] n is the size of the real vectors along dim
+ *
+ *  This is the inverse of fftDim( result, x, dim ), the result is not normalized.
+ */
+template<typename ValueType>
+void ifftDim( DenseVector<ValueType>& result, const DenseVector<common::Complex<ValueType>>& x, const IndexType dim, const IndexType n )
+{
+    const dmemo::GridDistribution* gridDist = dynamic_cast<const dmemo::GridDistribution*>( x.getDistributionPtr().get() );
+
+    SCAI_ASSERT_ERROR( gridDist, "vector has no grid distribution: " << x.getDistribution() )
+
+    const common::Grid& grid = gridDist->getGlobalGrid();
+    const common::Grid& procGrid = gridDist->getProcGrid();
+
+    SCAI_ASSERT_VALID_INDEX_ERROR( dim, grid.nDims(), "illegal dim for grid " << grid )
+    SCAI_ASSERT_EQ_ERROR( grid.size( dim ), n / 2 + 1, "packed grid does not match size n = " << n << " of real vectors" )
+
+    dmemo::CommunicatorPtr comm = gridDist->getCommunicatorPtr();
+
+    common::Grid resultGrid( grid );
+    resultGrid.setSize( dim, n );
+
+    auto resultDist = std::make_shared<dmemo::GridDistribution>( resultGrid, comm, procGrid );
+
+    if ( procGrid.size( dim ) > 1 && grid.nDims() == 1 )
+    {
+        ifft( result, x, n );
+        result.redistribute( resultDist );
+        return;
+    }
+
+    std::unique_ptr<DenseVector<common::Complex<ValueType>>> xT;
+
+    const DenseVector<common::Complex<ValueType>>* localX = &x;
+
+    if ( procGrid.size( dim ) > 1 )
+    {
+        xT.reset( new DenseVector<common::Complex<ValueType>>( x ) );
+        localizeGridDim( *xT, dim );
+        localX = xT.get();
+    }
+
+    const dmemo::GridDistribution& localDist = dynamic_cast<const dmemo::GridDistribution&>( localX->getDistribution() );
+
+    common::Grid localResultGrid( localDist.getLocalGrid() );
+    localResultGrid.setSize( dim, n );
+
+    hmemo::HArray<ValueType> resultValues;
+
+    {
+        SCAI_REGION( "Vector.fftDim_c2r" )
+
+        utilskernel::FFTUtils::fftGrid_c2r( resultValues, localX->getLocalValues(), localResultGrid, dim, x.getContextPtr() );
+    }
+
+    xT.reset();
+
+    result.swap( resultValues, std::make_shared<dmemo::GridDistribution>( resultGrid, comm, localDist.getProcGrid() ) );
+
+    if ( procGrid.size( dim ) > 1 )
+    {
+        result.redistribute( resultDist );
+    }
+}
+
 /** 
  *  @brief Apply FFT to each row for a 2D dense matrix
  *
  *  - FFT can only be applied to complex matrices
- *  - The column size must be a power of 2
  *  - use resize function to fill up or truncate matrices
  */
 template<typename ComplexType>
@@ -121,9 +799,6 @@ void fftRows(
     IndexType numColumns = data.getNumColumns();  // size of each vector to which FFT is applied
 
     IndexType m = common::Math::nextpow2( numColumns );
-    IndexType n2 = 1 << m;
-
-    SCAI_ASSERT_EQ_ERROR( n2, numColumns, "not power of 2" )
 
     if ( !data.getColDistribution().isReplicated() )
     {
@@ -149,41 +824,67 @@ void fftRows(
     }
 }
 
+/** 
+ *  @brief Apply FFT to each column for a 2D dense matrix
+ *
+ *  The local rows of a block distributed matrix are considered as a distributed 2D grid
+ *  and the FFT is applied along the first dimension after a global transpose. Other
+ *  distributions are redistributed to block distributed rows before.
+ */
 template<typename ComplexType>
 void fftCols(
     DenseMatrix<ComplexType>& data,
     int direction )
 {
-    // transpose the matrix, apply FFT row-wise and transpose back
+    const dmemo::Distribution& rowDist = data.getRowDistribution();
 
-    if ( !data.getRowDistribution().isReplicated() && data.getColDistribution().isReplicated() )
+    if ( rowDist.isReplicated() && data.getColDistribution().isReplicated() )
     {
-        // distributed rows, columns must also be distributed for transpose
+        SCAI_REGION( "Matrix.fftCols" )
 
-        dmemo::DistributionPtr saveColDistributionPtr = data.getColDistributionPtr();
-        dmemo::DistributionPtr blockDist = std::make_shared<dmemo::BlockDistribution>( data.getNumColumns() );
-        data.redistribute( data.getRowDistributionPtr(), blockDist );
-        fftCols( data, direction );
-        data.redistribute( data.getRowDistributionPtr(), saveColDistributionPtr );
+        // FFT along the first dimension of the local data, no transpose required
+
+        common::Grid2D grid( data.getNumRows(), data.getNumColumns() );
+
+        hmemo::HArray<ComplexType>& localData = data.getLocalStorage().getData();
+
+        utilskernel::FFTUtils::fftGrid<RealType<ComplexType>>( localData, grid, 0, direction, data.getContextPtr() );
     }
-    else if ( data.getRowDistribution().isReplicated() && !data.getColDistribution().isReplicated() )
+    else if ( data.getColDistribution().isReplicated() && dynamic_cast<const dmemo::BlockDistribution*>( &rowDist ) )
     {
-        // replicated rows, columns must also be replicated
+        SCAI_REGION( "Matrix.fftColsDist" )
 
-        dmemo::DistributionPtr saveRowDistributionPtr = data.getRowDistributionPtr();
-        dmemo::DistributionPtr blockDist = std::make_shared<dmemo::BlockDistribution>( data.getNumRows() );
-        data.redistribute( blockDist, data.getColDistributionPtr() );
-        fftCols( data, direction );
-        data.redistribute( saveRowDistributionPtr, data.getColDistributionPtr() );
+        // local data of block distributed rows is the local part of a distributed grid
+
+        const PartitionId np = rowDist.getNumPartitions();
+
+        common::Grid2D grid( data.getNumRows(), data.getNumColumns() );
+
+        auto gridDist = std::make_shared<dmemo::GridDistribution>( grid, rowDist.getCommunicatorPtr(), common::Grid2D( np, 1 ) );
+
+        SCAI_ASSERT_EQ_DEBUG( gridDist->getLocalSize(), rowDist.getLocalSize() * data.getNumColumns(), "serious mismatch" )
+
+        hmemo::HArray<ComplexType>& localData = data.getLocalStorage().getData();
+
+        DenseVector<ComplexType> gridData( data.getContextPtr() );
+
+        gridData.swap( localData, gridDist );
+
+        fftDim( gridData, 0, direction );
+
+        localData.swap( gridData.getLocalValues() );
     }
     else
-    {   // now transpose works fine, we do it in place
-
-        SCAI_REGION( "Matrix.fftCols" )
+    {
+        // block distributed rows, replicated columns
 
-        data.assignTranspose( data );
-        fftRows( data, direction );
-        data.assignTranspose( data );
+        dmemo::DistributionPtr saveRowDistributionPtr = data.getRowDistributionPtr();
+        dmemo::DistributionPtr saveColDistributionPtr = data.getColDistributionPtr();
+        dmemo::DistributionPtr blockDist = std::make_shared<dmemo::BlockDistribution>( data.getNumRows(), rowDist.getCommunicatorPtr() );
+        dmemo::DistributionPtr repColumns = std::make_shared<dmemo::NoDistribution>( data.getNumColumns() );
+        data.redistribute( blockDist, repColumns );
+        fftCols( data, direction );
+        data.redistribute( saveRowDistributionPtr, saveColDistributionPtr );
     }
 }
 
@@ -192,7 +893,6 @@ void fftCols(
  *
  *  - For dim = 0 the FFT is applied to each column
  *  - For dim = 1 the FFT is applied to each row 
- *  - The matrix size in the dimension to which the FFT is applied must be a power of 2
  *  - FFT can only be applied to complex matrices
  *  - use resize function to fill up or truncate matrices
  */
@@ -240,7 +940,7 @@ void ifft(
 /**
  * Apply Fast Fourier Transform in both dimensions of a matrix.
  *
- * @param[in,out] data is a two-dimensional dense matrix, must be complex and its sizes a power of 2
+ * @param[in,out] data is a two-dimensional dense matrix, must be complex
  */
 template<typename ComplexType>
 void fft(
@@ -253,7 +953,7 @@ void fft(
 /**
  * Apply inverse Fast Fourier Transform in both dimensions of a matrix.
  *
- * @param[in,out] data is a two-dimensional dense matrix, must be complex and its sizes a power of 2
+ * @param[in,out] data is a two-dimensional dense matrix, must be complex
  */
 template<typename ComplexType>
 void ifft(
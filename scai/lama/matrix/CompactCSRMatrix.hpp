@@ -0,0 +1,252 @@
+/**
+ * @file CompactCSRMatrix.hpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Operator matrix class for a distributed CSR matrix whose local parts use LocalIndexType
+ * @author Thomas Brandes
+ * @date 19.10.2026
+ */
+
+#pragma once
+
+#include <scai/lama/matrix/OperatorMatrix.hpp>
+#include <scai/lama/matrix/SparseMatrix.hpp>
+#include <scai/lama/storage/CSRStorage.hpp>
+
+#include <scai/sparsekernel/CSRUtils.hpp>
+
+#include <limits>
+
+namespace scai
+{
+
+namespace lama
+{
+
+/** Operator matrix class for a distributed sparse matrix where the local and the halo part
+ *  are stored in CSR format with offset and column index arrays of type LocalIndexType.
+ *
+ *  The distributions and the halo exchange plan still use the global IndexType. If IndexType is
+ *  a 64-bit type for matrices with more than 2^31 rows, the local index arrays can use 32-bit
+ *  integers as long as the local part on each processor is small enough. This halves the memory
+ *  of the index arrays and the index bandwidth of the matrix-vector multiplication.
+ *
+ *  \code
+ *      CSRSparseMatrix<double> A( ... );   // distributed matrix
+ *      CompactCSRMatrix<double> compactA( A );
+ *      A.clear();                          // the original matrix is no more needed
+ *      DenseVector<double> y = compactA * x;
+ *  \endcode
+ *
+ *  The constructor throws an exception if an index of the local or halo part cannot be represented
+ *  by LocalIndexType.
+ */
+template<typename ValueType>
+class CompactCSRMatrix : public OperatorMatrix<ValueType>
+{
+
+public:
+
+    /** Constructor
+     *
+     *  @param[in] A is the sparse matrix whose local and halo part are copied with compact index arrays
+     */
+    CompactCSRMatrix( const SparseMatrix<ValueType>& A ) :
+
+        OperatorMatrix<ValueType>( A.getRowDistributionPtr(), A.getColDistributionPtr() ),
+        mHaloExchangePlan( A.getHaloExchangePlan() ),
+        mContext( A.getContextPtr() )
+
+    {
+        mLocal.set( A.getLocalStorage() );
+        mHalo.set( A.getHaloStorage() );
+
+        SCAI_LOG_INFO( logger, "CompactCSRMatrix<" << common::TypeTraits<ValueType>::id() << ">( A = " << A << " ), "
+                       << "local = " << mLocal.numRows << " x " << mLocal.numColumns << ", halo = "
+                       << mHalo.numRows << " x " << mHalo.numColumns )
+    }
+
+    /**
+     *  Implementation of the linear operator
+     */
+    virtual void matrixTimesVectorDense(
+        DenseVector<ValueType>& result,
+        const ValueType alpha,
+        const DenseVector<ValueType>& x,
+        const ValueType beta,
+        const DenseVector<ValueType>* y,
+        const common::MatrixOp op ) const
+    {
+        SCAI_ASSERT_ERROR( !common::isConj( op ), "conj matrix operation not supported here." )
+
+        hmemo::HArray<ValueType>& localResult = result.getLocalValues();
+
+        // y might be an alias of result, this is supported by the kernels
+
+        const hmemo::HArray<ValueType>& localY = y == nullptr ? localResult : y->getLocalValues();
+        const hmemo::HArray<ValueType>& localX = x.getLocalValues();
+
+        if ( !common::isTranspose( op ) )
+        {
+            // halo update is collective, other processors might need local values even if there is no own halo
+
+            const dmemo::Communicator& comm = this->getColDistribution().getCommunicator();
+
+            hmemo::HArray<ValueType>& haloX = x.getHaloValues();
+
+            mHaloExchangePlan.updateHalo( haloX, localX, comm, mSendValues );
+
+            mLocal.gemv( localResult, alpha, localX, beta, localY, op, mContext );
+
+            if ( mHalo.numColumns > 0 )
+            {
+                mHalo.gemv( localResult, alpha, haloX, ValueType( 1 ), localResult, op, mContext );
+            }
+
+            return;
+        }
+
+        const dmemo::Communicator& rowComm = this->getRowDistribution().getCommunicator();
+        const dmemo::Communicator& colComm = this->getColDistribution().getCommunicator();
+
+        if ( rowComm.getSize() == 1 )
+        {
+            // all rows are available, so the result for the local columns is complete
+
+            mLocal.gemv( localResult, alpha, localX, beta, localY, op, mContext );
+        }
+        else if ( colComm.getSize() == 1 )
+        {
+            // each processor computes its part for all columns, y is added only by the first one
+
+            const ValueType myBeta = rowComm.getRank() == 0 ? beta : ValueType( 0 );
+
+            mLocal.gemv( localResult, alpha, localX, myBeta, localY, op, mContext );
+
+            rowComm.sumArray( localResult );
+        }
+        else
+        {
+            // contributions for the halo columns are sent back to their owners, reverse halo exchange
+
+            if ( mHalo.numColumns > 0 )
+            {
+                mHalo.gemv( mHaloResult, alpha, localX, ValueType( 0 ), mHaloResult, op, mContext );
+            }
+            else
+            {
+                mHaloResult.clear();
+            }
+
+            mLocal.gemv( localResult, alpha, localX, beta, localY, op, mContext );
+
+            mHaloExchangePlan.updateByHalo( localResult, mHaloResult, common::BinaryOp::ADD, colComm );
+        }
+    }
+
+    /** Provide the context where linear operator is executed */
+
+    virtual hmemo::ContextPtr getContextPtr() const
+    {
+        return mContext;
+    }
+
+    /** Number of stored entries in the local and halo part. */
+
+    virtual IndexType getLocalNumValues() const
+    {
+        return mLocal.values.size() + mHalo.values.size();
+    }
+
+    /** Just use here the logger of the base class. */
+
+    using OperatorMatrix<ValueType>::logger;
+
+private:
+
+    /** CSR data with compact index arrays */
+
+    struct CompactCSR
+    {
+        IndexType numRows;
+        IndexType numColumns;
+
+        hmemo::HArray<LocalIndexType> ia;
+        hmemo::HArray<LocalIndexType> ja;
+        hmemo::HArray<ValueType> values;
+
+        void set( const MatrixStorage<ValueType>& storage )
+        {
+            numRows    = storage.getNumRows();
+            numColumns = storage.getNumColumns();
+
+            if ( storage.getFormat() == Format::CSR )
+            {
+                set( static_cast<const CSRStorage<ValueType>&>( storage ) );
+            }
+            else
+            {
+                CSRStorage<ValueType> csr;
+                csr.assign( storage );
+                set( csr );
+            }
+        }
+
+        void set( const CSRStorage<ValueType>& csr )
+        {
+            SCAI_ASSERT_LE_ERROR( csr.getNumColumns(), IndexType( std::numeric_limits<LocalIndexType>::max() ),
+                                  "too many columns for LocalIndexType" )
+
+            sparsekernel::CSRUtils::compactIndexes( ia, csr.getIA() );
+            sparsekernel::CSRUtils::compactIndexes( ja, csr.getJA() );
+
+            values = csr.getValues();
+        }
+
+        void gemv(
+            hmemo::HArray<ValueType>& result,
+            const ValueType alpha,
+            const hmemo::HArray<ValueType>& x,
+            const ValueType beta,
+            const hmemo::HArray<ValueType>& y,
+            const common::MatrixOp op,
+            hmemo::ContextPtr ctx ) const
+        {
+            sparsekernel::CSRUtils::gemvCompact( result, alpha, x, beta, y, numRows, numColumns, ia, ja, values, op, ctx );
+        }
+    };
+
+    CompactCSR mLocal;   // local part, column indexes are local indexes
+    CompactCSR mHalo;    // halo part, column indexes are halo indexes
+
+    dmemo::HaloExchangePlan mHaloExchangePlan;   // copy of the exchange plan, uses global IndexType
+
+    hmemo::ContextPtr mContext;
+
+    mutable hmemo::HArray<ValueType> mSendValues;  // temporary array for halo exchange of x
+    mutable hmemo::HArray<ValueType> mHaloResult;  // temporary array for transposed halo part
+};
+
+}
+
+}
@@ -42,6 +42,9 @@ namespace lama
  *
  *  The above matrix is not built explicitly and only some methods are implemented so
  *  this class can be used in solvers that exploit matrix-free methods.
+ *
+ *  If A is a sparse matrix, transpose( A ) * ( A * x ) is computed by a fused operation
+ *  that reads the matrix data only once (see SparseMatrix::gramianTimesVector).
  */
 template<typename ValueType>
 class GramianMatrix : public OperatorMatrix<ValueType>
@@ -81,6 +84,33 @@ public:
 
         SCAI_LOG_INFO( logger, "matrixTimesVector, mA = " << mA )
 
+        const SparseMatrix<ValueType>* sparseA = dynamic_cast<const SparseMatrix<ValueType>*>( &mA );
+
+        if ( sparseA != nullptr )
+        {
+            // fused computation of A' * ( A * x ) that reads the matrix only once
+
+            if ( y == nullptr && &result != &x )
+            {
+                sparseA->gramianTimesVector( result, alpha, x );
+            }
+            else
+            {
+                sparseA->gramianTimesVector( mATAx, alpha, x );
+
+                if ( y == nullptr )
+                {
+                    result = mATAx;
+                }
+                else
+                {
+                    result = mATAx + beta * *y;
+                }
+            }
+
+            return;
+        }
+
         mAx    = mA * x;
         result = alpha * transpose( mA ) * mAx;  
 
@@ -104,6 +134,7 @@ public:
 private:
 
     mutable DenseVector<ValueType> mAx;      // help vector for A * x
+    mutable DenseVector<ValueType> mATAx;    // help vector for A' * A * x if result is needed in an expression
     const Matrix<ValueType>& mA;     // This class keeps only a reference
 };
 
@@ -79,6 +79,18 @@ public:
 
     void push( const IndexType i, const IndexType j, const ValueType val );
 
+    /** 
+     *  @brief Add a dense block of matrix elements for a pair of nodes
+     *
+     *  @param[in] iNode, jNode are the global node indexes, i.e. block row and block column
+     *  @param[in] blockSize is the number of degrees of freedom per node
+     *  @param[in] vals contains blockSize x blockSize values in row-major order
+     *
+     *  The entry vals[r * blockSize + c] is pushed as element ( iNode * blockSize + r, jNode * blockSize + c ).
+     *  This fits to the block structure of a BSR storage with the same block size.
+     */
+    void pushBlock( const IndexType iNode, const IndexType jNode, const IndexType blockSize, const ValueType vals[] );
+
     /** 
      *   @brief Add elements from another assembly as increment operator
      *
@@ -188,6 +200,22 @@ void MatrixAssembly<ValueType>::push( const IndexType i, const IndexType j, cons
     mValues.push_back( val );
 }   
 
+template<typename ValueType>
+void MatrixAssembly<ValueType>::pushBlock( 
+    const IndexType iNode, 
+    const IndexType jNode, 
+    const IndexType blockSize, 
+    const ValueType vals[] )
+{
+    for ( IndexType r = 0; r < blockSize; ++r )
+    {
+        for ( IndexType c = 0; c < blockSize; ++c )
+        {
+            push( iNode * blockSize + r, jNode * blockSize + c, vals[r * blockSize + c] );
+        }
+    }
+}
+
 template<typename ValueType>
 const dmemo::Communicator& MatrixAssembly<ValueType>::getCommunicator() const
 {
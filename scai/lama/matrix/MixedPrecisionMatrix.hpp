@@ -0,0 +1,208 @@
+/**
+ * @file MixedPrecisionMatrix.hpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Operator matrix class that applies a sparse matrix of another value type to vectors
+ * @author Thomas Brandes
+ * @date 19.10.2026
+ */
+
+#pragma once
+
+#include <scai/lama/matrix/OperatorMatrix.hpp>
+#include <scai/lama/matrix/SparseMatrix.hpp>
+#include <scai/lama/matrix/CSRSparseMatrix.hpp>
+#include <scai/lama/storage/CSRStorage.hpp>
+#include <scai/lama/storage/ELLStorage.hpp>
+
+#include <scai/sparsekernel/CSRUtils.hpp>
+#include <scai/sparsekernel/ELLUtils.hpp>
+
+#include <memory>
+
+namespace scai
+{
+
+namespace lama
+{
+
+/** Operator matrix class that uses a sparse matrix with the value type MatrixValueType
+ *  as a linear operator on vectors of type ValueType.
+ *
+ *  Typical use is a matrix stored in single precision applied to vectors in double precision.
+ *  The matrix values are converted on the fly within the matrix-vector multiplication and
+ *  the accumulation is done in ValueType, so there is no converted copy of the matrix.
+ *
+ *  \code
+ *      CSRSparseMatrix<float> A( ... );
+ *      MixedPrecisionMatrix<double, float> opA( A );
+ *      DenseVector<double> y = opA * x;
+ *  \endcode
+ *
+ *  The fused kernels are available for local and halo storage in CSR or ELL format. For other formats
+ *  or for the transposed operation of a distributed matrix a converted copy of the matrix is built once
+ *  and used instead.
+ */
+template<typename ValueType, typename MatrixValueType>
+class MixedPrecisionMatrix : public OperatorMatrix<ValueType>
+{
+
+public:
+
+    /** Constructor
+     *
+     *  @param[in] A is the sparse matrix, only a reference is kept
+     */
+    MixedPrecisionMatrix( const SparseMatrix<MatrixValueType>& A ) :
+
+        OperatorMatrix<ValueType>( A.getRowDistributionPtr(), A.getColDistributionPtr() ),
+        mA( A )
+
+    {
+        SCAI_LOG_INFO( logger, "MixedPrecisionMatrix<" << common::TypeTraits<ValueType>::id() << ">( A = " << A << " )" )
+    }
+
+    /**
+     *  Implementation of the linear operator
+     */
+    virtual void matrixTimesVectorDense(
+        DenseVector<ValueType>& result,
+        const ValueType alpha,
+        const DenseVector<ValueType>& x,
+        const ValueType beta,
+        const DenseVector<ValueType>* y,
+        const common::MatrixOp op ) const
+    {
+        SCAI_ASSERT_ERROR( !common::isConj( op ), "conj matrix operation not supported here." )
+
+        const MatrixStorage<MatrixValueType>& localA = mA.getLocalStorage();
+        const MatrixStorage<MatrixValueType>& haloA  = mA.getHaloStorage();
+
+        const bool hasHalo = haloA.getNumColumns() > 0;
+
+        bool fused = isSupported( localA ) && ( !hasHalo || isSupported( haloA ) );
+
+        if ( common::isTranspose( op ) )
+        {
+            // transposed operation only without any communication
+
+            fused = fused && !hasHalo && mA.getRowDistribution().getCommunicator().getSize() == 1;
+        }
+
+        if ( !fused )
+        {
+            SCAI_LOG_INFO( logger, "matrixTimesVector, no mixed kernel for A = " << mA << ", use converted matrix" )
+
+            if ( !mConvertedA )
+            {
+                mConvertedA.reset( new CSRSparseMatrix<ValueType>() );
+                mConvertedA->assign( mA );
+            }
+
+            mConvertedA->matrixTimesVectorDense( result, alpha, x, beta, y, op );
+
+            return;
+        }
+
+        hmemo::HArray<ValueType>& localResult = result.getLocalValues();
+
+        // y might be an alias of result, this is supported by the kernels
+
+        const hmemo::HArray<ValueType>& localY = y == nullptr ? localResult : y->getLocalValues();
+        const hmemo::HArray<ValueType>& localX = x.getLocalValues();
+
+        if ( hasHalo )
+        {
+            const dmemo::Communicator& comm = mA.getColDistribution().getCommunicator();
+
+            hmemo::HArray<ValueType>& haloX = x.getHaloValues();
+
+            mA.getHaloExchangePlan().updateHalo( haloX, localX, comm, mSendValues );
+
+            gemv( localResult, alpha, localX, beta, localY, localA, op );
+            gemv( localResult, alpha, haloX, ValueType( 1 ), localResult, haloA, op );
+        }
+        else
+        {
+            gemv( localResult, alpha, localX, beta, localY, localA, op );
+        }
+    }
+
+    /** Provide the context where linear operator is executed */
+
+    virtual hmemo::ContextPtr getContextPtr() const
+    {
+        return mA.getContextPtr();
+    }
+
+    /** Just use here the logger of the base class. */
+
+    using OperatorMatrix<ValueType>::logger;
+
+private:
+
+    static bool isSupported( const MatrixStorage<MatrixValueType>& storage )
+    {
+        return storage.getFormat() == Format::CSR || storage.getFormat() == Format::ELL;
+    }
+
+    /** result = alpha * op( storage ) * x + beta * y with the mixed precision kernels */
+
+    static void gemv(
+        hmemo::HArray<ValueType>& result,
+        const ValueType alpha,
+        const hmemo::HArray<ValueType>& x,
+        const ValueType beta,
+        const hmemo::HArray<ValueType>& y,
+        const MatrixStorage<MatrixValueType>& storage,
+        const common::MatrixOp op )
+    {
+        const IndexType numRows    = storage.getNumRows();
+        const IndexType numColumns = storage.getNumColumns();
+
+        if ( storage.getFormat() == Format::CSR )
+        {
+            const auto& csr = static_cast<const CSRStorage<MatrixValueType>&>( storage );
+
+            sparsekernel::CSRUtils::gemvMixed( result, alpha, x, beta, y, numRows, numColumns,
+                                               csr.getIA(), csr.getJA(), csr.getValues(), op, csr.getContextPtr() );
+        }
+        else
+        {
+            const auto& ell = static_cast<const ELLStorage<MatrixValueType>&>( storage );
+
+            sparsekernel::ELLUtils::gemvMixed( result, alpha, x, beta, y, numRows, numColumns, ell.getNumValuesPerRow(),
+                                               ell.getIA(), ell.getJA(), ell.getValues(), op, ell.getContextPtr() );
+        }
+    }
+
+    const SparseMatrix<MatrixValueType>& mA;    // This class keeps only a reference
+
+    mutable hmemo::HArray<ValueType> mSendValues;  // temporary array for halo exchange of x
+
+    mutable std::unique_ptr<CSRSparseMatrix<ValueType>> mConvertedA;  // only built if no mixed kernel is available
+};
+
+}
+
+}
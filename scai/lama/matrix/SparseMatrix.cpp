@@ -2320,6 +2320,99 @@ void SparseMatrix<ValueType>::vectorTimesMatrixImpl(
 
 /* -------------------------------------------------------------------------- */
 
+template<typename ValueType>
+void SparseMatrix<ValueType>::gramianTimesVector(
+    DenseVector<ValueType>& result,
+    const ValueType alpha,
+    const DenseVector<ValueType>& x ) const
+{
+    SCAI_REGION( "Mat.Sp.gramianTimesVector" )
+
+    SCAI_LOG_INFO( logger, "result = " << alpha << " * A' * A * x, x = " << x << ", A = " << *this )
+
+    SCAI_ASSERT_EQ_ERROR( x.getDistribution(), getColDistribution(), "x has illegal distribution for A' * A * x" )
+    SCAI_ASSERT_ERROR( static_cast<const _Vector*>( &result ) != &x, "alias of result and x not supported" )
+
+    const bool fused = mLocalData->getFormat() == Format::CSR &&
+                       ( mHaloData->getFormat() == Format::CSR || mHaloData->getNumColumns() == 0 );
+
+    if ( !fused )
+    {
+        SCAI_LOG_INFO( logger, "gramianTimesVector: no CSR data, use two matrix-vector multiplications" )
+
+        DenseVector<ValueType> ax;
+
+        ax.allocate( getRowDistributionPtr() );
+        matrixTimesVectorDense( ax, ValueType( 1 ), x, ValueType( 0 ), nullptr, common::MatrixOp::NORMAL );
+
+        result.allocate( getColDistributionPtr() );
+        matrixTimesVectorDense( result, alpha, ax, ValueType( 0 ), nullptr, common::MatrixOp::TRANSPOSE );
+
+        return;
+    }
+
+    const Communicator& comm = getColDistribution().getCommunicator();
+
+    const HArray<ValueType>& localX = x.getLocalValues();
+
+    HArray<ValueType>& haloX = x.getHaloValues();
+
+    {
+        SCAI_REGION( "Mat.Sp.updateHalo" )
+        mHaloExchangePlan.updateHalo( haloX, localX, comm, mTempSendValues );
+    }
+
+    result.allocate( getColDistributionPtr() );
+
+    HArray<ValueType>& localResult = result.getLocalValues();
+
+    HArray<ValueType> haloResult;
+
+    const auto& localCSR = static_cast<const CSRStorage<ValueType>&>( *mLocalData );
+
+    if ( mHaloData->getNumColumns() > 0 )
+    {
+        const auto& haloCSR = static_cast<const CSRStorage<ValueType>&>( *mHaloData );
+
+        CSRUtils::gemvGramian( localResult, haloResult, alpha, localX, haloX,
+                               localCSR.getIA(), localCSR.getJA(), localCSR.getValues(),
+                               haloCSR.getIA(), haloCSR.getJA(), haloCSR.getValues(), mLocalData->getContextPtr() );
+    }
+    else
+    {
+        HArray<IndexType> noIA;
+        HArray<IndexType> noJA;
+        HArray<ValueType> noValues;
+
+        CSRUtils::gemvGramian( localResult, haloResult, alpha, localX, HArray<ValueType>(),
+                               localCSR.getIA(), localCSR.getJA(), localCSR.getValues(),
+                               noIA, noJA, noValues, mLocalData->getContextPtr() );
+    }
+
+    const Communicator& rowComm = getRowDistribution().getCommunicator();
+
+    if ( rowComm.getSize() == 1 )
+    {
+        // all rows are available, so the result for the local columns is already complete
+    }
+    else if ( getColDistribution().isReplicated() )
+    {
+        // each processor has computed its part for all columns
+
+        rowComm.sumArray( localResult );
+    }
+    else
+    {
+        // add the contributions of other processors to my columns, reverse halo exchange
+
+        SCAI_REGION( "Mat.Sp.updateByHalo" )
+
+        mHaloExchangePlan.updateByHalo( localResult, haloResult, common::BinaryOp::ADD, comm );
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+
 template<typename ValueType>
 void SparseMatrix<ValueType>::matrixTimesVectorNImpl(
     DenseMatrix<ValueType>& result,
@@ -387,6 +387,24 @@ public:
         const DenseVector<ValueType>* y,
         const common::MatrixOp op ) const;
 
+    /**
+     * @brief Fused computation of result = alpha * transpose( A ) * ( A * x ) with this matrix A.
+     *
+     * @param[out] result is the result vector, gets the column distribution of this matrix
+     * @param[in]  alpha  is the scaling factor
+     * @param[in]  x      is the input vector, must have the column distribution of this matrix
+     *
+     * If local and halo storage have CSR format, each row of the matrix is used for A * x and
+     * for its contribution to the transposed product directly one after the other so the matrix data is
+     * read only once. A distributed matrix requires one halo exchange for x and one reverse halo
+     * exchange to add the contributions for non-local columns. For other formats the result is
+     * computed by two matrix-vector multiplications.
+     */
+    void gramianTimesVector(
+        DenseVector<ValueType>& result,
+        const ValueType alpha,
+        const DenseVector<ValueType>& x ) const;
+
     /**
      * @brief Operation on distributed matrix with halo exchange, sync version
      *
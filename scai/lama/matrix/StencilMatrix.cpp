@@ -34,6 +34,12 @@
 #include <scai/utilskernel/HArrayUtils.hpp>
 
 #include <scai/sparsekernel/openmp/OpenMPStencilKernel.hpp>
+#include <scai/sparsekernel/StencilUtils.hpp>
+#include <scai/utilskernel/LAMAKernel.hpp>
+#include <scai/utilskernel/SectionKernelTrait.hpp>
+#include <scai/dmemo/CommunicationPlan.hpp>
+#include <scai/dmemo/BlockDistribution.hpp>
+#include <scai/tracing.hpp>
 #include <scai/common/macros/print_string.hpp>
 #include <scai/common/macros/instantiate.hpp>
 
@@ -339,6 +345,399 @@ void StencilMatrix<ValueType>::buildLocalStorage( _MatrixStorage& storage ) cons
 
 /* -------------------------------------------------------------------------- */
 
+template<typename ValueType>
+bool StencilMatrix<ValueType>::hasGhostExchange() const
+{
+    const GridDistribution* gridDist = dynamic_cast<const GridDistribution*>( getColDistributionPtr().get() );
+
+    if ( gridDist == nullptr || getRowDistributionPtr() != getColDistributionPtr() )
+    {
+        return false;
+    }
+
+    if ( dynamic_cast<const StencilStorage<ValueType>*>( mLocalData.get() ) == nullptr )
+    {
+        return false;   // local storage has been modified
+    }
+
+    const common::Grid& globalGrid = gridDist->getGlobalGrid();
+    const common::Grid& procGrid   = gridDist->getProcGrid();
+
+    if ( procGrid.size() != gridDist->getCommunicator().getSize() )
+    {
+        return false;   // there are processors that do not own any part of the grid
+    }
+
+    // each processor must have at least as many grid points as ghost layers are required by its 
+    // neighbors so that the ghost layers can be exchanged with the direct neighbors only
+
+    IndexType width[ 2 * SCAI_GRID_MAX_DIMENSION ];
+
+    getStencil().getWidth( width );
+
+    for ( IndexType idim = 0; idim < globalGrid.nDims(); ++idim )
+    {
+        const IndexType nProcs = procGrid.size( idim );
+
+        const bool periodic = globalGrid.borders()[2 * idim] == common::BorderType::PERIODIC ||
+                              globalGrid.borders()[2 * idim + 1] == common::BorderType::PERIODIC;
+
+        if ( nProcs == 1 && !periodic )
+        {
+            continue;
+        }
+
+        const IndexType maxWidth = std::max( width[2 * idim], width[2 * idim + 1] );
+
+        for ( PartitionId p = 0; p < nProcs; ++p )
+        {
+            IndexType lb;
+            IndexType ub;
+
+            BlockDistribution::getLocalRange( lb, ub, globalGrid.size( idim ), p, nProcs );
+
+            if ( ub < lb + maxWidth )
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/** Help routine to exchange the ghost layers of one side for one dimension.
+ *
+ *  The box [boxLB, boxLB + boxSizes) of the extended grid is sent to the processor sendTo,
+ *  where boxLB[dim] is replaced with sendLB, and the box with recvLB is received from 
+ *  processor recvFrom. If there is no processor to receive from, the box is set to zero.
+ */
+template<typename ValueType>
+static void shiftGhostLayers(
+    hmemo::HArray<ValueType>& xGhost,
+    const IndexType nDims,
+    const IndexType ghostDistances[],
+    const IndexType boxLB[],
+    const IndexType boxSizes[],
+    const IndexType dim,
+    const IndexType sendLB,
+    const IndexType recvLB,
+    const PartitionId sendTo,
+    const PartitionId recvFrom,
+    const Communicator& comm,
+    hmemo::ContextPtr ctx )
+{
+    using utilskernel::LAMAKernel;
+    using utilskernel::SectionKernelTrait;
+
+    static LAMAKernel<SectionKernelTrait::assign<ValueType> > assign;
+    static LAMAKernel<SectionKernelTrait::assignScalar<ValueType> > assignScalar;
+
+    hmemo::ContextPtr loc = ctx;
+
+    assign.getSupportedContext( loc, assignScalar );
+
+    IndexType sendOffset = 0;
+    IndexType recvOffset = 0;
+    IndexType boxSize    = 1;
+
+    for ( IndexType idim = 0; idim < nDims; ++idim )
+    {
+        const IndexType lb = idim == dim ? sendLB : boxLB[idim];
+        const IndexType rb = idim == dim ? recvLB : boxLB[idim];
+
+        sendOffset += lb * ghostDistances[idim];
+        recvOffset += rb * ghostDistances[idim];
+        boxSize    *= boxSizes[idim];
+    }
+
+    if ( boxSize == 0 )
+    {
+        return;
+    }
+
+    // distances for the contiguous send/recv buffers
+
+    IndexType bufferDistances[ SCAI_GRID_MAX_DIMENSION ];
+
+    common::Grid( nDims, boxSizes ).getDistances( bufferDistances );
+
+    const common::BinaryOp op = common::BinaryOp::COPY;
+
+    if ( sendTo == comm.getRank() )
+    {
+        // periodic boundary in a dimension that is not distributed, recvFrom is also this processor
+
+        hmemo::WriteAccess<ValueType> wGhost( xGhost, loc );
+        SCAI_CONTEXT_ACCESS( loc )
+        assign[loc]( wGhost.get() + recvOffset, nDims, boxSizes, ghostDistances, 
+                     wGhost.get() + sendOffset, ghostDistances, op, false );
+        return;
+    }
+
+    hmemo::HArray<ValueType> sendBuffer;
+    hmemo::HArray<ValueType> recvBuffer;
+
+    CommunicationPlan sendPlan;
+    CommunicationPlan recvPlan;
+
+    if ( sendTo != invalidPartition )
+    {
+        hmemo::WriteOnlyAccess<ValueType> wSend( sendBuffer, loc, boxSize );
+        hmemo::ReadAccess<ValueType> rGhost( xGhost, loc );
+        SCAI_CONTEXT_ACCESS( loc )
+        assign[loc]( wSend.get(), nDims, boxSizes, bufferDistances, rGhost.get() + sendOffset, ghostDistances, op, false );
+        sendPlan.defineBySingleEntry( boxSize, sendTo );
+    }
+
+    if ( recvFrom != invalidPartition )
+    {
+        recvPlan.defineBySingleEntry( boxSize, recvFrom );
+    }
+
+    comm.exchangeByPlan( recvBuffer, recvPlan, sendBuffer, sendPlan );
+
+    hmemo::WriteAccess<ValueType> wGhost( xGhost, loc );
+    SCAI_CONTEXT_ACCESS( loc )
+
+    if ( recvFrom != invalidPartition )
+    {
+        hmemo::ReadAccess<ValueType> rRecv( recvBuffer, loc );
+        assign[loc]( wGhost.get() + recvOffset, nDims, boxSizes, ghostDistances, rRecv.get(), bufferDistances, op, false );
+    }
+    else
+    {
+        // absorbing border of the global grid
+
+        assignScalar[loc]( wGhost.get() + recvOffset, nDims, boxSizes, ghostDistances, ValueType( 0 ), op, false );
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void StencilMatrix<ValueType>::buildGhostValues(
+    hmemo::HArray<ValueType>& xGhost,
+    const hmemo::HArray<ValueType>& localX,
+    const IndexType ghostWidth[] ) const
+{
+    SCAI_REGION( "Mat.Stencil.ghostExchange" )
+
+    const GridDistribution& gridDist = static_cast<const GridDistribution&>( getColDistribution() );
+
+    const Communicator& comm = gridDist.getCommunicator();
+
+    const common::Grid& localGrid  = gridDist.getLocalGrid();
+    const common::Grid& globalGrid = gridDist.getGlobalGrid();
+    const common::Grid& procGrid   = gridDist.getProcGrid();
+
+    const IndexType nDims = localGrid.nDims();
+
+    IndexType localDistances[ SCAI_GRID_MAX_DIMENSION ];
+    IndexType ghostSizes[ SCAI_GRID_MAX_DIMENSION ];
+    IndexType ghostDistances[ SCAI_GRID_MAX_DIMENSION ];
+
+    localGrid.getDistances( localDistances );
+
+    IndexType coreOffset = 0;
+
+    for ( IndexType idim = 0; idim < nDims; ++idim )
+    {
+        ghostSizes[idim] = localGrid.size( idim ) + ghostWidth[2 * idim] + ghostWidth[2 * idim + 1];
+    }
+
+    common::Grid ghostGrid( nDims, ghostSizes );
+
+    ghostGrid.getDistances( ghostDistances );
+
+    for ( IndexType idim = 0; idim < nDims; ++idim )
+    {
+        coreOffset += ghostWidth[2 * idim] * ghostDistances[idim];
+    }
+
+    // copy the local values into the core of the extended grid
+
+    {
+        static utilskernel::LAMAKernel<utilskernel::SectionKernelTrait::assign<ValueType> > assign;
+
+        hmemo::ContextPtr loc = this->getContextPtr();
+
+        assign.getSupportedContext( loc );
+
+        hmemo::WriteOnlyAccess<ValueType> wGhost( xGhost, loc, ghostGrid.size() );
+        hmemo::ReadAccess<ValueType> rX( localX, loc );
+
+        SCAI_CONTEXT_ACCESS( loc )
+
+        assign[loc]( wGhost.get() + coreOffset, nDims, localGrid.sizes(), ghostDistances, 
+                     rX.get(), localDistances, common::BinaryOp::COPY, false );
+    }
+
+    // edges and corners are only needed if the stencil has diagonal points
+
+    const Stencil<ValueType>& stencil = getStencil();
+
+    bool diagonalPoints = false;
+
+    for ( IndexType k = 0; k < stencil.nPoints(); ++k )
+    {
+        IndexType nonZeros = 0;
+
+        for ( IndexType idim = 0; idim < nDims; ++idim )
+        {
+            if ( stencil.positions()[ k * nDims + idim ] != 0 )
+            {
+                nonZeros++;
+            }
+        }
+
+        diagonalPoints = diagonalPoints || nonZeros > 1;
+    }
+
+    IndexType procPos[ SCAI_GRID_MAX_DIMENSION ];
+
+    procGrid.gridPos( procPos, comm.getRank() );
+
+    // Exchange dimension by dimension, the boxes include the ghost layers of the dimensions
+    // already exchanged so that the edge and corner values are exchanged implicitly.
+
+    for ( IndexType dim = 0; dim < nDims; ++dim )
+    {
+        const IndexType lw = ghostWidth[2 * dim];
+        const IndexType rw = ghostWidth[2 * dim + 1];
+
+        const IndexType n = localGrid.size( dim );
+
+        IndexType boxLB[ SCAI_GRID_MAX_DIMENSION ];
+        IndexType boxSizes[ SCAI_GRID_MAX_DIMENSION ];
+
+        for ( IndexType idim = 0; idim < nDims; ++idim )
+        {
+            if ( idim < dim && diagonalPoints )
+            {
+                boxLB[idim]    = 0;
+                boxSizes[idim] = ghostSizes[idim];
+            }
+            else
+            {
+                boxLB[idim]    = ghostWidth[2 * idim];
+                boxSizes[idim] = localGrid.size( idim );
+            }
+        }
+
+        const IndexType nProcs = procGrid.size( dim );
+        const IndexType pos    = procPos[dim];
+
+        const bool leftPeriodic  = globalGrid.borders()[2 * dim] == common::BorderType::PERIODIC;
+        const bool rightPeriodic = globalGrid.borders()[2 * dim + 1] == common::BorderType::PERIODIC;
+
+        IndexType neighborPos[ SCAI_GRID_MAX_DIMENSION ];
+
+        std::copy( procPos, procPos + nDims, neighborPos );
+
+        neighborPos[dim] = pos == 0 ? nProcs - 1 : pos - 1;
+
+        const PartitionId left = procGrid.linearPos( neighborPos );
+
+        neighborPos[dim] = pos + 1 == nProcs ? 0 : pos + 1;
+
+        const PartitionId right = procGrid.linearPos( neighborPos );
+
+        if ( lw > 0 )
+        {
+            // my upper layers [n, n + lw) are the left ghost layers of the right neighbor
+
+            boxSizes[dim] = lw;
+
+            const PartitionId sendTo   = pos + 1 < nProcs || leftPeriodic ? right : invalidPartition;
+            const PartitionId recvFrom = pos > 0 || leftPeriodic ? left : invalidPartition;
+
+            shiftGhostLayers( xGhost, nDims, ghostDistances, boxLB, boxSizes, dim, n, 0,
+                              sendTo, recvFrom, comm, this->getContextPtr() );
+        }
+
+        if ( rw > 0 )
+        {
+            // my lower layers are the right ghost layers of the left neighbor
+
+            boxSizes[dim] = rw;
+
+            const PartitionId sendTo   = pos > 0 || rightPeriodic ? left : invalidPartition;
+            const PartitionId recvFrom = pos + 1 < nProcs || rightPeriodic ? right : invalidPartition;
+
+            shiftGhostLayers( xGhost, nDims, ghostDistances, boxLB, boxSizes, dim, lw, lw + n,
+                              sendTo, recvFrom, comm, this->getContextPtr() );
+        }
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void StencilMatrix<ValueType>::matrixTimesVectorDense(
+    DenseVector<ValueType>& result,
+    const ValueType alpha,
+    const DenseVector<ValueType>& x,
+    const ValueType beta,
+    const DenseVector<ValueType>* y,
+    const common::MatrixOp op ) const
+{
+    if ( op != common::MatrixOp::NORMAL || getColDistribution().isReplicated() || !hasGhostExchange() )
+    {
+        SparseMatrix<ValueType>::matrixTimesVectorDense( result, alpha, x, beta, y, op );
+        return;
+    }
+
+    SCAI_REGION( "Mat.Stencil.timesVector" )
+
+    const Stencil<ValueType>& stencil = getStencil();
+
+    const IndexType nDims = stencil.nDims();
+
+    IndexType ghostWidth[ 2 * SCAI_GRID_MAX_DIMENSION ];
+
+    stencil.getWidth( ghostWidth );
+
+    // the halo array of x is reused for the values on the extended grid
+
+    hmemo::HArray<ValueType>& xGhost = x.getHaloValues();
+
+    buildGhostValues( xGhost, x.getLocalValues(), ghostWidth );
+
+    const common::Grid& localGrid = getLocalStorage().getGrid();
+
+    IndexType ghostDistances[ SCAI_GRID_MAX_DIMENSION ];
+    IndexType ghostSizes[ SCAI_GRID_MAX_DIMENSION ];
+
+    for ( IndexType idim = 0; idim < nDims; ++idim )
+    {
+        ghostSizes[idim] = localGrid.size( idim ) + ghostWidth[2 * idim] + ghostWidth[2 * idim + 1];
+    }
+
+    common::Grid( nDims, ghostSizes ).getDistances( ghostDistances );
+
+    hmemo::HArray<int> stencilOffsets( stencil.nPoints() );
+
+    {
+        hmemo::WriteOnlyAccess<int> wOffsets( stencilOffsets, stencil.nPoints() );
+        stencil.getLinearOffsets( wOffsets.get(), ghostDistances );
+    }
+
+    hmemo::HArray<ValueType> stencilValues( stencil.nPoints(), stencil.values() );
+
+    // be careful: y is optional, i.e. nullptr iff beta == 0
+
+    const hmemo::HArray<ValueType>& localY = y == nullptr ? result.getLocalValues() : y->getLocalValues();
+
+    sparsekernel::StencilUtils::ghostGEMV( result.getLocalValues(), alpha, xGhost, beta, localY,
+                                           nDims, localGrid.sizes(), ghostWidth, stencilValues, stencilOffsets,
+                                           this->getContextPtr() );
+}
+
+/* -------------------------------------------------------------------------- */
+
 template<typename ValueType>
 const char* StencilMatrix<ValueType>::getTypeName() const
 {
@@ -50,6 +50,11 @@ namespace lama
 /** Definition of a derived class for SparseMatrix that uses the stencil storage 
  *  for the local part and the CSR format for the halo part.
  *
+ *  For a matrix-vector multiplication with a distributed stencil matrix the CSR halo
+ *  is not used at all. Instead the local grid is extended by ghost layers of the stencil
+ *  width that are exchanged only with the neighbored processors of the processor grid.
+ *  The CSR halo is still built as it is required for conversions to other formats.
+ *
  *  This matrix class will not register at the factory.
  *
  *  In contrary to the other sparse/dense matrix format, the following operations
@@ -146,6 +151,21 @@ public:
      */
     virtual void buildLocalStorage( _MatrixStorage& storage ) const;
 
+    /** Override SparseMatrix<ValueType>::matrixTimesVectorDense 
+     *
+     *  For a distributed stencil matrix, the non-local values of x are exchanged as ghost layers of the
+     *  local grid and the stencil is applied to all local grid points in the same way.
+     *  This operation falls back to the halo exchange of the sparse matrix if the ghost layers
+     *  cannot be exchanged with direct neighbors only (e.g. very small local grids).
+     */
+    virtual void matrixTimesVectorDense(
+        DenseVector<ValueType>& result,
+        const ValueType alpha,
+        const DenseVector<ValueType>& x,
+        const ValueType beta,
+        const DenseVector<ValueType>* y,
+        const common::MatrixOp op ) const;
+
     /* Query the stencil that has been used to define the stencil matrix */
 
     const common::Stencil<ValueType>& getStencil() const;
@@ -191,6 +211,23 @@ private:
         const dmemo::GridDistribution& gridDist,
         const common::Stencil<ValueType>& stencil );
 
+    /** Query if the ghost layers required by the stencil can be exchanged with the neighbored processors. */
+
+    bool hasGhostExchange() const;
+
+    /** 
+     *  @brief Set up the local part of a vector on the local grid extended by ghost layers.
+     *
+     *  @param[out] xGhost contains the local values and the ghost values of the neighbored processors
+     *  @param[in]  localX contains the local values on the local grid
+     *  @param[in]  ghostWidth contains the number of left/right ghost layers for each dimension
+     *
+     *  Ghost values at absorbing borders of the global grid are set to zero.
+     */
+    void buildGhostValues( 
+        hmemo::HArray<ValueType>& xGhost, 
+        const hmemo::HArray<ValueType>& localX,
+        const IndexType ghostWidth[] ) const;
 };
 
 } /* end namespace lama */
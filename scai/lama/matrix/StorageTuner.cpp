@@ -0,0 +1,574 @@
+/**
+ * @file StorageTuner.cpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Implementation of methods for the automatic selection of the storage format.
+ * @author Thomas Brandes
+ * @date 19.10.2026
+ */
+
+// hpp
+#include <scai/lama/matrix/StorageTuner.hpp>
+
+// local library
+#include <scai/lama/DenseVector.hpp>
+#include <scai/lama/expression/MatrixVectorExpressions.hpp>
+
+// internal scai libraries
+#include <scai/hmemo/HostReadAccess.hpp>
+
+#include <scai/common/Settings.hpp>
+#include <scai/common/Walltime.hpp>
+#include <scai/common/OpenMP.hpp>
+#include <scai/common/macros/instantiate.hpp>
+
+#include <scai/tracing.hpp>
+
+// std
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <cstdint>
+
+namespace scai
+{
+
+using namespace hmemo;
+
+namespace lama
+{
+
+/* ------------------------------------------------------------------------- */
+/*   MatrixStructure                                                         */
+/* ------------------------------------------------------------------------- */
+
+double MatrixStructure::avgRowLength() const
+{
+    return numRows == 0 ? 0.0 : double( numValues ) / double( numRows );
+}
+
+double MatrixStructure::diagonalOccupancy() const
+{
+    const double numDiagonalValues = double( numDiagonals ) * double( numRows );
+
+    return numDiagonalValues == 0.0 ? 0.0 : double( numValues ) / numDiagonalValues;
+}
+
+double MatrixStructure::ellFillRatio() const
+{
+    return numValues == 0 ? 1.0 : double( maxRowLength ) * double( numRows ) / double( numValues );
+}
+
+std::string MatrixStructure::fingerprint() const
+{
+    std::ostringstream key;
+
+    key << valueType << ":" << numProcessors << ":" << numRows << "x" << numColumns << ":" << numValues
+        << ":" << numEmptyRows << ":" << maxRowLength << ":" << std::setprecision( 6 ) << rowLengthVariance
+        << ":" << numDiagonals << ":" << bandwidth;
+
+    // FNV-1a hash, stable over different runs and compilers
+
+    const std::string keyString = key.str();
+
+    uint64_t hash = 14695981039346656037ULL;
+
+    for ( const char c : keyString )
+    {
+        hash ^= static_cast<unsigned char>( c );
+        hash *= 1099511628211ULL;
+    }
+
+    std::ostringstream result;
+
+    result << std::hex << std::setw( 16 ) << std::setfill( '0' ) << hash;
+
+    return result.str();
+}
+
+void MatrixStructure::writeAt( std::ostream& stream ) const
+{
+    stream << "MatrixStructure( " << numRows << " x " << numColumns << ", nnz = " << numValues
+           << ", empty rows = " << numEmptyRows << ", max row = " << maxRowLength
+           << ", row variance = " << rowLengthVariance << ", diagonals = " << numDiagonals
+           << ", bandwidth = " << bandwidth << " )";
+}
+
+std::ostream& operator<<( std::ostream& stream, const MatrixStructure& structure )
+{
+    structure.writeAt( stream );
+    return stream;
+}
+
+/* ------------------------------------------------------------------------- */
+/*   StorageTuner                                                            */
+/* ------------------------------------------------------------------------- */
+
+SCAI_LOG_DEF_TEMPLATE_LOGGER( template<typename ValueType>, StorageTuner<ValueType>::logger, "StorageTuner" )
+
+/* ------------------------------------------------------------------------- */
+
+template<typename ValueType>
+StorageTuner<ValueType>::StorageTuner() :
+
+    mTiming( false ),
+    mNumIterations( 10 ),
+    mFormats( { Format::CSR, Format::ELL, Format::JDS, Format::DIA, Format::COO } )
+{
+    common::Settings::getEnvironment( mCacheFile, "SCAI_TUNING_CACHE" );
+}
+
+template<typename ValueType>
+StorageTuner<ValueType>::~StorageTuner()
+{
+}
+
+/* ------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void StorageTuner<ValueType>::setTiming( const bool flag )
+{
+    mTiming = flag;
+}
+
+template<typename ValueType>
+void StorageTuner<ValueType>::setNumIterations( const IndexType numIterations )
+{
+    SCAI_ASSERT_GT_ERROR( numIterations, 0, "at least one iteration required for timing" )
+
+    mNumIterations = numIterations;
+}
+
+template<typename ValueType>
+void StorageTuner<ValueType>::setFormats( const std::vector<Format>& formats )
+{
+    SCAI_ASSERT_ERROR( formats.size() > 0, "no candidate formats" )
+
+    mFormats = formats;
+}
+
+template<typename ValueType>
+void StorageTuner<ValueType>::setThreadCounts( const std::vector<int>& threadCounts )
+{
+    for ( const int nThreads : threadCounts )
+    {
+        SCAI_ASSERT_GT_ERROR( nThreads, 0, "illegal thread count" )
+    }
+
+    mThreadCounts = threadCounts;
+}
+
+template<typename ValueType>
+void StorageTuner<ValueType>::setCacheFile( const std::string& fileName )
+{
+    mCacheFile = fileName;
+}
+
+/* ------------------------------------------------------------------------- */
+
+template<typename ValueType>
+MatrixStructure StorageTuner<ValueType>::getStructure( const SparseMatrix<ValueType>& matrix )
+{
+    SCAI_REGION( "StorageTuner.getStructure" )
+
+    const MatrixStorage<ValueType>& local = matrix.getLocalStorage();
+
+    const IndexType numLocalRows = local.getNumRows();
+    const IndexType numLocalColumns = local.getNumColumns();
+
+    HArray<IndexType> ia;
+    HArray<IndexType> ja;
+    HArray<ValueType> values;
+
+    local.buildCSRData( ia, ja, values );
+
+    IndexType numEmptyRows = 0;
+    IndexType maxRowLength = 0;
+    double sumSquares = 0;
+    IndexType numDiagonals = 0;
+    IndexType bandwidth = 0;
+
+    {
+        auto rIA = hostReadAccess( ia );
+        auto rJA = hostReadAccess( ja );
+
+        // diagonal offset j - i is mapped to j - i + numLocalRows - 1
+
+        std::vector<bool> usedDiagonals( numLocalRows + numLocalColumns, false );
+
+        for ( IndexType i = 0; i < numLocalRows; ++i )
+        {
+            const IndexType rowLength = rIA[i + 1] - rIA[i];
+
+            if ( rowLength == 0 )
+            {
+                numEmptyRows++;
+            }
+
+            maxRowLength = std::max( maxRowLength, rowLength );
+            sumSquares += double( rowLength ) * double( rowLength );
+
+            for ( IndexType jj = rIA[i]; jj < rIA[i + 1]; ++jj )
+            {
+                const IndexType offset = rJA[jj] - i;
+
+                bandwidth = std::max( bandwidth, offset < 0 ? -offset : offset );
+
+                const IndexType pos = offset + numLocalRows - 1;
+
+                if ( !usedDiagonals[pos] )
+                {
+                    usedDiagonals[pos] = true;
+                    numDiagonals++;
+                }
+            }
+        }
+    }
+
+    const dmemo::Communicator& comm = matrix.getRowDistribution().getCommunicator();
+
+    MatrixStructure structure;
+
+    structure.numRows       = matrix.getNumRows();
+    structure.numColumns    = matrix.getNumColumns();
+    structure.numValues     = comm.sum( local.getNumValues() );
+    structure.numEmptyRows  = comm.sum( numEmptyRows );
+    structure.maxRowLength  = comm.max( maxRowLength );
+    structure.numDiagonals  = comm.max( numDiagonals );
+    structure.bandwidth     = comm.max( bandwidth );
+    structure.numProcessors = comm.getSize();
+    structure.valueType     = common::TypeTraits<ValueType>::stype;
+
+    sumSquares = comm.sum( sumSquares );
+
+    const double avg = structure.avgRowLength();
+
+    structure.rowLengthVariance = structure.numRows == 0 ? 0.0 : sumSquares / double( structure.numRows ) - avg * avg;
+
+    SCAI_LOG_INFO( logger, "structure of " << matrix << ": " << structure )
+
+    return structure;
+}
+
+/* ------------------------------------------------------------------------- */
+
+template<typename ValueType>
+Format StorageTuner<ValueType>::selectFormat( const MatrixStructure& structure )
+{
+    if ( structure.numValues == 0 )
+    {
+        return Format::CSR;
+    }
+
+    if ( structure.diagonalOccupancy() >= 0.5 )
+    {
+        return Format::DIA;
+    }
+
+    if ( structure.ellFillRatio() <= 1.25 )
+    {
+        return Format::ELL;
+    }
+
+    return Format::CSR;
+}
+
+/* ------------------------------------------------------------------------- */
+
+template<typename ValueType>
+TuningDecision StorageTuner<ValueType>::decide( const SparseMatrix<ValueType>& matrix ) const
+{
+    SCAI_REGION( "StorageTuner.decide" )
+
+    const MatrixStructure structure = getStructure( matrix );
+
+    TuningDecision decision;
+
+    if ( !mTiming )
+    {
+        decision.format = selectFormat( structure );
+        decision.numThreads = 0;
+        decision.time = 0;
+        decision.fromCache = false;
+
+        SCAI_LOG_INFO( logger, "selected format " << decision.format << " by structure" )
+
+        return decision;
+    }
+
+    const dmemo::Communicator& comm = matrix.getRowDistribution().getCommunicator();
+
+    const std::string fingerprint = structure.fingerprint();
+
+    if ( readCache( decision, fingerprint, comm ) )
+    {
+        SCAI_LOG_INFO( logger, "selected format " << decision.format << " from cache, fingerprint = " << fingerprint )
+
+        return decision;
+    }
+
+    decision = timeCandidates( matrix, structure );
+
+    writeCache( decision, fingerprint, comm );
+
+    return decision;
+}
+
+/* ------------------------------------------------------------------------- */
+
+template<typename ValueType>
+TuningDecision StorageTuner<ValueType>::timeCandidates( const SparseMatrix<ValueType>& matrix, const MatrixStructure& structure ) const
+{
+    SCAI_REGION( "StorageTuner.timeCandidates" )
+
+    const int maxThreads = omp_get_max_threads();
+
+    std::vector<int> threadCounts = mThreadCounts;
+
+    if ( threadCounts.empty() )
+    {
+        threadCounts.push_back( 0 );   // 0 stands for the current number of threads
+    }
+
+    TuningDecision best;
+
+    best.format = selectFormat( structure );
+    best.numThreads = 0;
+    best.time = 0;
+    best.fromCache = false;
+
+    bool found = false;
+
+    for ( const Format format : mFormats )
+    {
+        if ( !_Matrix::canCreate( MatrixCreateKeyType( format, common::TypeTraits<ValueType>::stype ) ) )
+        {
+            continue;
+        }
+
+        // skip formats that would allocate much more memory than needed for the non-zero entries
+
+        if ( format == Format::DIA && structure.diagonalOccupancy() < 0.25 )
+        {
+            continue;
+        }
+
+        if ( format == Format::ELL && structure.ellFillRatio() > 4.0 )
+        {
+            continue;
+        }
+
+        auto candidate = apply( TuningDecision{ format, 0, 0.0, false }, matrix );
+
+        for ( const int nThreads : threadCounts )
+        {
+            if ( nThreads > 0 )
+            {
+                omp_set_num_threads( nThreads );
+            }
+
+            const double time = timeSpMV( *candidate );
+
+            SCAI_LOG_INFO( logger, "format = " << format << ", threads = " << nThreads << ": " << time << " s" )
+
+            if ( !found || time < best.time )
+            {
+                best.format = format;
+                best.numThreads = nThreads;
+                best.time = time;
+                found = true;
+            }
+        }
+    }
+
+    omp_set_num_threads( maxThreads );
+
+    SCAI_LOG_INFO( logger, "selected format " << best.format << ", threads = " << best.numThreads << " by timing" )
+
+    return best;
+}
+
+/* ------------------------------------------------------------------------- */
+
+template<typename ValueType>
+double StorageTuner<ValueType>::timeSpMV( const SparseMatrix<ValueType>& matrix ) const
+{
+    const dmemo::Communicator& comm = matrix.getRowDistribution().getCommunicator();
+
+    DenseVector<ValueType> x( matrix.getColDistributionPtr(), 1 );
+    DenseVector<ValueType> y( matrix.getRowDistributionPtr(), 0 );
+
+    y = matrix * x;   // warm up, allocates temporary arrays
+
+    comm.synchronize();
+
+    const double start = common::Walltime::get();
+
+    for ( IndexType iter = 0; iter < mNumIterations; ++iter )
+    {
+        y = matrix * x;
+    }
+
+    const double time = ( common::Walltime::get() - start ) / double( mNumIterations );
+
+    // all processors take the same decision
+
+    return comm.max( time );
+}
+
+/* ------------------------------------------------------------------------- */
+
+template<typename ValueType>
+bool StorageTuner<ValueType>::readCache( TuningDecision& decision, const std::string& fingerprint, const dmemo::Communicator& comm ) const
+{
+    if ( mCacheFile.empty() )
+    {
+        return false;
+    }
+
+    // only first processor reads the file, decision is broadcast
+
+    IndexType entry[] = { 0, 0, 0 };    // found, format, numThreads
+    double time = 0;
+
+    if ( comm.getRank() == 0 )
+    {
+        std::ifstream file( mCacheFile.c_str(), std::ios::in );
+
+        std::string line;
+
+        while ( file.good() && std::getline( file, line ) )
+        {
+            std::istringstream input( line );
+
+            std::string key;
+            std::string formatStr;
+            int nThreads;
+            double t;
+
+            if ( !( input >> key >> formatStr >> nThreads >> t ) || key != fingerprint )
+            {
+                continue;
+            }
+
+            Format format = str2Format( formatStr.c_str() );
+
+            if ( format == Format::UNDEFINED )
+            {
+                SCAI_LOG_WARN( logger, "illegal format " << formatStr << " in tuning cache " << mCacheFile )
+                continue;
+            }
+
+            // later entries overwrite earlier ones
+
+            entry[0] = 1;
+            entry[1] = static_cast<IndexType>( format );
+            entry[2] = nThreads;
+            time = t;
+        }
+    }
+
+    comm.bcast( entry, 3, 0 );
+    comm.bcast( &time, 1, 0 );
+
+    if ( entry[0] == 0 )
+    {
+        return false;
+    }
+
+    decision.format = static_cast<Format>( entry[1] );
+    decision.numThreads = static_cast<int>( entry[2] );
+    decision.time = time;
+    decision.fromCache = true;
+
+    return true;
+}
+
+/* ------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void StorageTuner<ValueType>::writeCache( const TuningDecision& decision, const std::string& fingerprint, const dmemo::Communicator& comm ) const
+{
+    if ( mCacheFile.empty() || comm.getRank() != 0 )
+    {
+        return;
+    }
+
+    std::ofstream file( mCacheFile.c_str(), std::ios::out | std::ios::app );
+
+    if ( !file.good() )
+    {
+        SCAI_LOG_WARN( logger, "could not write tuning cache " << mCacheFile )
+        return;
+    }
+
+    file << fingerprint << " " << format2Str( decision.format ) << " " << decision.numThreads << " " << decision.time << std::endl;
+}
+
+/* ------------------------------------------------------------------------- */
+
+template<typename ValueType>
+std::unique_ptr<SparseMatrix<ValueType> > StorageTuner<ValueType>::apply(
+    const TuningDecision& decision,
+    const SparseMatrix<ValueType>& matrix )
+{
+    SCAI_REGION( "StorageTuner.apply" )
+
+    std::unique_ptr<Matrix<ValueType> > newMatrix( Matrix<ValueType>::getMatrix( decision.format ) );
+
+    SCAI_ASSERT_EQ_ERROR( newMatrix->getMatrixKind(), MatrixKind::SPARSE, "tuning decision " << decision.format << " is not a sparse format" )
+
+    std::unique_ptr<SparseMatrix<ValueType> > result( static_cast<SparseMatrix<ValueType>*>( newMatrix.release() ) );
+
+    result->setContextPtr( matrix.getContextPtr() );
+    result->setCommunicationKind( matrix.getCommunicationKind() );
+
+    // assignment keeps the distributions, local and halo storage are converted
+
+    result->assign( matrix );
+
+    if ( decision.numThreads > 0 )
+    {
+        omp_set_num_threads( decision.numThreads );
+    }
+
+    return result;
+}
+
+/* ------------------------------------------------------------------------- */
+
+template<typename ValueType>
+std::unique_ptr<SparseMatrix<ValueType> > StorageTuner<ValueType>::tune( const SparseMatrix<ValueType>& matrix ) const
+{
+    return apply( decide( matrix ), matrix );
+}
+
+/* ========================================================================= */
+/*       Template instantiations                                             */
+/* ========================================================================= */
+
+SCAI_COMMON_INST_CLASS( StorageTuner, SCAI_NUMERIC_TYPES_HOST )
+
+} /* end namespace lama */
+
+} /* end namespace scai */
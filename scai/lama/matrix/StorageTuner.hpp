@@ -0,0 +1,218 @@
+/**
+ * @file StorageTuner.hpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Automatic selection of the storage format for a sparse matrix.
+ * @author Thomas Brandes
+ * @date 19.10.2026
+ */
+
+#pragma once
+
+// for dll_import
+#include <scai/common/config.hpp>
+
+// local library
+#include <scai/lama/matrix/SparseMatrix.hpp>
+#include <scai/lama/storage/Format.hpp>
+
+// internal scai libraries
+#include <scai/logging.hpp>
+
+// std
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace scai
+{
+
+namespace lama
+{
+
+/**
+ * @brief Structure statistics of a sparse matrix that are cheap to compute.
+ *
+ * The statistics are computed for the local parts of a distributed matrix and
+ * reduced over all processors, so all processors have the same values.
+ */
+struct COMMON_DLL_IMPORTEXPORT MatrixStructure
+{
+    IndexType numRows;          //!< global number of rows
+    IndexType numColumns;       //!< global number of columns
+    IndexType numValues;        //!< number of non-zero entries of all local parts
+    IndexType numEmptyRows;     //!< number of rows without any local entry
+    IndexType maxRowLength;     //!< maximal number of local entries in one row
+    double rowLengthVariance;   //!< variance of the number of local entries per row
+    IndexType numDiagonals;     //!< maximal number of used diagonals of a local part
+    IndexType bandwidth;        //!< maximal distance of an entry from the diagonal
+    IndexType numProcessors;    //!< number of processors onto which the matrix is distributed
+    common::ScalarType valueType;
+
+    /** Average number of entries per row. */
+
+    double avgRowLength() const;
+
+    /** Ratio of non-zero entries in the used diagonals, 1.0 for a perfectly banded matrix. */
+
+    double diagonalOccupancy() const;
+
+    /** Ratio of allocated entries in ELL format to the non-zero entries, 1.0 if all rows have same length. */
+
+    double ellFillRatio() const;
+
+    /**
+     *  @brief Fingerprint of the structure used as key for the persistent cache of tuning decisions.
+     *
+     *  Matrices with the same fingerprint have the same size, the same number of entries
+     *  and the same row-length and diagonal profile.
+     */
+    std::string fingerprint() const;
+
+    void writeAt( std::ostream& stream ) const;
+};
+
+COMMON_DLL_IMPORTEXPORT std::ostream& operator<<( std::ostream& stream, const MatrixStructure& structure );
+
+/**
+ * @brief Result of tuning, i.e. the format and the number of threads that should be used.
+ */
+struct COMMON_DLL_IMPORTEXPORT TuningDecision
+{
+    Format format;      //!< selected storage format for local and halo part
+    int numThreads;     //!< number of OpenMP threads, 0 if the thread count has not been tuned
+    double time;        //!< measured time for one SpMV, 0 if no timing has been done
+    bool fromCache;     //!< true if the decision has been taken from the cache
+};
+
+/**
+ * @brief StorageTuner selects the storage format of a sparse matrix.
+ *
+ * By default the selection is based on structure statistics only:
+ *
+ *  - DIA for matrices where the used diagonals are mostly filled
+ *  - ELL for matrices where all rows have nearly the same length
+ *  - CSR otherwise
+ *
+ * If timing is enabled, some matrix-vector multiplications are timed for each
+ * candidate format and each candidate thread count and the fastest one is taken.
+ * As timing is expensive, timed decisions are cached by the fingerprint of the matrix
+ * structure in a file that is given by setCacheFile or by the environment variable
+ * SCAI_TUNING_CACHE.
+ *
+ * \code
+ *     StorageTuner<double> tuner;
+ *     tuner.setTiming( true );
+ *     auto tunedA = tuner.tune( a );    // tunedA has local and halo storage in the selected format
+ * \endcode
+ *
+ * The tuning is collective and all processors take the same decision.
+ */
+template<typename ValueType>
+class COMMON_DLL_IMPORTEXPORT StorageTuner
+{
+public:
+
+    StorageTuner();
+
+    ~StorageTuner();
+
+    /** Enable or disable the timing of the candidate formats. */
+
+    void setTiming( const bool flag );
+
+    /** Set the number of matrix-vector multiplications that are timed for each candidate. */
+
+    void setNumIterations( const IndexType numIterations );
+
+    /** Set the candidate formats for timing, formats not registered for ValueType are ignored. */
+
+    void setFormats( const std::vector<Format>& formats );
+
+    /** Set the candidate thread counts for timing, empty for the current number of threads. */
+
+    void setThreadCounts( const std::vector<int>& threadCounts );
+
+    /** Set the file for the persistent cache of timed decisions, empty string disables the cache. */
+
+    void setCacheFile( const std::string& fileName );
+
+    /** Compute the structure statistics of a sparse matrix. */
+
+    static MatrixStructure getStructure( const SparseMatrix<ValueType>& matrix );
+
+    /** Select the format only by structure statistics. */
+
+    static Format selectFormat( const MatrixStructure& structure );
+
+    /** Take the tuning decision for a matrix, might be taken from the cache. */
+
+    TuningDecision decide( const SparseMatrix<ValueType>& matrix ) const;
+
+    /**
+     *  @brief Apply a tuning decision, returns a new matrix with local and halo storage in the selected format.
+     *
+     *  If the decision contains a number of threads, it is set for all following OpenMP regions.
+     */
+    static std::unique_ptr<SparseMatrix<ValueType> > apply( const TuningDecision& decision, const SparseMatrix<ValueType>& matrix );
+
+    /** Take the tuning decision for a matrix and apply it. */
+
+    std::unique_ptr<SparseMatrix<ValueType> > tune( const SparseMatrix<ValueType>& matrix ) const;
+
+protected:
+
+    SCAI_LOG_DECL_STATIC_LOGGER( logger )
+
+private:
+
+    /** Time the candidates, the fastest one is returned. */
+
+    TuningDecision timeCandidates( const SparseMatrix<ValueType>& matrix, const MatrixStructure& structure ) const;
+
+    /** Time matrix-vector multiplications, returns max time of all processors for one SpMV */
+
+    double timeSpMV( const SparseMatrix<ValueType>& matrix ) const;
+
+    /** Read decision for a fingerprint from the cache file, returns false if not available */
+
+    bool readCache( TuningDecision& decision, const std::string& fingerprint, const dmemo::Communicator& comm ) const;
+
+    /** Append a decision to the cache file, only done by the first processor */
+
+    void writeCache( const TuningDecision& decision, const std::string& fingerprint, const dmemo::Communicator& comm ) const;
+
+    bool mTiming;                     //!< if true candidates are timed
+
+    IndexType mNumIterations;         //!< number of SpMVs timed for each candidate
+
+    std::vector<Format> mFormats;     //!< candidate formats for timing
+
+    std::vector<int> mThreadCounts;   //!< candidate thread counts for timing
+
+    std::string mCacheFile;           //!< file name for persistent cache, empty if disabled
+};
+
+} /* end namespace lama */
+
+} /* end namespace scai */
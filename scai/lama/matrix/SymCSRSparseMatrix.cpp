@@ -0,0 +1,271 @@
+/**
+ * @file SymCSRSparseMatrix.cpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Implementation of methods and constructors for template class SymCSRSparseMatrix.
+ * @author Thomas Brandes
+ * @date 04.08.2012
+ */
+
+// hpp
+#include <scai/lama/matrix/SymCSRSparseMatrix.hpp>
+
+#include <scai/common/macros/print_string.hpp>
+#include <scai/common/macros/instantiate.hpp>
+
+#include <memory>
+
+using std::shared_ptr;
+
+namespace scai
+{
+
+using namespace dmemo;
+
+namespace lama
+{
+
+/* -------------------------------------------------------------------------- */
+
+SCAI_LOG_DEF_TEMPLATE_LOGGER( template<typename ValueType>, SymCSRSparseMatrix<ValueType>::logger,
+                              "Matrix.SparseMatrix.SymCSRSparseMatrix" )
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+std::shared_ptr<SymCSRStorage<ValueType> > SymCSRSparseMatrix<ValueType>::createStorage( hmemo::ContextPtr ctx )
+{
+    return shared_ptr<SymCSRStorage<ValueType> >( new StorageType( ctx ) );
+}
+
+template<typename ValueType>
+std::shared_ptr<SymCSRStorage<ValueType> > SymCSRSparseMatrix<ValueType>::createStorage( SymCSRStorage<ValueType>&& storage )
+{
+    return shared_ptr<SymCSRStorage<ValueType> >( new SymCSRStorage<ValueType>( std::move( storage ) ) );
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+SymCSRSparseMatrix<ValueType>::SymCSRSparseMatrix( hmemo::ContextPtr ctx ) : 
+
+    SparseMatrix<ValueType>( createStorage( ctx ) )
+
+{
+    SCAI_LOG_INFO( logger, "SymCSRSparseMatrix()" )
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+SymCSRSparseMatrix<ValueType>::SymCSRSparseMatrix( const SymCSRSparseMatrix& other ) : 
+
+    SparseMatrix<ValueType>( createStorage( other.getContextPtr() ) )
+
+{
+    this->setCommunicationKind( other.getCommunicationKind() );
+    SparseMatrix<ValueType>::assign( other );
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+SymCSRSparseMatrix<ValueType>::SymCSRSparseMatrix( SymCSRSparseMatrix&& other ) noexcept :
+
+    SparseMatrix<ValueType>( createStorage( other.getContextPtr() ) )
+{
+    SparseMatrix<ValueType>::operator=( std::move( other ) );
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+SymCSRSparseMatrix<ValueType>&  SymCSRSparseMatrix<ValueType>::operator=( SymCSRSparseMatrix&& other ) 
+{
+    SparseMatrix<ValueType>::operator=( std::move( other ) );
+    return *this;
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+SymCSRSparseMatrix<ValueType>::SymCSRSparseMatrix( const Matrix<ValueType>& other ) : 
+
+    SparseMatrix<ValueType>( createStorage( other.getContextPtr() ) )
+
+{
+    this->setContextPtr( other.getContextPtr() );
+    this->setCommunicationKind( other.getCommunicationKind() );
+
+    SparseMatrix<ValueType>::assign( other );
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+SymCSRSparseMatrix<ValueType>::SymCSRSparseMatrix( SymCSRStorage<ValueType> globalStorage ) : 
+
+    SparseMatrix<ValueType>( createStorage( std::move( globalStorage ) ) )
+
+{
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+SymCSRSparseMatrix<ValueType>::SymCSRSparseMatrix( DistributionPtr rowDist, SymCSRStorage<ValueType> localStorage ) :
+
+    SparseMatrix<ValueType>( rowDist, createStorage( std::move( localStorage ) ) )
+{
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+SymCSRSparseMatrix<ValueType>::~SymCSRSparseMatrix()
+{
+    SCAI_LOG_INFO( logger, "~SymCSRSpareMatrix" )
+}
+
+/* ---------------------------------------------------------------------------------------*/
+
+template<typename ValueType>
+SymCSRSparseMatrix<ValueType>& SymCSRSparseMatrix<ValueType>::operator=( const SymCSRSparseMatrix& matrix )
+{
+    SCAI_LOG_INFO( logger, "SymCSRSparseMatrix = SymCSRSparseMatrix : " << matrix )
+    this->assign( matrix );
+    return *this;
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+const typename SymCSRSparseMatrix<ValueType>::StorageType&
+SymCSRSparseMatrix<ValueType>::getLocalStorage() const
+{
+    // here we need a dynamic cast as for any stupid reasons somebody
+    // has modified the underlying storage type
+    const StorageType* local = dynamic_cast<const StorageType*>( this->mLocalData.get() );
+    SCAI_ASSERT_ERROR( local, "SymCSRSparseMatrix: local storage is no more SymCSR: " << *this->mLocalData )
+    return *local;
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+typename SymCSRSparseMatrix<ValueType>::StorageType&
+SymCSRSparseMatrix<ValueType>::getLocalStorage()
+{
+    // here we need a dynamic cast as for any stupid reasons somebody
+    // has modified the underlying storage type
+    StorageType* local = dynamic_cast<StorageType*>( this->mLocalData.get() );
+    SCAI_ASSERT_ERROR( local, "SymCSRSparseMatrix: local storage is no more SymCSR: " << *this->mLocalData )
+    return *local;
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+const typename SymCSRSparseMatrix<ValueType>::StorageType&
+SymCSRSparseMatrix<ValueType>::getHaloStorage() const
+{
+    // here we need a dynamic cast as for any stupid reasons somebody
+    // has modified the underlying storage type
+    const StorageType* halo = dynamic_cast<const StorageType*>( mHaloData.get() );
+    SCAI_ASSERT_ERROR( halo, "SymCSRSparseMatrix: halo storage is no more SymCSR: " << *mHaloData )
+    return *halo;
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+SymCSRSparseMatrix<ValueType>* SymCSRSparseMatrix<ValueType>::newMatrix() const
+{
+    std::unique_ptr<SymCSRSparseMatrix<ValueType> > newSparseMatrix( new SymCSRSparseMatrix<ValueType>() );
+    // inherit the context, communication kind of this matrix for the new matrix
+    newSparseMatrix->setContextPtr( this->getContextPtr() );
+    newSparseMatrix->setCommunicationKind( this->getCommunicationKind() );
+    newSparseMatrix->allocate( getRowDistributionPtr(), getColDistributionPtr() );
+    SCAI_LOG_INFO( logger,
+                   *this << ": create -> " << *newSparseMatrix << " @ " << * ( newSparseMatrix->getContextPtr() )
+                   << ", kind = " << newSparseMatrix->getCommunicationKind() );
+    return newSparseMatrix.release();
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+SymCSRSparseMatrix<ValueType>* SymCSRSparseMatrix<ValueType>::copy() const
+{
+    SCAI_LOG_INFO( logger, "copy of " << *this )
+    SymCSRSparseMatrix<ValueType>* newSparseMatrix = new SymCSRSparseMatrix<ValueType>( *this );
+    SCAI_LOG_INFO( logger, "copy is " << *newSparseMatrix )
+    return newSparseMatrix;
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+const char* SymCSRSparseMatrix<ValueType>::getTypeName() const
+{
+    return typeName();
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+_Matrix* SymCSRSparseMatrix<ValueType>::create()
+{
+    return new SymCSRSparseMatrix<ValueType>();
+}
+
+template<typename ValueType>
+MatrixCreateKeyType SymCSRSparseMatrix<ValueType>::createValue()
+{
+    return MatrixCreateKeyType( Format::SYMCSR, common::getScalarType<ValueType>() );
+}
+
+template<typename ValueType>
+std::string SymCSRSparseMatrix<ValueType>::initTypeName()
+{
+    std::stringstream s;
+    s << std::string( "SymCSRSparseMatrix<" ) << common::getScalarType<ValueType>() << std::string( ">" );
+    return s.str();
+}
+
+template<typename ValueType>
+const char* SymCSRSparseMatrix<ValueType>::typeName()
+{
+    static const std::string s = initTypeName();
+    return  s.c_str();
+}
+
+/* ========================================================================= */
+/*       Template specializations and nstantiations                          */
+/* ========================================================================= */
+
+SCAI_COMMON_INST_CLASS( SymCSRSparseMatrix, SCAI_NUMERIC_TYPES_HOST )
+
+} /* end namespace lama */
+
+} /* end namespace scai */
@@ -34,3 +34,5 @@
 #include <scai/lama/matrix/DIASparseMatrix.hpp>
 #include <scai/lama/matrix/JDSSparseMatrix.hpp>
 #include <scai/lama/matrix/COOSparseMatrix.hpp>
+#include <scai/lama/matrix/BSRSparseMatrix.hpp>
+#include <scai/lama/matrix/SymCSRSparseMatrix.hpp>
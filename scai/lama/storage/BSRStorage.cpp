@@ -0,0 +1,1310 @@
+/**
+ * @file BSRStorage.cpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Implementation and instantiation for template class BSRStorage.
+ * @author Thomas Brandes
+ * @date 19.10.2026
+ */
+
+// hpp
+#include <scai/lama/storage/BSRStorage.hpp>
+#include <scai/lama/storage/CSRStorage.hpp>
+
+// internal scai libraries
+#include <scai/sparsekernel/CSRUtils.hpp>
+#include <scai/sparsekernel/BSRUtils.hpp>
+
+#include <scai/utilskernel/HArrayUtils.hpp>
+#include <scai/utilskernel/TransferUtils.hpp>
+#include <scai/utilskernel/freeFunction.hpp>
+
+#include <scai/hmemo/ContextAccess.hpp>
+
+#include <scai/tasking/NoSyncToken.hpp>
+
+#include <scai/tracing.hpp>
+
+#include <scai/common/macros/print_string.hpp>
+#include <scai/common/Constants.hpp>
+#include <scai/common/TypeTraits.hpp>
+#include <scai/common/Math.hpp>
+#include <scai/common/macros/instantiate.hpp>
+
+#include <algorithm>
+#include <memory>
+
+using namespace scai::hmemo;
+
+namespace scai
+{
+
+using tasking::SyncToken;
+
+using utilskernel::HArrayUtils;
+using utilskernel::TransferUtils;
+
+using sparsekernel::CSRUtils;
+using sparsekernel::BSRUtils;
+
+using common::BinaryOp;
+
+namespace lama
+{
+
+/* --------------------------------------------------------------------------- */
+
+SCAI_LOG_DEF_TEMPLATE_LOGGER( template<typename ValueType>, BSRStorage<ValueType>::logger, "MatrixStorage.BSRStorage" )
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+BSRStorage<ValueType>::BSRStorage( ContextPtr ctx ) :
+
+    MatrixStorage<ValueType>( 0, 0, ctx ),
+    mBlockSize( 1 ),
+    mIA( 1, IndexType( 0 ), ctx ),
+    mJA( ctx ),
+    mValues( ctx ),
+    mInvDiagonal( ctx )
+{
+    SCAI_LOG_DEBUG( logger, "BSRStorage( 0 x 0 ) @ " << *ctx )
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+BSRStorage<ValueType>::BSRStorage( IndexType numRows, IndexType numColumns, ContextPtr ctx ) :
+
+    MatrixStorage<ValueType>( numRows, numColumns, ctx ),
+    mBlockSize( 1 ),
+    mIA( numRows + 1, IndexType( 0 ), ctx ),
+    mJA( ctx ),
+    mValues( ctx ),
+    mInvDiagonal( ctx )
+{
+    SCAI_LOG_DEBUG( logger, "BSRStorage( " << getNumRows() << " x " << getNumColumns() << " @ " << *ctx )
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+BSRStorage<ValueType>::BSRStorage(
+    const IndexType numRows,
+    const IndexType numColumns,
+    const IndexType blockSize,
+    HArray<IndexType> ia,
+    HArray<IndexType> ja,
+    HArray<ValueType> values,
+    ContextPtr ctx ) :
+
+    MatrixStorage<ValueType>( numRows, numColumns, ctx ),
+    mBlockSize( blockSize ),
+    mIA( std::move( ia ) ),
+    mJA( std::move( ja ) ),
+    mValues( std::move( values ) ),
+    mInvDiagonal( ctx )
+{
+    SCAI_ASSERT_GT_ERROR( blockSize, 0, "illegal block size for BSR storage" )
+
+    check( "BSRStorage( numRows, numColumns, blockSize, ia, ja, values )" );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+BSRStorage<ValueType>::BSRStorage( const BSRStorage<ValueType>& other ) :
+
+    MatrixStorage<ValueType>( other ),
+
+    mBlockSize( other.mBlockSize ),
+    mIA( other.mIA ),
+    mJA( other.mJA ),
+    mValues( other.mValues ),
+    mInvDiagonal( other.getContextPtr() )
+{
+    SCAI_LOG_INFO( logger, "copied BSRStorage other = " << other << ", this = " << *this )
+}
+
+/* ------------------------------------------------------------------------------------------------------------------ */
+
+template<typename ValueType>
+BSRStorage<ValueType>::BSRStorage( BSRStorage<ValueType>&& other ) noexcept :
+
+    MatrixStorage<ValueType>( std::move( other ) ),
+
+    mBlockSize( other.mBlockSize ),
+    mIA( std::move( other.mIA ) ),
+    mJA( std::move( other.mJA ) ),
+    mValues( std::move( other.mValues ) ),
+    mInvDiagonal( std::move( other.mInvDiagonal ) )
+{
+    // no further checks as we assume other to be a consistent and valid input BSR storage
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+BSRStorage<ValueType>& BSRStorage<ValueType>::operator=( const BSRStorage<ValueType>& other )
+{
+    assignBSR( other );
+    return *this;
+}
+
+template<typename ValueType>
+BSRStorage<ValueType>& BSRStorage<ValueType>::operator=( BSRStorage<ValueType>&& other )
+{
+    // call of move assignment for base class
+
+    MatrixStorage<ValueType>::moveImpl( std::move( other ) );
+
+    mBlockSize   = other.mBlockSize;
+    mIA          = std::move( other.mIA );
+    mJA          = std::move( other.mJA );
+    mValues      = std::move( other.mValues );
+    mInvDiagonal = std::move( other.mInvDiagonal );
+
+    return *this;
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::assign( const _MatrixStorage& other )
+{
+    // translate virtual call to specific template call via wrapper
+
+    mepr::StorageWrapper<BSRStorage, SCAI_NUMERIC_TYPES_HOST_LIST>::assignImpl( this, other );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+template<typename OtherValueType>
+void BSRStorage<ValueType>::assignImpl( const MatrixStorage<OtherValueType>& other )
+{
+    if ( other.getFormat() == Format::BSR )
+    {
+        // same format conversion, more efficient solution available
+
+        assignBSR( static_cast<const BSRStorage<OtherValueType> & >( other ) );
+    }
+    else if ( other.getFormat() == Format::CSR )
+    {
+        const auto& otherCSR = static_cast<const CSRStorage<OtherValueType> & >( other );
+
+        setCSRData( otherCSR.getNumRows(), otherCSR.getNumColumns(),
+                    otherCSR.getIA(), otherCSR.getJA(), otherCSR.getValues() );
+
+        SCAI_LOG_INFO( logger, "assignImpl: other CSR = " << other )
+    }
+    else
+    {
+        HArray<IndexType>  csrIA;
+        HArray<IndexType>  csrJA;
+        HArray<ValueType>  csrValues;
+
+        other.buildCSRData( csrIA, csrJA, csrValues );
+
+        setCSRDataImpl( other.getNumRows(), other.getNumColumns(), csrIA, csrJA, csrValues );
+
+        SCAI_LOG_INFO( logger, "assignImpl: other = " << other << " -> tmpCSR, this = " << *this )
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+template<typename OtherValueType>
+void BSRStorage<ValueType>::assignBSR( const BSRStorage<OtherValueType>& other )
+{
+    if ( static_cast<const _MatrixStorage*>( &other ) == this )
+    {
+        SCAI_LOG_DEBUG( logger, typeName() << ": self assign, skipped, storage = " << other )
+        return;
+    }
+
+    auto ctx = getContextPtr();
+
+    // both storage have BSR format, we can just copy the corresponding arrays to the right context
+
+    _MatrixStorage::_assign( other );     // assign member variables of base class
+
+    mBlockSize = other.getBlockSize();
+
+    HArrayUtils::assign( mIA, other.getIA(), ctx );
+    HArrayUtils::assign( mJA, other.getJA(), ctx );
+    HArrayUtils::assign( mValues, other.getValues(), ctx );
+
+    mInvDiagonal.clear();
+
+    SCAI_LOG_DEBUG( logger, "assignBSR: other = " << other << ", this = " << *this )
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+IndexType BSRStorage<ValueType>::getBlockSize() const
+{
+    return mBlockSize;
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+IndexType BSRStorage<ValueType>::getNumBlockRows() const
+{
+    return ( getNumRows() + mBlockSize - 1 ) / mBlockSize;
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+IndexType BSRStorage<ValueType>::getNumBlocks() const
+{
+    return mJA.size();
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::setBlockSize( const IndexType blockSize )
+{
+    SCAI_ASSERT_GT_ERROR( blockSize, 0, "illegal block size for BSR storage" )
+
+    if ( blockSize == mBlockSize )
+    {
+        return;
+    }
+
+    SCAI_LOG_INFO( logger, *this << ": set block size " << blockSize )
+
+    if ( mJA.size() == 0 )
+    {
+        mBlockSize = blockSize;
+        setEmptyBlocks();
+        return;
+    }
+
+    // convert via CSR data, as blocks might be split or joined
+
+    HArray<IndexType> csrIA;
+    HArray<IndexType> csrJA;
+    HArray<ValueType> csrValues;
+
+    buildCSRData( csrIA, csrJA, csrValues );
+
+    mBlockSize = blockSize;
+
+    setCSRDataImpl( getNumRows(), getNumColumns(), csrIA, csrJA, csrValues );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::setEmptyBlocks()
+{
+    HArrayUtils::setSameValue( mIA, getNumBlockRows() + 1, IndexType( 0 ), getContextPtr() );
+    mJA.clear();
+    mValues.clear();
+    mInvDiagonal.clear();
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::print( std::ostream& stream ) const
+{
+    using std::endl;
+
+    const IndexType b  = mBlockSize;
+    const IndexType bb = b * b;
+
+    stream << "BSRStorage " << getNumRows() << " x " << getNumColumns()
+           << ", block size = " << b << ", #blocks = " << mJA.size() << endl;
+
+    auto ia = hostReadAccess( mIA );
+    auto ja = hostReadAccess( mJA );
+    auto values = hostReadAccess( mValues );
+
+    for ( IndexType ib = 0; ib < getNumBlockRows(); ib++ )
+    {
+        for ( IndexType k = ia[ib]; k < ia[ib + 1]; ++k )
+        {
+            stream << "Block ( " << ib << ", " << ja[k] << " ) :";
+
+            for ( IndexType r = 0; r < bb; ++r )
+            {
+                stream << " " << values[k * bb + r];
+            }
+
+            stream << endl;
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::clear()
+{
+    _MatrixStorage::setDimension( 0, 0 );
+
+    setEmptyBlocks();
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+Format BSRStorage<ValueType>::getFormat() const
+{
+    return Format::BSR;
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::getRow( HArray<ValueType>& row, const IndexType i ) const
+{
+    SCAI_REGION( "Storage.BSR.getDenseRow" )
+
+    HArray<IndexType> colIndexes;   // column indexes that have entry for row i
+    HArray<ValueType> rowValues;    // contains the values of entries belonging to row i
+
+    getSparseRow( colIndexes, rowValues, i );
+
+    HArrayUtils::buildDenseArray( row, getNumColumns(), rowValues, colIndexes, ValueType( 0 ) );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::getSparseRow(
+    hmemo::HArray<IndexType>& jA,
+    hmemo::HArray<ValueType>& values,
+    const IndexType i ) const
+{
+    SCAI_REGION( "Storage.BSR.getSparseRow" )
+
+    SCAI_ASSERT_VALID_INDEX_DEBUG( i, getNumRows(), "row index out of range" )
+
+    ContextPtr loc = Context::getHostPtr();  // only on host here
+
+    HArray<IndexType> positions;     // positions in the values array
+
+    BSRUtils::getRowPositions( jA, positions, i, getNumColumns(), mBlockSize, mIA, mJA, getContextPtr() );
+
+    HArrayUtils::gather( values, mValues, positions, BinaryOp::COPY, loc );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::getSparseColumn(
+    hmemo::HArray<IndexType>& iA,
+    hmemo::HArray<ValueType>& values,
+    const IndexType j ) const
+{
+    SCAI_REGION( "Storage.BSR.getSparseCol" )
+
+    SCAI_ASSERT_VALID_INDEX_DEBUG( j, getNumColumns(), "col index out of range" )
+
+    ContextPtr loc = Context::getHostPtr();  // only on host here
+
+    HArray<IndexType> positions;     // positions in the values array
+
+    BSRUtils::getColPositions( iA, positions, j, getNumRows(), mBlockSize, mIA, mJA, getContextPtr() );
+
+    HArrayUtils::gather( values, mValues, positions, BinaryOp::COPY, loc );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::setRow( const HArray<ValueType>& row, const IndexType i, const BinaryOp op )
+{
+    SCAI_ASSERT_VALID_INDEX_DEBUG( i, getNumRows(), "row index out of range" )
+    SCAI_ASSERT_GE_DEBUG( row.size(), getNumColumns(), "row array to small for set" )
+
+    HArray<IndexType> ja;          // available indexes of the row
+    HArray<IndexType> positions;   // positions in the values array
+
+    BSRUtils::getRowPositions( ja, positions, i, getNumColumns(), mBlockSize, mIA, mJA, getContextPtr() );
+
+    // for each k :  values[positions[k]] op= row[ja[k]]
+
+    if ( op == BinaryOp::COPY )
+    {
+        TransferUtils::copy( mValues, positions, row, ja );
+    }
+    else
+    {
+        HArray<ValueType> sparseRow;  // gather entries of row that can be set
+
+        HArrayUtils::gather( sparseRow, row, ja, BinaryOp::COPY, getContextPtr() );
+        HArrayUtils::scatter( mValues, positions, true, sparseRow, op, getContextPtr() );
+    }
+
+    mInvDiagonal.clear();
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::getColumn( HArray<ValueType>& column, const IndexType j ) const
+{
+    SCAI_REGION( "Storage.BSR.getDenseCol" )
+
+    HArray<IndexType> rowIndexes;   // row indexes that have entry for column j
+    HArray<ValueType> colValues;    // contains the values of entries belonging to column j
+
+    getSparseColumn( rowIndexes, colValues, j );
+
+    HArrayUtils::buildDenseArray( column, getNumRows(), colValues, rowIndexes, ValueType( 0 ) );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::setColumn( const HArray<ValueType>& column, const IndexType j, const BinaryOp op )
+{
+    SCAI_ASSERT_VALID_INDEX_DEBUG( j, getNumColumns(), "column index out of range" )
+
+    HArray<IndexType> ia;          // available indexes of the columns
+    HArray<IndexType> positions;   // positions in the values array
+
+    BSRUtils::getColPositions( ia, positions, j, getNumRows(), mBlockSize, mIA, mJA, getContextPtr() );
+
+    // for each k :  values[positions[k]] op= column[ia[k]]
+
+    if ( op == BinaryOp::COPY )
+    {
+        TransferUtils::copy( mValues, positions, column, ia );
+    }
+    else
+    {
+        HArray<ValueType> sparseCol;  // gather entries of column that can be set
+
+        HArrayUtils::gather( sparseCol, column, ia, BinaryOp::COPY, getContextPtr() );
+        HArrayUtils::scatter( mValues, positions, true, sparseCol, op, getContextPtr() );
+    }
+
+    mInvDiagonal.clear();
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+IndexType BSRStorage<ValueType>::getDiagonalPositions( HArray<IndexType>& positions ) const
+{
+    const IndexType n  = std::min( getNumRows(), getNumColumns() );
+    const IndexType b  = mBlockSize;
+    const IndexType bb = b * b;
+
+    auto ia = hostReadAccess( mIA );
+    auto ja = hostReadAccess( mJA );
+
+    auto wPositions = hostWriteOnlyAccess( positions, n );
+
+    IndexType numMissing = 0;
+
+    #pragma omp parallel for reduction( + : numMissing )
+
+    for ( IndexType i = 0; i < n; ++i )
+    {
+        const IndexType ib = i / b;
+        const IndexType r  = i % b;
+
+        // block column indexes are sorted, so binary search for diagonal block
+
+        const IndexType* first = ja.get() + ia[ib];
+        const IndexType* last  = ja.get() + ia[ib + 1];
+        const IndexType* pos   = std::lower_bound( first, last, ib );
+
+        if ( pos != last && *pos == ib )
+        {
+            wPositions[i] = static_cast<IndexType>( pos - ja.get() ) * bb + r * b + r;
+        }
+        else
+        {
+            wPositions[i] = invalidIndex;
+            numMissing++;
+        }
+    }
+
+    return numMissing;
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::getDiagonal( HArray<ValueType>& diagonal ) const
+{
+    SCAI_REGION( "Storage.BSR.getDiagonal" )
+
+    HArray<IndexType> positions;
+
+    getDiagonalPositions( positions );
+
+    const IndexType n = positions.size();
+
+    auto rPositions = hostReadAccess( positions );
+    auto rValues    = hostReadAccess( mValues );
+    auto wDiagonal  = hostWriteOnlyAccess( diagonal, n );
+
+    #pragma omp parallel for
+
+    for ( IndexType i = 0; i < n; ++i )
+    {
+        wDiagonal[i] = rPositions[i] == invalidIndex ? ValueType( 0 ) : rValues[rPositions[i]];
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::setDiagonalV( const HArray<ValueType>& diagonal )
+{
+    SCAI_REGION( "Storage.BSR.setDiagonalV" )
+
+    HArray<IndexType> positions;
+
+    IndexType numMissing = getDiagonalPositions( positions );
+
+    SCAI_ASSERT_EQ_ERROR( numMissing, 0, "BSR storage has " << numMissing << " missing diagonal elements" )
+    SCAI_ASSERT_GE_ERROR( diagonal.size(), positions.size(), "diagonal array too small" )
+
+    HArrayUtils::scatter( mValues, positions, true, diagonal, BinaryOp::COPY, Context::getHostPtr() );
+
+    mInvDiagonal.clear();
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::setDiagonal( const ValueType value )
+{
+    HArray<ValueType> diagonal;
+
+    HArrayUtils::setSameValue( diagonal, std::min( getNumRows(), getNumColumns() ), value, getContextPtr() );
+
+    setDiagonalV( diagonal );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::scale( const ValueType value )
+{
+    HArrayUtils::compute( mValues, mValues, BinaryOp::MULT, value, this->getContextPtr() );
+
+    mInvDiagonal.clear();
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::conj()
+{
+    HArrayUtils::unaryOp( mValues, mValues, common::UnaryOp::CONJ, this->getContextPtr() );
+
+    mInvDiagonal.clear();
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::scaleRows( const HArray<ValueType>& diagonal )
+{
+    SCAI_REGION( "Storage.BSR.scaleRows" )
+
+    SCAI_ASSERT_GE_ERROR( diagonal.size(), getNumRows(), "diagonal array too small for scaling rows" )
+
+    const IndexType numRows = getNumRows();
+    const IndexType b  = mBlockSize;
+    const IndexType bb = b * b;
+
+    auto ia        = hostReadAccess( mIA );
+    auto rDiagonal = hostReadAccess( diagonal );
+    auto values    = hostWriteAccess( mValues );
+
+    #pragma omp parallel for
+
+    for ( IndexType ib = 0; ib < getNumBlockRows(); ++ib )
+    {
+        for ( IndexType k = ia[ib]; k < ia[ib + 1]; ++k )
+        {
+            for ( IndexType r = 0; r < b; ++r )
+            {
+                const IndexType i = ib * b + r;
+
+                if ( i >= numRows )
+                {
+                    break;
+                }
+
+                for ( IndexType c = 0; c < b; ++c )
+                {
+                    values[k * bb + r * b + c] *= rDiagonal[i];
+                }
+            }
+        }
+    }
+
+    mInvDiagonal.clear();
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::scaleColumns( const HArray<ValueType>& diagonal )
+{
+    SCAI_REGION( "Storage.BSR.scaleColumns" )
+
+    SCAI_ASSERT_GE_ERROR( diagonal.size(), getNumColumns(), "diagonal array too small for scaling columns" )
+
+    const IndexType numColumns = getNumColumns();
+    const IndexType b  = mBlockSize;
+    const IndexType bb = b * b;
+
+    auto ia        = hostReadAccess( mIA );
+    auto ja        = hostReadAccess( mJA );
+    auto rDiagonal = hostReadAccess( diagonal );
+    auto values    = hostWriteAccess( mValues );
+
+    #pragma omp parallel for
+
+    for ( IndexType ib = 0; ib < getNumBlockRows(); ++ib )
+    {
+        for ( IndexType k = ia[ib]; k < ia[ib + 1]; ++k )
+        {
+            for ( IndexType c = 0; c < b; ++c )
+            {
+                const IndexType j = ja[k] * b + c;
+
+                if ( j >= numColumns )
+                {
+                    break;
+                }
+
+                for ( IndexType r = 0; r < b; ++r )
+                {
+                    values[k * bb + r * b + c] *= rDiagonal[j];
+                }
+            }
+        }
+    }
+
+    mInvDiagonal.clear();
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::check( const char* msg ) const
+{
+    const IndexType bb = mBlockSize * mBlockSize;
+
+    SCAI_ASSERT_EQ_ERROR( getNumBlockRows() + 1, mIA.size(), msg << ": ia array in BSR storage has illegal size" )
+    SCAI_ASSERT_EQ_ERROR( mJA.size() * bb, mValues.size(), msg << ": values array in BSR storage has illegal size" )
+
+    SCAI_ASSERT_ERROR( CSRUtils::validOffsets( mIA, mJA.size(), getContextPtr() ),
+                       msg << ": illegal offset array ia in BSR storage" )
+
+    const IndexType numBlockColumns = ( getNumColumns() + mBlockSize - 1 ) / mBlockSize;
+
+    SCAI_ASSERT_ERROR( HArrayUtils::validIndexes( mJA, numBlockColumns, getContextPtr() ),
+                       msg << ": illegal block column indexes in BSR storage, #block columns = " << numBlockColumns )
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::setDiagonalBlocks( const HArray<ValueType>& diagonal )
+{
+    const IndexType size = diagonal.size();
+
+    _MatrixStorage::setDimension( size, size );
+
+    const IndexType b   = mBlockSize;
+    const IndexType bb  = b * b;
+    const IndexType nbr = getNumBlockRows();
+
+    HArrayUtils::setOrder( mIA, nbr + 1, getContextPtr() );
+    HArrayUtils::setOrder( mJA, nbr, getContextPtr() );
+
+    {
+        auto rDiagonal = hostReadAccess( diagonal );
+        auto values    = hostWriteOnlyAccess( mValues, nbr * bb );
+
+        #pragma omp parallel for
+
+        for ( IndexType ib = 0; ib < nbr; ++ib )
+        {
+            for ( IndexType r = 0; r < bb; ++r )
+            {
+                values[ib * bb + r] = ValueType( 0 );
+            }
+
+            for ( IndexType r = 0; r < b && ib * b + r < size; ++r )
+            {
+                values[ib * bb + r * b + r] = rDiagonal[ib * b + r];
+            }
+        }
+    }
+
+    mInvDiagonal.clear();
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::setIdentity( const IndexType size )
+{
+    SCAI_LOG_DEBUG( logger, "set identity, size = " << size )
+
+    HArray<ValueType> diagonal;
+
+    HArrayUtils::setSameValue( diagonal, size, ValueType( 1 ), getContextPtr() );
+
+    setDiagonalBlocks( diagonal );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::assignDiagonal( const HArray<ValueType>& diagonal )
+{
+    setDiagonalBlocks( diagonal );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::buildCSRSizes( hmemo::HArray<IndexType>& ia ) const
+{
+    BSRUtils::getCSRSizes( ia, getNumRows(), getNumColumns(), mBlockSize, mIA, mJA, getContextPtr() );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::buildCSRData(
+    hmemo::HArray<IndexType>& csrIA,
+    hmemo::HArray<IndexType>& csrJA,
+    hmemo::_HArray& csrValues ) const
+{
+    if ( csrValues.getValueType() == getValueType() )
+    {
+        HArray<ValueType>& typedCSRValues = static_cast<HArray<ValueType>&>( csrValues );
+
+        BSRUtils::convertBSR2CSR( csrIA, csrJA, typedCSRValues,
+                                  getNumRows(), getNumColumns(), mBlockSize, mIA, mJA, mValues, getContextPtr() );
+    }
+    else
+    {
+        HArray<ValueType> tmpValues;
+
+        BSRUtils::convertBSR2CSR( csrIA, csrJA, tmpValues,
+                                  getNumRows(), getNumColumns(), mBlockSize, mIA, mJA, mValues, getContextPtr() );
+
+        HArrayUtils::_assign( csrValues, tmpValues );
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::setCSRData(
+    const IndexType numRows,
+    const IndexType numColumns,
+    const HArray<IndexType>& ia,
+    const HArray<IndexType>& ja,
+    const _HArray& values )
+{
+    if ( values.getValueType() == getValueType() )
+    {
+        // call directly setCSRDataImpl, no conversion but cast
+
+        setCSRDataImpl( numRows, numColumns, ia, ja,
+                        static_cast<const HArray<ValueType>&>( values ) );
+    }
+    else
+    {
+        // call setCSRDataImpl with converted values
+
+        setCSRDataImpl( numRows, numColumns, ia, ja,
+                        utilskernel::convertHArray<ValueType>( values, getContextPtr() ) );
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::setCSRDataImpl(
+    const IndexType numRows,
+    const IndexType numColumns,
+    const HArray<IndexType>& ia,
+    const HArray<IndexType>& ja,
+    const HArray<ValueType>& values )
+{
+    SCAI_REGION( "Storage.BSR.setCSR" )
+
+    SCAI_LOG_INFO( logger, "setCSRData " << numRows << " x " << numColumns << ", block size = " << mBlockSize
+                            << ", ia = " << ia << ", ja = " << ja << ", values = " << values )
+
+    IndexType numValues = ja.size();
+
+    if ( ia.size() == numRows )
+    {
+        HArray<IndexType> tmpOffsets;
+        IndexType total = CSRUtils::sizes2offsets( tmpOffsets, ia, getContextPtr() );
+        SCAI_ASSERT_EQUAL( total, numValues, "sizes do not sum up correctly" )
+        setCSRDataImpl( numRows, numColumns, tmpOffsets, ja, values );
+        return;
+    }
+
+    SCAI_ASSERT_EQ_DEBUG( numRows + 1, ia.size(), "illegal CSR ia offset array" )
+    SCAI_ASSERT_EQ_DEBUG( ja.size(), values.size(), "serious size mismatch for CSR arrays." )
+
+    SCAI_ASSERT_DEBUG( CSRUtils::validOffsets( ia, numValues, getContextPtr() ), "illegal CSR offset array" );
+
+    SCAI_ASSERT_DEBUG( HArrayUtils::validIndexes( ja, numColumns, getContextPtr() ),
+                       "CSR ja array contains illegal column indexes, #columns = " << numColumns );
+
+    _MatrixStorage::setDimension( numRows, numColumns );
+
+    BSRUtils::convertCSR2BSR( mIA, mJA, mValues, numRows, numColumns, mBlockSize, ia, ja, values, getContextPtr() );
+
+    mInvDiagonal.clear();
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+BSRStorage<ValueType>::~BSRStorage()
+{
+    SCAI_LOG_DEBUG( logger,
+                    "~BSRStorage for matrix " << getNumRows() << " x " << getNumColumns() << ", # blocks = " << mJA.size() )
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::purge()
+{
+    _MatrixStorage::setDimension( 0, 0 );
+
+    mIA.purge();
+    mJA.purge();
+    mValues.purge();
+    mInvDiagonal.purge();
+
+    HArrayUtils::setSameValue( mIA, 1, IndexType( 0 ), getContextPtr() );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::allocate( IndexType numRows, IndexType numColumns )
+{
+    SCAI_LOG_INFO( logger, "allocate BSR sparse matrix of size " << numRows << " x " << numColumns )
+
+    _MatrixStorage::setDimension( numRows, numColumns );
+
+    setEmptyBlocks();
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::writeAt( std::ostream& stream ) const
+{
+    stream << "BSRStorage<" << common::getScalarType<ValueType>()
+           << ">( size = " << getNumRows() << " x " << getNumColumns()
+           << ", block size = " << mBlockSize << ", #blocks = " << getNumBlocks() << " )";
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+RealType<ValueType> BSRStorage<ValueType>::l1Norm() const
+{
+    SCAI_LOG_INFO( logger, *this << ": l1Norm()" )
+
+    // padded entries of the blocks are always zero
+
+    return HArrayUtils::l1Norm( mValues, getContextPtr() );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+RealType<ValueType> BSRStorage<ValueType>::l2Norm() const
+{
+    SCAI_LOG_INFO( logger, *this << ": l2Norm()" )
+
+    ValueType res = HArrayUtils::dotProduct( mValues, mValues, getContextPtr() );
+    return common::Math::sqrt( res );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+RealType<ValueType> BSRStorage<ValueType>::maxNorm() const
+{
+    SCAI_LOG_INFO( logger, *this << ": maxNorm()" )
+
+    return HArrayUtils::maxNorm( mValues, getContextPtr() );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+ValueType BSRStorage<ValueType>::getValue( const IndexType i, const IndexType j ) const
+{
+    SCAI_ASSERT_VALID_INDEX_DEBUG( i, getNumRows(), "row index out of range" )
+    SCAI_ASSERT_VALID_INDEX_DEBUG( j, getNumColumns(), "column index out of range" )
+
+    IndexType pos = BSRUtils::getValuePos( i, j, mBlockSize, mIA, mJA, getContextPtr() );
+
+    ValueType val = 0;
+
+    if ( pos != invalidIndex )
+    {
+        SCAI_ASSERT_VALID_INDEX_DEBUG( pos, mValues.size(), "illegal value position for ( " << i << ", " << j << " )" );
+
+        val = HArrayUtils::getVal<ValueType>( mValues, pos );
+    }
+
+    return val;
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::setValue( const IndexType i,
+                                      const IndexType j,
+                                      const ValueType val,
+                                      const BinaryOp op )
+{
+    SCAI_ASSERT_VALID_INDEX_DEBUG( i, getNumRows(), "row index out of range" )
+    SCAI_ASSERT_VALID_INDEX_DEBUG( j, getNumColumns(), "column index out of range" )
+
+    SCAI_LOG_TRACE( logger, "set value (" << i << ", " << j << ")" )
+
+    IndexType pos = BSRUtils::getValuePos( i, j, mBlockSize, mIA, mJA, getContextPtr() );
+
+    if ( pos == invalidIndex )
+    {
+        COMMON_THROWEXCEPTION( "BSR storage has no block for entry ( " << i << ", " << j << " ) " )
+    }
+
+    SCAI_ASSERT_VALID_INDEX_DEBUG( pos, mValues.size(), "illegal value position for ( " << i << ", " << j << " )" );
+
+    HArrayUtils::setVal( mValues, pos, val, op );
+
+    mInvDiagonal.clear();
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::prefetch( const ContextPtr location ) const
+{
+    mIA.prefetch( location );
+    mJA.prefetch( location );
+    mValues.prefetch( location );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+const HArray<IndexType>& BSRStorage<ValueType>::getIA() const
+{
+    return mIA;
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+const HArray<IndexType>& BSRStorage<ValueType>::getJA() const
+{
+    return mJA;
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+const HArray<ValueType>& BSRStorage<ValueType>::getValues() const
+{
+    return mValues;
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::wait() const
+{
+    mIA.wait();
+    mJA.wait();
+    mValues.wait();
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::swap( BSRStorage<ValueType>& other )
+{
+    // swap base class
+
+    MatrixStorage<ValueType>::swap( other );
+
+    // swap my member variables
+
+    std::swap( mBlockSize, other.mBlockSize );
+
+    mIA.swap( other.mIA );
+    mJA.swap( other.mJA );
+    mValues.swap( other.mValues );
+    mInvDiagonal.swap( other.mInvDiagonal );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+size_t BSRStorage<ValueType>::getMemoryUsage() const
+{
+    size_t memoryUsage = _MatrixStorage::_getMemoryUsage();
+
+    memoryUsage += sizeof( IndexType );
+    memoryUsage += sizeof( IndexType ) * mIA.size();
+    memoryUsage += sizeof( IndexType ) * mJA.size();
+    memoryUsage += sizeof( ValueType ) * mValues.size();
+    memoryUsage += sizeof( ValueType ) * mInvDiagonal.size();
+
+    return memoryUsage;
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::matrixTimesVector(
+    HArray<ValueType>& result,
+    const ValueType alpha,
+    const HArray<ValueType>& x,
+    const ValueType beta,
+    const HArray<ValueType>& y,
+    const common::MatrixOp op ) const
+{
+    bool async = false; // synchronously execution, no SyncToken required
+    SyncToken* token = gemv( result, alpha, x, beta, y, op, async );
+    SCAI_ASSERT( token == NULL, "There should be no sync token for synchronous execution" )
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+SyncToken* BSRStorage<ValueType>::gemv(
+    HArray<ValueType>& result,
+    const ValueType alpha,
+    const HArray<ValueType>& x,
+    const ValueType beta,
+    const HArray<ValueType>& y,
+    const common::MatrixOp op,
+    bool async ) const
+{
+    SCAI_REGION( "Storage.BSR.gemv" )
+
+    const IndexType nTarget = common::isTranspose( op ) ? getNumColumns() : getNumRows();
+
+    SCAI_LOG_INFO( logger,
+                   "gemv<" << getValueType() << "> ( op = " << op << ", async = " << async
+                   << " ), result = " << alpha << " * A * x + " << beta << " * y "
+                   << ", result = " << result << ", x = " << x << ", y = " << y
+                   << ", A (this) = " << *this );
+
+    if ( alpha == common::Constants::ZERO || ( mJA.size() == 0 ) )
+    {
+        // so we just have result = beta * y, will be done synchronously
+
+        if ( beta == common::Constants::ZERO )
+        {
+            HArrayUtils::setSameValue( result, nTarget, ValueType( 0 ), this->getContextPtr() );
+        }
+        else
+        {
+            HArrayUtils::compute( result, beta, BinaryOp::MULT, y, this->getContextPtr() );
+        }
+
+        if ( async )
+        {
+            return new tasking::NoSyncToken();
+        }
+        else
+        {
+            return NULL;
+        }
+    }
+
+    return BSRUtils::gemv( result, alpha, x, beta, y,
+                           getNumRows(), getNumColumns(), mBlockSize, mIA, mJA, mValues,
+                           op, async, getContextPtr() );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+SyncToken* BSRStorage<ValueType>::matrixTimesVectorAsync(
+    HArray<ValueType>& result,
+    const ValueType alpha,
+    const HArray<ValueType>& x,
+    const ValueType beta,
+    const HArray<ValueType>& y,
+    const common::MatrixOp op ) const
+{
+    bool async = true;
+    SyncToken* token = gemv( result, alpha, x, beta, y, op, async );
+    SCAI_ASSERT( token, "NULL token not allowed for asynchronous execution gemv, alpha = " << alpha << ", beta = " << beta )
+    return token;
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::jacobiIterate(
+    HArray<ValueType>& solution,
+    const HArray<ValueType>& oldSolution,
+    const HArray<ValueType>& rhs,
+    const ValueType omega ) const
+{
+    SCAI_LOG_INFO( logger, *this << ": block Jacobi iteration for local matrix data." )
+
+    if ( &solution == &oldSolution )
+    {
+        COMMON_THROWEXCEPTION( "alias of solution and oldSolution unsupported" )
+    }
+
+    // matrix must be square
+
+    SCAI_ASSERT_EQ_DEBUG( getNumRows(), getNumColumns(), "jacobi iteration step only on square matrix storage" )
+
+    if ( mInvDiagonal.size() == 0 && getNumRows() > 0 )
+    {
+        // inverted diagonal blocks are computed only once and kept until storage is modified
+
+        BSRUtils::invertDiagonalBlocks( mInvDiagonal, getNumRows(), mBlockSize, mIA, mJA, mValues, getContextPtr() );
+    }
+
+    BSRUtils::jacobi( solution, omega, oldSolution, rhs,
+                      getNumRows(), mBlockSize, mIA, mJA, mValues, mInvDiagonal, getContextPtr() );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRStorage<ValueType>::jacobiIterateHalo(
+    HArray<ValueType>& solution,
+    const HArray<ValueType>& localDiagonal,
+    const HArray<ValueType>& oldSolution,
+    const ValueType omega ) const
+{
+    // the halo update with the diagonal elements fits only to the point Jacobi method
+
+    SCAI_ASSERT_EQ_ERROR( mBlockSize, 1, "jacobiIterateHalo with BSR storage only supported for block size 1" )
+
+    BSRUtils::jacobiHalo( solution, omega, localDiagonal, oldSolution,
+                          getNumRows(), getNumColumns(), mBlockSize, mIA, mJA, mValues, getContextPtr() );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+BSRStorage<ValueType>* BSRStorage<ValueType>::copy() const
+{
+    return new BSRStorage<ValueType>( *this );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+BSRStorage<ValueType>* BSRStorage<ValueType>::newMatrixStorage( const IndexType numRows, const IndexType numColumns ) const
+{
+    std::unique_ptr<BSRStorage<ValueType> > storage( new BSRStorage<ValueType>( getContextPtr() ) );
+    storage->mBlockSize = mBlockSize;
+    storage->allocate( numRows, numColumns );
+    return storage.release();
+}
+
+/* ========================================================================= */
+/*  Static fatory methods and related virtual methods                        */
+/* ========================================================================= */
+
+template<typename ValueType>
+std::string BSRStorage<ValueType>::initTypeName()
+{
+    std::stringstream s;
+    s << std::string( "BSRStorage<" ) << common::getScalarType<ValueType>() << std::string( ">" );
+    return s.str();
+}
+
+template<typename ValueType>
+const char* BSRStorage<ValueType>::typeName()
+{
+    static const std::string s = initTypeName();
+    return  s.c_str();
+}
+
+template<typename ValueType>
+const char* BSRStorage<ValueType>::getTypeName() const
+{
+    return typeName();
+}
+
+template<typename ValueType>
+MatrixStorageCreateKeyType BSRStorage<ValueType>::createValue()
+{
+    return MatrixStorageCreateKeyType( Format::BSR, common::getScalarType<ValueType>() );
+}
+
+template<typename ValueType>
+MatrixStorageCreateKeyType BSRStorage<ValueType>::getCreateValue() const
+{
+    return createValue();
+}
+
+template<typename ValueType>
+_MatrixStorage* BSRStorage<ValueType>::create()
+{
+    return new BSRStorage<ValueType>();
+}
+
+/* ========================================================================= */
+/*       Template specializations and instantiations                         */
+/* ========================================================================= */
+
+SCAI_COMMON_INST_CLASS( BSRStorage, SCAI_NUMERIC_TYPES_HOST )
+
+} /* end namespace lama */
+
+} /* end namespace scai */
@@ -0,0 +1,508 @@
+/**
+ * @file BSRStorage.hpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Definition of a structure for a (non-distributed) BSR sparse matrix.
+ * @author Thomas Brandes
+ * @date 19.10.2026
+ */
+
+#pragma once
+
+// for dll_import
+#include <scai/common/config.hpp>
+
+// base classes
+#include <scai/lama/storage/MatrixStorage.hpp>
+#include <scai/lama/mepr/StorageWrapper.hpp>
+
+#include <scai/logging.hpp>
+
+namespace scai
+{
+
+namespace lama
+{
+
+/** @brief Storage format for a BSR (block compressed sparse row) sparse matrix.
+ *
+ *  The BSR format stores dense blocks of size blockSize x blockSize in a CSR like
+ *  structure. It fits well for matrices of systems with several degrees of freedom
+ *  per node, e.g. finite element discretizations, as only one column index is needed
+ *  for each block.
+ *
+ *  - ia contains the offsets for each block row, size is numBlockRows + 1
+ *  - ja contains the block column index for each stored block, sorted in each block row
+ *  - values contains blockSize * blockSize values for each block, row-major
+ *
+ *  If the number of rows or columns is not a multiple of the block size, the border
+ *  blocks are padded with zeros.
+ *
+ *  The block size is a runtime parameter, its default value is 1 (i.e. the storage is
+ *  just a CSR storage with sorted column indexes). Storages created by copy or by
+ *  newMatrixStorage (e.g. for the halo part of a distributed matrix) inherit the block size.
+ *
+ *  The method jacobiIterate implements a block Jacobi method that uses the inverse of the
+ *  diagonal blocks. The inverted blocks are computed at the first call and kept until
+ *  the storage is modified.
+ *
+ *  @tparam ValueType is the value type of the matrix values.
+ */
+template<typename ValueType>
+class COMMON_DLL_IMPORTEXPORT BSRStorage:
+    public MatrixStorage<ValueType>,
+    public _MatrixStorage::Register<BSRStorage<ValueType> >    // register at factory
+{
+public:
+
+    /* ==================================================================== */
+    /*  static getter methods and corresponding pure methods                */
+    /* ==================================================================== */
+
+    /** Static method that returns a unique name for this storage class */
+
+    static const char* typeName();
+
+    /** Implementation of pure method _MatrixStorage:getTypeName    */
+
+    virtual const char* getTypeName() const;
+
+    /** Statitc method that return the unique key for matrix storage factory. */
+
+    static MatrixStorageCreateKeyType createValue();
+
+    /** Implementation of pure method _MatrixStorage:getCreateValue    */
+
+    virtual MatrixStorageCreateKeyType getCreateValue() const;
+
+    /** Static method to create a new object of this storage type, used by factory. */
+
+    static _MatrixStorage* create();
+
+    /** Default constructor, creates empty storage of size 0 x 0 with block size 1 */
+
+    BSRStorage( hmemo::ContextPtr ctx = hmemo::Context::getContextPtr() );
+
+    /**
+     * @brief Create a zero-storage of a certain size
+     *
+     * @param[in] numRows    number of rows
+     * @param[in] numColumns number of columns
+     * @param[in] ctx        context where storage is located, optional
+     *
+     * Attention: DEPRECATED, use the free function zero to create a storage.
+     */
+    BSRStorage( const IndexType numRows, const IndexType numColumns, hmemo::ContextPtr ctx = hmemo::Context::getContextPtr() );
+
+    /** Constructor for BSR storage by corresponding arrays.
+     *
+     *  @param[in] numRows    number of rows
+     *  @param[in] numColumns number of columns
+     *  @param[in] blockSize  size of the blocks
+     *  @param[in] ia         block row offsets, size is ( numRows + blockSize - 1 ) / blockSize + 1
+     *  @param[in] ja         block column indexes, sorted in each block row
+     *  @param[in] values     values of the blocks, size is ja.size() * blockSize * blockSize
+     *  @param[in] ctx        context for the storage
+     *
+     *  \code
+     *      BSRStorage<double> bsr( 4, 4, 2, HArray<IndexType>( { 0, 1, 2 } ), HArray<IndexType>( { 0, 1 } ),
+     *                              HArray<double>( { 2, 1, 1, 2, 3, 0, 0, 3 } ) );
+     *  \endcode
+     */
+    BSRStorage(
+        const IndexType numRows,
+        const IndexType numColumns,
+        const IndexType blockSize,
+        hmemo::HArray<IndexType> ia,
+        hmemo::HArray<IndexType> ja,
+        hmemo::HArray<ValueType> values,
+        hmemo::ContextPtr ctx = hmemo::Context::getContextPtr() );
+
+    /** Default copy constructor is overridden */
+
+    BSRStorage( const BSRStorage<ValueType>& other );
+
+    /** Move constructor (noexcept allows use in container classes ) */
+
+    BSRStorage( BSRStorage<ValueType>&& other ) noexcept;
+
+    /** Implementation of MatrixStorage::copy for derived class. */
+
+    virtual BSRStorage* copy() const;
+
+    /** Implementation of MatrixStorage::newMatrixStorage for derived class, keeps the block size. */
+
+    virtual BSRStorage* newMatrixStorage( const IndexType numRows, const IndexType numColumns ) const;
+
+    virtual BSRStorage* newMatrixStorage() const
+    {
+        return newMatrixStorage( getNumRows(), getNumColumns() );
+    }
+
+    /** Implementation of _MatrixStorage::clear  */
+
+    virtual void clear();
+
+    /** Destructor of BSR sparse matrix. */
+
+    virtual ~BSRStorage();
+
+    /* ==================================================================== */
+    /*   assignment operator=                                               */
+    /* ==================================================================== */
+
+    /**
+     *  Override default assignment operator.
+     */
+    BSRStorage<ValueType>& operator=( const BSRStorage<ValueType>& other );
+
+    /**
+     *  Move assignment operator, reuses allocated data.
+     */
+    BSRStorage& operator=( BSRStorage<ValueType>&& other );
+
+    /**
+     * @brief Implementation of pure method _MatrixStorage::assign, keeps the block size of this storage
+     *        unless other is also a BSR storage.
+     */
+    virtual void assign( const _MatrixStorage& other );
+
+    /**
+     * @brief Implemenation of pure method MatrixStorage<ValueType>::assignDiagonal
+     */
+    virtual void assignDiagonal( const hmemo::HArray<ValueType>& diagonal );
+
+    /**
+     *  @brief Implemenation of assignments for this class
+     */
+    template<typename OtherValueType>
+    void assignImpl( const MatrixStorage<OtherValueType>& other );
+
+    /**
+     *  @brief Implementation of assign method for same storage type.
+     */
+    template<typename OtherValueType>
+    void assignBSR( const BSRStorage<OtherValueType>& other );
+
+    /* ==================================================================== */
+    /*   Block size                                                         */
+    /* ==================================================================== */
+
+    /** Getter for the block size of this storage. */
+
+    IndexType getBlockSize() const;
+
+    /** Set a new block size, the storage data is converted correspondingly. */
+
+    void setBlockSize( const IndexType blockSize );
+
+    /** Getter for the number of block rows. */
+
+    IndexType getNumBlockRows() const;
+
+    /** Getter for the number of stored blocks. */
+
+    IndexType getNumBlocks() const;
+
+    /* ==================================================================== */
+    /*   Implementation of other pure methods                               */
+    /* ==================================================================== */
+
+    /** Test the storage data for inconsistencies.
+     *
+     *  @throw Exception in case of any inconsistency.
+     */
+    void check( const char* msg ) const;
+
+    /** Getter routine for the enum value that stands for this format. */
+
+    virtual Format getFormat() const;
+
+    /** Resize of a zero matrix, keeps the block size. */
+
+    void allocate( const IndexType numRows, const IndexType numColumns );
+
+    /** Implementation of pure method of class MatrixStorage. */
+
+    virtual void purge();
+
+    /**  Implementation of pure method for BSR storage format.  */
+
+    virtual void setIdentity( const IndexType size );
+
+    /* ==================================================================== */
+    /*  set / get CSR data                                                  */
+    /* ==================================================================== */
+
+    /** Implementation of _MatrixStorage::setCSRData for this class, keeps the block size. */
+
+    void setCSRData(
+        const IndexType numRows,
+        const IndexType numColumns,
+        const hmemo::HArray<IndexType>& ia,
+        const hmemo::HArray<IndexType>& ja,
+        const hmemo::_HArray& values );
+
+    /**
+     * @brief template (non-virtual) version of setCSRData with explicit other value type.
+     */
+    void setCSRDataImpl(
+        const IndexType numRows,
+        const IndexType numColumns,
+        const hmemo::HArray<IndexType>& ia,
+        const hmemo::HArray<IndexType>& ja,
+        const hmemo::HArray<ValueType>& values );
+
+    /* ==================================================================== */
+    /*  build CSR data                                                      */
+    /* ==================================================================== */
+
+    /** Implementation for _MatrixStorage::buildCSRSizes */
+
+    void buildCSRSizes( hmemo::HArray<IndexType>& ia ) const;
+
+    /** Implementation for _MatrixStorage::buildCSRData */
+
+    void buildCSRData( hmemo::HArray<IndexType>& csrIA, hmemo::HArray<IndexType>& csrJA, hmemo::_HArray& csrValues ) const;
+
+    /** Implementation of MatrixStorage::matrixTimesVector for BSR */
+
+    virtual void matrixTimesVector(
+        hmemo::HArray<ValueType>& result,
+        const ValueType alpha,
+        const hmemo::HArray<ValueType>& x,
+        const ValueType beta,
+        const hmemo::HArray<ValueType>& y,
+        const common::MatrixOp op ) const;
+
+    /** Implementation of MatrixStorage::matrixTimesVectorAsync for BSR */
+
+    virtual tasking::SyncToken* matrixTimesVectorAsync(
+        hmemo::HArray<ValueType>& result,
+        const ValueType alpha,
+        const hmemo::HArray<ValueType>& x,
+        const ValueType beta,
+        const hmemo::HArray<ValueType>& y,
+        const common::MatrixOp op ) const;
+
+    /** Implementation of MatrixStorage::jacobiIterate for BSR, block Jacobi with the inverted diagonal blocks. */
+
+    virtual void jacobiIterate(
+        hmemo::HArray<ValueType>& solution,
+        const hmemo::HArray<ValueType>& oldSolution,
+        const hmemo::HArray<ValueType>& rhs,
+        const ValueType omega ) const;
+
+    /** Implementation of MatrixStorage::jacobiIterateHalo for BSR
+     *
+     *  The halo update only gets the diagonal elements of the local part, so it is only
+     *  consistent with the block Jacobi method of the local part for block size 1.
+     *  For larger block sizes an exception is thrown.
+     */
+    virtual void jacobiIterateHalo(
+        hmemo::HArray<ValueType>& localSolution,
+        const hmemo::HArray<ValueType>& localDiagonal,
+        const hmemo::HArray<ValueType>& haloOldSolution,
+        const ValueType omega ) const;
+
+    /* Print relevant information about matrix storage format. */
+
+    virtual void writeAt( std::ostream& stream ) const;
+
+    /** Getter routine for the block row offsets (read-only). */
+
+    const hmemo::HArray<IndexType>& getIA() const;
+
+    /** Getter routine for the block column indexes (read-only). */
+
+    const hmemo::HArray<IndexType>& getJA() const;
+
+    /** Getter routine for the values of the blocks (read-only). */
+
+    const hmemo::HArray<ValueType>& getValues() const;
+
+    /******************************************************************/
+    /*  set - get  row - column                                       */
+    /******************************************************************/
+
+    /** Implementation of pure method MatrixStorage<ValueType>::getRow */
+
+    virtual void getRow( hmemo::HArray<ValueType>& row, const IndexType i ) const;
+
+    /** Implementation of pure method MatrixStorage<ValueType>::getColumn */
+
+    virtual void getColumn( hmemo::HArray<ValueType>& column, const IndexType j ) const;
+
+    /** Implementation of pure method MatrixStorage<ValueType>::getSparseRow */
+
+    virtual void getSparseRow( hmemo::HArray<IndexType>& jA, hmemo::HArray<ValueType>& values, const IndexType i ) const;
+
+    /** Implementation of pure method MatrixStorage::getSparseColumn */
+
+    virtual void getSparseColumn( hmemo::HArray<IndexType>& iA, hmemo::HArray<ValueType>& values, const IndexType j ) const;
+
+    /** Implementation of pure method MatrixStorage<ValueType>::setRow */
+
+    virtual void setRow( const hmemo::HArray<ValueType>& row, const IndexType i, const common::BinaryOp op );
+
+    /** Implementation of pure method MatrixStorage<ValueType>::setColumn */
+
+    virtual void setColumn( const hmemo::HArray<ValueType>& column, const IndexType j, const common::BinaryOp op );
+
+    /******************************************************************/
+    /*  set / get diagonal                                            */
+    /******************************************************************/
+
+    /**
+     * Implementation of pure method MatrixStorage<ValueType>::getDiagonal
+     */
+    void getDiagonal( hmemo::HArray<ValueType>& diagonal ) const;
+
+    /**
+     * Implementation of pure method MatrixStorage<ValueType>::setDiagonalV
+     */
+    void setDiagonalV( const hmemo::HArray<ValueType>& diagonal );
+
+    /**
+     * Implementation of pure method MatrixStorage<ValueType>::setDiagonal
+     */
+    virtual void setDiagonal( const ValueType value );
+
+    /******************************************************************
+     *  Scaling of elements in a matrix                                *
+     ******************************************************************/
+
+    /** Implementation of pure method MatrixStorage<ValueType>::scaleRows */
+
+    void scaleRows( const hmemo::HArray<ValueType>& values );
+
+    /** Implementation of pure method MatrixStorage<ValueType>::scaleColumns */
+
+    void scaleColumns( const hmemo::HArray<ValueType>& values );
+
+    /** Implementation of pure method.  */
+
+    virtual void scale( const ValueType value );
+
+    /** Implementation of pure method.  */
+
+    virtual void conj();
+
+    /** Implementation for MatrixStorage::l1Norm */
+
+    virtual RealType<ValueType> l1Norm() const;
+
+    /** Implementation for MatrixStorage::l2Norm */
+
+    virtual RealType<ValueType> l2Norm() const;
+
+    /** Implementation for MatrixStorage::maxNorm */
+
+    virtual RealType<ValueType> maxNorm() const;
+
+    /** Implementation of pure method. */
+
+    ValueType getValue( const IndexType i, const IndexType j ) const;
+
+    /** Implementation of pure method MatrixStorage<ValueType>::setValue for BSR storage */
+
+    void setValue( const IndexType i, const IndexType j, const ValueType val,
+                   const common::BinaryOp op = common::BinaryOp::COPY );
+
+    /** Initiate an asynchronous data transfer to a specified location. */
+
+    void prefetch( const hmemo::ContextPtr location ) const;
+
+    /** Will wait for all outstanding asynchronous data transfers. */
+
+    void wait() const;
+
+    /** Swaps this with other.
+     * @param[in,out] other the BSRStorage to swap this with
+     */
+    void swap( BSRStorage<ValueType>& other );
+
+    virtual size_t getMemoryUsage() const;
+
+    /** print matrix on cout, helpful for debug. */
+
+    void print( std::ostream& stream = std::cout ) const;
+
+    using _MatrixStorage::getNumRows;
+    using _MatrixStorage::getNumColumns;
+    using _MatrixStorage::getValueType;
+
+    using MatrixStorage<ValueType>::prefetch;
+    using MatrixStorage<ValueType>::getContextPtr;
+    using MatrixStorage<ValueType>::assign;
+    using MatrixStorage<ValueType>::setContextPtr;
+
+protected:
+
+    using MatrixStorage<ValueType>::mRowIndexes;
+    using MatrixStorage<ValueType>::mCompressThreshold;
+
+private:
+
+    IndexType mBlockSize;             //!< size of the blocks, number of rows and columns
+
+    hmemo::HArray<IndexType> mIA;     //!< offsets for each block row, size is getNumBlockRows() + 1
+    hmemo::HArray<IndexType> mJA;     //!< block column indexes, size is number of blocks
+    hmemo::HArray<ValueType> mValues; //!< values of the blocks, size is mJA.size() * mBlockSize * mBlockSize
+
+    /** Inverted diagonal blocks as needed by jacobiIterate, empty if not computed yet. */
+
+    mutable hmemo::HArray<ValueType> mInvDiagonal;
+
+    /** Set the block row offsets of an empty storage with the current sizes. */
+
+    void setEmptyBlocks();
+
+    /** Builds the storage for a diagonal matrix with the given diagonal values. */
+
+    void setDiagonalBlocks( const hmemo::HArray<ValueType>& diagonal );
+
+    /** Help routine to get the positions of the diagonal elements, returns number of missing entries. */
+
+    IndexType getDiagonalPositions( hmemo::HArray<IndexType>& positions ) const;
+
+    /** matrixTimesVector for synchronous and asynchronous execution */
+
+    virtual tasking::SyncToken* gemv(
+        hmemo::HArray<ValueType>& result,
+        const ValueType alpha,
+        const hmemo::HArray<ValueType>& x,
+        const ValueType beta,
+        const hmemo::HArray<ValueType>& y,
+        const common::MatrixOp op,
+        bool async ) const;
+
+    static std::string initTypeName();
+
+    SCAI_LOG_DECL_STATIC_LOGGER( logger ); //!< logger for this matrix format
+
+};
+
+} /* end namespace lama */
+
+} /* end namespace scai */
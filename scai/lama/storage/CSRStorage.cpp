@@ -416,6 +416,38 @@ bool CSRStorage<ValueType>::hasSortedRows()
 
 /* --------------------------------------------------------------------------- */
 
+template<typename ValueType>
+void CSRStorage<ValueType>::buildRCMPermutation( HArray<IndexType>& perm ) const
+{
+    SCAI_ASSERT_EQ_ERROR( getNumRows(), getNumColumns(), "RCM ordering only for square storage" )
+
+    CSRUtils::reverseCuthillMcKee( perm, getNumRows(), mIA, mJA, getContextPtr() );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void CSRStorage<ValueType>::permuteSymmetric( const HArray<IndexType>& perm )
+{
+    SCAI_REGION( "Storage.CSR.permuteSymmetric" )
+
+    SCAI_ASSERT_EQ_ERROR( getNumRows(), getNumColumns(), "symmetric permutation only for square storage" )
+    SCAI_ASSERT_EQ_ERROR( perm.size(), getNumRows(), "illegal size of permutation" )
+
+    CSRUtils::permute( mIA, mJA, mValues, perm, perm, getContextPtr() );
+
+    // diagonal elements remain first entries, but sorted rows must be sorted again
+
+    if ( mSortedRows )
+    {
+        sortRows();
+    }
+
+    buildRowIndexes();
+}
+
+/* --------------------------------------------------------------------------- */
+
 template<typename ValueType>
 IndexType CSRStorage<ValueType>::setDiagonalFirst()
 {
@@ -341,6 +341,34 @@ public:
      */
     bool hasSortedRows();
 
+    /** 
+     *  @brief Compute a reverse Cuthill-McKee ordering for this square storage.
+     *
+     *  @param[out] perm is the new ordering, new row/column i is the old row/column perm[i]
+     *
+     *  The ordering reduces the bandwidth of the storage, it is applied by permuteSymmetric.
+     *  The sparsity pattern should be symmetric.
+     */
+    void buildRCMPermutation( hmemo::HArray<IndexType>& perm ) const;
+
+    /** 
+     *  @brief Permute rows and columns of this square storage in the same way, i.e. P * A * P^T
+     *
+     *  @param[in] perm new row/column i is the old row/column perm[i], e.g. computed by buildRCMPermutation
+     *
+     *  Vectors used with the permuted storage must be permuted in the same way, results 
+     *  are mapped back to the original ordering by the inverse permutation.
+     *
+     *  \code
+     *      csr.buildRCMPermutation( perm );
+     *      csr.permuteSymmetric( perm );
+     *      HArrayUtils::gather( xP, x, perm, BinaryOp::COPY );          // xP[i] = x[perm[i]]
+     *      csr.matrixTimesVector( yP, 1, xP, 0, yP, common::MatrixOp::NORMAL );
+     *      HArrayUtils::scatter( y, perm, true, yP, BinaryOp::COPY );   // y[perm[i]] = yP[i]
+     *  \endcode
+     */
+    void permuteSymmetric( const hmemo::HArray<IndexType>& perm );
+
     /** 
      *  @brief Set the diagonal element as first entry in each row.
      * 
@@ -1039,6 +1039,27 @@ void ELLStorage<ValueType>::matrixTimesVector(
 
 /* --------------------------------------------------------------------------- */
 
+template<typename ValueType>
+void ELLStorage<ValueType>::matrixTimesVectorN(
+    HArray<ValueType>& result,
+    const IndexType n,
+    const ValueType alpha,
+    const HArray<ValueType>& x,
+    const ValueType beta,
+    const HArray<ValueType>& y ) const
+{
+    SCAI_REGION( "Storage.ELL.timesVectorN" )
+
+    SCAI_LOG_INFO( logger,
+                   *this << ": matrixTimesVectorN, n = " << n << ", result = " << result << ", alpha = " << alpha 
+                         << ", x = " << x << ", beta = " << beta << ", y = " << y )
+
+    ELLUtils::gemmSD( result, alpha, x, beta, y, getNumRows(), getNumColumns(), n, mNumValuesPerRow,
+                      mIA, mJA, mValues, getContextPtr() );
+}
+
+/* --------------------------------------------------------------------------- */
+
 template<typename ValueType>
 SyncToken* ELLStorage<ValueType>::matrixTimesVectorAsync(
     HArray<ValueType>& result,
@@ -411,6 +411,16 @@ public:
         const hmemo::HArray<ValueType>& y,
         const common::MatrixOp op ) const;
 
+    /** Implementation of MatrixStorage::matrixTimesVectorN for ELL */
+
+    virtual void matrixTimesVectorN(
+        hmemo::HArray<ValueType>& result,
+        const IndexType n,
+        const ValueType alpha,
+        const hmemo::HArray<ValueType>& x,
+        const ValueType beta,
+        const hmemo::HArray<ValueType>& y ) const;
+
     /** Implementation of MatrixStorage::matrixTimesVectorAsync for ELL */
 
     virtual tasking::SyncToken* matrixTimesVectorAsync(
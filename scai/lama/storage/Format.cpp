@@ -63,6 +63,14 @@ const char* format2Str( const Format storageFormat )
             return "COO";
             break;
 
+        case Format::BSR:
+            return "BSR";
+            break;
+
+        case Format::SYMCSR:
+            return "SymCSR";
+            break;
+
         case Format::DENSE:
             return "Dense";
             break;
@@ -51,6 +51,8 @@ enum class Format
     DIA,      //!< Diagonal
     JDS,      //!< Jagged Diagonal Storage
     COO,      //!< Coordinate list
+    BSR,      //!< Block Compressed Sparse Row
+    SYMCSR,   //!< Compressed Sparse Row, only upper triangle for symmetric matrices
     STENCIL,  //!< stencil pattern
     ASSEMBLY, //!< fast format for assembling, CSR like but usess std::vector
     UNDEFINED //!< Default value
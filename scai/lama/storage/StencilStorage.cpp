@@ -505,27 +505,61 @@ void StencilStorage<ValueType>::jacobiIterate(
     SCAI_ASSERT_EQ_DEBUG( getNumRows(), getNumColumns(), "jacobiIterate only on square matrices" )
 
     // solution = omega * ( rhs - B * oldSolution ) * dinv  + ( 1 - omega ) * oldSolution
-    // solution = omega * rhs * dinv + ( 1 - omega ) * oldSolution;
-    // solution -= B * oldSolution * ( omega * dinv )
+    //          = oldSolution + omega * dinv * rhs - omega * dinv * A * oldSolution
+    // Note: the diagonal cannot be removed from the stencil as the kernels use mStencilValues
 
-    // okay that is tricky stuff, swap the diagonal entry with 0
-    // would cause serious problems if stencil storage is used in other operation
+    const ValueType* diagonalPtr = getDiagonalPtr( mStencil );
 
-    ValueType* diagonalPtr = const_cast<ValueType*>( getDiagonalPtr( mStencil ) );
+    SCAI_ASSERT_ERROR( diagonalPtr != NULL && *diagonalPtr != ValueType( 0 ), 
+                       "jacobiIterate: stencil " << mStencil << " has zero diagonal" )
 
-    ValueType diagonalValue = *diagonalPtr;
+    ValueType alpha = omega / *diagonalPtr;
 
-    *diagonalPtr = ValueType( 0 );
+    HArrayUtils::arrayPlusArray( solution, alpha, rhs, ValueType( 1 ), oldSolution, getContextPtr() );
 
-    ValueType alpha = omega / diagonalValue;
+    matrixTimesVector( solution, -alpha, oldSolution, ValueType( 1 ), solution, common::MatrixOp::NORMAL );
+}
 
-    HArrayUtils::arrayPlusArray( solution, alpha, rhs, ValueType( 1 ) - omega, oldSolution, getContextPtr() );
+/* --------------------------------------------------------------------------- */
 
-    // incGEMV( solution, -alpha, oldSolution, async );
+template<typename ValueType>
+void StencilStorage<ValueType>::jacobiSweeps(
+    HArray<ValueType>& solution,
+    const HArray<ValueType>& rhs,
+    const ValueType omega,
+    const IndexType nSweeps ) const
+{
+    const ValueType* diagonalPtr = getDiagonalPtr( mStencil );
 
-    matrixTimesVector( solution, -alpha, oldSolution, ValueType( 1 ), solution, common::MatrixOp::NORMAL );
+    SCAI_ASSERT_ERROR( diagonalPtr != NULL && *diagonalPtr != ValueType( 0 ), 
+                       "jacobiSweeps: stencil " << mStencil << " has zero diagonal" )
+
+    richardsonSweeps( solution, rhs, omega / *diagonalPtr, nSweeps );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void StencilStorage<ValueType>::richardsonSweeps(
+    HArray<ValueType>& solution,
+    const HArray<ValueType>& rhs,
+    const ValueType omega,
+    const IndexType nSweeps ) const
+{
+    SCAI_REGION( "Storage.Stencil.sweeps" )
+
+    SCAI_LOG_INFO( logger, *this << ": " << nSweeps << " sweeps, omega = " << omega )
+
+    SCAI_ASSERT_EQ_ERROR( getNumRows(), solution.size(), "illegal size for solution" )
+    SCAI_ASSERT_EQ_ERROR( getNumRows(), rhs.size(), "illegal size for rhs" )
+
+    if ( mGrid.size() == 0 )
+    {
+        return;
+    }
 
-    *diagonalPtr = diagonalValue;
+    StencilUtils::sweeps( solution, rhs, omega, nSweeps, mGrid.size(), mGrid.nDims(), mStencil.nPoints(),
+                          mGridInfo, mStencilInfo, mStencilValues, this->getContextPtr() );
 }
 
 /* --------------------------------------------------------------------------- */
@@ -414,6 +414,33 @@ public:
         const hmemo::HArray<ValueType>& rhs,
         const ValueType omega ) const;
 
+    /** Apply nSweeps Jacobi iterations, solution = solution + omega * ( rhs - A * solution ) / diagonal
+     *
+     *  @param[in,out] solution is the start solution and will contain the result after nSweeps iterations
+     *  @param[in] rhs is the right-hand side
+     *  @param[in] omega is the damping factor
+     *  @param[in] nSweeps is the number of iterations
+     *
+     *  The result is the same as for nSweeps calls of jacobiIterate but the iterations are blocked 
+     *  in space and time, i.e. several iterations are done on one slab of the grid before the next
+     *  slab is processed. This reduces the memory traffic for large grids significantly.
+     */
+    void jacobiSweeps(
+        hmemo::HArray<ValueType>& solution,
+        const hmemo::HArray<ValueType>& rhs,
+        const ValueType omega,
+        const IndexType nSweeps ) const;
+
+    /** Apply nSweeps Richardson iterations, solution = solution + omega * ( rhs - A * solution ) 
+     *
+     *  Like jacobiSweeps the iterations are blocked in space and time.
+     */
+    void richardsonSweeps(
+        hmemo::HArray<ValueType>& solution,
+        const hmemo::HArray<ValueType>& rhs,
+        const ValueType omega,
+        const IndexType nSweeps ) const;
+
     /** Implementation of MatrixStorage::matrixTimesVectorAsync for stencil storage */
 
     virtual tasking::SyncToken* matrixTimesVectorAsync(
@@ -0,0 +1,1146 @@
+/**
+ * @file SymCSRStorage.cpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Implementation and instantiation for template class SymCSRStorage.
+ * @author Thomas Brandes
+ * @date 19.10.2026
+ */
+
+// hpp
+#include <scai/lama/storage/SymCSRStorage.hpp>
+
+// internal scai libraries
+#include <scai/sparsekernel/CSRUtils.hpp>
+
+#include <scai/utilskernel/HArrayUtils.hpp>
+#include <scai/utilskernel/freeFunction.hpp>
+
+#include <scai/hmemo/ContextAccess.hpp>
+
+#include <scai/tasking/NoSyncToken.hpp>
+
+#include <scai/tracing.hpp>
+
+#include <scai/common/macros/print_string.hpp>
+#include <scai/common/Constants.hpp>
+#include <scai/common/TypeTraits.hpp>
+#include <scai/common/Math.hpp>
+#include <scai/common/macros/instantiate.hpp>
+
+#include <algorithm>
+#include <memory>
+
+using namespace scai::hmemo;
+
+namespace scai
+{
+
+using tasking::SyncToken;
+
+using utilskernel::HArrayUtils;
+
+using sparsekernel::CSRUtils;
+
+using common::BinaryOp;
+
+namespace lama
+{
+
+/* --------------------------------------------------------------------------- */
+
+SCAI_LOG_DEF_TEMPLATE_LOGGER( template<typename ValueType>, SymCSRStorage<ValueType>::logger, "MatrixStorage.SymCSRStorage" )
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+SymCSRStorage<ValueType>::SymCSRStorage( ContextPtr ctx ) :
+
+    MatrixStorage<ValueType>( 0, 0, ctx ),
+    mCSR( ctx ),
+    mSymmetric( false )
+{
+    SCAI_LOG_DEBUG( logger, "SymCSRStorage( 0 x 0 ) @ " << *ctx )
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+SymCSRStorage<ValueType>::SymCSRStorage( IndexType numRows, IndexType numColumns, ContextPtr ctx ) :
+
+    MatrixStorage<ValueType>( numRows, numColumns, ctx ),
+    mCSR( numRows, numColumns, ctx ),
+    mSymmetric( false )
+{
+    SCAI_LOG_DEBUG( logger, "SymCSRStorage( " << getNumRows() << " x " << getNumColumns() << " @ " << *ctx )
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+SymCSRStorage<ValueType>::SymCSRStorage(
+    const IndexType numRows,
+    const IndexType numColumns,
+    const HArray<IndexType>& ia,
+    const HArray<IndexType>& ja,
+    const HArray<ValueType>& values,
+    ContextPtr ctx ) :
+
+    MatrixStorage<ValueType>( 0, 0, ctx ),
+    mCSR( ctx ),
+    mSymmetric( false )
+{
+    setCSRData( numRows, numColumns, ia, ja, values );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+SymCSRStorage<ValueType>::SymCSRStorage( const SymCSRStorage<ValueType>& other ) :
+
+    MatrixStorage<ValueType>( other ),
+
+    mCSR( other.mCSR ),
+    mSymmetric( other.mSymmetric )
+{
+    SCAI_LOG_INFO( logger, "copied SymCSRStorage other = " << other << ", this = " << *this )
+}
+
+/* ------------------------------------------------------------------------------------------------------------------ */
+
+template<typename ValueType>
+SymCSRStorage<ValueType>::SymCSRStorage( SymCSRStorage<ValueType>&& other ) noexcept :
+
+    MatrixStorage<ValueType>( std::move( other ) ),
+
+    mCSR( std::move( other.mCSR ) ),
+    mSymmetric( other.mSymmetric )
+{
+    // no further checks as we assume other to be a consistent and valid input storage
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+SymCSRStorage<ValueType>& SymCSRStorage<ValueType>::operator=( const SymCSRStorage<ValueType>& other )
+{
+    assignSymCSR( other );
+    return *this;
+}
+
+template<typename ValueType>
+SymCSRStorage<ValueType>& SymCSRStorage<ValueType>::operator=( SymCSRStorage<ValueType>&& other )
+{
+    // call of move assignment for base class
+
+    MatrixStorage<ValueType>::moveImpl( std::move( other ) );
+
+    mCSR       = std::move( other.mCSR );
+    mSymmetric = other.mSymmetric;
+
+    return *this;
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+CSRStorage<ValueType>& SymCSRStorage<ValueType>::csr() const
+{
+    // setContextPtr is not virtual, so the context of the CSR data might be outdated
+
+    mCSR.setContextPtr( getContextPtr() );
+
+    return mCSR;
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::assign( const _MatrixStorage& other )
+{
+    // translate virtual call to specific template call via wrapper
+
+    mepr::StorageWrapper<SymCSRStorage, SCAI_NUMERIC_TYPES_HOST_LIST>::assignImpl( this, other );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+template<typename OtherValueType>
+void SymCSRStorage<ValueType>::assignImpl( const MatrixStorage<OtherValueType>& other )
+{
+    if ( other.getFormat() == Format::SYMCSR )
+    {
+        // same format, symmetry check is not required
+
+        assignSymCSR( static_cast<const SymCSRStorage<OtherValueType> & >( other ) );
+    }
+    else
+    {
+        csr().assign( other );
+
+        _MatrixStorage::setDimension( other.getNumRows(), other.getNumColumns() );
+
+        compact();
+
+        SCAI_LOG_INFO( logger, "assignImpl: other = " << other << ", this = " << *this )
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+template<typename OtherValueType>
+void SymCSRStorage<ValueType>::assignSymCSR( const SymCSRStorage<OtherValueType>& other )
+{
+    if ( static_cast<const _MatrixStorage*>( &other ) == this )
+    {
+        SCAI_LOG_DEBUG( logger, typeName() << ": self assign, skipped, storage = " << other )
+        return;
+    }
+
+    _MatrixStorage::_assign( other );     // assign member variables of base class
+
+    csr().setCSRData( other.getNumRows(), other.getNumColumns(), other.getIA(), other.getJA(), other.getValues() );
+
+    mSymmetric = other.isSymmetric();
+
+    SCAI_LOG_DEBUG( logger, "assignSymCSR: other = " << other << ", this = " << *this )
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+bool SymCSRStorage<ValueType>::isSymmetric() const
+{
+    return mSymmetric;
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::compact()
+{
+    SCAI_REGION( "Storage.SymCSR.compact" )
+
+    mSymmetric = false;
+
+    const IndexType n = getNumRows();
+
+    if ( n != getNumColumns() )
+    {
+        return;
+    }
+
+    auto ctx = getContextPtr();
+
+    if ( !CSRUtils::isSymmetric( n, n, mCSR.getIA(), mCSR.getJA(), mCSR.getValues(), ctx ) )
+    {
+        SCAI_LOG_INFO( logger, "CSR data of " << n << " x " << n << " storage not symmetric, keep full data" )
+        return;
+    }
+
+    HArray<IndexType> upperIA( ctx );
+    HArray<IndexType> upperJA( ctx );
+    HArray<ValueType> upperValues( ctx );
+
+    CSRUtils::getUpperTriangle( upperIA, upperJA, upperValues, mCSR.getIA(), mCSR.getJA(), mCSR.getValues(), ctx );
+
+    mCSR = CSRStorage<ValueType>( n, n, std::move( upperIA ), std::move( upperJA ), std::move( upperValues ), ctx );
+
+    mSymmetric = true;
+
+    SCAI_LOG_INFO( logger, "symmetric storage " << n << " x " << n << ", keep upper triangle, #nnz = " << mCSR.getNumValues() )
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::buildFullCSR(
+    HArray<IndexType>& csrIA,
+    HArray<IndexType>& csrJA,
+    HArray<ValueType>& csrValues ) const
+{
+    SCAI_ASSERT_DEBUG( mSymmetric, "buildFullCSR only for symmetric storage" )
+
+    CSRUtils::expandSymmetric( csrIA, csrJA, csrValues, mCSR.getIA(), mCSR.getJA(), mCSR.getValues(), getContextPtr() );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::expand()
+{
+    if ( !mSymmetric )
+    {
+        return;
+    }
+
+    SCAI_LOG_INFO( logger, "expand symmetric storage " << getNumRows() << " x " << getNumColumns() << " to full CSR data" )
+
+    auto ctx = getContextPtr();
+
+    HArray<IndexType> csrIA( ctx );
+    HArray<IndexType> csrJA( ctx );
+    HArray<ValueType> csrValues( ctx );
+
+    buildFullCSR( csrIA, csrJA, csrValues );
+
+    const IndexType n = getNumRows();
+
+    mCSR = CSRStorage<ValueType>( n, n, std::move( csrIA ), std::move( csrJA ), std::move( csrValues ), ctx );
+
+    mSymmetric = false;
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::print( std::ostream& stream ) const
+{
+    stream << "SymCSRStorage " << getNumRows() << " x " << getNumColumns()
+           << ", symmetric = " << mSymmetric << std::endl;
+
+    mCSR.print( stream );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::clear()
+{
+    _MatrixStorage::setDimension( 0, 0 );
+
+    csr().clear();
+
+    mSymmetric = false;
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+Format SymCSRStorage<ValueType>::getFormat() const
+{
+    return Format::SYMCSR;
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::getRow( HArray<ValueType>& row, const IndexType i ) const
+{
+    SCAI_REGION( "Storage.SymCSR.getDenseRow" )
+
+    HArray<IndexType> colIndexes;   // column indexes that have entry for row i
+    HArray<ValueType> rowValues;    // contains the values of entries belonging to row i
+
+    getSparseRow( colIndexes, rowValues, i );
+
+    HArrayUtils::buildDenseArray( row, getNumColumns(), rowValues, colIndexes, ValueType( 0 ) );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::getSparseRow(
+    HArray<IndexType>& jA,
+    HArray<ValueType>& values,
+    const IndexType i ) const
+{
+    SCAI_REGION( "Storage.SymCSR.getSparseRow" )
+
+    if ( !mSymmetric )
+    {
+        csr().getSparseRow( jA, values, i );
+        return;
+    }
+
+    // row i = entries ( k, i ) with k < i of the upper triangle + stored row i ( j >= i )
+
+    HArray<IndexType> lowerJA;
+    HArray<ValueType> lowerValues;
+
+    csr().getSparseColumn( lowerJA, lowerValues, i );
+
+    HArray<IndexType> upperJA;
+    HArray<ValueType> upperValues;
+
+    csr().getSparseRow( upperJA, upperValues, i );
+
+    auto rLowerJA     = hostReadAccess( lowerJA );
+    auto rLowerValues = hostReadAccess( lowerValues );
+    auto rUpperJA     = hostReadAccess( upperJA );
+    auto rUpperValues = hostReadAccess( upperValues );
+
+    IndexType numLower = 0;
+
+    for ( IndexType k = 0; k < lowerJA.size(); ++k )
+    {
+        if ( rLowerJA[k] < i )
+        {
+            numLower++;
+        }
+    }
+
+    const IndexType n = numLower + upperJA.size();
+
+    auto wJA     = hostWriteOnlyAccess( jA, n );
+    auto wValues = hostWriteOnlyAccess( values, n );
+
+    IndexType pos = 0;
+
+    for ( IndexType k = 0; k < lowerJA.size(); ++k )
+    {
+        if ( rLowerJA[k] < i )
+        {
+            wJA[pos]     = rLowerJA[k];
+            wValues[pos] = rLowerValues[k];
+            pos++;
+        }
+    }
+
+    for ( IndexType k = 0; k < upperJA.size(); ++k )
+    {
+        wJA[pos]     = rUpperJA[k];
+        wValues[pos] = rUpperValues[k];
+        pos++;
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::getSparseColumn(
+    HArray<IndexType>& iA,
+    HArray<ValueType>& values,
+    const IndexType j ) const
+{
+    if ( !mSymmetric )
+    {
+        csr().getSparseColumn( iA, values, j );
+    }
+    else
+    {
+        getSparseRow( iA, values, j );
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::setRow( const HArray<ValueType>& row, const IndexType i, const BinaryOp op )
+{
+    expand();
+
+    csr().setRow( row, i, op );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::getColumn( HArray<ValueType>& column, const IndexType j ) const
+{
+    if ( !mSymmetric )
+    {
+        csr().getColumn( column, j );
+    }
+    else
+    {
+        getRow( column, j );
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::setColumn( const HArray<ValueType>& column, const IndexType j, const BinaryOp op )
+{
+    expand();
+
+    csr().setColumn( column, j, op );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::getDiagonal( HArray<ValueType>& diagonal ) const
+{
+    csr().getDiagonal( diagonal );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::setDiagonalV( const HArray<ValueType>& diagonal )
+{
+    csr().setDiagonalV( diagonal );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::setDiagonal( const ValueType value )
+{
+    csr().setDiagonal( value );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::scale( const ValueType value )
+{
+    csr().scale( value );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::conj()
+{
+    // conj( A ) is still symmetric
+
+    csr().conj();
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::scaleRows( const HArray<ValueType>& diagonal )
+{
+    expand();
+
+    csr().scaleRows( diagonal );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::scaleColumns( const HArray<ValueType>& diagonal )
+{
+    expand();
+
+    csr().scaleColumns( diagonal );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::check( const char* msg ) const
+{
+    SCAI_ASSERT_EQ_ERROR( getNumRows(), mCSR.getNumRows(), msg << ": serious mismatch for number of rows" )
+    SCAI_ASSERT_EQ_ERROR( getNumColumns(), mCSR.getNumColumns(), msg << ": serious mismatch for number of columns" )
+
+    mCSR.check( msg );
+
+    if ( mSymmetric )
+    {
+        SCAI_ASSERT_EQ_ERROR( getNumRows(), getNumColumns(), msg << ": symmetric storage must be square" )
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::setIdentity( const IndexType size )
+{
+    SCAI_LOG_INFO( logger, "set identity values with size = " << size )
+
+    _MatrixStorage::setDimension( size, size );
+
+    csr().setIdentity( size );
+
+    mSymmetric = true;
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::assignDiagonal( const HArray<ValueType>& diagonal )
+{
+    const IndexType size = diagonal.size();
+
+    _MatrixStorage::setDimension( size, size );
+
+    csr().assignDiagonal( diagonal );
+
+    mSymmetric = true;
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+IndexType SymCSRStorage<ValueType>::getNumValues() const
+{
+    if ( !mSymmetric )
+    {
+        return mCSR.getNumValues();
+    }
+
+    // each off-diagonal entry of the upper triangle stands for two entries
+
+    const IndexType n = getNumRows();
+
+    auto ia = hostReadAccess( mCSR.getIA() );
+    auto ja = hostReadAccess( mCSR.getJA() );
+
+    IndexType numDiagonals = 0;
+
+    for ( IndexType i = 0; i < n; ++i )
+    {
+        // rows are sorted, diagonal element is first one if available
+
+        if ( ia[i] < ia[i + 1] && ja[ia[i]] == i )
+        {
+            numDiagonals++;
+        }
+    }
+
+    return 2 * mCSR.getJA().size() - numDiagonals;
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+bool SymCSRStorage<ValueType>::checkSymmetry() const
+{
+    if ( mSymmetric )
+    {
+        return true;
+    }
+
+    return CSRUtils::isSymmetric( getNumRows(), getNumColumns(), mCSR.getIA(), mCSR.getJA(), mCSR.getValues(), getContextPtr() );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::buildCSRSizes( HArray<IndexType>& ia ) const
+{
+    if ( !mSymmetric )
+    {
+        mCSR.buildCSRSizes( ia );
+        return;
+    }
+
+    const IndexType n = getNumRows();
+
+    auto upperIA = hostReadAccess( mCSR.getIA() );
+    auto upperJA = hostReadAccess( mCSR.getJA() );
+
+    auto sizes = hostWriteOnlyAccess( ia, n );
+
+    for ( IndexType i = 0; i < n; ++i )
+    {
+        sizes[i] = upperIA[i + 1] - upperIA[i];
+    }
+
+    for ( IndexType i = 0; i < n; ++i )
+    {
+        for ( IndexType jj = upperIA[i]; jj < upperIA[i + 1]; ++jj )
+        {
+            const IndexType j = upperJA[jj];
+
+            if ( j != i )
+            {
+                sizes[j]++;
+            }
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::buildCSRData(
+    HArray<IndexType>& csrIA,
+    HArray<IndexType>& csrJA,
+    _HArray& csrValues ) const
+{
+    if ( !mSymmetric )
+    {
+        mCSR.buildCSRData( csrIA, csrJA, csrValues );
+    }
+    else if ( csrValues.getValueType() == getValueType() )
+    {
+        buildFullCSR( csrIA, csrJA, static_cast<HArray<ValueType>&>( csrValues ) );
+    }
+    else
+    {
+        HArray<ValueType> tmpValues;
+
+        buildFullCSR( csrIA, csrJA, tmpValues );
+
+        HArrayUtils::_assign( csrValues, tmpValues );
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::setCSRData(
+    const IndexType numRows,
+    const IndexType numColumns,
+    const HArray<IndexType>& ia,
+    const HArray<IndexType>& ja,
+    const _HArray& values )
+{
+    SCAI_REGION( "Storage.SymCSR.setCSR" )
+
+    csr().setCSRData( numRows, numColumns, ia, ja, values );
+
+    _MatrixStorage::setDimension( numRows, numColumns );
+
+    compact();
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+SymCSRStorage<ValueType>::~SymCSRStorage()
+{
+    SCAI_LOG_DEBUG( logger, "~SymCSRStorage for matrix " << getNumRows() << " x " << getNumColumns() )
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::purge()
+{
+    _MatrixStorage::setDimension( 0, 0 );
+
+    csr().purge();
+
+    mSymmetric = false;
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::allocate( IndexType numRows, IndexType numColumns )
+{
+    SCAI_LOG_INFO( logger, "allocate symmetric CSR sparse matrix of size " << numRows << " x " << numColumns )
+
+    _MatrixStorage::setDimension( numRows, numColumns );
+
+    csr().allocate( numRows, numColumns );
+
+    // a zero matrix is not considered as symmetric to keep halo storages in full CSR format
+
+    mSymmetric = false;
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::writeAt( std::ostream& stream ) const
+{
+    stream << "SymCSRStorage<" << common::getScalarType<ValueType>()
+           << ">( size = " << getNumRows() << " x " << getNumColumns()
+           << ", symmetric = " << mSymmetric << ", nnz = " << mCSR.getJA().size() << " )";
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+RealType<ValueType> SymCSRStorage<ValueType>::l1Norm() const
+{
+    SCAI_LOG_INFO( logger, *this << ": l1Norm()" )
+
+    if ( !mSymmetric )
+    {
+        return csr().l1Norm();
+    }
+
+    // off-diagonal elements of the upper triangle count twice
+
+    HArray<ValueType> diagonal;
+
+    csr().getDiagonal( diagonal );
+
+    RealType<ValueType> upperNorm = HArrayUtils::l1Norm( mCSR.getValues(), getContextPtr() );
+    RealType<ValueType> diagNorm  = HArrayUtils::l1Norm( diagonal, getContextPtr() );
+
+    return 2 * upperNorm - diagNorm;
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+RealType<ValueType> SymCSRStorage<ValueType>::l2Norm() const
+{
+    SCAI_LOG_INFO( logger, *this << ": l2Norm()" )
+
+    if ( !mSymmetric )
+    {
+        return csr().l2Norm();
+    }
+
+    HArray<ValueType> diagonal;
+
+    csr().getDiagonal( diagonal );
+
+    const auto& values = mCSR.getValues();
+
+    RealType<ValueType> upperSum = common::Math::real( HArrayUtils::dotProduct( values, values, getContextPtr() ) );
+    RealType<ValueType> diagSum  = common::Math::real( HArrayUtils::dotProduct( diagonal, diagonal, getContextPtr() ) );
+
+    return common::Math::sqrt( 2 * upperSum - diagSum );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+RealType<ValueType> SymCSRStorage<ValueType>::maxNorm() const
+{
+    SCAI_LOG_INFO( logger, *this << ": maxNorm()" )
+
+    // mirrored entries do not change the maximal value
+
+    return csr().maxNorm();
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+ValueType SymCSRStorage<ValueType>::getValue( const IndexType i, const IndexType j ) const
+{
+    if ( mSymmetric && i > j )
+    {
+        return csr().getValue( j, i );
+    }
+
+    return csr().getValue( i, j );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::setValue( const IndexType i,
+        const IndexType j,
+        const ValueType val,
+        const BinaryOp op )
+{
+    if ( i != j )
+    {
+        // setting a single off-diagonal entry destroys the symmetry
+
+        expand();
+    }
+
+    csr().setValue( i, j, val, op );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::prefetch( const ContextPtr location ) const
+{
+    mCSR.prefetch( location );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+const HArray<IndexType>& SymCSRStorage<ValueType>::getIA() const
+{
+    return mCSR.getIA();
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+const HArray<IndexType>& SymCSRStorage<ValueType>::getJA() const
+{
+    return mCSR.getJA();
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+const HArray<ValueType>& SymCSRStorage<ValueType>::getValues() const
+{
+    return mCSR.getValues();
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::wait() const
+{
+    mCSR.wait();
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::swap( SymCSRStorage<ValueType>& other )
+{
+    // swap base class
+
+    MatrixStorage<ValueType>::swap( other );
+
+    // swap my member variables
+
+    mCSR.swap( other.mCSR );
+    std::swap( mSymmetric, other.mSymmetric );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+size_t SymCSRStorage<ValueType>::getMemoryUsage() const
+{
+    size_t memoryUsage = _MatrixStorage::_getMemoryUsage();
+
+    memoryUsage += sizeof( bool );
+    memoryUsage += mCSR.getMemoryUsage();
+
+    return memoryUsage;
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::matrixTimesVector(
+    HArray<ValueType>& result,
+    const ValueType alpha,
+    const HArray<ValueType>& x,
+    const ValueType beta,
+    const HArray<ValueType>& y,
+    const common::MatrixOp op ) const
+{
+    bool async = false; // synchronously execution, no SyncToken required
+    SyncToken* token = gemv( result, alpha, x, beta, y, op, async );
+    SCAI_ASSERT( token == NULL, "There should be no sync token for synchronous execution" )
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+SyncToken* SymCSRStorage<ValueType>::gemv(
+    HArray<ValueType>& result,
+    const ValueType alpha,
+    const HArray<ValueType>& x,
+    const ValueType beta,
+    const HArray<ValueType>& y,
+    const common::MatrixOp op,
+    bool async ) const
+{
+    if ( !mSymmetric )
+    {
+        if ( async )
+        {
+            return csr().matrixTimesVectorAsync( result, alpha, x, beta, y, op );
+        }
+
+        csr().matrixTimesVector( result, alpha, x, beta, y, op );
+
+        return NULL;
+    }
+
+    SCAI_REGION( "Storage.SymCSR.gemv" )
+
+    SCAI_LOG_INFO( logger,
+                   "gemv<" << getValueType() << "> ( op = " << op << ", async = " << async
+                   << " ), result = " << alpha << " * A * x + " << beta << " * y "
+                   << ", result = " << result << ", x = " << x << ", y = " << y
+                   << ", A (this) = " << *this );
+
+    SCAI_ASSERT_ERROR( !common::isConj( op ), "gemv: op = " << op << " unsupported for " << *this )
+
+    // A == transpose( A ), so the operation NORMAL or TRANSPOSE does not matter
+
+    SyncToken* token = CSRUtils::gemvSymmetric( result, alpha, x, beta, y, getNumRows(),
+                                                mCSR.getIA(), mCSR.getJA(), mCSR.getValues(),
+                                                async, getContextPtr() );
+
+    if ( async && token == NULL )
+    {
+        // computation has already been done synchronously
+
+        token = new tasking::NoSyncToken();
+    }
+
+    return token;
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+SyncToken* SymCSRStorage<ValueType>::matrixTimesVectorAsync(
+    HArray<ValueType>& result,
+    const ValueType alpha,
+    const HArray<ValueType>& x,
+    const ValueType beta,
+    const HArray<ValueType>& y,
+    const common::MatrixOp op ) const
+{
+    bool async = true;
+    SyncToken* token = gemv( result, alpha, x, beta, y, op, async );
+    SCAI_ASSERT( token, "NULL token not allowed for asynchronous execution gemv, alpha = " << alpha << ", beta = " << beta )
+    return token;
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::jacobiIterate(
+    HArray<ValueType>& solution,
+    const HArray<ValueType>& oldSolution,
+    const HArray<ValueType>& rhs,
+    const ValueType omega ) const
+{
+    if ( !mSymmetric )
+    {
+        csr().jacobiIterate( solution, oldSolution, rhs, omega );
+        return;
+    }
+
+    SCAI_REGION( "Storage.SymCSR.jacobiIterate" )
+
+    SCAI_LOG_INFO( logger, *this << ": Jacobi iteration for local matrix data." )
+
+    if ( &solution == &oldSolution )
+    {
+        COMMON_THROWEXCEPTION( "alias of solution and oldSolution unsupported" )
+    }
+
+    auto ctx = getContextPtr();
+
+    // solution = oldSolution + omega * ( rhs - A * oldSolution ) / diag
+
+    HArray<ValueType> residual( ctx );
+
+    SyncToken* token = CSRUtils::gemvSymmetric( residual, ValueType( -1 ), oldSolution, ValueType( 1 ), rhs, getNumRows(),
+                                                mCSR.getIA(), mCSR.getJA(), mCSR.getValues(), false, ctx );
+
+    SCAI_ASSERT( token == NULL, "There should be no sync token for synchronous execution" )
+
+    HArray<ValueType> diagonal( ctx );
+
+    csr().getDiagonal( diagonal );
+
+    HArrayUtils::binaryOp( residual, residual, diagonal, BinaryOp::DIVIDE, ctx );
+    HArrayUtils::arrayPlusArray( solution, ValueType( 1 ), oldSolution, omega, residual, ctx );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void SymCSRStorage<ValueType>::jacobiIterateHalo(
+    HArray<ValueType>& solution,
+    const HArray<ValueType>& localDiagonal,
+    const HArray<ValueType>& oldSolution,
+    const ValueType omega ) const
+{
+    if ( !mSymmetric )
+    {
+        csr().jacobiIterateHalo( solution, localDiagonal, oldSolution, omega );
+        return;
+    }
+
+    // solution -= omega * ( A * oldSolution ) / diag, A is symmetric only for a square halo part
+
+    auto ctx = getContextPtr();
+
+    HArray<ValueType> tmp( ctx );
+
+    SyncToken* token = CSRUtils::gemvSymmetric( tmp, ValueType( 1 ), oldSolution, ValueType( 0 ), tmp, getNumRows(),
+                                                mCSR.getIA(), mCSR.getJA(), mCSR.getValues(), false, ctx );
+
+    SCAI_ASSERT( token == NULL, "There should be no sync token for synchronous execution" )
+
+    HArrayUtils::binaryOp( tmp, tmp, localDiagonal, BinaryOp::DIVIDE, ctx );
+    HArrayUtils::arrayPlusArray( solution, ValueType( 1 ), solution, -omega, tmp, ctx );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+SymCSRStorage<ValueType>* SymCSRStorage<ValueType>::copy() const
+{
+    return new SymCSRStorage<ValueType>( *this );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+SymCSRStorage<ValueType>* SymCSRStorage<ValueType>::newMatrixStorage( const IndexType numRows, const IndexType numColumns ) const
+{
+    std::unique_ptr<SymCSRStorage<ValueType> > storage( new SymCSRStorage<ValueType>( getContextPtr() ) );
+    storage->allocate( numRows, numColumns );
+    return storage.release();
+}
+
+/* ========================================================================= */
+/*  Static fatory methods and related virtual methods                        */
+/* ========================================================================= */
+
+template<typename ValueType>
+std::string SymCSRStorage<ValueType>::initTypeName()
+{
+    std::stringstream s;
+    s << std::string( "SymCSRStorage<" ) << common::getScalarType<ValueType>() << std::string( ">" );
+    return s.str();
+}
+
+template<typename ValueType>
+const char* SymCSRStorage<ValueType>::typeName()
+{
+    static const std::string s = initTypeName();
+    return  s.c_str();
+}
+
+template<typename ValueType>
+const char* SymCSRStorage<ValueType>::getTypeName() const
+{
+    return typeName();
+}
+
+template<typename ValueType>
+MatrixStorageCreateKeyType SymCSRStorage<ValueType>::createValue()
+{
+    return MatrixStorageCreateKeyType( Format::SYMCSR, common::getScalarType<ValueType>() );
+}
+
+template<typename ValueType>
+MatrixStorageCreateKeyType SymCSRStorage<ValueType>::getCreateValue() const
+{
+    return createValue();
+}
+
+template<typename ValueType>
+_MatrixStorage* SymCSRStorage<ValueType>::create()
+{
+    return new SymCSRStorage<ValueType>();
+}
+
+/* ========================================================================= */
+/*       Template specializations and instantiations                         */
+/* ========================================================================= */
+
+SCAI_COMMON_INST_CLASS( SymCSRStorage, SCAI_NUMERIC_TYPES_HOST )
+
+} /* end namespace lama */
+
+} /* end namespace scai */
@@ -0,0 +1,471 @@
+/**
+ * @file SymCSRStorage.hpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Definition of a CSR storage that keeps only the upper triangle of symmetric matrices.
+ * @author Thomas Brandes
+ * @date 19.10.2026
+ */
+
+#pragma once
+
+// for dll_import
+#include <scai/common/config.hpp>
+
+// base classes
+#include <scai/lama/storage/MatrixStorage.hpp>
+#include <scai/lama/storage/CSRStorage.hpp>
+#include <scai/lama/mepr/StorageWrapper.hpp>
+
+#include <scai/logging.hpp>
+
+namespace scai
+{
+
+namespace lama
+{
+
+/** @brief Storage format for symmetric sparse matrices that stores only the upper triangle.
+ *
+ *  When data is assigned to this storage, it is checked whether the matrix is symmetric.
+ *  In this case only the entries a(i,j) with j >= i are kept in a CSR structure with sorted rows,
+ *  i.e. the diagonal element is always the first entry of a row. This halves the memory traffic
+ *  of the matrix-vector multiplication that is the dominating operation in iterative solvers
+ *  like CG.
+ *
+ *  The matrix-vector multiplication uses each stored off-diagonal entry twice, once
+ *  for the row and once for the column. Each thread accumulates into its own partial
+ *  result, so no atomic updates are needed.
+ *
+ *  If the data is not symmetric (e.g. the local or halo part of a distributed matrix), the storage
+ *  keeps the full CSR data and behaves exactly like a CSR storage. Operations that destroy the
+ *  symmetry (e.g. setRow, scaleRows) switch the storage also to the full CSR data.
+ *
+ *  @tparam ValueType is the value type of the matrix values.
+ */
+template<typename ValueType>
+class COMMON_DLL_IMPORTEXPORT SymCSRStorage:
+    public MatrixStorage<ValueType>,
+    public _MatrixStorage::Register<SymCSRStorage<ValueType> >    // register at factory
+{
+public:
+
+    /* ==================================================================== */
+    /*  static getter methods and corresponding pure methods                */
+    /* ==================================================================== */
+
+    /** Static method that returns a unique name for this storage class */
+
+    static const char* typeName();
+
+    /** Implementation of pure method _MatrixStorage:getTypeName    */
+
+    virtual const char* getTypeName() const;
+
+    /** Statitc method that return the unique key for matrix storage factory. */
+
+    static MatrixStorageCreateKeyType createValue();
+
+    /** Implementation of pure method _MatrixStorage:getCreateValue    */
+
+    virtual MatrixStorageCreateKeyType getCreateValue() const;
+
+    /** Static method to create a new object of this storage type, used by factory. */
+
+    static _MatrixStorage* create();
+
+    /** Default constructor, creates empty storage of size 0 x 0 */
+
+    SymCSRStorage( hmemo::ContextPtr ctx = hmemo::Context::getContextPtr() );
+
+    /**
+     * @brief Create a zero-storage of a certain size
+     *
+     * Attention: DEPRECATED, use the free function zero to create a storage.
+     */
+    SymCSRStorage( const IndexType numRows, const IndexType numColumns, hmemo::ContextPtr ctx = hmemo::Context::getContextPtr() );
+
+    /** Constructor by the (full) CSR arrays, only the upper triangle is kept if the data is symmetric.
+     *
+     *  @param[in] numRows    number of rows
+     *  @param[in] numColumns number of columns
+     *  @param[in] ia         row offsets
+     *  @param[in] ja         column indexes
+     *  @param[in] values     matrix values
+     *  @param[in] ctx        context for the storage
+     */
+    SymCSRStorage(
+        const IndexType numRows,
+        const IndexType numColumns,
+        const hmemo::HArray<IndexType>& ia,
+        const hmemo::HArray<IndexType>& ja,
+        const hmemo::HArray<ValueType>& values,
+        hmemo::ContextPtr ctx = hmemo::Context::getContextPtr() );
+
+    /** Default copy constructor is overridden */
+
+    SymCSRStorage( const SymCSRStorage<ValueType>& other );
+
+    /** Move constructor (noexcept allows use in container classes ) */
+
+    SymCSRStorage( SymCSRStorage<ValueType>&& other ) noexcept;
+
+    /** Implementation of MatrixStorage::copy for derived class. */
+
+    virtual SymCSRStorage* copy() const;
+
+    /** Implementation of MatrixStorage::newMatrixStorage for derived class. */
+
+    virtual SymCSRStorage* newMatrixStorage( const IndexType numRows, const IndexType numColumns ) const;
+
+    virtual SymCSRStorage* newMatrixStorage() const
+    {
+        return newMatrixStorage( getNumRows(), getNumColumns() );
+    }
+
+    /** Implementation of _MatrixStorage::clear  */
+
+    virtual void clear();
+
+    /** Destructor of symmetric CSR sparse matrix. */
+
+    virtual ~SymCSRStorage();
+
+    /* ==================================================================== */
+    /*   assignment operator=                                               */
+    /* ==================================================================== */
+
+    /**
+     *  Override default assignment operator.
+     */
+    SymCSRStorage<ValueType>& operator=( const SymCSRStorage<ValueType>& other );
+
+    /**
+     *  Move assignment operator, reuses allocated data.
+     */
+    SymCSRStorage& operator=( SymCSRStorage<ValueType>&& other );
+
+    /**
+     * @brief Implementation of pure method _MatrixStorage::assign
+     */
+    virtual void assign( const _MatrixStorage& other );
+
+    /**
+     * @brief Implemenation of pure method MatrixStorage<ValueType>::assignDiagonal
+     */
+    virtual void assignDiagonal( const hmemo::HArray<ValueType>& diagonal );
+
+    /**
+     *  @brief Implemenation of assignments for this class
+     */
+    template<typename OtherValueType>
+    void assignImpl( const MatrixStorage<OtherValueType>& other );
+
+    /**
+     *  @brief Implementation of assign method for same storage type.
+     */
+    template<typename OtherValueType>
+    void assignSymCSR( const SymCSRStorage<OtherValueType>& other );
+
+    /* ==================================================================== */
+    /*   Symmetry                                                           */
+    /* ==================================================================== */
+
+    /** Query if only the upper triangle of a symmetric matrix is stored. */
+
+    bool isSymmetric() const;
+
+    /** Switch to the full CSR data, only the upper triangle might be stored before. */
+
+    void expand();
+
+    /* ==================================================================== */
+    /*   Implementation of other pure methods                               */
+    /* ==================================================================== */
+
+    /** Test the storage data for inconsistencies.
+     *
+     *  @throw Exception in case of any inconsistency.
+     */
+    void check( const char* msg ) const;
+
+    /** Getter routine for the enum value that stands for this format. */
+
+    virtual Format getFormat() const;
+
+    /** Resize of a zero matrix. */
+
+    void allocate( const IndexType numRows, const IndexType numColumns );
+
+    /** Implementation of pure method of class MatrixStorage. */
+
+    virtual void purge();
+
+    /**  Implementation of pure method for symmetric CSR storage format.  */
+
+    virtual void setIdentity( const IndexType size );
+
+    /** Override _MatrixStorage::getNumValues, counts the mirrored entries of the upper triangle. */
+
+    virtual IndexType getNumValues() const;
+
+    /** Override MatrixStorage::checkSymmetry, no check required if only the upper triangle is stored. */
+
+    virtual bool checkSymmetry() const;
+
+    /* ==================================================================== */
+    /*  set / get CSR data                                                  */
+    /* ==================================================================== */
+
+    /** Implementation of _MatrixStorage::setCSRData for this class. */
+
+    void setCSRData(
+        const IndexType numRows,
+        const IndexType numColumns,
+        const hmemo::HArray<IndexType>& ia,
+        const hmemo::HArray<IndexType>& ja,
+        const hmemo::_HArray& values );
+
+    /** Implementation for _MatrixStorage::buildCSRSizes */
+
+    void buildCSRSizes( hmemo::HArray<IndexType>& ia ) const;
+
+    /** Implementation for _MatrixStorage::buildCSRData */
+
+    void buildCSRData( hmemo::HArray<IndexType>& csrIA, hmemo::HArray<IndexType>& csrJA, hmemo::_HArray& csrValues ) const;
+
+    /** Implementation of MatrixStorage::matrixTimesVector for symmetric CSR */
+
+    virtual void matrixTimesVector(
+        hmemo::HArray<ValueType>& result,
+        const ValueType alpha,
+        const hmemo::HArray<ValueType>& x,
+        const ValueType beta,
+        const hmemo::HArray<ValueType>& y,
+        const common::MatrixOp op ) const;
+
+    /** Implementation of MatrixStorage::matrixTimesVectorAsync for symmetric CSR */
+
+    virtual tasking::SyncToken* matrixTimesVectorAsync(
+        hmemo::HArray<ValueType>& result,
+        const ValueType alpha,
+        const hmemo::HArray<ValueType>& x,
+        const ValueType beta,
+        const hmemo::HArray<ValueType>& y,
+        const common::MatrixOp op ) const;
+
+    /** Implementation of MatrixStorage::jacobiIterate for symmetric CSR */
+
+    virtual void jacobiIterate(
+        hmemo::HArray<ValueType>& solution,
+        const hmemo::HArray<ValueType>& oldSolution,
+        const hmemo::HArray<ValueType>& rhs,
+        const ValueType omega ) const;
+
+    /** Implementation of MatrixStorage::jacobiIterateHalo for symmetric CSR */
+
+    virtual void jacobiIterateHalo(
+        hmemo::HArray<ValueType>& localSolution,
+        const hmemo::HArray<ValueType>& localDiagonal,
+        const hmemo::HArray<ValueType>& haloOldSolution,
+        const ValueType omega ) const;
+
+    /* Print relevant information about matrix storage format. */
+
+    virtual void writeAt( std::ostream& stream ) const;
+
+    /** Getter routine for the row offsets, only of the upper triangle if isSymmetric() */
+
+    const hmemo::HArray<IndexType>& getIA() const;
+
+    /** Getter routine for the column indexes, only of the upper triangle if isSymmetric() */
+
+    const hmemo::HArray<IndexType>& getJA() const;
+
+    /** Getter routine for the values, only of the upper triangle if isSymmetric() */
+
+    const hmemo::HArray<ValueType>& getValues() const;
+
+    /******************************************************************/
+    /*  set - get  row - column                                       */
+    /******************************************************************/
+
+    /** Implementation of pure method MatrixStorage<ValueType>::getRow */
+
+    virtual void getRow( hmemo::HArray<ValueType>& row, const IndexType i ) const;
+
+    /** Implementation of pure method MatrixStorage<ValueType>::getColumn */
+
+    virtual void getColumn( hmemo::HArray<ValueType>& column, const IndexType j ) const;
+
+    /** Implementation of pure method MatrixStorage<ValueType>::getSparseRow */
+
+    virtual void getSparseRow( hmemo::HArray<IndexType>& jA, hmemo::HArray<ValueType>& values, const IndexType i ) const;
+
+    /** Implementation of pure method MatrixStorage::getSparseColumn */
+
+    virtual void getSparseColumn( hmemo::HArray<IndexType>& iA, hmemo::HArray<ValueType>& values, const IndexType j ) const;
+
+    /** Implementation of pure method MatrixStorage<ValueType>::setRow */
+
+    virtual void setRow( const hmemo::HArray<ValueType>& row, const IndexType i, const common::BinaryOp op );
+
+    /** Implementation of pure method MatrixStorage<ValueType>::setColumn */
+
+    virtual void setColumn( const hmemo::HArray<ValueType>& column, const IndexType j, const common::BinaryOp op );
+
+    /******************************************************************/
+    /*  set / get diagonal                                            */
+    /******************************************************************/
+
+    /**
+     * Implementation of pure method MatrixStorage<ValueType>::getDiagonal
+     */
+    void getDiagonal( hmemo::HArray<ValueType>& diagonal ) const;
+
+    /**
+     * Implementation of pure method MatrixStorage<ValueType>::setDiagonalV
+     */
+    void setDiagonalV( const hmemo::HArray<ValueType>& diagonal );
+
+    /**
+     * Implementation of pure method MatrixStorage<ValueType>::setDiagonal
+     */
+    virtual void setDiagonal( const ValueType value );
+
+    /******************************************************************
+     *  Scaling of elements in a matrix                                *
+     ******************************************************************/
+
+    /** Implementation of pure method MatrixStorage<ValueType>::scaleRows */
+
+    void scaleRows( const hmemo::HArray<ValueType>& values );
+
+    /** Implementation of pure method MatrixStorage<ValueType>::scaleColumns */
+
+    void scaleColumns( const hmemo::HArray<ValueType>& values );
+
+    /** Implementation of pure method.  */
+
+    virtual void scale( const ValueType value );
+
+    /** Implementation of pure method.  */
+
+    virtual void conj();
+
+    /** Implementation for MatrixStorage::l1Norm */
+
+    virtual RealType<ValueType> l1Norm() const;
+
+    /** Implementation for MatrixStorage::l2Norm */
+
+    virtual RealType<ValueType> l2Norm() const;
+
+    /** Implementation for MatrixStorage::maxNorm */
+
+    virtual RealType<ValueType> maxNorm() const;
+
+    /** Implementation of pure method. */
+
+    ValueType getValue( const IndexType i, const IndexType j ) const;
+
+    /** Implementation of pure method MatrixStorage<ValueType>::setValue for symmetric CSR storage */
+
+    void setValue( const IndexType i, const IndexType j, const ValueType val,
+                   const common::BinaryOp op = common::BinaryOp::COPY );
+
+    /** Initiate an asynchronous data transfer to a specified location. */
+
+    void prefetch( const hmemo::ContextPtr location ) const;
+
+    /** Will wait for all outstanding asynchronous data transfers. */
+
+    void wait() const;
+
+    /** Swaps this with other.
+     * @param[in,out] other the SymCSRStorage to swap this with
+     */
+    void swap( SymCSRStorage<ValueType>& other );
+
+    virtual size_t getMemoryUsage() const;
+
+    /** print matrix on cout, helpful for debug. */
+
+    void print( std::ostream& stream = std::cout ) const;
+
+    using _MatrixStorage::getNumRows;
+    using _MatrixStorage::getNumColumns;
+    using _MatrixStorage::getValueType;
+
+    using MatrixStorage<ValueType>::prefetch;
+    using MatrixStorage<ValueType>::getContextPtr;
+    using MatrixStorage<ValueType>::assign;
+    using MatrixStorage<ValueType>::setContextPtr;
+
+protected:
+
+    using MatrixStorage<ValueType>::mRowIndexes;
+    using MatrixStorage<ValueType>::mCompressThreshold;
+
+private:
+
+    /** CSR data, either the upper triangle (mSymmetric) or the full matrix.
+     *
+     *  The context of this storage is set before each use as setContextPtr is not virtual.
+     */
+    mutable CSRStorage<ValueType> mCSR;
+
+    bool mSymmetric;    //!< if true only the upper triangle including the diagonal is stored
+
+    /** Getter for the CSR data that has the same context as this storage. */
+
+    CSRStorage<ValueType>& csr() const;
+
+    /** Keep only the upper triangle of the CSR data if the matrix is symmetric. */
+
+    void compact();
+
+    /** Build the full CSR data without changing this storage. */
+
+    void buildFullCSR( hmemo::HArray<IndexType>& csrIA, hmemo::HArray<IndexType>& csrJA, hmemo::HArray<ValueType>& csrValues ) const;
+
+    /** matrixTimesVector for synchronous and asynchronous execution */
+
+    virtual tasking::SyncToken* gemv(
+        hmemo::HArray<ValueType>& result,
+        const ValueType alpha,
+        const hmemo::HArray<ValueType>& x,
+        const ValueType beta,
+        const hmemo::HArray<ValueType>& y,
+        const common::MatrixOp op,
+        bool async ) const;
+
+    static std::string initTypeName();
+
+    SCAI_LOG_DECL_STATIC_LOGGER( logger ); //!< logger for this matrix format
+
+};
+
+} /* end namespace lama */
+
+} /* end namespace scai */
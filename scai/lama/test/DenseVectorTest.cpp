@@ -1253,6 +1253,130 @@ BOOST_AUTO_TEST_CASE_TEMPLATE( allFFTTest, ValueType, scai_fft_test_types )
     BOOST_CHECK( utilskernel::HArrayUtils::maxDiffNorm( x.getLocalValues(), x1.getLocalValues() ) < eps );
 }
 
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( realFFTTest, ValueType, scai_fft_test_types )
+{
+    typedef RealType<ValueType> Real;
+    typedef common::Complex<Real> FFTType;
+
+    // even and odd sizes, FFT of real vectors computes only half of the complex FFT
+
+    const IndexType sizes[] = { 30, 31, 64 };
+
+    auto comm = dmemo::Communicator::getCommunicatorPtr();
+
+    for ( IndexType n : sizes )
+    {
+        const IndexType nc = n / 2 + 1;
+
+        hmemo::HArray<Real> values( n );
+
+        {
+            auto wValues = hmemo::hostWriteAccess( values );
+
+            for ( IndexType i = 0; i < n; ++i )
+            {
+                wValues[i] = Real( ( 5 * i ) % 11 ) / 11 - Real( 0.5 );
+            }
+        }
+
+        DenseVector<Real> x( values );    // replicated
+
+        DenseVector<FFTType> xc;
+        xc.assign( x );
+        fft( xc );
+
+        hmemo::HArray<FFTType> expValues( nc );
+
+        {
+            auto rXc = hmemo::hostReadAccess( xc.getLocalValues() );
+            auto wExp = hmemo::hostWriteAccess( expValues );
+
+            for ( IndexType k = 0; k < nc; ++k )
+            {
+                wExp[k] = rXc[k];
+            }
+        }
+
+        Real eps = common::TypeTraits<Real>::small() * n;
+
+        dmemo::TestDistributions dists( n );
+
+        for ( size_t i = 0; i < dists.size(); ++i )
+        {
+            DenseVector<Real> xd( x );
+            xd.redistribute( dists[i] );
+
+            DenseVector<FFTType> y;
+
+            fft( y, xd );
+
+            BOOST_REQUIRE_EQUAL( y.size(), nc );
+
+            DenseVector<Real> x1;
+
+            ifft( x1, y, n );
+
+            y.replicate();
+
+            BOOST_CHECK( utilskernel::HArrayUtils::maxDiffNorm( y.getLocalValues(), expValues ) < eps );
+
+            x1.replicate();
+            x1 /= Real( n );
+
+            BOOST_CHECK( utilskernel::HArrayUtils::maxDiffNorm( x1.getLocalValues(), x.getLocalValues() ) < eps );
+        }
+    }
+}
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( distFFTTest, ValueType, scai_fft_test_types )
+{
+    typedef common::Complex<RealType<ValueType>> FFTType;
+
+    // sizes with different factorizations n = n1 * n2 used for the distributed FFT
+
+    const IndexType sizes[] = { 60, 64, 97 };
+
+    auto comm = dmemo::Communicator::getCommunicatorPtr();
+
+    for ( IndexType n : sizes )
+    {
+        hmemo::HArray<FFTType> values( n );
+
+        {
+            auto wValues = hmemo::hostWriteAccess( values );
+
+            for ( IndexType i = 0; i < n; ++i )
+            {
+                wValues[i] = FFTType( RealType<ValueType>( i % 7 ) / 7, RealType<ValueType>( ( 3 * i ) % 5 ) / 5 );
+            }
+        }
+
+        DenseVector<FFTType> x( values );    // replicated
+
+        DenseVector<FFTType> y( x );
+
+        fft( x );
+
+        auto dist = std::make_shared<dmemo::CyclicDistribution>( n, 2, comm );
+
+        y.redistribute( dist );
+
+        fft( y );
+
+        BOOST_CHECK_EQUAL( y.getDistribution(), *dist );
+
+        y.redistribute( x.getDistributionPtr() );
+
+        RealType<ValueType> eps = common::TypeTraits<ValueType>::small() * 10;
+
+        BOOST_CHECK( utilskernel::HArrayUtils::maxDiffNorm( x.getLocalValues(), y.getLocalValues() ) < eps );
+    }
+}
+
 #endif
 
 /* --------------------------------------------------------------------- */
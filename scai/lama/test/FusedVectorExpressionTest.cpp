@@ -0,0 +1,234 @@
+/**
+ * @file FusedVectorExpressionTest.cpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Test of fused vector expressions evaluated in a single loop
+ * @author Thomas Brandes
+ * @date 19.10.2026
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <scai/common/test/TestMacros.hpp>
+
+#include <scai/dmemo/test/TestDistributions.hpp>
+
+#include <scai/lama/expression/FusedVectorExpression.hpp>
+#include <scai/lama/expression/VectorExpressions.hpp>
+#include <scai/lama/DenseVector.hpp>
+#include <scai/lama/SparseVector.hpp>
+
+using namespace scai;
+using namespace lama;
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_SUITE( FusedVectorExpressionTest )
+
+/* --------------------------------------------------------------------- */
+
+SCAI_LOG_DEF_LOGGER( logger, "Test.FusedVectorExpressionTest" )
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( assignTest, ValueType, scai_numeric_test_types )
+{
+    typedef RealType<ValueType> RealType;
+
+    const IndexType n = 17;
+
+    dmemo::TestDistributions dists( n );
+
+    for ( size_t i = 0; i < dists.size(); ++i )
+    {
+        auto dist = dists[i];
+
+        auto x = denseVectorLinear<ValueType>( dist, 1, 1 );
+        auto y = denseVectorLinear<ValueType>( dist, 2, -1 );
+        auto z = denseVectorLinear<ValueType>( dist, 3, 2 );
+
+        const ValueType a = 2;
+        const ValueType b = 3;
+
+        // expected = a * x + b * y * z - x / z, computed with single operations
+
+        DenseVector<ValueType> xz;
+        xz.binaryOp( x, common::BinaryOp::DIVIDE, z );
+        DenseVector<ValueType> yz;
+        yz.binaryOp( y, common::BinaryOp::MULT, z );
+        DenseVector<ValueType> expected;
+        expected = a * x + b * yz;
+        expected -= xz;
+
+        DenseVector<ValueType> result;
+
+        using namespace fused;
+
+        assign( result, a * vec( x ) + b * vec( y ) * vec( z ) - vec( x ) / vec( z ) );
+
+        BOOST_CHECK_EQUAL( result.getDistribution(), *dist );
+
+        RealType eps = 0.0001;
+
+        BOOST_CHECK( result.maxDiffNorm( expected ) < eps );
+
+        // target is also an operand, x = x + a * ( z - x )
+
+        expected = z - x;
+        expected = x + a * expected;
+
+        assign( x, vec( x ) + a * ( vec( z ) - vec( x ) ) );
+
+        BOOST_CHECK( x.maxDiffNorm( expected ) < eps );
+    }
+}
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( unaryTest, ValueType, scai_numeric_test_types )
+{
+    typedef RealType<ValueType> RealType;
+
+    const IndexType n = 13;
+
+    dmemo::TestDistributions dists( n );
+
+    for ( size_t i = 0; i < dists.size(); ++i )
+    {
+        auto dist = dists[i];
+
+        auto x = denseVectorLinear<ValueType>( dist, -5, 1 );
+
+        DenseVector<ValueType> absX;
+        absX.unaryOp( x, common::UnaryOp::ABS );
+        DenseVector<ValueType> expected;
+        expected.unaryOp( absX, common::UnaryOp::SQRT );
+        expected = 2 * expected;
+
+        DenseVector<ValueType> result;
+
+        using namespace fused;
+
+        assign( result, 2 * sqrt( abs( vec( x ) ) ) );
+
+        RealType eps = 0.0001;
+
+        BOOST_CHECK( result.maxDiffNorm( expected ) < eps );
+
+        assign( result, -vec( x ) );
+
+        expected = -x;
+
+        BOOST_CHECK( result.maxDiffNorm( expected ) < eps );
+    }
+}
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( reduceTest, ValueType, scai_numeric_test_types )
+{
+    typedef RealType<ValueType> RealType;
+
+    const IndexType n = 19;
+
+    dmemo::TestDistributions dists( n );
+
+    for ( size_t i = 0; i < dists.size(); ++i )
+    {
+        auto dist = dists[i];
+
+        auto x = denseVectorLinear<ValueType>( dist, 1, 1 );
+        auto y = denseVectorLinear<ValueType>( dist, 5, -1 );
+
+        DenseVector<ValueType> expected;
+        expected = x - 2 * y;
+
+        RealType eps = 0.001;
+
+        using namespace fused;
+
+        // reduction without target
+
+        ValueType s = reduce( vec( x ) - 2 * vec( y ), common::BinaryOp::ADD );
+        BOOST_CHECK( common::Math::abs( s - expected.sum() ) < eps );
+
+        ValueType m = reduce( abs( vec( x ) - 2 * vec( y ) ), common::BinaryOp::ABS_MAX );
+        BOOST_CHECK( common::Math::abs( m - ValueType( expected.maxNorm() ) ) < eps );
+
+        ValueType d = dot( vec( x ), vec( y ) + 1 );
+        BOOST_CHECK( common::Math::abs( d - x.dotProduct( y ) - x.sum() ) < eps );
+
+        // fused assignment and reduction
+
+        DenseVector<ValueType> r;
+
+        ValueType rr = assignDot( r, vec( x ) - 2 * vec( y ) );
+
+        BOOST_CHECK( r.maxDiffNorm( expected ) < eps );
+        BOOST_CHECK( common::Math::abs( rr - expected.dotProduct( expected ) ) < eps );
+
+        ValueType rs = assignReduce( r, vec( x ) - 2 * vec( y ), common::BinaryOp::ADD );
+
+        BOOST_CHECK( common::Math::abs( rs - expected.sum() ) < eps );
+    }
+}
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE( sparseTest )
+{
+    // sparse operands and sparse targets use the fallback with temporary dense vectors
+
+    typedef DefaultReal ValueType;
+
+    const IndexType n = 10;
+
+    auto x = denseVectorLinear<ValueType>( n, 1, 1 );
+
+    SparseVector<ValueType> s( n, 0 );
+    s.setValue( 3, 2 );
+    s.setValue( 7, 5 );
+
+    DenseVector<ValueType> expected;
+    expected = x + 2 * s;
+
+    DenseVector<ValueType> result;
+
+    using namespace fused;
+
+    assign( result, vec( x ) + 2 * vec( s ) );
+
+    BOOST_CHECK_EQUAL( result.maxDiffNorm( expected ), 0 );
+
+    SparseVector<ValueType> sResult( n, 0 );
+
+    assign( sResult, vec( s ) * vec( x ) );
+
+    expected.binaryOp( s, common::BinaryOp::MULT, x );
+
+    BOOST_CHECK_EQUAL( sResult.maxDiffNorm( expected ), 0 );
+}
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_SUITE_END();
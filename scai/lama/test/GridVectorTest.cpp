@@ -35,6 +35,11 @@
 #include <scai/lama/GridVector.hpp>
 #include <scai/lama/GridReadAccess.hpp>
 #include <scai/lama/GridWriteAccess.hpp>
+#include <scai/lama/fft.hpp>
+
+#include <scai/dmemo/GridDistribution.hpp>
+#include <scai/utilskernel/FFTUtils.hpp>
+#include <scai/utilskernel/HArrayUtils.hpp>
 
 #include <scai/testsupport/uniquePathComm.hpp>
 #include <scai/testsupport/GlobalTempDir.hpp>
@@ -141,4 +146,157 @@ BOOST_AUTO_TEST_CASE_TEMPLATE( ioTest, ValueType, scai_numeric_test_types )
 
 /* --------------------------------------------------------------------- */
 
+#ifdef SCAI_COMPLEX_SUPPORTED
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( fftGridTest, ValueType, scai_fft_test_types )
+{
+    typedef common::Complex<RealType<ValueType>> FFTType;
+
+    const common::Grid3D grid( 6, 4, 5 );
+
+    GridVector<FFTType> x( grid, FFTType( 0 ) );
+
+    {
+        auto wX = hmemo::hostWriteAccess( x.getLocalValues() );
+
+        for ( IndexType i = 0; i < grid.size(); ++i )
+        {
+            wX[i] = FFTType( RealType<ValueType>( i % 7 ) / 7, RealType<ValueType>( ( 3 * i ) % 5 ) / 5 );
+        }
+    }
+
+    // expected result: FFT in all dimensions on the replicated data
+
+    hmemo::HArray<FFTType> expX( x.getLocalValues() );
+
+    for ( IndexType dim = 0; dim < grid.nDims(); ++dim )
+    {
+        utilskernel::FFTUtils::fftGrid<ValueType>( expX, grid, dim, 1 );
+    }
+
+    auto comm = dmemo::Communicator::getCommunicatorPtr();
+
+    auto gridDist = std::make_shared<dmemo::GridDistribution>( grid, comm );
+
+    RealType<ValueType> eps = common::TypeTraits<ValueType>::small() * 10;
+
+    for ( int keepTransposed = 0; keepTransposed < 2; ++keepTransposed )
+    {
+        GridVector<FFTType> y( x );
+
+        y.redistribute( gridDist );
+
+        fftGrid( y, 1, keepTransposed == 1 );
+
+        if ( !keepTransposed )
+        {
+            BOOST_CHECK_EQUAL( y.getDistribution(), *gridDist );
+        }
+
+        GridVector<FFTType> z( y );
+
+        z.redistribute( x.getDistributionPtr() );
+
+        BOOST_CHECK( utilskernel::HArrayUtils::maxDiffNorm( z.getLocalValues(), expX ) < eps * grid.size() );
+
+        // inverse FFT with any grid distribution gives the original data scaled by size
+
+        fftGrid( y, -1 );
+
+        y.redistribute( x.getDistributionPtr() );
+
+        y /= FFTType( grid.size() );
+
+        BOOST_CHECK( utilskernel::HArrayUtils::maxDiffNorm( y.getLocalValues(), x.getLocalValues() ) < eps );
+    }
+}
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( fftDimRealTest, ValueType, scai_fft_test_types )
+{
+    typedef RealType<ValueType> Real;
+    typedef common::Complex<Real> FFTType;
+
+    const common::Grid3D grid( 6, 5, 8 );
+
+    GridVector<Real> x( grid, Real( 0 ) );
+
+    {
+        auto wX = hmemo::hostWriteAccess( x.getLocalValues() );
+
+        for ( IndexType i = 0; i < grid.size(); ++i )
+        {
+            wX[i] = Real( ( 7 * i ) % 13 ) / 13;
+        }
+    }
+
+    auto comm = dmemo::Communicator::getCommunicatorPtr();
+
+    RealType<ValueType> eps = common::TypeTraits<ValueType>::small() * 10;
+
+    for ( IndexType dim = 0; dim < grid.nDims(); ++dim )
+    {
+        const IndexType n = grid.size( dim );
+
+        // expected result: first half of the complex FFT along dim on the replicated data
+
+        hmemo::HArray<FFTType> complexX;
+
+        utilskernel::HArrayUtils::setArray( complexX, x.getLocalValues() );
+        utilskernel::FFTUtils::fftGrid<ValueType>( complexX, grid, dim, 1 );
+
+        common::Grid3D packedGrid( grid );
+        packedGrid.setSize( dim, n / 2 + 1 );
+
+        hmemo::HArray<FFTType> expX( packedGrid.size() );
+
+        {
+            auto rComplex = hmemo::hostReadAccess( complexX );
+            auto wExp = hmemo::hostWriteAccess( expX );
+
+            IndexType pos[3];
+
+            for ( IndexType i = 0; i < packedGrid.size(); ++i )
+            {
+                packedGrid.gridPos( pos, i );
+                wExp[i] = rComplex[grid.linearPos( pos )];
+            }
+        }
+
+        // distribute the grid with the processors in the dimension of the FFT
+
+        common::Grid3D procGrid( 1, 1, 1 );
+        procGrid.setSize( dim, comm->getSize() );
+
+        GridVector<Real> xd( x );
+        xd.redistribute( std::make_shared<dmemo::GridDistribution>( grid, comm, procGrid ) );
+
+        GridVector<FFTType> y;
+
+        fftDim( y, xd, dim );
+
+        BOOST_CHECK_EQUAL( y.globalGrid(), packedGrid );
+
+        GridVector<Real> x1;
+
+        ifftDim( x1, y, dim, n );
+
+        BOOST_CHECK_EQUAL( x1.getDistribution(), xd.getDistribution() );
+
+        y.redistribute( dmemo::gridDistributionReplicated( packedGrid ) );
+
+        BOOST_CHECK( utilskernel::HArrayUtils::maxDiffNorm( y.getLocalValues(), expX ) < eps );
+
+        x1.redistribute( x.getDistributionPtr() );
+        x1 /= Real( n );
+
+        BOOST_CHECK( utilskernel::HArrayUtils::maxDiffNorm( x1.getLocalValues(), x.getLocalValues() ) < eps );
+    }
+}
+
+#endif
+
+/* --------------------------------------------------------------------- */
+
 BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,309 @@
+/**
+ * @file MultiVectorTest.cpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Test of the distributed multi-vector and its block operations
+ * @author Thomas Brandes
+ * @date 19.10.2026
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <scai/common/test/TestMacros.hpp>
+
+#include <scai/dmemo/test/TestDistributions.hpp>
+
+#include <scai/lama/MultiVector.hpp>
+#include <scai/lama/matrix/CSRSparseMatrix.hpp>
+#include <scai/lama/matrix/ELLSparseMatrix.hpp>
+#include <scai/lama/expression/MatrixVectorExpressions.hpp>
+
+#include <scai/hmemo/HostReadAccess.hpp>
+#include <scai/hmemo/HostWriteAccess.hpp>
+
+using namespace scai;
+using namespace lama;
+using namespace dmemo;
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_SUITE( MultiVectorTest )
+
+/* --------------------------------------------------------------------- */
+
+SCAI_LOG_DEF_LOGGER( logger, "Test.MultiVectorTest" )
+
+/* --------------------------------------------------------------------- */
+
+/** Set all columns of a multi-vector with different linear values */
+
+template<typename ValueType>
+static void setLinearColumns( MultiVector<ValueType>& x, DistributionPtr dist, const IndexType k )
+{
+    x.setSameValue( dist, k, 0 );
+
+    for ( IndexType j = 0; j < k; ++j )
+    {
+        auto column = denseVectorLinear<ValueType>( dist, ValueType( j + 1 ), ValueType( 1 - j ) );
+        x.setColumn( j, column );
+    }
+}
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE( columnTest )
+{
+    typedef DefaultReal ValueType;
+
+    const IndexType n = 11;
+    const IndexType k = 3;
+
+    TestDistributions dists( n );
+
+    for ( size_t i = 0; i < dists.size(); ++i )
+    {
+        auto dist = dists[i];
+
+        MultiVector<ValueType> x;
+        setLinearColumns( x, dist, k );
+
+        BOOST_CHECK_EQUAL( x.getNumRows(), n );
+        BOOST_CHECK_EQUAL( x.getNumColumns(), k );
+        BOOST_CHECK_EQUAL( x.getLocalValues().size(), dist->getLocalSize() * k );
+
+        for ( IndexType j = 0; j < k; ++j )
+        {
+            auto expected = denseVectorLinear<ValueType>( dist, ValueType( j + 1 ), ValueType( 1 - j ) );
+
+            DenseVector<ValueType> column;
+            x.getColumn( column, j );
+
+            BOOST_CHECK_EQUAL( column.maxDiffNorm( expected ), 0 );
+        }
+    }
+}
+
+/* --------------------------------------------------------------------- */
+
+/** Compare result = alpha * A * x + beta * y for a multi-vector with the matrix-vector multiplication for each column */
+
+static void checkSpMM( const SparseMatrix<double>& a, DistributionPtr rowDist, DistributionPtr colDist )
+{
+    const IndexType k = 3;
+
+    MultiVector<double> x;
+    MultiVector<double> y;
+
+    setLinearColumns( x, colDist, k );
+    setLinearColumns( y, rowDist, k );
+
+    MultiVector<double> result;
+
+    result.matrixTimesMultiVector( 2.0, a, x, -3.0, y );
+
+    BOOST_CHECK_EQUAL( result.getDistribution(), *rowDist );
+    BOOST_CHECK_EQUAL( result.getNumColumns(), k );
+
+    // alias of result and y
+
+    y.matrixTimesMultiVector( 2.0, a, x, -3.0, y );
+
+    for ( IndexType j = 0; j < k; ++j )
+    {
+        DenseVector<double> xj;
+        DenseVector<double> yj;
+        DenseVector<double> resultj;
+
+        x.getColumn( xj, j );
+        result.getColumn( resultj, j );
+
+        auto expected = denseVectorLinear<double>( rowDist, double( j + 1 ), double( 1 - j ) );
+        expected = 2.0 * a * xj - 3.0 * expected;
+
+        BOOST_CHECK( expected.maxDiffNorm( resultj ) < 1e-12 );
+
+        y.getColumn( yj, j );
+
+        BOOST_CHECK( expected.maxDiffNorm( yj ) < 1e-12 );
+    }
+
+    // beta = 0, y is not used
+
+    MultiVector<double> result0;
+
+    result0.matrixTimesMultiVector( 1.0, a, x, 0.0, result0 );
+
+    for ( IndexType j = 0; j < k; ++j )
+    {
+        DenseVector<double> xj;
+        DenseVector<double> resultj;
+
+        x.getColumn( xj, j );
+        result0.getColumn( resultj, j );
+
+        auto expected = denseVectorEval( a * xj );
+
+        BOOST_CHECK( expected.maxDiffNorm( resultj ) < 1e-12 );
+    }
+}
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE( spmmTest )
+{
+    const IndexType numRows = 7;
+    const IndexType numCols = 5;
+
+    hmemo::HArray<IndexType> ia    ( { 0,     2,  3,     5,        8,  9,  9,    11 } );
+    hmemo::HArray<IndexType> ja    ( { 0, 3,  4,  1, 2,  0, 2, 4,  3,      1, 4 } );
+    hmemo::HArray<double> values   ( { 1, 2, -1,  3, 1,  2, 1, 1, -2,      1, 3 } );
+
+    CSRStorage<double> csr( numRows, numCols, ia, ja, values );
+
+    TestDistributions rowDists( numRows );
+    TestDistributions colDists( numCols );
+
+    for ( size_t ir = 0; ir < rowDists.size(); ++ir )
+    {
+        for ( size_t ic = 0; ic < colDists.size(); ++ic )
+        {
+            DistributionPtr rowDist = rowDists[ir];
+            DistributionPtr colDist = colDists[ic];
+
+            SCAI_LOG_INFO( logger, "spmmTest, rowDist = " << *rowDist << ", colDist = " << *colDist )
+
+            auto csrA = convert<CSRSparseMatrix<double>>( csr );
+            csrA.redistribute( rowDist, colDist );
+            checkSpMM( csrA, rowDist, colDist );
+
+            auto ellA = convert<ELLSparseMatrix<double>>( csr );
+            ellA.redistribute( rowDist, colDist );
+            checkSpMM( ellA, rowDist, colDist );
+        }
+    }
+}
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( dotTest, ValueType, scai_numeric_test_types )
+{
+    typedef RealType<ValueType> RealType;
+
+    const IndexType n = 13;
+    const IndexType kx = 3;
+    const IndexType ky = 2;
+
+    TestDistributions dists( n );
+
+    for ( size_t i = 0; i < dists.size(); ++i )
+    {
+        auto dist = dists[i];
+
+        MultiVector<ValueType> x;
+        MultiVector<ValueType> y;
+
+        setLinearColumns( x, dist, kx );
+        setLinearColumns( y, dist, ky );
+
+        hmemo::HArray<ValueType> g;
+
+        x.dot( g, y );
+
+        BOOST_REQUIRE_EQUAL( g.size(), kx * ky );
+
+        auto rG = hmemo::hostReadAccess( g );
+
+        for ( IndexType i1 = 0; i1 < kx; ++i1 )
+        {
+            for ( IndexType j1 = 0; j1 < ky; ++j1 )
+            {
+                DenseVector<ValueType> xi;
+                DenseVector<ValueType> yj;
+
+                x.getColumn( xi, i1 );
+                y.getColumn( yj, j1 );
+
+                ValueType expected = xi.dotProduct( yj );
+
+                BOOST_CHECK( common::Math::abs( expected - rG[ i1 * ky + j1 ] ) < RealType( 0.001 ) );
+            }
+        }
+    }
+}
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( axpyTest, ValueType, scai_numeric_test_types )
+{
+    typedef RealType<ValueType> RealType;
+
+    const IndexType n = 13;
+    const IndexType kx = 3;
+    const IndexType ky = 2;
+
+    TestDistributions dists( n );
+
+    for ( size_t i = 0; i < dists.size(); ++i )
+    {
+        auto dist = dists[i];
+
+        MultiVector<ValueType> x;
+        MultiVector<ValueType> y;
+
+        setLinearColumns( x, dist, kx );
+        setLinearColumns( y, dist, ky );
+
+        // b is kx x ky, row-major
+
+        hmemo::HArray<ValueType> b( { 1, 2,
+                                     -1, 0,
+                                      3, 1 } );
+
+        const ValueType alpha = 2;
+
+        y.axpy( alpha, x, b );
+
+        auto rB = hmemo::hostReadAccess( b );
+
+        for ( IndexType j = 0; j < ky; ++j )
+        {
+            auto expected = denseVectorLinear<ValueType>( dist, ValueType( j + 1 ), ValueType( 1 - j ) );
+
+            for ( IndexType l = 0; l < kx; ++l )
+            {
+                DenseVector<ValueType> xl;
+                x.getColumn( xl, l );
+                expected += ( alpha * rB[ l * ky + j ] ) * xl;
+            }
+
+            DenseVector<ValueType> yj;
+            y.getColumn( yj, j );
+
+            BOOST_CHECK( expected.maxDiffNorm( yj ) < RealType( 0.001 ) );
+        }
+    }
+}
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -33,6 +33,7 @@
 #include <scai/lama/matrix/GramianMatrix.hpp>
 #include <scai/lama/matrix/MatrixWithT.hpp>
 #include <scai/lama/matrix/CSRSparseMatrix.hpp>
+#include <scai/lama/matrix/ELLSparseMatrix.hpp>
 #include <scai/common/test/TestMacros.hpp>
 
 #include <scai/dmemo/test/TestDistributions.hpp>
@@ -160,4 +161,55 @@ BOOST_AUTO_TEST_CASE_TEMPLATE( combinedTest, ValueType, scai_numeric_test_types
 
 /* ------------------------------------------------------------------------- */
 
+BOOST_AUTO_TEST_CASE_TEMPLATE( fusedTest, ValueType, scai_numeric_test_types )
+{
+    // the fused kernel is used for CSR matrices, other formats fall back to two products
+
+    IndexType numRows = 3;
+    IndexType numCols = 4;
+
+    hmemo::HArray<IndexType> ia    ( { 0,     2,     4,     6 } );
+    hmemo::HArray<IndexType> ja    ( { 0, 1,  1, 2,  2,  3    } );
+    hmemo::HArray<ValueType> values( { 1, 2, -1, -1, 2, 1     } );
+
+    CSRStorage<ValueType> csr( numRows, numCols, ia, ja, values );
+
+    CSRSparseMatrix<ValueType> a( csr );
+    CSRSparseMatrix<ValueType> aT;
+    aT.assignTranspose( a );
+    auto aTaExplicit = eval<CSRSparseMatrix<ValueType>>( aT * a );
+
+    auto ellA = convert<ELLSparseMatrix<ValueType>>( csr );
+
+    GramianMatrix<ValueType> csrGramian( a );
+    GramianMatrix<ValueType> ellGramian( ellA );
+
+    auto x = denseVector<ValueType>( a.getColDistributionPtr(), 0 );
+    x.fillRandom( 5 );
+    auto y = denseVector<ValueType>( a.getColDistributionPtr(), 0 );
+    y.fillRandom( 3 );
+
+    const ValueType alpha = 2;
+    const ValueType beta  = -1;
+
+    auto expected = denseVectorEval( alpha * aTaExplicit * x + beta * y );
+
+    RealType<ValueType> eps = 0.0001;
+
+    auto r1 = denseVectorEval( alpha * csrGramian * x + beta * y );
+    auto r2 = denseVectorEval( alpha * ellGramian * x + beta * y );
+
+    BOOST_CHECK( expected.maxDiffNorm( r1 ) < eps );
+    BOOST_CHECK( expected.maxDiffNorm( r2 ) < eps );
+
+    // result aliased to x must not use the fused kernel
+
+    expected = alpha * aTaExplicit * x;
+    x = alpha * csrGramian * x;
+
+    BOOST_CHECK( expected.maxDiffNorm( x ) < eps );
+}
+
+/* ------------------------------------------------------------------------- */
+
 BOOST_AUTO_TEST_SUITE_END();
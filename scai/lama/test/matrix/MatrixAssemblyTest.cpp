@@ -307,4 +307,73 @@ BOOST_AUTO_TEST_CASE( operatorTest )
 
 /* ------------------------------------------------------------------------- */
 
+BOOST_AUTO_TEST_CASE( blockTest )
+{
+    dmemo::CommunicatorPtr comm = dmemo::Communicator::getCommunicatorPtr();
+
+    PartitionId commSize = comm->getSize();
+    PartitionId commRank = comm->getRank();
+
+    const IndexType numNodes  = 4;
+    const IndexType blockSize = 3;
+    const IndexType n         = numNodes * blockSize;
+
+    // block for node i, coupling to node i + 1 has the negative values
+
+    ValueType block[] = { 4, 1, 0, 1, 5, 2, 0, 2, 6 };
+
+    ValueType negBlock[ blockSize * blockSize ];
+
+    for ( IndexType k = 0; k < blockSize * blockSize; ++k )
+    {
+        negBlock[k] = -block[k];
+    }
+
+    MatrixAssembly<ValueType> assembly;
+
+    for ( IndexType iNode = 0; iNode < numNodes; ++iNode )
+    {
+        if ( iNode % commSize != commRank )
+        {
+            continue;
+        }
+
+        assembly.pushBlock( iNode, iNode, blockSize, block );
+
+        if ( iNode + 1 < numNodes )
+        {
+            assembly.pushBlock( iNode, iNode + 1, blockSize, negBlock );
+        }
+    }
+
+    COOStorage<ValueType> cooGlobal = assembly.buildGlobalCOO( n, n, common::BinaryOp::COPY );
+
+    BSRStorage<ValueType> bsr;
+    bsr.setBlockSize( blockSize );
+    bsr.assign( cooGlobal );
+
+    BOOST_CHECK_EQUAL( bsr.getNumBlocks(), 2 * numNodes - 1 );
+
+    for ( IndexType iNode = 0; iNode < numNodes; ++iNode )
+    {
+        for ( IndexType r = 0; r < blockSize; ++r )
+        {
+            for ( IndexType c = 0; c < blockSize; ++c )
+            {
+                const IndexType i = iNode * blockSize + r;
+                const IndexType j = iNode * blockSize + c;
+
+                BOOST_CHECK_EQUAL( bsr.getValue( i, j ), block[r * blockSize + c] );
+
+                if ( iNode + 1 < numNodes )
+                {
+                    BOOST_CHECK_EQUAL( bsr.getValue( i, j + blockSize ), negBlock[r * blockSize + c] );
+                }
+            }
+        }
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
 BOOST_AUTO_TEST_SUITE_END();
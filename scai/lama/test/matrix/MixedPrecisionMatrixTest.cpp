@@ -0,0 +1,134 @@
+/**
+ * @file test/matrix/MixedPrecisionMatrixTest.cpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Test routines for the operator matrix class MixedPrecisionMatrix
+ * @author Thomas Brandes
+ * @date 19.10.2026
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <scai/lama/matrix/MixedPrecisionMatrix.hpp>
+#include <scai/lama/matrix/CSRSparseMatrix.hpp>
+#include <scai/lama/matrix/ELLSparseMatrix.hpp>
+#include <scai/lama/matrix/JDSSparseMatrix.hpp>
+#include <scai/common/test/TestMacros.hpp>
+
+#include <scai/dmemo/test/TestDistributions.hpp>
+
+using namespace scai;
+using namespace lama;
+using namespace dmemo;
+
+/* ------------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_SUITE( MixedPrecisionMatrixTest )
+
+/* ------------------------------------------------------------------------- */
+
+SCAI_LOG_DEF_LOGGER( logger, "Test.MixedPrecisionMatrixTest" );
+
+/* ------------------------------------------------------------------------- */
+
+/** Compare y = alpha * A * x + beta * y of the mixed operator with the converted matrix. */
+
+static void checkMixed( const SparseMatrix<float>& a, DistributionPtr rowDist, DistributionPtr colDist )
+{
+    CSRSparseMatrix<double> aDouble;
+    aDouble.assign( a );
+
+    MixedPrecisionMatrix<double, float> opA( a );
+
+    BOOST_CHECK_EQUAL( opA.getRowDistribution(), *rowDist );
+    BOOST_CHECK_EQUAL( opA.getColDistribution(), *colDist );
+
+    auto x = denseVectorLinear<double>( colDist, 1.0, 0.25 );
+    auto y = denseVectorLinear<double>( rowDist, -1.0, 0.5 );
+
+    auto expected = denseVectorEval( 2.0 * aDouble * x - 3.0 * y );
+    auto result   = denseVectorEval( 2.0 * opA * x - 3.0 * y );
+
+    BOOST_CHECK( expected.maxDiffNorm( result ) < 1e-10 );
+
+    // alias of result and y
+
+    y = 2.0 * opA * x - 3.0 * y;
+
+    BOOST_CHECK( expected.maxDiffNorm( y ) < 1e-10 );
+
+    // transposed operation
+
+    auto xT = denseVectorLinear<double>( rowDist, 1.0, 0.5 );
+
+    expected = transpose( aDouble ) * xT;
+    result   = transpose( opA ) * xT;
+
+    BOOST_CHECK( expected.maxDiffNorm( result ) < 1e-10 );
+}
+
+/* ------------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE( gemvTest )
+{
+    const IndexType numRows = 7;
+    const IndexType numCols = 5;
+
+    hmemo::HArray<IndexType> ia    ( { 0,     2,  3,     5,        8,  9,  9,    11 } );
+    hmemo::HArray<IndexType> ja    ( { 0, 3,  4,  1, 2,  0, 2, 4,  3,      1, 4 } );
+    hmemo::HArray<float> values    ( { 1, 2, -1,  3, 1,  2, 1, 1, -2,      1, 3 } );
+
+    CSRStorage<float> csr( numRows, numCols, ia, ja, values );
+
+    TestDistributions rowDists( numRows );
+    TestDistributions colDists( numCols );
+
+    for ( size_t ir = 0; ir < rowDists.size(); ++ir )
+    {
+        for ( size_t ic = 0; ic < colDists.size(); ++ic )
+        {
+            DistributionPtr rowDist = rowDists[ir];
+            DistributionPtr colDist = colDists[ic];
+
+            SCAI_LOG_INFO( logger, "gemvTest, rowDist = " << *rowDist << ", colDist = " << *colDist )
+
+            // CSR and ELL use the mixed kernels, JDS uses the fallback with a converted matrix
+
+            auto csrA = convert<CSRSparseMatrix<float>>( csr );
+            csrA.redistribute( rowDist, colDist );
+            checkMixed( csrA, rowDist, colDist );
+
+            auto ellA = convert<ELLSparseMatrix<float>>( csr );
+            ellA.redistribute( rowDist, colDist );
+            checkMixed( ellA, rowDist, colDist );
+
+            auto jdsA = convert<JDSSparseMatrix<float>>( csr );
+            jdsA.redistribute( rowDist, colDist );
+            checkMixed( jdsA, rowDist, colDist );
+        }
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_SUITE_END();
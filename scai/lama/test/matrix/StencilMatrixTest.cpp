@@ -32,6 +32,10 @@
 
 #include <scai/lama/matrix/StencilMatrix.hpp>
 #include <scai/lama/matutils/MatrixCreator.hpp>
+#include <scai/lama/DenseVector.hpp>
+#include <scai/common/TypeTraits.hpp>
+
+#include <vector>
 
 using namespace scai;
 using namespace lama;
@@ -189,4 +193,66 @@ BOOST_AUTO_TEST_CASE( AssignTest )
 
 /* ------------------------------------------------------------------------- */
 
+BOOST_AUTO_TEST_CASE( DistributedGEMVTest )
+{
+    // matrix-vector multiplication of a distributed stencil matrix uses ghost layers, compare with CSR
+
+    dmemo::CommunicatorPtr comm = dmemo::Communicator::getCommunicatorPtr();
+
+    std::vector<common::Stencil<ValueType> > stencils;
+    std::vector<common::Grid> grids;
+
+    stencils.push_back( common::Stencil1D<ValueType>( 3 ) );
+    grids.push_back( common::Grid1D( 37 ) );
+    grids.back().setBorderType( 0, common::BorderType::PERIODIC );
+    stencils.push_back( common::Stencil2D<ValueType>( 5 ) );
+    grids.push_back( common::Grid2D( 17, 19 ) );
+    stencils.push_back( common::Stencil2D<ValueType>( 9 ) );
+    grids.push_back( common::Grid2D( 17, 19 ) );
+    grids.back().setBorderType( 0, common::BorderType::PERIODIC );
+    stencils.push_back( common::Stencil3D<ValueType>( 7 ) );
+    grids.push_back( common::Grid3D( 15, 6, 17 ) );
+    grids.back().setBorderType( 2, common::BorderType::PERIODIC );
+    stencils.push_back( common::Stencil3D<ValueType>( 27 ) );
+    grids.push_back( common::Grid3D( 15, 16, 7 ) );
+    grids.back().setBorderType( 1, common::BorderType::PERIODIC );
+
+    for ( size_t i = 0; i < stencils.size(); ++i )
+    {
+        const common::Stencil<ValueType>& stencil = stencils[i];
+
+        // different value for each point so that transposed ghost values would be detected
+
+        common::Stencil<ValueType> stencil1( stencil.nDims() );
+
+        for ( IndexType p = 0; p < stencil.nPoints(); ++p )
+        {
+            stencil1.addPoint( stencil.positions() + p * stencil.nDims(), stencil.values()[p] + ValueType( p ) / 4 );
+        }
+
+        auto dist = dmemo::gridDistribution( grids[i], comm );
+
+        StencilMatrix<ValueType> stencilMatrix( dist, stencil1 );
+
+        CSRSparseMatrix<ValueType> csrMatrix( stencilMatrix );
+
+        DenseVector<ValueType> x;
+        x.setRandom( dist, 1 );
+        DenseVector<ValueType> y;
+        y.setRandom( dist, 1 );
+
+        DenseVector<ValueType> result1;
+        DenseVector<ValueType> result2;
+
+        result1 = 2 * stencilMatrix * x - y;
+        result2 = 2 * csrMatrix * x - y;
+
+        auto eps = common::TypeTraits<ValueType>::small();
+
+        BOOST_CHECK_MESSAGE( result1.maxDiffNorm( result2 ) < eps, stencil1 << " on " << grids[i] << ", dist = " << *dist );
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
 BOOST_AUTO_TEST_SUITE_END();
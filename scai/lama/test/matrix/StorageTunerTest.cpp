@@ -0,0 +1,268 @@
+/**
+ * @file StorageTunerTest.cpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Test of the automatic selection of the storage format for sparse matrices
+ * @author Thomas Brandes
+ * @date 19.10.2026
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <scai/lama/matrix/StorageTuner.hpp>
+#include <scai/lama/matrix/CSRSparseMatrix.hpp>
+#include <scai/lama/expression/MatrixVectorExpressions.hpp>
+#include <scai/common/test/TestMacros.hpp>
+
+#include <scai/dmemo/test/TestDistributions.hpp>
+
+#include <scai/testsupport/uniquePathComm.hpp>
+#include <scai/testsupport/GlobalTempDir.hpp>
+
+#include <cstdio>
+
+using namespace scai;
+using namespace lama;
+using namespace dmemo;
+
+using scai::testsupport::uniquePathSharedAmongNodes;
+using scai::testsupport::GlobalTempDir;
+
+/* ------------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_SUITE( StorageTunerTest )
+
+/* ------------------------------------------------------------------------- */
+
+SCAI_LOG_DEF_LOGGER( logger, "Test.StorageTunerTest" );
+
+/* ------------------------------------------------------------------------- */
+
+/** Build a n x n CSR storage where row i has rowLength( i ) entries in the columns col( i, 0 ), col( i, 1 ), ... */
+
+template<typename RowLength, typename Column>
+static CSRStorage<double> buildStorage( const IndexType n, RowLength rowLength, Column col )
+{
+    std::vector<IndexType> ia( 1, 0 );
+    std::vector<IndexType> ja;
+    std::vector<double> values;
+
+    for ( IndexType i = 0; i < n; ++i )
+    {
+        for ( IndexType k = 0; k < rowLength( i ); ++k )
+        {
+            ja.push_back( col( i, k ) );
+            values.push_back( double( i + k + 1 ) );
+        }
+
+        ia.push_back( static_cast<IndexType>( ja.size() ) );
+    }
+
+    const IndexType numValues = static_cast<IndexType>( ja.size() );
+
+    hmemo::HArray<IndexType> csrIA( n + 1, ia.data() );
+    hmemo::HArray<IndexType> csrJA( numValues, ja.data() );
+    hmemo::HArray<double> csrValues( numValues, values.data() );
+
+    return CSRStorage<double>( n, n, std::move( csrIA ), std::move( csrJA ), std::move( csrValues ) );
+}
+
+/** Tridiagonal matrix */
+
+static CSRStorage<double> bandStorage( const IndexType n )
+{
+    return buildStorage( n, [n]( IndexType i ) { return i == 0 || i == n - 1 ? 2 : 3; },
+                            []( IndexType i, IndexType k ) { return i == 0 ? k : i - 1 + k; } );
+}
+
+/** All rows have 3 entries, scattered over the whole matrix */
+
+static CSRStorage<double> uniformStorage( const IndexType n )
+{
+    return buildStorage( n, []( IndexType ) { return 3; },
+                            [n]( IndexType i, IndexType k ) { return ( i * 7 + k ) % n; } );
+}
+
+/** Row lengths vary between 0 and 9 */
+
+static CSRStorage<double> irregularStorage( const IndexType n )
+{
+    return buildStorage( n, []( IndexType i ) { return i % 10; },
+                            [n]( IndexType i, IndexType k ) { return ( i * 7 + k ) % n; } );
+}
+
+/* ------------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE( structureTest )
+{
+    const IndexType n = 50;
+
+    auto a = convert<CSRSparseMatrix<double>>( bandStorage( n ) );
+
+    MatrixStructure structure = StorageTuner<double>::getStructure( a );
+
+    BOOST_CHECK_EQUAL( structure.numRows, n );
+    BOOST_CHECK_EQUAL( structure.numValues, 3 * n - 2 );
+    BOOST_CHECK_EQUAL( structure.maxRowLength, 3 );
+    BOOST_CHECK_EQUAL( structure.numEmptyRows, 0 );
+    BOOST_CHECK_EQUAL( structure.numDiagonals, 3 );
+    BOOST_CHECK_EQUAL( structure.bandwidth, 1 );
+
+    BOOST_CHECK( structure.diagonalOccupancy() > 0.9 );
+
+    auto b = convert<CSRSparseMatrix<double>>( irregularStorage( n ) );
+
+    MatrixStructure structureB = StorageTuner<double>::getStructure( b );
+
+    BOOST_CHECK_EQUAL( structureB.maxRowLength, 9 );
+    BOOST_CHECK_EQUAL( structureB.numEmptyRows, 5 );
+    BOOST_CHECK( structureB.rowLengthVariance > 1.0 );
+
+    // different structures give different fingerprints, same structure gives same fingerprint
+
+    BOOST_CHECK( structure.fingerprint() != structureB.fingerprint() );
+    BOOST_CHECK_EQUAL( structure.fingerprint(), StorageTuner<double>::getStructure( a ).fingerprint() );
+}
+
+/* ------------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE( selectTest )
+{
+    const IndexType n = 50;
+
+    auto band = convert<CSRSparseMatrix<double>>( bandStorage( n ) );
+    auto uniform = convert<CSRSparseMatrix<double>>( uniformStorage( n ) );
+    auto irregular = convert<CSRSparseMatrix<double>>( irregularStorage( n ) );
+
+    BOOST_CHECK_EQUAL( StorageTuner<double>::selectFormat( StorageTuner<double>::getStructure( band ) ), Format::DIA );
+    BOOST_CHECK_EQUAL( StorageTuner<double>::selectFormat( StorageTuner<double>::getStructure( uniform ) ), Format::ELL );
+    BOOST_CHECK_EQUAL( StorageTuner<double>::selectFormat( StorageTuner<double>::getStructure( irregular ) ), Format::CSR );
+
+    StorageTuner<double> tuner;
+
+    tuner.setCacheFile( "" );
+
+    auto tunedBand = tuner.tune( band );
+
+    BOOST_CHECK_EQUAL( tunedBand->getFormat(), Format::DIA );
+    BOOST_CHECK_EQUAL( tunedBand->getLocalStorage().getFormat(), Format::DIA );
+}
+
+/* ------------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE( timingTest )
+{
+    const IndexType n = 50;
+
+    auto storage = irregularStorage( n );
+
+    TestDistributions dists( n );
+
+    for ( size_t i = 0; i < dists.size(); ++i )
+    {
+        auto dist = dists[i];
+
+        auto a = convert<CSRSparseMatrix<double>>( storage );
+        a.redistribute( dist, dist );
+
+        StorageTuner<double> tuner;
+
+        tuner.setCacheFile( "" );
+        tuner.setTiming( true );
+        tuner.setNumIterations( 2 );
+        tuner.setFormats( { Format::CSR, Format::ELL, Format::JDS, Format::COO } );
+
+        TuningDecision decision = tuner.decide( a );
+
+        BOOST_CHECK( !decision.fromCache );
+        BOOST_CHECK( decision.format != Format::DIA );
+
+        auto tunedA = StorageTuner<double>::apply( decision, a );
+
+        SCAI_LOG_INFO( logger, "tuned " << a << " -> " << *tunedA )
+
+        BOOST_CHECK_EQUAL( tunedA->getFormat(), decision.format );
+        BOOST_CHECK_EQUAL( tunedA->getRowDistribution(), a.getRowDistribution() );
+        BOOST_CHECK_EQUAL( tunedA->getColDistribution(), a.getColDistribution() );
+        BOOST_CHECK_EQUAL( tunedA->getHaloStorage().getFormat(), decision.format );
+
+        auto x = denseVectorLinear<double>( dist, 1.0, 0.5 );
+
+        auto expected = denseVectorEval( a * x );
+        auto result   = denseVectorEval( *tunedA * x );
+
+        BOOST_CHECK( expected.maxDiffNorm( result ) < 1e-12 );
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE( cacheTest )
+{
+    const IndexType n = 40;
+
+    auto comm = Communicator::getCommunicatorPtr();
+
+    const std::string fileName = uniquePathSharedAmongNodes( GlobalTempDir::getPath(), *comm, "tuning" ) + ".txt";
+
+    auto a = convert<CSRSparseMatrix<double>>( uniformStorage( n ) );
+
+    a.redistribute( blockDistribution( n, comm ), blockDistribution( n, comm ) );
+
+    StorageTuner<double> tuner;
+
+    tuner.setCacheFile( fileName );
+    tuner.setTiming( true );
+    tuner.setNumIterations( 1 );
+    tuner.setThreadCounts( { 1, 2 } );
+
+    TuningDecision decision1 = tuner.decide( a );
+
+    BOOST_CHECK( !decision1.fromCache );
+    BOOST_CHECK( decision1.numThreads == 1 || decision1.numThreads == 2 );
+
+    TuningDecision decision2 = tuner.decide( a );
+
+    BOOST_CHECK( decision2.fromCache );
+    BOOST_CHECK_EQUAL( decision1.format, decision2.format );
+    BOOST_CHECK_EQUAL( decision1.numThreads, decision2.numThreads );
+
+    // matrix with different structure is not in the cache
+
+    auto b = convert<CSRSparseMatrix<double>>( irregularStorage( n ) );
+
+    TuningDecision decision3 = tuner.decide( b );
+
+    BOOST_CHECK( !decision3.fromCache );
+
+    comm->synchronize();
+
+    if ( comm->getRank() == 0 )
+    {
+        std::remove( fileName.c_str() );
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_SUITE_END();
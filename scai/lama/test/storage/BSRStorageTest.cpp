@@ -0,0 +1,369 @@
+/**
+ * @file BSRStorageTest.cpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Contains the implementation of the class BSRStorageTest
+ * @author Thomas Brandes
+ * @date 19.10.2026
+ */
+
+#include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
+
+#include <scai/lama/storage/BSRStorage.hpp>
+#include <scai/lama/storage/CSRStorage.hpp>
+#include <scai/lama/storage/DenseStorage.hpp>
+#include <scai/common/test/TestMacros.hpp>
+#include <scai/utilskernel.hpp>
+
+#include <scai/lama/test/storage/TestStorages.hpp>
+#include <scai/lama/test/storage/StorageTemplateTests.hpp>
+
+using namespace scai;
+using namespace lama;
+using namespace utilskernel;
+using namespace hmemo;
+
+/* ------------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_SUITE( BSRStorageTest )
+
+SCAI_LOG_DEF_LOGGER( logger, "Test.BSRStorageTest" )
+
+/* ------------------------------------------------------------------------------------------------------------------ */
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( constructorTest, ValueType, scai_numeric_test_types )
+{
+    // Test the full BSRStorage constructor and the individual getter routines of BSR storage
+
+    const IndexType numRows = 5;
+    const IndexType numColumns = 5;
+    const IndexType blockSize = 2;
+
+    //  6  1  0  0  4
+    // -2  8  0  0  0
+    //  0  0  9  4  0
+    //  0  0  1  3  0
+    //  0  0  0  0  5
+
+    HArray<IndexType> bsrIA( { 0, 2, 3, 4 } );
+    HArray<IndexType> bsrJA( { 0, 2, 1, 2 } );
+    HArray<ValueType> bsrValues( { 6, 1, -2, 8, 4, 0, 0, 0, 9, 4, 1, 3, 5, 0, 0, 0 } );
+
+    BSRStorage<ValueType> bsrStorage( numRows, numColumns, blockSize, bsrIA, bsrJA, bsrValues );
+
+    BOOST_REQUIRE_EQUAL( numRows, bsrStorage.getNumRows() );
+    BOOST_REQUIRE_EQUAL( numColumns, bsrStorage.getNumColumns() );
+    BOOST_REQUIRE_EQUAL( blockSize, bsrStorage.getBlockSize() );
+    BOOST_REQUIRE_EQUAL( IndexType( 4 ), bsrStorage.getNumBlocks() );
+
+    DenseStorage<ValueType> denseStorage( numRows, numColumns,
+                                          HArray<ValueType>( { 6, 1, 0, 0, 4,
+                                                              -2, 8, 0, 0, 0,
+                                                               0, 0, 9, 4, 0,
+                                                               0, 0, 1, 3, 0,
+                                                               0, 0, 0, 0, 5 } ) );
+
+    BOOST_CHECK_EQUAL( bsrStorage.maxDiffNorm( denseStorage ), 0 );
+
+    // conversion from the dense storage results in same BSR data
+
+    BSRStorage<ValueType> bsrStorage1;
+    bsrStorage1.setBlockSize( blockSize );
+    bsrStorage1.assign( denseStorage );
+
+    BOOST_TEST( hostReadAccess( bsrIA ) == hostReadAccess( bsrStorage1.getIA() ), boost::test_tools::per_element() );
+    BOOST_TEST( hostReadAccess( bsrJA ) == hostReadAccess( bsrStorage1.getJA() ), boost::test_tools::per_element() );
+    BOOST_TEST( hostReadAccess( bsrValues ) == hostReadAccess( bsrStorage1.getValues() ), boost::test_tools::per_element() );
+}
+
+/* ------------------------------------------------------------------------------------------------------------------ */
+
+BOOST_AUTO_TEST_CASE( blockSizeTest )
+{
+    typedef SCAI_TEST_TYPE ValueType;    // test for one value type is sufficient here
+
+    DenseStorage<ValueType> denseStorage;
+    setDenseData( denseStorage );
+
+    const IndexType numRows = denseStorage.getNumRows();
+    const IndexType numColumns = denseStorage.getNumColumns();
+
+    auto csrStorage = convert<CSRStorage<ValueType>>( denseStorage );
+
+    auto x  = randomHArray<ValueType>( numColumns, 1 );
+    auto y  = randomHArray<ValueType>( numRows, 1 );
+    auto xT = randomHArray<ValueType>( numRows, 1 );
+    auto yT = randomHArray<ValueType>( numColumns, 1 );
+
+    const ValueType alpha = 2;
+    const ValueType beta  = -1;
+
+    HArray<ValueType> expResult;
+    HArray<ValueType> expResultT;
+
+    csrStorage.matrixTimesVector( expResult, alpha, x, beta, y, common::MatrixOp::NORMAL );
+    csrStorage.matrixTimesVector( expResultT, alpha, xT, beta, yT, common::MatrixOp::TRANSPOSE );
+
+    auto bsrStorage = convert<BSRStorage<ValueType>>( csrStorage );
+
+    for ( IndexType blockSize = 1; blockSize <= 7; ++blockSize )
+    {
+        bsrStorage.setBlockSize( blockSize );
+
+        BOOST_CHECK_EQUAL( blockSize, bsrStorage.getBlockSize() );
+
+        bsrStorage.check( "blockSizeTest" );
+
+        BOOST_CHECK_EQUAL( bsrStorage.maxDiffNorm( denseStorage ), 0 );
+
+        HArray<ValueType> result;
+        HArray<ValueType> resultT;
+
+        bsrStorage.matrixTimesVector( result, alpha, x, beta, y, common::MatrixOp::NORMAL );
+        bsrStorage.matrixTimesVector( resultT, alpha, xT, beta, yT, common::MatrixOp::TRANSPOSE );
+
+        BOOST_CHECK( HArrayUtils::maxDiffNorm( result, expResult ) < 0.0001 );
+        BOOST_CHECK( HArrayUtils::maxDiffNorm( resultT, expResultT ) < 0.0001 );
+
+        // copy and new storage keep the block size as required for the halo part
+
+        std::unique_ptr<BSRStorage<ValueType>> copyStorage( bsrStorage.copy() );
+        std::unique_ptr<BSRStorage<ValueType>> newStorage( bsrStorage.newMatrixStorage( numRows, 0 ) );
+
+        BOOST_CHECK_EQUAL( blockSize, copyStorage->getBlockSize() );
+        BOOST_CHECK_EQUAL( blockSize, newStorage->getBlockSize() );
+    }
+}
+
+/* ------------------------------------------------------------------------------------------------------------------ */
+
+BOOST_AUTO_TEST_CASE( blockJacobiTest )
+{
+    typedef SCAI_TEST_TYPE ValueType;    // test for one value type is sufficient here
+
+    // block tridiagonal matrix with strong couplings inside the diagonal blocks
+
+    const IndexType n = 12;
+
+    DenseStorage<ValueType> denseStorage( n, n, HArray<ValueType>( n * n, ValueType( 0 ) ) );
+
+    for ( IndexType i = 0; i < n; ++i )
+    {
+        denseStorage.setValue( i, i, 8 );
+
+        if ( i + 1 < n )
+        {
+            denseStorage.setValue( i, i + 1, 3 );
+            denseStorage.setValue( i + 1, i, 3 );
+        }
+
+        if ( i + 3 < n )
+        {
+            denseStorage.setValue( i, i + 3, -1 );
+            denseStorage.setValue( i + 3, i, -1 );
+        }
+    }
+
+    auto rhs = randomHArray<ValueType>( n, 1 );
+
+    const ValueType omega = 0.8;
+
+    for ( IndexType blockSize = 1; blockSize <= 4; ++blockSize )
+    {
+        BSRStorage<ValueType> bsrStorage;
+        bsrStorage.setBlockSize( blockSize );
+        bsrStorage.assign( denseStorage );
+
+        HArray<ValueType> oldSolution( n, ValueType( 0 ) );
+        HArray<ValueType> solution;
+
+        for ( IndexType iter = 0; iter < 200; ++iter )
+        {
+            bsrStorage.jacobiIterate( solution, oldSolution, rhs, omega );
+            solution.swap( oldSolution );
+        }
+
+        // residual = rhs - A * solution must be close to zero
+
+        HArray<ValueType> residual;
+
+        denseStorage.matrixTimesVector( residual, ValueType( -1 ), oldSolution, ValueType( 1 ), rhs, common::MatrixOp::NORMAL );
+
+        BOOST_CHECK( HArrayUtils::maxNorm( residual ) < 0.0001 );
+
+        // modification of the storage invalidates the inverted diagonal blocks, compare with a
+        // copy of the modified storage that computes them from scratch
+
+        bsrStorage.scale( 2 );
+        bsrStorage.jacobiIterate( solution, oldSolution, rhs, omega );
+
+        BSRStorage<ValueType> bsrCopy( bsrStorage );
+
+        HArray<ValueType> expSolution;
+
+        bsrCopy.jacobiIterate( expSolution, oldSolution, rhs, omega );
+
+        BOOST_CHECK( HArrayUtils::maxDiffNorm( expSolution, solution ) < 0.001 );
+    }
+}
+
+/* ------------------------------------------------------------------------------------------------------------------ */
+
+BOOST_AUTO_TEST_CASE( valueTest )
+{
+    typedef SCAI_TEST_TYPE ValueType;    // test for one value type is sufficient here
+
+    DenseStorage<ValueType> denseStorage;
+    setDenseData( denseStorage );
+
+    BSRStorage<ValueType> bsrStorage;
+    bsrStorage.setBlockSize( 2 );
+    bsrStorage.assign( denseStorage );
+
+    const IndexType numRows = bsrStorage.getNumRows();
+    const IndexType numColumns = bsrStorage.getNumColumns();
+
+    for ( IndexType i = 0; i < numRows; ++i )
+    {
+        HArray<ValueType> row;
+        HArray<ValueType> expRow;
+
+        bsrStorage.getRow( row, i );
+        denseStorage.getRow( expRow, i );
+
+        BOOST_TEST( hostReadAccess( expRow ) == hostReadAccess( row ), boost::test_tools::per_element() );
+    }
+
+    for ( IndexType j = 0; j < numColumns; ++j )
+    {
+        HArray<ValueType> col;
+        HArray<ValueType> expCol;
+
+        bsrStorage.getColumn( col, j );
+        denseStorage.getColumn( expCol, j );
+
+        BOOST_TEST( hostReadAccess( expCol ) == hostReadAccess( col ), boost::test_tools::per_element() );
+    }
+
+    // update all non-zero entries
+
+    for ( IndexType i = 0; i < numRows; ++i )
+    {
+        for ( IndexType j = 0; j < numColumns; ++j )
+        {
+            if ( denseStorage.getValue( i, j ) == ValueType( 0 ) )
+            {
+                continue;
+            }
+
+            bsrStorage.setValue( i, j, 1, common::BinaryOp::ADD );
+            denseStorage.setValue( i, j, 1, common::BinaryOp::ADD );
+        }
+    }
+
+    BOOST_CHECK_EQUAL( bsrStorage.maxDiffNorm( denseStorage ), 0 );
+
+    HArray<ValueType> diagonal;
+
+    bsrStorage.getDiagonal( diagonal );
+
+    HArray<ValueType> expDiagonal( diagonal.size() );
+
+    for ( IndexType i = 0; i < diagonal.size(); ++i )
+    {
+        expDiagonal[i] = denseStorage.getValue( i, i );
+    }
+
+    BOOST_TEST( hostReadAccess( expDiagonal ) == hostReadAccess( diagonal ), boost::test_tools::per_element() );
+
+    // an entry of a block that is not stored cannot be set
+
+    BSRStorage<ValueType> bsrEmpty( 4, 4 );
+    bsrEmpty.setBlockSize( 2 );
+
+    BOOST_CHECK_THROW(
+    {
+        bsrEmpty.setValue( 1, 1, 1 );
+    }, common::Exception );
+
+    bsrEmpty.setIdentity( 5 );
+
+    BOOST_CHECK_EQUAL( bsrEmpty.getNumBlocks(), IndexType( 3 ) );
+    BOOST_CHECK_EQUAL( bsrEmpty.l1Norm(), RealType<ValueType>( 5 ) );
+}
+
+/* ------------------------------------------------------------------------------------------------------------------ */
+
+BOOST_AUTO_TEST_CASE( haloTest )
+{
+    typedef SCAI_TEST_TYPE ValueType;    // test for one value type is sufficient here
+
+    BSRStorage<ValueType> bsrStorage;
+
+    setDenseHalo( bsrStorage );
+
+    // jacobiIterateHalo is only supported for block size 1
+
+    const IndexType numRows = bsrStorage.getNumRows();
+
+    HArray<ValueType> diagonal( numRows, ValueType( 2 ) );
+    HArray<ValueType> oldSolution( bsrStorage.getNumColumns(), ValueType( 1 ) );
+    HArray<ValueType> solution( numRows, ValueType( 0 ) );
+
+    auto csrStorage = convert<CSRStorage<ValueType>>( bsrStorage );
+
+    HArray<ValueType> expSolution( numRows, ValueType( 0 ) );
+
+    csrStorage.jacobiIterateHalo( expSolution, diagonal, oldSolution, ValueType( 0.5 ) );
+    bsrStorage.jacobiIterateHalo( solution, diagonal, oldSolution, ValueType( 0.5 ) );
+
+    BOOST_CHECK( HArrayUtils::maxDiffNorm( expSolution, solution ) < 0.0001 );
+
+    bsrStorage.setBlockSize( 2 );
+
+    BOOST_CHECK_THROW(
+    {
+        bsrStorage.jacobiIterateHalo( solution, diagonal, oldSolution, ValueType( 0.5 ) );
+    }, common::Exception );
+}
+
+/* ------------------------------------------------------------------------------------------------------------------ */
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( typenameTest, ValueType, scai_numeric_test_types )
+{
+    SCAI_LOG_INFO( logger, "typeNameTest for BSRStorage<" << common::TypeTraits<ValueType>::id() << ">" )
+    storageTypeNameTest<BSRStorage<ValueType> >( "BSR" );
+}
+
+/* ------------------------------------------------------------------------------------------------------------------ */
+
+BOOST_AUTO_TEST_CASE( BSRCopyTest )
+{
+    typedef SCAI_TEST_TYPE ValueType;    // test for one value type is sufficient here
+    copyStorageTest<BSRStorage<ValueType> >();
+}
+
+/* ------------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_SUITE_END();
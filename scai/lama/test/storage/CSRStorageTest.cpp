@@ -31,12 +31,16 @@
 #include <boost/mpl/list.hpp>
 
 #include <scai/lama/storage/CSRStorage.hpp>
+#include <scai/lama/storage/StencilStorage.hpp>
 #include <scai/common/test/TestMacros.hpp>
 #include <scai/common/TypeTraits.hpp>
 
 #include <scai/lama/test/storage/TestStorages.hpp>
 #include <scai/lama/test/storage/StorageTemplateTests.hpp>
 
+#include <random>
+#include <algorithm>
+
 using namespace scai;
 using namespace lama;
 using namespace utilskernel;
@@ -383,6 +387,86 @@ BOOST_AUTO_TEST_CASE( setDiagonalFirstTest )
 
 /* ------------------------------------------------------------------------------------------------------------------ */
 
+BOOST_AUTO_TEST_CASE( reorderingTest )
+{
+    typedef SCAI_TEST_TYPE ValueType;    // test for one value type is sufficient here
+
+    ContextPtr context = Context::getContextPtr();
+
+    // 5-point stencil on a 8 x 6 grid, numbered randomly
+
+    const IndexType n1 = 8;
+    const IndexType n2 = 6;
+    const IndexType n  = n1 * n2;
+
+    StencilStorage<ValueType> stencilStorage( common::Grid2D( n1, n2 ), common::Stencil2D<ValueType>( 5 ) );
+
+    auto csr = convert<CSRStorage<ValueType>>( stencilStorage );
+    csr.setContextPtr( context );
+
+    std::vector<IndexType> randomPerm( n );
+
+    for ( IndexType i = 0; i < n; ++i )
+    {
+        randomPerm[i] = i;
+    }
+
+    std::mt19937 generator( 13 );
+    std::shuffle( randomPerm.begin(), randomPerm.end(), generator );
+
+    csr.permuteSymmetric( HArray<IndexType>( randomPerm, context ) );
+
+    auto bandwidth = []( const CSRStorage<ValueType>& storage )
+    {
+        auto ia = hostReadAccess( storage.getIA() );
+        auto ja = hostReadAccess( storage.getJA() );
+
+        IndexType bw = 0;
+
+        for ( IndexType i = 0; i < storage.getNumRows(); ++i )
+        {
+            for ( IndexType jj = ia[i]; jj < ia[i + 1]; ++jj )
+            {
+                bw = std::max( bw, ja[jj] > i ? ja[jj] - i : i - ja[jj] );
+            }
+        }
+
+        return bw;
+    };
+
+    HArray<IndexType> perm;
+
+    csr.buildRCMPermutation( perm );
+
+    BOOST_CHECK( HArrayUtils::validIndexes( perm, n ) );
+
+    HArray<ValueType> x( n );
+    HArrayUtils::setRandom( x, 1 );
+
+    HArray<ValueType> y;
+    csr.matrixTimesVector( y, 1, x, 0, y, common::MatrixOp::NORMAL );
+
+    CSRStorage<ValueType> csrP( csr );
+    csrP.permuteSymmetric( perm );
+
+    BOOST_CHECK( bandwidth( csrP ) <= 2 * std::min( n1, n2 ) );
+    BOOST_CHECK( bandwidth( csrP ) < bandwidth( csr ) );
+
+    // permute vector, multiply, map back the result
+
+    HArray<ValueType> xP;
+    HArray<ValueType> yP;
+    HArrayUtils::gather( xP, x, perm, common::BinaryOp::COPY );
+    csrP.matrixTimesVector( yP, 1, xP, 0, yP, common::MatrixOp::NORMAL );
+
+    HArray<ValueType> y1( n );
+    HArrayUtils::scatter( y1, perm, true, yP, common::BinaryOp::COPY );
+
+    BOOST_CHECK( HArrayUtils::maxDiffNorm( y, y1 ) < 0.0001 );
+}
+
+/* ------------------------------------------------------------------------------------------------------------------ */
+
 BOOST_AUTO_TEST_CASE( CSRCopyTest )
 {
     typedef SCAI_TEST_TYPE ValueType;    // test for one value type is sufficient here
@@ -136,6 +136,142 @@ BOOST_AUTO_TEST_CASE( scaleTest )
 
 /* ------------------------------------------------------------------------------------------------------------------ */
 
+BOOST_AUTO_TEST_CASE( specializedGEMVTest )
+{
+    // stencils with 3, 5, 9, 7, 19, 27 points use specialized kernels, compare results with CSR
+
+    typedef DefaultReal ValueType;
+
+    std::vector<common::Stencil<ValueType> > stencils;
+    std::vector<common::Grid> grids;
+
+    stencils.push_back( common::Stencil1D<ValueType>( 3 ) );
+    grids.push_back( common::Grid1D( 37 ) );
+    stencils.push_back( common::Stencil2D<ValueType>( 5 ) );
+    grids.push_back( common::Grid2D( 7, 19 ) );
+    stencils.push_back( common::Stencil2D<ValueType>( 9 ) );
+    grids.push_back( common::Grid2D( 7, 19 ) );
+    stencils.push_back( common::Stencil3D<ValueType>( 7 ) );
+    grids.push_back( common::Grid3D( 5, 6, 17 ) );
+    stencils.push_back( common::Stencil3D<ValueType>( 19 ) );
+    grids.push_back( common::Grid3D( 5, 6, 17 ) );
+    stencils.push_back( common::Stencil3D<ValueType>( 27 ) );
+    grids.push_back( common::Grid3D( 5, 6, 17 ) );
+
+    for ( size_t i = 0; i < stencils.size(); ++i )
+    {
+        const common::Stencil<ValueType>& stencil = stencils[i];
+
+        // different value for each point so that mismatches of offsets and values are detected
+
+        common::Stencil<ValueType> stencil1( stencil.nDims() );
+
+        for ( IndexType p = 0; p < stencil.nPoints(); ++p )
+        {
+            stencil1.addPoint( stencil.positions() + p * stencil.nDims(), stencil.values()[p] + ValueType( p ) / 4 );
+        }
+
+        StencilStorage<ValueType> stencilStorage( grids[i], stencil1 );
+
+        auto csrStorage = convert<CSRStorage<ValueType>>( stencilStorage );
+
+        HArray<ValueType> x( stencilStorage.getNumColumns() );
+        HArrayUtils::setRandom( x, 1 );
+
+        HArray<ValueType> y( x );
+
+        const ValueType alpha = 2;
+        const ValueType beta  = -1;
+
+        HArray<ValueType> result1;
+        HArray<ValueType> result2;
+
+        stencilStorage.matrixTimesVector( result1, alpha, x, beta, y, common::MatrixOp::NORMAL );
+        csrStorage.matrixTimesVector( result2, alpha, x, beta, y, common::MatrixOp::NORMAL );
+
+        auto eps = common::TypeTraits<ValueType>::small();
+
+        BOOST_CHECK_MESSAGE( HArrayUtils::maxDiffNorm( result1, result2 ) < eps, stencil1 << " on " << grids[i] );
+    }
+}
+
+/* ------------------------------------------------------------------------------------------------------------------ */
+
+BOOST_AUTO_TEST_CASE( jacobiSweepsTest )
+{
+    // blocked sweeps must give same result as single Jacobi iterations
+
+    typedef DefaultReal ValueType;
+
+    const IndexType nSweeps = 11;
+    const ValueType omega = 0.8;
+
+    // grids must be larger than the cache size used for one tile
+
+    common::Grid3D grid3( 60, 40, 41 );
+    common::Grid3D grid3P( 40, 60, 41 );
+    common::Grid2D grid2( 4000, 30 );
+    common::Grid2D grid2P( 4000, 30 );
+    common::Grid1D grid1( 200000 );
+
+    // temporal blocking is only supported for absorbing borders
+
+    grid3P.setBorderType( 0, common::BorderType::PERIODIC );
+    grid2P.setBorderType( 1, common::BorderType::PERIODIC );
+
+    std::vector<StencilStorage<ValueType> > storages;
+
+    storages.push_back( StencilStorage<ValueType>( grid3, common::Stencil3D<ValueType>( 7 ) ) );
+    storages.push_back( StencilStorage<ValueType>( grid3, common::Stencil3D<ValueType>( 27 ) ) );
+    storages.push_back( StencilStorage<ValueType>( grid3P, common::Stencil3D<ValueType>( 19 ) ) );
+    storages.push_back( StencilStorage<ValueType>( grid2, common::Stencil2D<ValueType>( 9 ) ) );
+    storages.push_back( StencilStorage<ValueType>( grid2P, common::Stencil2D<ValueType>( 5 ) ) );
+    storages.push_back( StencilStorage<ValueType>( grid1, common::Stencil1D<ValueType>( 5 ) ) );
+
+    for ( size_t i = 0; i < storages.size(); ++i )
+    {
+        const StencilStorage<ValueType>& storage = storages[i];
+
+        const IndexType n = storage.getNumRows();
+
+        HArray<ValueType> rhs( n );
+        HArray<ValueType> x( n );
+
+        HArrayUtils::setRandom( rhs, 1 );
+        HArrayUtils::setRandom( x, 1 );
+
+        auto csrStorage = convert<CSRStorage<ValueType>>( storage );
+
+        auto eps = common::TypeTraits<ValueType>::small();
+
+        HArray<ValueType> solution1( x );
+        HArray<ValueType> solution2( x );
+
+        HArray<ValueType> tmp;
+
+        // single iteration of stencil storage and CSR storage
+
+        storage.jacobiIterate( solution1, x, rhs, omega );
+        csrStorage.jacobiIterate( tmp, x, rhs, omega );
+
+        BOOST_CHECK_MESSAGE( HArrayUtils::maxDiffNorm( solution1, tmp ) < eps, storage );
+
+        solution1 = x;
+
+        for ( IndexType iter = 0; iter < nSweeps; ++iter )
+        {
+            csrStorage.jacobiIterate( tmp, solution1, rhs, omega );
+            solution1.swap( tmp );
+        }
+
+        storage.jacobiSweeps( solution2, rhs, omega, nSweeps );
+
+        BOOST_CHECK_MESSAGE( HArrayUtils::maxDiffNorm( solution1, solution2 ) < eps, storage );
+    }
+}
+
+/* ------------------------------------------------------------------------------------------------------------------ */
+
 BOOST_AUTO_TEST_CASE_TEMPLATE( convertTest, ValueType, scai_numeric_test_types )
 {
     const IndexType N1 = 5;
@@ -34,6 +34,8 @@
 #include <scai/lama/storage/ELLStorage.hpp>
 #include <scai/lama/storage/JDSStorage.hpp>
 #include <scai/lama/storage/COOStorage.hpp>
+#include <scai/lama/storage/BSRStorage.hpp>
+#include <scai/lama/storage/SymCSRStorage.hpp>
 #include <scai/lama/storage/DIAStorage.hpp>
 #include <scai/lama/storage/DenseStorage.hpp>
 
@@ -53,12 +55,14 @@ SCAI_LOG_DEF_LOGGER( logger, "Test.StorageConstructorTest" );
 /** Define a list of all storagee types. */
 
 typedef boost::mpl::list < 
+            BSRStorage<DefaultReal>,
             COOStorage<DefaultReal>,
             DIAStorage<DefaultReal>,
             CSRStorage<DefaultReal>,
             JDSStorage<DefaultReal>,
             ELLStorage<DefaultReal>,
-            DenseStorage<DefaultReal>
+            DenseStorage<DefaultReal>,
+            SymCSRStorage<DefaultReal>
         > StorageTypes;
 
 /* ------------------------------------------------------------------------- */
@@ -0,0 +1,306 @@
+/**
+ * @file SymCSRStorageTest.cpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Test cases for SymCSRStorage( only specific ones )
+ * @author Thomas Brandes
+ * @date 19.10.2026
+ */
+
+#include <boost/test/unit_test.hpp>
+#include <boost/mpl/list.hpp>
+
+#include <scai/lama/storage/SymCSRStorage.hpp>
+#include <scai/lama/storage/CSRStorage.hpp>
+#include <scai/lama/storage/DenseStorage.hpp>
+#include <scai/lama/storage/StencilStorage.hpp>
+#include <scai/common/test/TestMacros.hpp>
+#include <scai/utilskernel.hpp>
+
+#include <scai/lama/test/storage/TestStorages.hpp>
+#include <scai/lama/test/storage/StorageTemplateTests.hpp>
+
+using namespace scai;
+using namespace lama;
+using namespace utilskernel;
+using namespace hmemo;
+
+/* ------------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_SUITE( SymCSRStorageTest )
+
+SCAI_LOG_DEF_LOGGER( logger, "Test.SymCSRStorageTest" )
+
+/* ------------------------------------------------------------------------------------------------------------------ */
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( constructorTest, ValueType, scai_numeric_test_types )
+{
+    DenseStorage<ValueType> denseStorage;
+    setSymDenseData( denseStorage );
+
+    auto csrStorage = convert<CSRStorage<ValueType>>( denseStorage );
+
+    SymCSRStorage<ValueType> symStorage( csrStorage.getNumRows(), csrStorage.getNumColumns(),
+                                         csrStorage.getIA(), csrStorage.getJA(), csrStorage.getValues() );
+
+    BOOST_REQUIRE( symStorage.isSymmetric() );
+
+    // only upper triangle is stored:  1 2 5 / 1 3 / 1 4 / 2
+
+    HArray<IndexType> expIA( { 0, 3, 5, 7, 8 } );
+    HArray<IndexType> expJA( { 0, 1, 3, 1, 2, 2, 3, 3 } );
+
+    BOOST_TEST( hostReadAccess( expIA ) == hostReadAccess( symStorage.getIA() ), boost::test_tools::per_element() );
+    BOOST_TEST( hostReadAccess( expJA ) == hostReadAccess( symStorage.getJA() ), boost::test_tools::per_element() );
+
+    BOOST_CHECK_EQUAL( symStorage.getNumValues(), csrStorage.getNumValues() );
+    BOOST_CHECK_EQUAL( symStorage.maxDiffNorm( denseStorage ), 0 );
+    BOOST_CHECK( symStorage.checkSymmetry() );
+
+    auto csrStorage1 = convert<CSRStorage<ValueType>>( symStorage );
+
+    BOOST_CHECK_EQUAL( csrStorage1.maxDiffNorm( csrStorage ), 0 );
+    BOOST_CHECK_EQUAL( csrStorage1.getNumValues(), csrStorage.getNumValues() );
+}
+
+/* ------------------------------------------------------------------------------------------------------------------ */
+
+BOOST_AUTO_TEST_CASE( gemvTest )
+{
+    typedef SCAI_TEST_TYPE ValueType;    // test for one value type is sufficient here
+
+    // 5-point stencil on a 9 x 7 grid gives a symmetric matrix
+
+    StencilStorage<ValueType> stencilStorage( common::Grid2D( 9, 7 ), common::Stencil2D<ValueType>( 5 ) );
+
+    auto csrStorage = convert<CSRStorage<ValueType>>( stencilStorage );
+    auto symStorage = convert<SymCSRStorage<ValueType>>( stencilStorage );
+
+    BOOST_REQUIRE( symStorage.isSymmetric() );
+    BOOST_CHECK( symStorage.getJA().size() < csrStorage.getJA().size() );
+
+    const IndexType n = csrStorage.getNumRows();
+
+    auto x = randomHArray<ValueType>( n, 1 );
+    auto y = randomHArray<ValueType>( n, 1 );
+
+    const ValueType alpha = 2;
+    const ValueType beta  = -1;
+
+    HArray<ValueType> expResult;
+
+    csrStorage.matrixTimesVector( expResult, alpha, x, beta, y, common::MatrixOp::NORMAL );
+
+    HArray<ValueType> result;
+
+    symStorage.matrixTimesVector( result, alpha, x, beta, y, common::MatrixOp::NORMAL );
+    BOOST_CHECK( HArrayUtils::maxDiffNorm( expResult, result ) < 0.001 );
+
+    symStorage.matrixTimesVector( result, alpha, x, beta, y, common::MatrixOp::TRANSPOSE );
+    BOOST_CHECK( HArrayUtils::maxDiffNorm( expResult, result ) < 0.001 );
+
+    {
+        std::unique_ptr<tasking::SyncToken> token( symStorage.matrixTimesVectorAsync( result, alpha, x, beta, y, common::MatrixOp::NORMAL ) );
+    }
+
+    BOOST_CHECK( HArrayUtils::maxDiffNorm( expResult, result ) < 0.001 );
+
+    // beta = 0, y must not be used
+
+    csrStorage.matrixTimesVector( expResult, alpha, x, ValueType( 0 ), HArray<ValueType>(), common::MatrixOp::NORMAL );
+    symStorage.matrixTimesVector( result, alpha, x, ValueType( 0 ), HArray<ValueType>(), common::MatrixOp::NORMAL );
+
+    BOOST_CHECK( HArrayUtils::maxDiffNorm( expResult, result ) < 0.001 );
+
+    // norms must be the same as for the full storage
+
+    BOOST_CHECK( common::Math::abs( symStorage.l1Norm() - csrStorage.l1Norm() ) < 0.001 );
+    BOOST_CHECK( common::Math::abs( symStorage.l2Norm() - csrStorage.l2Norm() ) < 0.001 );
+    BOOST_CHECK_EQUAL( symStorage.maxNorm(), csrStorage.maxNorm() );
+}
+
+/* ------------------------------------------------------------------------------------------------------------------ */
+
+BOOST_AUTO_TEST_CASE( rowColumnTest )
+{
+    typedef SCAI_TEST_TYPE ValueType;    // test for one value type is sufficient here
+
+    DenseStorage<ValueType> denseStorage;
+    setSymDenseData( denseStorage );
+
+    auto symStorage = convert<SymCSRStorage<ValueType>>( denseStorage );
+
+    BOOST_REQUIRE( symStorage.isSymmetric() );
+
+    const IndexType n = denseStorage.getNumRows();
+
+    for ( IndexType i = 0; i < n; ++i )
+    {
+        HArray<ValueType> row;
+        HArray<ValueType> expRow;
+        HArray<ValueType> column;
+
+        symStorage.getRow( row, i );
+        denseStorage.getRow( expRow, i );
+        symStorage.getColumn( column, i );
+
+        BOOST_TEST( hostReadAccess( expRow ) == hostReadAccess( row ), boost::test_tools::per_element() );
+        BOOST_TEST( hostReadAccess( expRow ) == hostReadAccess( column ), boost::test_tools::per_element() );
+
+        for ( IndexType j = 0; j < n; ++j )
+        {
+            BOOST_CHECK_EQUAL( symStorage.getValue( i, j ), denseStorage.getValue( i, j ) );
+        }
+    }
+}
+
+/* ------------------------------------------------------------------------------------------------------------------ */
+
+BOOST_AUTO_TEST_CASE( expandTest )
+{
+    typedef SCAI_TEST_TYPE ValueType;    // test for one value type is sufficient here
+
+    DenseStorage<ValueType> denseStorage;
+    setSymDenseData( denseStorage );
+
+    auto symStorage = convert<SymCSRStorage<ValueType>>( denseStorage );
+
+    BOOST_REQUIRE( symStorage.isSymmetric() );
+
+    // diagonal and scale operations keep the symmetry
+
+    symStorage.setDiagonal( 3 );
+    symStorage.scale( 2 );
+    denseStorage.setDiagonal( 3 );
+    denseStorage.scale( 2 );
+
+    BOOST_CHECK( symStorage.isSymmetric() );
+    BOOST_CHECK_EQUAL( symStorage.maxDiffNorm( denseStorage ), 0 );
+
+    // scaling of the rows destroys the symmetry
+
+    HArray<ValueType> scaleValues( { 1, 2, 3, 4 } );
+
+    symStorage.scaleRows( scaleValues );
+    denseStorage.scaleRows( scaleValues );
+
+    BOOST_CHECK( !symStorage.isSymmetric() );
+    BOOST_CHECK_EQUAL( symStorage.maxDiffNorm( denseStorage ), 0 );
+
+    // a non-symmetric storage is kept as full CSR data
+
+    DenseStorage<ValueType> denseStorage1;
+    setDenseSquareData( denseStorage1 );
+
+    symStorage.assign( denseStorage1 );
+
+    BOOST_CHECK( !symStorage.isSymmetric() );
+    BOOST_CHECK( !symStorage.checkSymmetry() );
+    BOOST_CHECK_EQUAL( symStorage.maxDiffNorm( denseStorage1 ), 0 );
+}
+
+/* ------------------------------------------------------------------------------------------------------------------ */
+
+BOOST_AUTO_TEST_CASE( jacobiTest )
+{
+    typedef SCAI_TEST_TYPE ValueType;    // test for one value type is sufficient here
+
+    StencilStorage<ValueType> stencilStorage( common::Grid2D( 6, 5 ), common::Stencil2D<ValueType>( 5 ) );
+
+    auto csrStorage = convert<CSRStorage<ValueType>>( stencilStorage );
+    auto symStorage = convert<SymCSRStorage<ValueType>>( stencilStorage );
+
+    BOOST_REQUIRE( symStorage.isSymmetric() );
+
+    const IndexType n = csrStorage.getNumRows();
+
+    auto oldSolution = randomHArray<ValueType>( n, 1 );
+    auto rhs = randomHArray<ValueType>( n, 1 );
+
+    const ValueType omega = 0.5;
+
+    HArray<ValueType> expSolution;
+    HArray<ValueType> solution;
+
+    csrStorage.jacobiIterate( expSolution, oldSolution, rhs, omega );
+    symStorage.jacobiIterate( solution, oldSolution, rhs, omega );
+
+    BOOST_CHECK( HArrayUtils::maxDiffNorm( expSolution, solution ) < 0.0001 );
+
+    // halo update
+
+    HArray<ValueType> diagonal( n, ValueType( 4 ) );
+
+    csrStorage.jacobiIterateHalo( expSolution, diagonal, oldSolution, omega );
+    symStorage.jacobiIterateHalo( solution, diagonal, oldSolution, omega );
+
+    BOOST_CHECK( HArrayUtils::maxDiffNorm( expSolution, solution ) < 0.0001 );
+}
+
+/* ------------------------------------------------------------------------------------------------------------------ */
+
+BOOST_AUTO_TEST_CASE( haloTest )
+{
+    typedef SCAI_TEST_TYPE ValueType;    // test for one value type is sufficient here
+
+    SymCSRStorage<ValueType> symStorage;
+
+    setDenseHalo( symStorage );
+
+    BOOST_CHECK( !symStorage.isSymmetric() );
+
+    const IndexType numRows = symStorage.getNumRows();
+
+    HArray<ValueType> diagonal( numRows, ValueType( 2 ) );
+    HArray<ValueType> oldSolution( symStorage.getNumColumns(), ValueType( 1 ) );
+    HArray<ValueType> solution( numRows, ValueType( 0 ) );
+
+    auto csrStorage = convert<CSRStorage<ValueType>>( symStorage );
+
+    HArray<ValueType> expSolution( numRows, ValueType( 0 ) );
+
+    csrStorage.jacobiIterateHalo( expSolution, diagonal, oldSolution, ValueType( 0.5 ) );
+    symStorage.jacobiIterateHalo( solution, diagonal, oldSolution, ValueType( 0.5 ) );
+
+    BOOST_CHECK( HArrayUtils::maxDiffNorm( expSolution, solution ) < 0.0001 );
+}
+
+/* ------------------------------------------------------------------------------------------------------------------ */
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( typenameTest, ValueType, scai_numeric_test_types )
+{
+    SCAI_LOG_INFO( logger, "typeNameTest for SymCSRStorage<" << common::TypeTraits<ValueType>::id() << ">" )
+    storageTypeNameTest<SymCSRStorage<ValueType> >( "SymCSR" );
+}
+
+/* ------------------------------------------------------------------------------------------------------------------ */
+
+BOOST_AUTO_TEST_CASE( SymCSRCopyTest )
+{
+    typedef SCAI_TEST_TYPE ValueType;    // test for one value type is sufficient here
+    copyStorageTest<SymCSRStorage<ValueType> >();
+}
+
+/* ------------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,918 @@
+/**
+ * @file GeometricPartitioning.cpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Implementation of partitioning by coordinates.
+ * @author Thomas Brandes
+ * @date 18.10.2018
+ */
+
+// hpp
+#include <scai/partitioning/GeometricPartitioning.hpp>
+
+// local library
+#include <scai/dmemo/GeneralDistribution.hpp>
+
+// internal scai libraries
+#include <scai/hmemo/HostReadAccess.hpp>
+#include <scai/hmemo/HostWriteAccess.hpp>
+#include <scai/hmemo/HostWriteOnlyAccess.hpp>
+#include <scai/common/macros/loop.hpp>
+#include <scai/tracing.hpp>
+
+// std
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace scai
+{
+
+using namespace hmemo;
+using namespace dmemo;
+
+namespace partitioning
+{
+
+SCAI_LOG_DEF_LOGGER( GeometricPartitioning::logger, "Partitioning.GeometricPartitioning" )
+
+/** All keys of the space filling curves are smaller than this value */
+
+static const uint64_t KEY_MAX = uint64_t( 1 ) << 63;
+
+/** Maximal number of bisection steps to find a cut */
+
+static const IndexType MAX_BISECTION_STEPS = 64;
+
+/** Relative tolerance for the weight of a part, bisection of RCB stops if reached */
+
+static const double RCB_TOLERANCE = 1e-3;
+
+/* ---------------------------------------------------------------------------------*/
+
+std::ostream& operator<<( std::ostream& stream, const GeometricPartitioning::Method& method )
+{
+    switch ( method )
+    {
+        case GeometricPartitioning::Method::RCB :
+            stream << "RCB";
+            break;
+        case GeometricPartitioning::Method::HILBERT :
+            stream << "HILBERT";
+            break;
+        case GeometricPartitioning::Method::MORTON :
+            stream << "MORTON";
+            break;
+        default:
+            stream << "<unknown_method>";
+    }
+
+    return stream;
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+GeometricPartitioning::GeometricPartitioning( const Method method ) :
+
+    mMethod( method ),
+    mDim( 0 ),
+    mIncremental( false )
+{
+}
+
+GeometricPartitioning::~GeometricPartitioning()
+{
+}
+
+void GeometricPartitioning::writeAt( std::ostream& stream ) const
+{
+    stream << "GeometricPartitioning( " << mMethod << ", dim = " << mDim << " )";
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+template<typename ValueType>
+void GeometricPartitioning::setCoordinates( const std::vector<lama::DenseVector<ValueType> >& coordinates )
+{
+    SCAI_ASSERT_GT_ERROR( coordinates.size(), 0, "no coordinates specified" )
+
+    mDim = static_cast<IndexType>( coordinates.size() );
+    mDistribution = coordinates[0].getDistributionPtr();
+
+    const IndexType n = mDistribution->getLocalSize();
+
+    mCoordinates.resize( n * mDim );
+
+    for ( IndexType d = 0; d < mDim; ++d )
+    {
+        SCAI_ASSERT_EQ_ERROR( coordinates[d].getDistribution(), *mDistribution,
+                              "coordinates for dim = " << d << " have different distribution" )
+
+        auto rCoords = hostReadAccess( coordinates[d].getLocalValues() );
+
+        for ( IndexType i = 0; i < n; ++i )
+        {
+            mCoordinates[ i * mDim + d ] = static_cast<double>( rCoords[i] );
+        }
+    }
+
+    mIncremental = false;
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+void GeometricPartitioning::setGridCoordinates( const common::Grid& grid, DistributionPtr dist )
+{
+    SCAI_ASSERT_EQ_ERROR( grid.size(), dist->getGlobalSize(), "grid does not fit to distribution" )
+
+    mDim = grid.nDims();
+    mDistribution = dist;
+
+    HArray<IndexType> ownedIndexes;
+
+    dist->getOwnedIndexes( ownedIndexes );
+
+    const IndexType n = ownedIndexes.size();
+
+    mCoordinates.resize( n * mDim );
+
+    auto rOwned = hostReadAccess( ownedIndexes );
+
+    IndexType pos[ SCAI_GRID_MAX_DIMENSION ];
+
+    for ( IndexType i = 0; i < n; ++i )
+    {
+        grid.gridPos( pos, rOwned[i] );
+
+        for ( IndexType d = 0; d < mDim; ++d )
+        {
+            mCoordinates[ i * mDim + d ] = static_cast<double>( pos[d] );
+        }
+    }
+
+    mIncremental = false;
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+void GeometricPartitioning::partition(
+    HArray<PartitionId>& newLocalOwners,
+    const HArray<float>& localWeights,
+    const HArray<float>& processorWeights )
+{
+    SCAI_REGION( "Partitioning.Geometric.partition" )
+
+    SCAI_ASSERT_ERROR( mDistribution, "no coordinates set for geometric partitioning" )
+
+    const IndexType n = mDistribution->getLocalSize();
+
+    std::vector<double> weights( n, 1.0 );
+
+    if ( localWeights.size() > 0 )
+    {
+        SCAI_ASSERT_EQ_ERROR( localWeights.size(), n, "serious mismatch for array with local weights" )
+
+        auto rWeights = hostReadAccess( localWeights );
+
+        std::copy( rWeights.begin(), rWeights.end(), weights.begin() );
+    }
+
+    SCAI_ASSERT_GT_ERROR( processorWeights.size(), 0, "no parts for partitioning" )
+
+    // norm the processor weights so that they sum up to 1
+
+    auto normedWeights = hostReadAccess( processorWeights ).buildVector<double>();
+
+    double sum = 0;
+
+    for ( size_t p = 0; p < normedWeights.size(); ++p )
+    {
+        sum += normedWeights[p];
+    }
+
+    for ( size_t p = 0; p < normedWeights.size(); ++p )
+    {
+        normedWeights[p] /= sum;
+    }
+
+    SCAI_LOG_INFO( logger, *this << ": partition " << *mDistribution << " into " << normedWeights.size()
+                            << " parts, incremental = " << mIncremental )
+
+    if ( mMethod == Method::RCB )
+    {
+        partitionRCB( newLocalOwners, weights, normedWeights );
+    }
+    else
+    {
+        if ( !mIncremental )
+        {
+            computeKeys();
+        }
+
+        partitionSFC( newLocalOwners, weights, normedWeights );
+    }
+
+    mIncremental = true;
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+DistributionPtr GeometricPartitioning::partitionIt( const HArray<float>& localWeights, const float weight )
+{
+    SCAI_ASSERT_ERROR( mDistribution, "no coordinates set for geometric partitioning" )
+
+    const Communicator& comm = mDistribution->getCommunicator();
+
+    const PartitionId MASTER = 0;
+
+    const PartitionId np = comm.getSize();
+
+    HArray<float> processorWeights;
+
+    {
+        auto wWeights = hostWriteOnlyAccess( processorWeights, np );
+        comm.gather( wWeights.get(), 1, MASTER, &weight );
+        comm.bcast( wWeights.get(), np, MASTER );
+    }
+
+    HArray<PartitionId> newLocalOwners;
+
+    partition( newLocalOwners, localWeights, processorWeights );
+
+    return generalDistributionByNewOwners( *mDistribution, newLocalOwners );
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+/** Transform coordinates to the transposed Hilbert index, algorithm by J. Skilling,
+ *  "Programming the Hilbert curve", AIP Conf. Proc. 707, 2004.
+ */
+static void axesToTranspose( uint64_t x[], const IndexType bits, const IndexType dim )
+{
+    const uint64_t M = uint64_t( 1 ) << ( bits - 1 );
+
+    // inverse undo
+
+    for ( uint64_t Q = M; Q > 1; Q >>= 1 )
+    {
+        const uint64_t P = Q - 1;
+
+        for ( IndexType i = 0; i < dim; i++ )
+        {
+            if ( x[i] & Q )
+            {
+                x[0] ^= P;   // invert
+            }
+            else
+            {
+                uint64_t t = ( x[0] ^ x[i] ) & P;   // exchange
+                x[0] ^= t;
+                x[i] ^= t;
+            }
+        }
+    }
+
+    // Gray encode
+
+    for ( IndexType i = 1; i < dim; i++ )
+    {
+        x[i] ^= x[i - 1];
+    }
+
+    uint64_t t = 0;
+
+    for ( uint64_t Q = M; Q > 1; Q >>= 1 )
+    {
+        if ( x[dim - 1] & Q )
+        {
+            t ^= Q - 1;
+        }
+    }
+
+    for ( IndexType i = 0; i < dim; i++ )
+    {
+        x[i] ^= t;
+    }
+}
+
+/** Interleave the bits of the dim values, most significant bits first */
+
+static uint64_t interleave( const uint64_t x[], const IndexType bits, const IndexType dim )
+{
+    uint64_t key = 0;
+
+    for ( IndexType b = bits; b-- > 0; )
+    {
+        for ( IndexType i = 0; i < dim; ++i )
+        {
+            key = ( key << 1 ) | ( ( x[i] >> b ) & 1 );
+        }
+    }
+
+    return key;
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+void GeometricPartitioning::computeKeys()
+{
+    SCAI_REGION( "Partitioning.Geometric.keys" )
+
+    const IndexType n = mDistribution->getLocalSize();
+
+    const Communicator& comm = mDistribution->getCommunicator();
+
+    SCAI_ASSERT_LE_ERROR( mDim, 63, "too many dimensions for space filling curve" )
+
+    // global bounding box of all points
+
+    HArray<double> minCoords( mDim, std::numeric_limits<double>::max() );
+    HArray<double> maxCoords( mDim, -std::numeric_limits<double>::max() );
+
+    {
+        auto wMin = hostWriteAccess( minCoords );
+        auto wMax = hostWriteAccess( maxCoords );
+
+        for ( IndexType i = 0; i < n; ++i )
+        {
+            for ( IndexType d = 0; d < mDim; ++d )
+            {
+                wMin[d] = std::min( wMin[d], mCoordinates[ i * mDim + d ] );
+                wMax[d] = std::max( wMax[d], mCoordinates[ i * mDim + d ] );
+            }
+        }
+    }
+
+    comm.reduce( minCoords, common::BinaryOp::MIN );
+    comm.reduce( maxCoords, common::BinaryOp::MAX );
+
+    auto rMin = hostReadAccess( minCoords );
+    auto rMax = hostReadAccess( maxCoords );
+
+    // number of bits used for each dimension, all keys must be smaller than KEY_MAX
+
+    const IndexType bits = std::min( IndexType( 21 ), 63 / mDim );
+
+    const double scale = static_cast<double>( ( uint64_t( 1 ) << bits ) - 1 );
+
+    std::vector<std::pair<uint64_t, IndexType> > keys( n );
+
+    #pragma omp parallel for
+
+    for ( IndexType i = 0; i < n; ++i )
+    {
+        uint64_t x[ 64 ];
+
+        for ( IndexType d = 0; d < mDim; ++d )
+        {
+            const double extent = rMax[d] - rMin[d];
+
+            x[d] = extent > 0 ? static_cast<uint64_t>( ( mCoordinates[ i * mDim + d ] - rMin[d] ) / extent * scale ) : 0;
+        }
+
+        if ( mMethod == Method::HILBERT )
+        {
+            axesToTranspose( x, bits, mDim );
+        }
+
+        keys[i] = std::pair<uint64_t, IndexType>( interleave( x, bits, mDim ), i );
+    }
+
+    std::sort( keys.begin(), keys.end() );
+
+    mSortedKeys.resize( n );
+    mSortedPerm.resize( n );
+
+    for ( IndexType i = 0; i < n; ++i )
+    {
+        mSortedKeys[i] = keys[i].first;
+        mSortedPerm[i] = keys[i].second;
+    }
+
+    mSplitters.clear();
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+void GeometricPartitioning::partitionSFC(
+    HArray<PartitionId>& newLocalOwners,
+    const std::vector<double>& weights,
+    const std::vector<double>& processorWeights )
+{
+    SCAI_REGION( "Partitioning.Geometric.SFC" )
+
+    const Communicator& comm = mDistribution->getCommunicator();
+
+    const IndexType n = static_cast<IndexType>( mSortedKeys.size() );
+
+    // prefix sums of the weights along the curve
+
+    std::vector<double> prefix( n + 1 );
+
+    prefix[0] = 0;
+
+    for ( IndexType k = 0; k < n; ++k )
+    {
+        prefix[k + 1] = prefix[k] + weights[ mSortedPerm[k] ];
+    }
+
+    const double total = comm.sum( prefix[n] );
+
+    const IndexType nSplitters = static_cast<IndexType>( processorWeights.size() ) - 1;
+
+    // splitter p is the smallest key of part p + 1, target is the weight of all parts <= p
+
+    std::vector<double> targets( nSplitters );
+
+    double fraction = 0;
+
+    for ( IndexType p = 0; p < nSplitters; ++p )
+    {
+        fraction += processorWeights[p];
+        targets[p] = std::min( total, fraction * total );
+    }
+
+    // global weight of all points with key < splitter for multiple splitters
+
+    HArray<double> globalWeights;
+
+    auto weightBelow = [&]( const std::vector<uint64_t>& keys )
+    {
+        {
+            auto wWeights = hostWriteOnlyAccess( globalWeights, static_cast<IndexType>( keys.size() ) );
+
+            for ( size_t p = 0; p < keys.size(); ++p )
+            {
+                size_t pos = std::lower_bound( mSortedKeys.begin(), mSortedKeys.end(), keys[p] ) - mSortedKeys.begin();
+                wWeights[p] = prefix[pos];
+            }
+        }
+
+        comm.sumArray( globalWeights );
+
+        return hostReadAccess( globalWeights ).buildVector<double>();
+    };
+
+    // intervals for the bisection with invariant W(lo) < target <= W(hi)
+
+    std::vector<uint64_t> lo( nSplitters, 0 );
+    std::vector<uint64_t> hi( nSplitters, KEY_MAX );
+    std::vector<double> wLo( nSplitters, 0 );
+    std::vector<double> wHi( nSplitters, total );
+
+    if ( mIncremental && static_cast<IndexType>( mSplitters.size() ) == nSplitters )
+    {
+        // start with the previous splitters and increase the interval until it contains the target
+
+        std::vector<double> w = weightBelow( mSplitters );
+
+        std::vector<bool> down( nSplitters );       // true if the new splitter is smaller than the old one
+        std::vector<bool> bracketed( nSplitters );
+        std::vector<uint64_t> steps( nSplitters, 1 );
+
+        for ( IndexType p = 0; p < nSplitters; ++p )
+        {
+            down[p] = w[p] >= targets[p];
+            bracketed[p] = targets[p] <= 0;
+
+            if ( down[p] )
+            {
+                hi[p] = mSplitters[p];
+                wHi[p] = w[p];
+            }
+            else
+            {
+                lo[p] = mSplitters[p];
+                wLo[p] = w[p];
+            }
+        }
+
+        while ( !std::all_of( bracketed.begin(), bracketed.end(), []( bool b ) { return b; } ) )
+        {
+            std::vector<uint64_t> candidates( nSplitters );
+
+            for ( IndexType p = 0; p < nSplitters; ++p )
+            {
+                if ( down[p] )
+                {
+                    candidates[p] = hi[p] > steps[p] ? hi[p] - steps[p] : 0;
+                }
+                else
+                {
+                    candidates[p] = KEY_MAX - lo[p] > steps[p] ? lo[p] + steps[p] : KEY_MAX;
+                }
+            }
+
+            std::vector<double> wCandidates = weightBelow( candidates );
+
+            for ( IndexType p = 0; p < nSplitters; ++p )
+            {
+                if ( bracketed[p] )
+                {
+                    continue;
+                }
+
+                if ( wCandidates[p] >= targets[p] )
+                {
+                    hi[p] = candidates[p];
+                    wHi[p] = wCandidates[p];
+                    bracketed[p] = !down[p];
+                }
+                else
+                {
+                    lo[p] = candidates[p];
+                    wLo[p] = wCandidates[p];
+                    bracketed[p] = down[p];
+                }
+
+                steps[p] *= 2;
+            }
+        }
+    }
+
+    // bisection for all splitters simultaneously
+
+    for ( IndexType step = 0; step < MAX_BISECTION_STEPS; ++step )
+    {
+        std::vector<uint64_t> mid( nSplitters );
+
+        bool active = false;
+
+        for ( IndexType p = 0; p < nSplitters; ++p )
+        {
+            mid[p] = lo[p] + ( hi[p] - lo[p] ) / 2;
+
+            if ( hi[p] - lo[p] > 1 && targets[p] > 0 )
+            {
+                active = true;
+            }
+        }
+
+        if ( !active )
+        {
+            break;
+        }
+
+        std::vector<double> w = weightBelow( mid );
+
+        for ( IndexType p = 0; p < nSplitters; ++p )
+        {
+            if ( hi[p] - lo[p] <= 1 || targets[p] <= 0 )
+            {
+                continue;
+            }
+
+            if ( w[p] >= targets[p] )
+            {
+                hi[p] = mid[p];
+                wHi[p] = w[p];
+            }
+            else
+            {
+                lo[p] = mid[p];
+                wLo[p] = w[p];
+            }
+        }
+    }
+
+    // choose the bound with the weight closest to the target, splitters must be monotonic
+
+    mSplitters.resize( nSplitters );
+
+    for ( IndexType p = 0; p < nSplitters; ++p )
+    {
+        if ( targets[p] <= 0 )
+        {
+            mSplitters[p] = 0;
+        }
+        else
+        {
+            mSplitters[p] = wHi[p] - targets[p] <= targets[p] - wLo[p] ? hi[p] : lo[p];
+        }
+
+        if ( p > 0 )
+        {
+            mSplitters[p] = std::max( mSplitters[p], mSplitters[p - 1] );
+        }
+    }
+
+    SCAI_LOG_DEBUG( logger, comm << ": splitters computed for " << nSplitters + 1 << " parts" )
+
+    auto wOwners = hostWriteOnlyAccess( newLocalOwners, n );
+
+    #pragma omp parallel for
+
+    for ( IndexType k = 0; k < n; ++k )
+    {
+        size_t owner = std::upper_bound( mSplitters.begin(), mSplitters.end(), mSortedKeys[k] ) - mSplitters.begin();
+        wOwners[ mSortedPerm[k] ] = static_cast<PartitionId>( owner );
+    }
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+void GeometricPartitioning::partitionRCB(
+    HArray<PartitionId>& newLocalOwners,
+    const std::vector<double>& weights,
+    const std::vector<double>& processorWeights )
+{
+    SCAI_REGION( "Partitioning.Geometric.RCB" )
+
+    const Communicator& comm = mDistribution->getCommunicator();
+
+    const IndexType n = mDistribution->getLocalSize();
+
+    const PartitionId np = static_cast<PartitionId>( processorWeights.size() );
+
+    // previous cuts can only be used if the number of parts has not changed
+
+    const bool useOldCuts = mIncremental && static_cast<PartitionId>( mCutDims.size() ) == np - 1;
+
+    if ( !useOldCuts )
+    {
+        mCutDims.clear();
+        mCutValues.clear();
+    }
+
+    // segment s stands for the parts firstPart[s], ..., firstPart[s] + numParts[s] - 1
+
+    std::vector<PartitionId> firstPart( 1, 0 );
+    std::vector<PartitionId> numParts( 1, np );
+
+    std::vector<IndexType> pointSegment( n, 0 );
+
+    IndexType cutCounter = 0;
+
+    while ( *std::max_element( numParts.begin(), numParts.end() ) > 1 )
+    {
+        const IndexType nSeg = static_cast<IndexType>( numParts.size() );
+
+        // bounding box and total weight of each segment
+
+        HArray<double> minCoords( nSeg * mDim, std::numeric_limits<double>::max() );
+        HArray<double> maxCoords( nSeg * mDim, -std::numeric_limits<double>::max() );
+        HArray<double> segWeights( nSeg, 0.0 );
+
+        {
+            auto wMin = hostWriteAccess( minCoords );
+            auto wMax = hostWriteAccess( maxCoords );
+            auto wWeights = hostWriteAccess( segWeights );
+
+            for ( IndexType i = 0; i < n; ++i )
+            {
+                const IndexType s = pointSegment[i];
+
+                for ( IndexType d = 0; d < mDim; ++d )
+                {
+                    wMin[ s * mDim + d ] = std::min( wMin[ s * mDim + d ], mCoordinates[ i * mDim + d ] );
+                    wMax[ s * mDim + d ] = std::max( wMax[ s * mDim + d ], mCoordinates[ i * mDim + d ] );
+                }
+
+                wWeights[s] += weights[i];
+            }
+        }
+
+        comm.reduce( minCoords, common::BinaryOp::MIN );
+        comm.reduce( maxCoords, common::BinaryOp::MAX );
+        comm.sumArray( segWeights );
+
+        auto rMin = hostReadAccess( minCoords );
+        auto rMax = hostReadAccess( maxCoords );
+        auto rWeights = hostReadAccess( segWeights );
+
+        // determine cut dimension and target weight for each segment that is split
+
+        std::vector<IndexType> cutDim( nSeg, 0 );
+        std::vector<IndexType> cutId( nSeg, invalidIndex );
+        std::vector<double> target( nSeg, 0 );
+        std::vector<double> lo( nSeg ), hi( nSeg ), cut( nSeg );
+        std::vector<bool> active( nSeg, false );
+
+        for ( IndexType s = 0; s < nSeg; ++s )
+        {
+            if ( numParts[s] <= 1 )
+            {
+                continue;
+            }
+
+            const PartitionId nParts0 = numParts[s] / 2;
+
+            double w0 = 0;
+            double w  = 0;
+
+            for ( PartitionId p = 0; p < numParts[s]; ++p )
+            {
+                w += processorWeights[ firstPart[s] + p ];
+
+                if ( p < nParts0 )
+                {
+                    w0 += processorWeights[ firstPart[s] + p ];
+                }
+            }
+
+            target[s] = w > 0 ? rWeights[s] * w0 / w : 0.5 * rWeights[s];
+
+            cutId[s] = cutCounter++;
+
+            if ( useOldCuts )
+            {
+                cutDim[s] = mCutDims[ cutId[s] ];
+            }
+            else
+            {
+                double maxExtent = -1;
+
+                for ( IndexType d = 0; d < mDim; ++d )
+                {
+                    const double extent = rMax[ s * mDim + d ] - rMin[ s * mDim + d ];
+
+                    if ( extent > maxExtent )
+                    {
+                        maxExtent = extent;
+                        cutDim[s] = d;
+                    }
+                }
+            }
+
+            lo[s] = rMin[ s * mDim + cutDim[s] ];
+            hi[s] = rMax[ s * mDim + cutDim[s] ];
+
+            // empty segment has an illegal bounding box
+
+            if ( lo[s] > hi[s] )
+            {
+                lo[s] = 0;
+                hi[s] = 0;
+            }
+
+            cut[s] = 0.5 * ( lo[s] + hi[s] );
+
+            if ( useOldCuts )
+            {
+                cut[s] = std::min( hi[s], std::max( lo[s], mCutValues[ cutId[s] ] ) );
+            }
+
+            active[s] = true;
+        }
+
+        // bisection for the cut positions of all segments simultaneously
+
+        HArray<double> cutWeights;
+
+        for ( IndexType step = 0; step < MAX_BISECTION_STEPS; ++step )
+        {
+            {
+                auto wCutWeights = hostWriteOnlyAccess( cutWeights, nSeg );
+
+                std::fill( wCutWeights.begin(), wCutWeights.end(), 0.0 );
+
+                for ( IndexType i = 0; i < n; ++i )
+                {
+                    const IndexType s = pointSegment[i];
+
+                    if ( active[s] && mCoordinates[ i * mDim + cutDim[s] ] <= cut[s] )
+                    {
+                        wCutWeights[s] += weights[i];
+                    }
+                }
+            }
+
+            comm.sumArray( cutWeights );
+
+            auto rCutWeights = hostReadAccess( cutWeights );
+
+            bool anyActive = false;
+
+            for ( IndexType s = 0; s < nSeg; ++s )
+            {
+                if ( !active[s] )
+                {
+                    continue;
+                }
+
+                const double w = rCutWeights[s];
+
+                const double extent = rMax[ s * mDim + cutDim[s] ] - rMin[ s * mDim + cutDim[s] ];
+
+                if ( std::abs( w - target[s] ) <= RCB_TOLERANCE * rWeights[s] || hi[s] - lo[s] <= 1e-12 * extent )
+                {
+                    active[s] = false;
+                    continue;
+                }
+
+                if ( w < target[s] )
+                {
+                    lo[s] = cut[s];
+                }
+                else
+                {
+                    hi[s] = cut[s];
+                }
+
+                cut[s] = 0.5 * ( lo[s] + hi[s] );
+
+                anyActive = true;
+            }
+
+            if ( !anyActive )
+            {
+                break;
+            }
+        }
+
+        // build the new segments and assign the points
+
+        std::vector<PartitionId> newFirstPart;
+        std::vector<PartitionId> newNumParts;
+        std::vector<IndexType> leftSeg( nSeg );
+        std::vector<IndexType> rightSeg( nSeg );
+
+        for ( IndexType s = 0; s < nSeg; ++s )
+        {
+            leftSeg[s] = static_cast<IndexType>( newFirstPart.size() );
+            rightSeg[s] = leftSeg[s];
+
+            if ( numParts[s] <= 1 )
+            {
+                newFirstPart.push_back( firstPart[s] );
+                newNumParts.push_back( numParts[s] );
+                continue;
+            }
+
+            const PartitionId nParts0 = numParts[s] / 2;
+
+            newFirstPart.push_back( firstPart[s] );
+            newNumParts.push_back( nParts0 );
+
+            rightSeg[s] = leftSeg[s] + 1;
+
+            newFirstPart.push_back( firstPart[s] + nParts0 );
+            newNumParts.push_back( numParts[s] - nParts0 );
+
+            if ( useOldCuts )
+            {
+                mCutValues[ cutId[s] ] = cut[s];
+            }
+            else
+            {
+                mCutDims.push_back( cutDim[s] );
+                mCutValues.push_back( cut[s] );
+            }
+        }
+
+        #pragma omp parallel for
+
+        for ( IndexType i = 0; i < n; ++i )
+        {
+            const IndexType s = pointSegment[i];
+
+            pointSegment[i] = mCoordinates[ i * mDim + cutDim[s] ] <= cut[s] ? leftSeg[s] : rightSeg[s];
+        }
+
+        firstPart.swap( newFirstPart );
+        numParts.swap( newNumParts );
+    }
+
+    auto wOwners = hostWriteOnlyAccess( newLocalOwners, n );
+
+    for ( IndexType i = 0; i < n; ++i )
+    {
+        wOwners[i] = firstPart[ pointSegment[i] ];
+    }
+}
+
+/* ---------------------------------------------------------------------------------*/
+/*   Template instantiations                                                         */
+/* ---------------------------------------------------------------------------------*/
+
+#define SCAI_GEOMETRIC_PARTITIONING_INST( ValueType )                                        \
+    template COMMON_DLL_IMPORTEXPORT void GeometricPartitioning::setCoordinates<ValueType>(  \
+        const std::vector<lama::DenseVector<ValueType> >& );
+
+SCAI_COMMON_LOOP( SCAI_GEOMETRIC_PARTITIONING_INST, SCAI_REAL_TYPES_HOST )
+
+#undef SCAI_GEOMETRIC_PARTITIONING_INST
+
+} /* end namespace partitioning */
+
+} /* end namespace scai */
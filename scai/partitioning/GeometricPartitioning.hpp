@@ -0,0 +1,190 @@
+/**
+ * @file GeometricPartitioning.hpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Partitioning by coordinates (recursive coordinate bisection, space filling curves)
+ * @author Thomas Brandes
+ * @date 18.10.2018
+ */
+
+#pragma once
+
+// for dll_import
+#include <scai/common/config.hpp>
+
+// base classes
+#include <scai/common/NonCopyable.hpp>
+#include <scai/common/Printable.hpp>
+
+#include <scai/lama/DenseVector.hpp>
+#include <scai/dmemo/Distribution.hpp>
+#include <scai/common/Grid.hpp>
+#include <scai/logging.hpp>
+
+#include <vector>
+#include <cstdint>
+
+namespace scai
+{
+
+namespace partitioning
+{
+
+/** Geometric partitioning computes a new mapping of points by their coordinates and not
+ *  by their connectivity as done by the graph partitionings.
+ *
+ *  The following methods are supported:
+ *
+ *   - RCB: recursive coordinate bisection, each part is split by the weighted median of the
+ *          coordinates in the dimension with the largest extent
+ *   - HILBERT: points are sorted along a Hilbert space filling curve that is split in parts of equal weight
+ *   - MORTON:  same as HILBERT but with the Morton (Z-order) curve
+ *
+ *  All methods work on distributed data; only reductions are needed, the coordinates
+ *  themselves are never communicated.
+ *
+ *  The coordinates are set once and the sorted curve keys (SFC) or the cut positions (RCB) are kept,
+ *  so a repartitioning with new weights (e.g. for dynamic load balancing) is rather cheap.
+ *
+ *  \code
+ *     GeometricPartitioning partitioning( GeometricPartitioning::Method::HILBERT );
+ *     partitioning.setCoordinates( coordinates );  // std::vector<DenseVector<double>>, one for each dim
+ *     auto dist = partitioning.partitionIt( weights, 1.0f );
+ *     ...
+ *     auto dist1 = partitioning.partitionIt( newWeights, 1.0f );   // incremental
+ *  \endcode
+ */
+class COMMON_DLL_IMPORTEXPORT GeometricPartitioning:
+
+    public common::Printable,
+    private common::NonCopyable
+{
+public:
+
+    /** Enumeration type for the supported geometric partitioning methods */
+
+    enum class Method
+    {
+        RCB,        //!< recursive coordinate bisection
+        HILBERT,    //!< Hilbert space filling curve
+        MORTON      //!< Morton (Z-order) space filling curve
+    };
+
+    /** Constructor of a geometric partitioning with a given method */
+
+    explicit GeometricPartitioning( const Method method = Method::HILBERT );
+
+    virtual ~GeometricPartitioning();
+
+    /** Set the coordinates of the points that will be partitioned.
+     *
+     *  @param[in] coordinates one vector for each dimension, all vectors must have the same distribution
+     *
+     *  This distribution is also the source distribution of the new partitioning.
+     */
+    template<typename ValueType>
+    void setCoordinates( const std::vector<lama::DenseVector<ValueType> >& coordinates );
+
+    /** Set the positions of a grid as coordinates of the points.
+     *
+     *  @param[in] grid is the global grid, grid.size() == dist->getGlobalSize()
+     *  @param[in] dist is the current distribution of the grid elements, e.g. a GridDistribution
+     */
+    void setGridCoordinates( const common::Grid& grid, dmemo::DistributionPtr dist );
+
+    /** Compute the new owners for the local points.
+     *
+     *  @param[out] newLocalOwners   new owner for each local point
+     *  @param[in]  localWeights     weight for each local point, empty array for unit weights
+     *  @param[in]  processorWeights desired weights of the parts, size is the number of parts
+     *
+     *  A second call with the same coordinates, e.g. after changing the weights, uses
+     *  the previous result as starting point and is much cheaper.
+     */
+    void partition( hmemo::HArray<PartitionId>& newLocalOwners,
+                    const hmemo::HArray<float>& localWeights,
+                    const hmemo::HArray<float>& processorWeights );
+
+    /** Compute a new general distribution for the points.
+     *
+     *  @param[in] localWeights     weight for each local point, empty array for unit weights
+     *  @param[in] weight           individual weight of this processor
+     */
+    dmemo::DistributionPtr partitionIt( const hmemo::HArray<float>& localWeights, const float weight );
+
+    /** Query if the next call of partition can use the results of a previous one. */
+
+    bool isIncremental() const
+    {
+        return mIncremental;
+    }
+
+    /** Override Printable::writeAt */
+
+    virtual void writeAt( std::ostream& stream ) const;
+
+private:
+
+    /** Compute the keys of the local points for the space filling curve */
+
+    void computeKeys();
+
+    void partitionSFC( hmemo::HArray<PartitionId>& newLocalOwners,
+                       const std::vector<double>& weights,
+                       const std::vector<double>& targets );
+
+    void partitionRCB( hmemo::HArray<PartitionId>& newLocalOwners,
+                       const std::vector<double>& weights,
+                       const std::vector<double>& processorWeights );
+
+    Method mMethod;
+
+    dmemo::DistributionPtr mDistribution;    // distribution of the points
+
+    IndexType mDim;                          // number of dimensions
+
+    std::vector<double> mCoordinates;        // local coordinates, mDim values for each point
+
+    bool mIncremental;                       // true if previous results can be used
+
+    // data kept for the space filling curves
+
+    std::vector<uint64_t> mSortedKeys;       // sorted keys of the local points
+    std::vector<IndexType> mSortedPerm;      // local point of the sorted keys
+    std::vector<uint64_t> mSplitters;        // splitters of the previous partitioning
+
+    // data kept for the recursive coordinate bisection
+
+    std::vector<IndexType> mCutDims;         // dimension of each cut in order of computation
+    std::vector<double> mCutValues;          // position of each cut in order of computation
+
+    SCAI_LOG_DECL_STATIC_LOGGER( logger )
+};
+
+/** Output of the geometric partitioning method in a stream */
+
+COMMON_DLL_IMPORTEXPORT std::ostream& operator<<( std::ostream& stream, const GeometricPartitioning::Method& method );
+
+} /* end namespace partitioning */
+
+} /* end namespace scai */
@@ -0,0 +1,384 @@
+/**
+ * @file LoadBalancer.cpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Implementation of dynamic load balancing by measured runtimes
+ * @author Thomas Brandes
+ * @date 18.10.2018
+ */
+
+// hpp
+#include <scai/partitioning/LoadBalancer.hpp>
+
+// local library
+#include <scai/dmemo/RedistributePlan.hpp>
+
+// internal scai libraries
+#include <scai/lama/storage/_MatrixStorage.hpp>
+#include <scai/hmemo/HostReadAccess.hpp>
+#include <scai/hmemo/HostWriteOnlyAccess.hpp>
+#include <scai/common/Walltime.hpp>
+#include <scai/common/macros/assert.hpp>
+#include <scai/tracing.hpp>
+
+// std
+#include <algorithm>
+
+namespace scai
+{
+
+using namespace hmemo;
+using namespace dmemo;
+
+namespace partitioning
+{
+
+SCAI_LOG_DEF_LOGGER( LoadBalancer::logger, "Partitioning.LoadBalancer" )
+
+/* ---------------------------------------------------------------------------------*/
+
+LoadBalancer::LoadBalancer( const float tolerance, const float damping ) :
+
+    mTolerance( tolerance ),
+    mDamping( damping ),
+    mStart( 0 ),
+    mTime( 0 )
+{
+    SCAI_ASSERT_GE_ERROR( tolerance, 0.0f, "illegal tolerance for load balancer" )
+    SCAI_ASSERT_ERROR( damping >= 0.0f && damping < 1.0f, "damping = " << damping << " must be in range [0, 1)" )
+}
+
+LoadBalancer::~LoadBalancer()
+{
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+void LoadBalancer::writeAt( std::ostream& stream ) const
+{
+    stream << "LoadBalancer( tolerance = " << mTolerance << ", damping = " << mDamping
+           << ", time = " << mTime << " )";
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+void LoadBalancer::start()
+{
+    mStart = common::Walltime::get();
+}
+
+void LoadBalancer::stop()
+{
+    mTime += common::Walltime::get() - mStart;
+}
+
+void LoadBalancer::addTime( const double time )
+{
+    mTime += time;
+}
+
+void LoadBalancer::reset()
+{
+    mTime = 0;
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+float LoadBalancer::getImbalance( const Communicator& comm ) const
+{
+    const double maxTime = comm.max( mTime );
+    const double avgTime = comm.sum( mTime ) / comm.getSize();
+
+    if ( avgTime <= 0 )
+    {
+        return 1.0f;
+    }
+
+    return static_cast<float>( maxTime / avgTime );
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+void LoadBalancer::computeWeights(
+    HArray<float>& processorWeights,
+    const double localWork,
+    const Communicator& comm ) const
+{
+    const PartitionId MASTER = 0;
+
+    const PartitionId np = comm.getSize();
+
+    std::vector<double> times( np );
+    std::vector<double> work( np );
+
+    comm.gather( times.data(), 1, MASTER, &mTime );
+    comm.bcast( times.data(), np, MASTER );
+    comm.gather( work.data(), 1, MASTER, &localWork );
+    comm.bcast( work.data(), np, MASTER );
+
+    double totalWork = 0;
+
+    for ( PartitionId p = 0; p < np; ++p )
+    {
+        totalWork += work[p];
+    }
+
+    // speed of each processor, average speed for processors without measurement
+
+    std::vector<double> speed( np, 0 );
+
+    double sumSpeed = 0;
+    PartitionId nMeasured = 0;
+
+    for ( PartitionId p = 0; p < np; ++p )
+    {
+        if ( times[p] > 0 && work[p] > 0 )
+        {
+            speed[p] = work[p] / times[p];
+            sumSpeed += speed[p];
+            nMeasured++;
+        }
+    }
+
+    for ( PartitionId p = 0; p < np; ++p )
+    {
+        if ( nMeasured == 0 )
+        {
+            speed[p] = 1;
+        }
+        else if ( !( times[p] > 0 && work[p] > 0 ) )
+        {
+            speed[p] = sumSpeed / nMeasured;
+        }
+    }
+
+    sumSpeed = 0;
+
+    for ( PartitionId p = 0; p < np; ++p )
+    {
+        sumSpeed += speed[p];
+    }
+
+    // new weight is a mixture of the current work distribution and the measured speed
+
+    auto wWeights = hostWriteOnlyAccess( processorWeights, np );
+
+    double sumWeights = 0;
+
+    for ( PartitionId p = 0; p < np; ++p )
+    {
+        double current = totalWork > 0 ? work[p] / totalWork : 1.0 / np;
+        double measured = speed[p] / sumSpeed;
+        double weight = mDamping * current + ( 1.0 - mDamping ) * measured;
+        wWeights[p] = static_cast<float>( weight );
+        sumWeights += weight;
+    }
+
+    for ( PartitionId p = 0; p < np; ++p )
+    {
+        wWeights[p] = static_cast<float>( wWeights[p] / sumWeights );
+    }
+
+    SCAI_LOG_INFO( logger, comm << ": new processor weights computed, my weight = " << wWeights[comm.getRank()]
+                           << ", time = " << mTime << ", work = " << localWork )
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+void LoadBalancer::shiftPartitioning(
+    HArray<PartitionId>& newLocalOwners,
+    const HArray<float>& rowWeights,
+    const HArray<float>& processorWeights,
+    const Communicator& comm )
+{
+    SCAI_REGION( "partitioning.shift" )
+
+    const PartitionId np = processorWeights.size();
+
+    SCAI_ASSERT_GT_ERROR( np, 0, "no processor weights" )
+
+    const IndexType localN = rowWeights.size();
+
+    auto rWeights = hostReadAccess( rowWeights );
+
+    double localWeight = 0;
+
+    for ( IndexType i = 0; i < localN; ++i )
+    {
+        localWeight += rWeights[i];
+    }
+
+    // position of the local rows in the chain of all processors
+
+    const double totalWeight = comm.sum( localWeight );
+    const double offset = comm.scan( localWeight ) - localWeight;
+
+    // boundaries[p] is the start position of processor p in the new partitioning
+
+    std::vector<double> boundaries( np + 1 );
+
+    {
+        auto rProcWeights = hostReadAccess( processorWeights );
+
+        double sumProcWeights = 0;
+
+        for ( PartitionId p = 0; p < np; ++p )
+        {
+            sumProcWeights += rProcWeights[p];
+        }
+
+        boundaries[0] = 0;
+
+        for ( PartitionId p = 0; p < np; ++p )
+        {
+            boundaries[p + 1] = boundaries[p] + totalWeight * rProcWeights[p] / sumProcWeights;
+        }
+    }
+
+    auto wOwners = hostWriteOnlyAccess( newLocalOwners, localN );
+
+    double pos = offset;
+
+    PartitionId owner = 0;
+
+    for ( IndexType i = 0; i < localN; ++i )
+    {
+        // the center of a row decides about the new owner, positions are increasing
+
+        const double center = pos + 0.5 * rWeights[i];
+
+        while ( owner < np - 1 && center >= boundaries[owner + 1] )
+        {
+            owner++;
+        }
+
+        wOwners[i] = owner;
+        pos += rWeights[i];
+    }
+
+    SCAI_LOG_DEBUG( logger, comm << ": shift partitioning, local weight = " << localWeight << ", offset = " << offset
+                            << ", total = " << totalWeight )
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+void LoadBalancer::rowWeights( HArray<float>& weights, const lama::_Matrix& matrix )
+{
+    HArray<IndexType> sizes;
+
+    matrix.getLocalStorage().buildCSRSizes( sizes );
+
+    const IndexType localN = sizes.size();
+
+    auto rSizes = hostReadAccess( sizes );
+    auto wWeights = hostWriteOnlyAccess( weights, localN );
+
+    for ( IndexType i = 0; i < localN; ++i )
+    {
+        wWeights[i] = static_cast<float>( rSizes[i] + 1 );
+    }
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+bool LoadBalancer::rebalance( lama::_Matrix& matrix, const std::vector<lama::_Vector*>& vectors )
+{
+    SCAI_REGION( "partitioning.rebalance" )
+
+    DistributionPtr rowDist = matrix.getRowDistributionPtr();
+
+    if ( rowDist->isReplicated() )
+    {
+        reset();
+        return false;
+    }
+
+    const Communicator& comm = rowDist->getCommunicator();
+
+    const float imbalance = getImbalance( comm );
+
+    SCAI_LOG_INFO( logger, comm << ": " << *this << ", imbalance = " << imbalance )
+
+    if ( imbalance <= 1.0f + mTolerance )
+    {
+        reset();
+        return false;
+    }
+
+    for ( size_t k = 0; k < vectors.size(); ++k )
+    {
+        SCAI_ASSERT_EQ_ERROR( vectors[k]->getDistribution(), *rowDist, "vector " << k << " does not match row distribution" )
+    }
+
+    HArray<float> weights;
+
+    rowWeights( weights, matrix );
+
+    double localWork = 0;
+
+    {
+        auto rWeights = hostReadAccess( weights );
+
+        for ( IndexType i = 0; i < weights.size(); ++i )
+        {
+            localWork += rWeights[i];
+        }
+    }
+
+    HArray<float> processorWeights;
+
+    computeWeights( processorWeights, localWork, comm );
+
+    HArray<PartitionId> newLocalOwners;
+
+    shiftPartitioning( newLocalOwners, weights, processorWeights, comm );
+
+    // one plan for the redistribution of all data
+
+    auto plan = redistributePlanByNewOwners( newLocalOwners, rowDist );
+
+    DistributionPtr colDist = matrix.getColDistributionPtr();
+
+    if ( *colDist == *rowDist )
+    {
+        colDist = plan.getTargetDistributionPtr();
+    }
+
+    matrix.redistribute( plan, colDist );
+
+    for ( size_t k = 0; k < vectors.size(); ++k )
+    {
+        vectors[k]->redistribute( plan );
+    }
+
+    SCAI_LOG_INFO( logger, comm << ": rebalanced, local size " << rowDist->getLocalSize()
+                           << " -> " << plan.getTargetDistributionPtr()->getLocalSize() )
+
+    reset();
+
+    return true;
+}
+
+} /* end namespace partitioning */
+
+} /* end namespace scai */
@@ -0,0 +1,187 @@
+/**
+ * @file LoadBalancer.hpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Dynamic load balancing by measured runtimes of the processors
+ * @author Thomas Brandes
+ * @date 18.10.2018
+ */
+
+#pragma once
+
+// for dll_import
+#include <scai/common/config.hpp>
+
+// base classes
+#include <scai/common/NonCopyable.hpp>
+#include <scai/common/Printable.hpp>
+
+#include <scai/lama/matrix/_Matrix.hpp>
+#include <scai/lama/_Vector.hpp>
+#include <scai/dmemo/Communicator.hpp>
+#include <scai/logging.hpp>
+
+#include <vector>
+
+namespace scai
+{
+
+namespace partitioning
+{
+
+/** A load balancer computes a new mapping of matrix rows by the measured runtimes of the processors.
+ *
+ *  The partitioning methods take a static weight for each processor. On heterogeneous systems the
+ *  speed of the processors is not known in advance and might change over time. The load balancer
+ *  measures the time of the calling processor for a certain code region (e.g. the matrix-vector
+ *  multiplication), derives new weights from the measured speed and redistributes the matrix
+ *  and its vectors if the imbalance exceeds a tolerance.
+ *
+ *  The new mapping is computed incrementally: the local rows of all processors are considered
+ *  as one chain in the order of the ranks and only the boundaries between neighbored processors
+ *  are shifted. So the number of migrated rows is minimal and a block distribution remains a
+ *  block distribution.
+ *
+ *  \code
+ *     LoadBalancer balancer;
+ *
+ *     for ( IndexType iter = 0; iter < maxIter; ++iter )
+ *     {
+ *         balancer.start();
+ *         y = A * x;
+ *         balancer.stop();
+ *         ...
+ *         if ( iter % 10 == 9 )
+ *         {
+ *             balancer.rebalance( A, { &x, &y } );
+ *         }
+ *     }
+ *  \endcode
+ */
+class COMMON_DLL_IMPORTEXPORT LoadBalancer:
+
+    public common::Printable,
+    private common::NonCopyable
+{
+public:
+
+    /** Constructor of a load balancer
+     *
+     *  @param[in] tolerance  rebalance only if the maximal time exceeds the average time by this fraction
+     *  @param[in] damping    new weights are the current weights scaled by this fraction plus the measured ones
+     *                        scaled by 1 - damping, avoids oscillation
+     */
+    explicit LoadBalancer( const float tolerance = 0.05f, const float damping = 0.5f );
+
+    virtual ~LoadBalancer();
+
+    /** Start the time measurement for a region */
+
+    void start();
+
+    /** Stop the time measurement for a region, the time since start is added */
+
+    void stop();
+
+    /** Add time that has been measured otherwise */
+
+    void addTime( const double time );
+
+    /** Get the accumulated time of the calling processor */
+
+    double getTime() const
+    {
+        return mTime;
+    }
+
+    /** Reset the accumulated time */
+
+    void reset();
+
+    /** Get the imbalance of the accumulated times, i.e. maximal time / average time
+     *
+     *  This method must be called by all processors of the communicator.
+     */
+    float getImbalance( const dmemo::Communicator& comm ) const;
+
+    /** Compute new processor weights by the measured speed of each processor.
+     *
+     *  @param[out] processorWeights   new weights for all processors, size is comm.getSize(), sum is 1
+     *  @param[in]  localWork          work done by this processor in the accumulated time
+     *  @param[in]  comm               communicator for the involved processors
+     */
+    void computeWeights(
+        hmemo::HArray<float>& processorWeights,
+        const double localWork,
+        const dmemo::Communicator& comm ) const;
+
+    /** Incremental repartitioning by shifting the boundaries between the processors.
+     *
+     *  @param[out] newLocalOwners   new owner for each local row
+     *  @param[in]  rowWeights       weight of each local row
+     *  @param[in]  processorWeights desired weights of the parts, size is the number of parts
+     *  @param[in]  comm             communicator for the involved processors
+     *
+     *  Like for the partitioning methods the number of parts does not have to be the number of processors.
+     */
+    static void shiftPartitioning(
+        hmemo::HArray<PartitionId>& newLocalOwners,
+        const hmemo::HArray<float>& rowWeights,
+        const hmemo::HArray<float>& processorWeights,
+        const dmemo::Communicator& comm );
+
+    /** Compute the weight of the local rows of a matrix, it is the number of non-zero entries plus 1. */
+
+    static void rowWeights( hmemo::HArray<float>& weights, const lama::_Matrix& matrix );
+
+    /** Redistribute a matrix and its vectors if the measured times are imbalanced.
+     *
+     *  @param[in,out] matrix  is the matrix whose rows are redistributed
+     *  @param[in,out] vectors are redistributed in the same way, must have the row distribution of the matrix
+     *  @returns true if the data has been redistributed
+     *
+     *  The column distribution of a square matrix is changed in the same way if it is the same as the row distribution.
+     *  All data is redistributed with one single redistribution plan. The accumulated time is reset.
+     */
+    bool rebalance( lama::_Matrix& matrix, const std::vector<lama::_Vector*>& vectors );
+
+    /** Override Printable::writeAt */
+
+    virtual void writeAt( std::ostream& stream ) const;
+
+private:
+
+    float mTolerance;
+
+    float mDamping;
+
+    double mStart;    // start time of the current measurement
+
+    double mTime;     // accumulated time
+
+    SCAI_LOG_DECL_STATIC_LOGGER( logger )
+};
+
+} /* end namespace partitioning */
+
+} /* end namespace scai */
@@ -0,0 +1,1102 @@
+/**
+ * @file MultilevelPartitioning.cpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Implementation of native multilevel graph partitioning.
+ * @author Thomas Brandes
+ * @date 18.10.2018
+ */
+
+// hpp
+#include <scai/partitioning/MultilevelPartitioning.hpp>
+#include <scai/partitioning/CSRGraph.hpp>
+#include <scai/partitioning/CSRGraph2.hpp>
+
+// local library
+
+#include <scai/lama/matrix/CSRSparseMatrix.hpp>
+#include <scai/dmemo/SingleDistribution.hpp>
+#include <scai/dmemo/RedistributePlan.hpp>
+
+// internal scai libraries
+
+#include <scai/utilskernel/HArrayUtils.hpp>
+#include <scai/tracing.hpp>
+
+// std
+#include <algorithm>
+#include <queue>
+#include <random>
+#include <utility>
+
+namespace scai
+{
+
+using namespace lama;
+using namespace dmemo;
+using namespace hmemo;
+
+namespace partitioning
+{
+
+SCAI_LOG_DEF_LOGGER( MultilevelPartitioning::logger, "Partitioning.MultilevelPartitioning" )
+
+#define MASTER 0
+
+/** Coarsening stops if the graph has less vertices than this value */
+
+static const IndexType COARSEN_TO = 100;
+
+/** Number of trials for the initial bisection of the coarsest graph */
+
+static const IndexType INITIAL_TRIALS = 8;
+
+/** Maximal number of FM passes on each level */
+
+static const IndexType MAX_FM_PASSES = 8;
+
+/** FM pass stops after this number of moves without any improvement */
+
+static const IndexType MAX_FM_NO_GAIN = 64;
+
+/** Allowed imbalance for each bisection, relative to the weight of the smaller part */
+
+static const float IMBALANCE = 0.03f;
+
+MultilevelPartitioning::MultilevelPartitioning()
+{
+}
+
+void MultilevelPartitioning::writeAt( std::ostream& stream ) const
+{
+    stream << "MultilevelPartitioning";
+}
+
+MultilevelPartitioning::~MultilevelPartitioning()
+{
+    SCAI_LOG_INFO( logger, "~MultilevelPartitioning" )
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+IndexType MultilevelPartitioning::Graph::totalWeight() const
+{
+    IndexType total = 0;
+
+    for ( size_t i = 0; i < vertexWeights.size(); ++i )
+    {
+        total += vertexWeights[i];
+    }
+
+    return total;
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+void MultilevelPartitioning::squarePartitioning(
+    HArray<PartitionId>& newLocalOwners,
+    const lama::_Matrix& matrix,
+    const HArray<float>& processorWeights ) const
+{
+    HArray<float> vertexWeights;   // empty array, weights are taken by the graph
+
+    squarePartitioningW( newLocalOwners, matrix, vertexWeights, processorWeights );
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+void MultilevelPartitioning::squarePartitioningW(
+    HArray<PartitionId>& newLocalOwners,
+    const lama::_Matrix& matrix,
+    const HArray<float>& vertexWeights,
+    const HArray<float>& processorWeights ) const
+{
+    SCAI_REGION( "Partitioning.Multilevel.square" )
+
+    SCAI_ASSERT_EQ_ERROR( matrix.getNumRows(), matrix.getNumColumns(), "square partitioning only for square matrices" )
+
+    HArray<float> normedProcessorWeights( processorWeights );
+    Partitioning::normWeights( normedProcessorWeights );
+
+    DistributionPtr dist = matrix.getRowDistributionPtr();
+
+    const Communicator& comm = dist->getCommunicator();
+
+    const bool hasVertexWeights = vertexWeights.size() > 0;
+
+    if ( hasVertexWeights )
+    {
+        SCAI_ASSERT_EQ_ERROR( dist->getLocalSize(), vertexWeights.size(), "serious mismatch for array with vertex weights" )
+    }
+
+    // Note: the vertex weights of all processors are only needed on the master, so the
+    //       flag hasVertexWeights must be the same on all processors
+
+    bool anyVertexWeights = comm.any( hasVertexWeights );
+
+    SCAI_ASSERT_EQ_ERROR( anyVertexWeights, comm.all( hasVertexWeights ), "vertex weights must be given by all or none" )
+
+    DistributionPtr singleDist( new SingleDistribution( dist->getGlobalSize(), dist->getCommunicatorPtr(), MASTER ) );
+
+    CSRSparseMatrix<DefaultReal> csrMatrix;
+    csrMatrix.assign( matrix );
+    csrMatrix.redistribute( singleDist, singleDist );
+
+    // plan is used to bring the vertex weights to the master and the new owners back
+
+    auto plan = redistributePlanByNewDistribution( singleDist, dist );
+
+    HArray<float> allVertexWeights;
+
+    if ( anyVertexWeights )
+    {
+        plan.redistribute( allVertexWeights, vertexWeights );
+    }
+
+    HArray<PartitionId> newOwners;
+
+    if ( comm.getRank() == MASTER )
+    {
+        SCAI_LOG_INFO( logger, "Master process does the partitioning" )
+        squarePartitioningMaster( newOwners, csrMatrix, allVertexWeights, normedProcessorWeights );
+    }
+    else
+    {
+        SCAI_LOG_INFO( logger, comm << ": wait for results of MASTER partitioning" )
+    }
+
+    plan.reverse();
+    plan.redistribute( newLocalOwners, newOwners );
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+void MultilevelPartitioning::squarePartitioningMaster(
+    HArray<PartitionId>& newOwners,
+    const lama::_Matrix& matrix,
+    const HArray<float>& vertexWeights,
+    const HArray<float>& processorWeights ) const
+{
+    SCAI_LOG_INFO( logger, "Multilevel square partitioning, matrix = " << matrix << ", #parts = " << processorWeights.size() )
+
+    bool isSingle = true;
+    CSRGraph<IndexType> graph( matrix, isSingle );
+
+    if ( vertexWeights.size() == 0 )
+    {
+        partitionGraph( newOwners, graph.ia(), graph.ja(), graph.weights(), processorWeights );
+    }
+    else
+    {
+        // float weights are rounded to integer values, each vertex has at least weight 1
+
+        HArray<IndexType> iVertexWeights;
+
+        {
+            auto rWeights = hostReadAccess( vertexWeights );
+            auto wWeights = hostWriteOnlyAccess( iVertexWeights, vertexWeights.size() );
+
+            for ( IndexType i = 0; i < vertexWeights.size(); ++i )
+            {
+                wWeights[i] = std::max( IndexType( 1 ), static_cast<IndexType>( rWeights[i] + 0.5f ) );
+            }
+        }
+
+        partitionGraph( newOwners, graph.ia(), graph.ja(), iVertexWeights, processorWeights );
+    }
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+void MultilevelPartitioning::rectangularPartitioning(
+    HArray<PartitionId>& rowMapping,
+    HArray<PartitionId>& colMapping,
+    const lama::_Matrix& matrix,
+    const HArray<float>& processorWeights ) const
+{
+    SCAI_REGION( "Partitioning.Multilevel.rectangular" )
+
+    SCAI_LOG_INFO( logger, "Multilevel: rectangular partitioning for " << processorWeights.size()
+                            << " processors, matrix = " << matrix )
+
+    HArray<float> normedProcessorWeights( processorWeights );
+    Partitioning::normWeights( normedProcessorWeights );
+
+    CSRGraph2<IndexType> graph( matrix );
+
+    IndexType numRows    = matrix.getNumRows();
+    IndexType numColumns = matrix.getNumColumns();
+    IndexType nNodes     = numRows + numColumns;
+
+    IndexType ncon = graph.vertexWeights().size() / nNodes;
+
+    SCAI_ASSERT_EQ_ERROR( ncon * nNodes, graph.vertexWeights().size(), "#weights is not multiple of #nodes = " << nNodes )
+
+    // take only the first constraint as weight
+
+    HArray<IndexType> vertexWeights;
+
+    {
+        auto rWeights = hostReadAccess( graph.vertexWeights() );
+        auto wWeights = hostWriteOnlyAccess( vertexWeights, nNodes );
+
+        for ( IndexType i = 0; i < nNodes; ++i )
+        {
+            wWeights[i] = rWeights[ i * ncon ];
+        }
+    }
+
+    HArray<PartitionId> mapping;
+
+    partitionGraph( mapping, graph.ia(), graph.ja(), vertexWeights, normedProcessorWeights );
+
+    // split mapping to new owners for rows and new owners for columns
+
+    auto rMapping = hostReadAccess( mapping );
+
+    auto wRowMapping = hostWriteOnlyAccess( rowMapping, numRows );
+    auto wColMapping = hostWriteOnlyAccess( colMapping, numColumns );
+
+    std::copy( rMapping.begin(), rMapping.begin() + numRows, wRowMapping.begin() );
+    std::copy( rMapping.begin() + numRows, rMapping.end(), wColMapping.begin() );
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+void MultilevelPartitioning::partitionGraph(
+    HArray<PartitionId>& owners,
+    const HArray<IndexType>& ia,
+    const HArray<IndexType>& ja,
+    const HArray<IndexType>& vertexWeights,
+    const HArray<float>& processorWeights )
+{
+    SCAI_REGION( "Partitioning.Multilevel.partitionGraph" )
+
+    const IndexType n = ia.size() - 1;
+
+    SCAI_ASSERT_GE_ERROR( n, 0, "illegal offset array" )
+    SCAI_ASSERT_GT_ERROR( processorWeights.size(), 0, "no parts for partitioning" )
+
+    // build graph for the finest level, diagonal elements are removed
+
+    Graph graph;
+
+    {
+        auto rIA = hostReadAccess( ia );
+        auto rJA = hostReadAccess( ja );
+
+        graph.ia.resize( n + 1 );
+        graph.ja.reserve( rJA.size() );
+
+        graph.ia[0] = 0;
+
+        for ( IndexType i = 0; i < n; ++i )
+        {
+            for ( IndexType jj = rIA[i]; jj < rIA[i + 1]; ++jj )
+            {
+                IndexType j = rJA[jj];
+
+                if ( j != i && j != invalidIndex )
+                {
+                    SCAI_ASSERT_VALID_INDEX_DEBUG( j, n, "illegal column index in graph" )
+                    graph.ja.push_back( j );
+                }
+            }
+
+            graph.ia[i + 1] = static_cast<IndexType>( graph.ja.size() );
+        }
+
+        graph.edgeWeights.assign( graph.ja.size(), 1 );
+    }
+
+    if ( vertexWeights.size() == 0 )
+    {
+        graph.vertexWeights.assign( n, 1 );
+    }
+    else
+    {
+        SCAI_ASSERT_EQ_ERROR( vertexWeights.size(), n, "serious mismatch for vertex weights" )
+        graph.vertexWeights = hostReadAccess( vertexWeights ).buildVector<IndexType>();
+    }
+
+    std::vector<IndexType> vertexIds( n );
+
+    for ( IndexType i = 0; i < n; ++i )
+    {
+        vertexIds[i] = i;
+    }
+
+    auto weights = hostReadAccess( processorWeights ).buildVector<float>();
+
+    std::vector<PartitionId> result( n, 0 );
+
+    const PartitionId nParts = static_cast<PartitionId>( weights.size() );
+
+    #pragma omp parallel
+    {
+        #pragma omp single
+        {
+            recursiveBisection( result, graph, vertexIds, weights, 0, nParts );
+        }
+    }
+
+    auto wOwners = hostWriteOnlyAccess( owners, n );
+
+    std::copy( result.begin(), result.end(), wOwners.begin() );
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+void MultilevelPartitioning::recursiveBisection(
+    std::vector<PartitionId>& owners,
+    const Graph& graph,
+    const std::vector<IndexType>& vertexIds,
+    const std::vector<float>& processorWeights,
+    const PartitionId firstPart,
+    const PartitionId nParts )
+{
+    const IndexType n = graph.numVertices();
+
+    if ( nParts == 1 || n == 0 )
+    {
+        for ( IndexType i = 0; i < n; ++i )
+        {
+            owners[vertexIds[i]] = firstPart;
+        }
+
+        return;
+    }
+
+    const PartitionId nParts0 = nParts / 2;
+
+    float weight0 = 0;
+    float weight  = 0;
+
+    for ( PartitionId p = 0; p < nParts; ++p )
+    {
+        weight += processorWeights[firstPart + p];
+
+        if ( p < nParts0 )
+        {
+            weight0 += processorWeights[firstPart + p];
+        }
+    }
+
+    const float fraction = weight > 0 ? weight0 / weight : 0.5f;
+
+    std::vector<IndexType> side;
+
+    bisect( side, graph, fraction );
+
+    // each task builds its own subgraph, so the graph might be freed by the calling task
+
+    for ( IndexType s = 0; s < 2; ++s )
+    {
+        #pragma omp task shared( owners, graph, vertexIds, processorWeights, side ) firstprivate( s, firstPart, nParts, nParts0 )
+        {
+            Graph subGraph;
+            std::vector<IndexType> subVertexIds;
+
+            extractSubgraph( subGraph, subVertexIds, graph, vertexIds, side, s );
+
+            PartitionId subFirst  = s == 0 ? firstPart : firstPart + nParts0;
+            PartitionId subNParts = s == 0 ? nParts0 : nParts - nParts0;
+
+            recursiveBisection( owners, subGraph, subVertexIds, processorWeights, subFirst, subNParts );
+        }
+    }
+
+    #pragma omp taskwait
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+void MultilevelPartitioning::extractSubgraph(
+    Graph& subGraph,
+    std::vector<IndexType>& subVertexIds,
+    const Graph& graph,
+    const std::vector<IndexType>& vertexIds,
+    const std::vector<IndexType>& side,
+    const IndexType s )
+{
+    const IndexType n = graph.numVertices();
+
+    std::vector<IndexType> newIndex( n, invalidIndex );
+
+    subVertexIds.clear();
+
+    for ( IndexType i = 0; i < n; ++i )
+    {
+        if ( side[i] == s )
+        {
+            newIndex[i] = static_cast<IndexType>( subVertexIds.size() );
+            subVertexIds.push_back( vertexIds[i] );
+            subGraph.vertexWeights.push_back( graph.vertexWeights[i] );
+        }
+    }
+
+    subGraph.ia.assign( 1, 0 );
+
+    for ( IndexType i = 0; i < n; ++i )
+    {
+        if ( side[i] != s )
+        {
+            continue;
+        }
+
+        for ( IndexType jj = graph.ia[i]; jj < graph.ia[i + 1]; ++jj )
+        {
+            IndexType j = graph.ja[jj];
+
+            if ( side[j] == s )
+            {
+                subGraph.ja.push_back( newIndex[j] );
+                subGraph.edgeWeights.push_back( graph.edgeWeights[jj] );
+            }
+        }
+
+        subGraph.ia.push_back( static_cast<IndexType>( subGraph.ja.size() ) );
+    }
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+void MultilevelPartitioning::bisect( std::vector<IndexType>& side, const Graph& graph, const float fraction )
+{
+    // build the hierarchy of coarsened graphs, levels[0] is the input graph
+
+    std::vector<Graph> levels;
+    std::vector<std::vector<IndexType> > cmaps;
+
+    const IndexType totalWeight = graph.totalWeight();
+
+    // limit for vertex weights on coarse levels, avoids heavy vertices that cannot be balanced
+
+    const IndexType maxVertexWeight = std::max( IndexType( 1 ), static_cast<IndexType>( 1.5 * totalWeight / COARSEN_TO ) );
+
+    const Graph* current = &graph;
+
+    levels.reserve( 64 );
+
+    while ( current->numVertices() > COARSEN_TO )
+    {
+        Graph coarseGraph;
+        std::vector<IndexType> cmap;
+
+        coarsen( coarseGraph, cmap, *current, maxVertexWeight );
+
+        // stop coarsening if the graph does not shrink any more
+
+        if ( coarseGraph.numVertices() > 0.95 * current->numVertices() )
+        {
+            break;
+        }
+
+        levels.push_back( std::move( coarseGraph ) );
+        cmaps.push_back( std::move( cmap ) );
+        current = &levels.back();
+    }
+
+    IndexType target[2];
+    IndexType maxWeight[2];
+
+    target[0] = static_cast<IndexType>( fraction * totalWeight + 0.5f );
+    target[1] = totalWeight - target[0];
+
+    // allowed deviation is relative to the smaller part, otherwise the smaller part of an
+    // uneven bisection might lose much more than the tolerated fraction of its weight
+
+    const IndexType tolerance = static_cast<IndexType>( IMBALANCE * std::min( target[0], target[1] ) );
+
+    // on the coarse levels the balance constraint is relaxed by the weight of the heaviest vertex
+
+    for ( IndexType s = 0; s < 2; ++s )
+    {
+        maxWeight[s] = target[s] + std::max( tolerance, maxVertexWeight );
+    }
+
+    std::vector<IndexType> coarseSide;
+
+    initialBisection( coarseSide, *current, target, maxWeight );
+
+    // uncoarsening: project to the finer graph and refine
+
+    for ( IndexType level = static_cast<IndexType>( levels.size() ); level-- > 0; )
+    {
+        const Graph& fineGraph = level == 0 ? graph : levels[level - 1];
+        const std::vector<IndexType>& cmap = cmaps[level];
+
+        std::vector<IndexType> fineSide( fineGraph.numVertices() );
+
+        for ( IndexType i = 0; i < fineGraph.numVertices(); ++i )
+        {
+            fineSide[i] = coarseSide[cmap[i]];
+        }
+
+        if ( level == 0 )
+        {
+            // finest level: no more relaxation for the balance
+
+            for ( IndexType s = 0; s < 2; ++s )
+            {
+                maxWeight[s] = target[s] + std::max( tolerance, IndexType( 1 ) );
+            }
+        }
+
+        refine( fineSide, fineGraph, target, maxWeight );
+
+        coarseSide.swap( fineSide );
+    }
+
+    side.swap( coarseSide );
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+void MultilevelPartitioning::coarsen(
+    Graph& coarseGraph,
+    std::vector<IndexType>& cmap,
+    const Graph& graph,
+    const IndexType maxVertexWeight )
+{
+    const IndexType n = graph.numVertices();
+
+    // visit the vertices in random order, but reproducible
+
+    std::vector<IndexType> perm( n );
+
+    for ( IndexType i = 0; i < n; ++i )
+    {
+        perm[i] = i;
+    }
+
+    std::mt19937 generator( static_cast<unsigned int>( n ) );
+    std::shuffle( perm.begin(), perm.end(), generator );
+
+    // heavy edge matching
+
+    std::vector<IndexType> match( n, invalidIndex );
+
+    for ( IndexType k = 0; k < n; ++k )
+    {
+        const IndexType i = perm[k];
+
+        if ( match[i] != invalidIndex )
+        {
+            continue;
+        }
+
+        IndexType best = i;
+        IndexType bestWeight = 0;
+
+        for ( IndexType jj = graph.ia[i]; jj < graph.ia[i + 1]; ++jj )
+        {
+            const IndexType j = graph.ja[jj];
+
+            if ( match[j] != invalidIndex || j == i )
+            {
+                continue;
+            }
+
+            if ( graph.vertexWeights[i] + graph.vertexWeights[j] > maxVertexWeight )
+            {
+                continue;
+            }
+
+            if ( graph.edgeWeights[jj] > bestWeight )
+            {
+                best = j;
+                bestWeight = graph.edgeWeights[jj];
+            }
+        }
+
+        match[i] = best;
+        match[best] = i;
+    }
+
+    // numbering of the coarse vertices, coarse2fine keeps the (at most two) fine vertices
+
+    cmap.assign( n, invalidIndex );
+
+    std::vector<IndexType> coarse2fine;
+    coarse2fine.reserve( 2 * n );
+
+    IndexType nc = 0;
+
+    for ( IndexType i = 0; i < n; ++i )
+    {
+        if ( i <= match[i] )
+        {
+            cmap[i] = nc;
+            cmap[match[i]] = nc;
+            coarse2fine.push_back( i );
+            coarse2fine.push_back( match[i] );
+            nc++;
+        }
+    }
+
+    // contraction, edges of merged vertices are combined by accumulating their weights
+
+    coarseGraph.ia.resize( nc + 1 );
+    coarseGraph.ja.clear();
+    coarseGraph.edgeWeights.clear();
+    coarseGraph.vertexWeights.resize( nc );
+
+    coarseGraph.ja.reserve( graph.ja.size() );
+    coarseGraph.edgeWeights.reserve( graph.ja.size() );
+
+    std::vector<IndexType> marker( nc, invalidIndex );
+
+    coarseGraph.ia[0] = 0;
+
+    for ( IndexType c = 0; c < nc; ++c )
+    {
+        const IndexType i1 = coarse2fine[2 * c];
+        const IndexType i2 = coarse2fine[2 * c + 1];
+
+        coarseGraph.vertexWeights[c] = graph.vertexWeights[i1];
+
+        if ( i2 != i1 )
+        {
+            coarseGraph.vertexWeights[c] += graph.vertexWeights[i2];
+        }
+
+        const IndexType start = static_cast<IndexType>( coarseGraph.ja.size() );
+
+        for ( IndexType k = 0; k < 2; ++k )
+        {
+            const IndexType i = k == 0 ? i1 : i2;
+
+            if ( k == 1 && i2 == i1 )
+            {
+                break;
+            }
+
+            for ( IndexType jj = graph.ia[i]; jj < graph.ia[i + 1]; ++jj )
+            {
+                const IndexType cj = cmap[graph.ja[jj]];
+
+                if ( cj == c )
+                {
+                    continue;
+                }
+
+                if ( marker[cj] == invalidIndex )
+                {
+                    marker[cj] = static_cast<IndexType>( coarseGraph.ja.size() );
+                    coarseGraph.ja.push_back( cj );
+                    coarseGraph.edgeWeights.push_back( graph.edgeWeights[jj] );
+                }
+                else
+                {
+                    coarseGraph.edgeWeights[marker[cj]] += graph.edgeWeights[jj];
+                }
+            }
+        }
+
+        const IndexType end = static_cast<IndexType>( coarseGraph.ja.size() );
+
+        for ( IndexType jj = start; jj < end; ++jj )
+        {
+            marker[coarseGraph.ja[jj]] = invalidIndex;
+        }
+
+        coarseGraph.ia[c + 1] = end;
+    }
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+void MultilevelPartitioning::initialBisection(
+    std::vector<IndexType>& side,
+    const Graph& graph,
+    const IndexType target[],
+    const IndexType maxWeight[] )
+{
+    const IndexType n = graph.numVertices();
+
+    IndexType bestCut = invalidIndex;
+
+    std::mt19937 generator( static_cast<unsigned int>( n ) );
+
+    std::vector<IndexType> trialSide( n );
+    std::vector<IndexType> queue;
+
+    queue.reserve( n );
+
+    for ( IndexType trial = 0; trial < INITIAL_TRIALS; ++trial )
+    {
+        // greedy graph growing of part 0 by breadth first search from a random seed
+
+        std::fill( trialSide.begin(), trialSide.end(), 1 );
+
+        IndexType weight0 = 0;
+
+        queue.clear();
+
+        size_t head = 0;
+
+        IndexType nextUnvisited = 0;
+
+        if ( n > 0 )
+        {
+            IndexType seed = static_cast<IndexType>( generator() % n );
+            trialSide[seed] = 0;
+            queue.push_back( seed );
+        }
+
+        while ( weight0 < target[0] )
+        {
+            if ( head == queue.size() )
+            {
+                // disconnected graph, continue with any vertex not in part 0
+
+                while ( nextUnvisited < n && trialSide[nextUnvisited] == 0 )
+                {
+                    nextUnvisited++;
+                }
+
+                if ( nextUnvisited == n )
+                {
+                    break;
+                }
+
+                trialSide[nextUnvisited] = 0;
+                queue.push_back( nextUnvisited );
+            }
+
+            const IndexType i = queue[head++];
+
+            weight0 += graph.vertexWeights[i];
+
+            for ( IndexType jj = graph.ia[i]; jj < graph.ia[i + 1]; ++jj )
+            {
+                const IndexType j = graph.ja[jj];
+
+                if ( trialSide[j] == 1 )
+                {
+                    trialSide[j] = 0;
+                    queue.push_back( j );
+                }
+            }
+        }
+
+        // vertices that have been queued but not taken remain in part 1
+
+        for ( size_t k = head; k < queue.size(); ++k )
+        {
+            trialSide[queue[k]] = 1;
+        }
+
+        IndexType cut = refine( trialSide, graph, target, maxWeight );
+
+        if ( bestCut == invalidIndex || cut < bestCut )
+        {
+            bestCut = cut;
+            side = trialSide;
+        }
+    }
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+IndexType MultilevelPartitioning::refine(
+    std::vector<IndexType>& side,
+    const Graph& graph,
+    const IndexType target[],
+    const IndexType maxWeight[] )
+{
+    const IndexType n = graph.numVertices();
+
+    std::vector<IndexType> gain( n );
+    std::vector<bool> locked( n );
+    std::vector<IndexType> moves;
+
+    IndexType weight[2] = { 0, 0 };
+
+    for ( IndexType i = 0; i < n; ++i )
+    {
+        weight[side[i]] += graph.vertexWeights[i];
+    }
+
+    // violation of the balance constraint, 0 if balanced
+
+    auto violation = [&]()
+    {
+        return std::max( IndexType( 0 ), weight[0] - maxWeight[0] ) + std::max( IndexType( 0 ), weight[1] - maxWeight[1] );
+    };
+
+    IndexType cut = 0;
+
+    typedef std::pair<IndexType, IndexType> Entry;   // ( gain, vertex )
+
+    for ( IndexType pass = 0; pass < MAX_FM_PASSES; ++pass )
+    {
+        // gain of a vertex is the reduction of the edge cut when it is moved
+
+        cut = 0;
+
+        for ( IndexType i = 0; i < n; ++i )
+        {
+            IndexType g = 0;
+
+            for ( IndexType jj = graph.ia[i]; jj < graph.ia[i + 1]; ++jj )
+            {
+                g += side[graph.ja[jj]] != side[i] ? graph.edgeWeights[jj] : -graph.edgeWeights[jj];
+            }
+
+            gain[i] = g;
+            locked[i] = false;
+
+            for ( IndexType jj = graph.ia[i]; jj < graph.ia[i + 1]; ++jj )
+            {
+                if ( side[graph.ja[jj]] != side[i] )
+                {
+                    cut += graph.edgeWeights[jj];
+                }
+            }
+        }
+
+        cut /= 2;
+
+        // priority queues for moves from side 0 and from side 1, outdated entries are skipped
+
+        std::priority_queue<Entry> queue[2];
+
+        const bool insertAll = violation() > 0;
+
+        for ( IndexType i = 0; i < n; ++i )
+        {
+            bool isBoundary = false;
+
+            for ( IndexType jj = graph.ia[i]; jj < graph.ia[i + 1]; ++jj )
+            {
+                if ( side[graph.ja[jj]] != side[i] )
+                {
+                    isBoundary = true;
+                    break;
+                }
+            }
+
+            if ( isBoundary || insertAll )
+            {
+                queue[side[i]].push( Entry( gain[i], i ) );
+            }
+        }
+
+        IndexType bestCut = cut;
+        IndexType bestViolation = violation();
+        size_t bestMoves = 0;
+
+        moves.clear();
+
+        IndexType noGain = 0;
+
+        // remove outdated entries at the top of a queue
+
+        auto top = [&]( const IndexType s )
+        {
+            while ( !queue[s].empty() )
+            {
+                const Entry& e = queue[s].top();
+
+                if ( !locked[e.second] && side[e.second] == s && gain[e.second] == e.first )
+                {
+                    return e.second;
+                }
+
+                queue[s].pop();
+            }
+
+            return invalidIndex;
+        };
+
+        while ( noGain < MAX_FM_NO_GAIN )
+        {
+            IndexType from = invalidIndex;
+
+            if ( weight[0] > maxWeight[0] )
+            {
+                from = 0;
+            }
+            else if ( weight[1] > maxWeight[1] )
+            {
+                from = 1;
+            }
+            else
+            {
+                // choose the move with the higher gain that keeps the balance
+
+                IndexType bestGain = 0;
+
+                for ( IndexType s = 0; s < 2; ++s )
+                {
+                    IndexType i = top( s );
+
+                    if ( i == invalidIndex || weight[1 - s] + graph.vertexWeights[i] > maxWeight[1 - s] )
+                    {
+                        continue;
+                    }
+
+                    if ( from == invalidIndex || gain[i] > bestGain )
+                    {
+                        from = s;
+                        bestGain = gain[i];
+                    }
+                }
+            }
+
+            if ( from == invalidIndex )
+            {
+                break;
+            }
+
+            const IndexType i = top( from );
+
+            if ( i == invalidIndex )
+            {
+                break;
+            }
+
+            queue[from].pop();
+
+            // move vertex i to the other side
+
+            const IndexType to = 1 - from;
+
+            side[i] = to;
+            locked[i] = true;
+            weight[from] -= graph.vertexWeights[i];
+            weight[to] += graph.vertexWeights[i];
+            cut -= gain[i];
+            gain[i] = -gain[i];
+
+            moves.push_back( i );
+
+            for ( IndexType jj = graph.ia[i]; jj < graph.ia[i + 1]; ++jj )
+            {
+                const IndexType j = graph.ja[jj];
+
+                gain[j] += side[j] == from ? 2 * graph.edgeWeights[jj] : -2 * graph.edgeWeights[jj];
+
+                if ( !locked[j] )
+                {
+                    queue[side[j]].push( Entry( gain[j], j ) );
+                }
+            }
+
+            const IndexType currentViolation = violation();
+
+            if ( currentViolation < bestViolation || ( currentViolation == bestViolation && cut < bestCut ) )
+            {
+                bestCut = cut;
+                bestViolation = currentViolation;
+                bestMoves = moves.size();
+                noGain = 0;
+            }
+            else
+            {
+                noGain++;
+            }
+        }
+
+        // roll back all moves after the best state
+
+        for ( size_t k = moves.size(); k-- > bestMoves; )
+        {
+            const IndexType i = moves[k];
+            const IndexType from = side[i];
+
+            side[i] = 1 - from;
+            weight[from] -= graph.vertexWeights[i];
+            weight[1 - from] += graph.vertexWeights[i];
+        }
+
+        cut = bestCut;
+
+        if ( bestMoves == 0 )
+        {
+            break;
+        }
+    }
+
+    SCAI_LOG_TRACE( logger, "refined bisection, n = " << n << ", cut = " << cut << ", weights = " << weight[0]
+                             << " : " << weight[1] << ", targets = " << target[0] << " : " << target[1] )
+
+    return cut;
+}
+
+/* ---------------------------------------------------------------------------------*/
+
+IndexType MultilevelPartitioning::edgeCut(
+    const HArray<PartitionId>& owners,
+    const HArray<IndexType>& ia,
+    const HArray<IndexType>& ja )
+{
+    const IndexType n = ia.size() - 1;
+
+    SCAI_ASSERT_EQ_ERROR( owners.size(), n, "serious mismatch for owners array" )
+
+    auto rIA = hostReadAccess( ia );
+    auto rJA = hostReadAccess( ja );
+    auto rOwners = hostReadAccess( owners );
+
+    IndexType cut = 0;
+
+    #pragma omp parallel for reduction( + : cut )
+
+    for ( IndexType i = 0; i < n; ++i )
+    {
+        for ( IndexType jj = rIA[i]; jj < rIA[i + 1]; ++jj )
+        {
+            IndexType j = rJA[jj];
+
+            if ( j != invalidIndex && rOwners[j] != rOwners[i] )
+            {
+                cut++;
+            }
+        }
+    }
+
+    return cut / 2;
+}
+
+/* ---------------------------------------------------------------------------------*
+ *   static create methods ( required for registration in Partitioning factory )    *
+ * ---------------------------------------------------------------------------------*/
+
+const char MultilevelPartitioning::theCreateValue[] = "MULTILEVEL";
+
+std::string MultilevelPartitioning::createValue()
+{
+    return theCreateValue;
+}
+
+PartitioningPtr MultilevelPartitioning::create()
+{
+    return PartitioningPtr( new MultilevelPartitioning() );
+}
+
+} /* end namespace partitioning */
+
+} /* end namespace scai */
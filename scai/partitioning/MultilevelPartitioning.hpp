@@ -0,0 +1,198 @@
+/**
+ * @file MultilevelPartitioning.hpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Native multilevel graph partitioning (no external software required)
+ * @author Thomas Brandes
+ * @date 18.10.2018
+ */
+
+#pragma once
+
+// for dll_import
+#include <scai/common/config.hpp>
+
+// base classes
+#include <scai/partitioning/Partitioning.hpp>
+
+// std
+#include <vector>
+
+namespace scai
+{
+
+namespace partitioning
+{
+
+/** Multilevel graph partitioning that is implemented within LAMA itself.
+ *
+ *  The partitioning uses multilevel recursive bisection in the same way as Metis does:
+ *
+ *   - coarsening of the graph by heavy edge matching
+ *   - initial bisection of the coarsest graph by greedy graph growing (several trials)
+ *   - uncoarsening where each level is refined by Fiduccia-Mattheyses (FM) refinement
+ *
+ *  The two subgraphs of a bisection are partitioned independently as OpenMP tasks.
+ *
+ *  Like MetisPartitioning the graph is collected on the MASTER processor and the
+ *  computed owners are scattered back.
+ */
+class COMMON_DLL_IMPORTEXPORT MultilevelPartitioning:
+
+    public Partitioning,
+    private Partitioning::Register<MultilevelPartitioning>
+
+{
+public:
+
+    /** Constructor of an object that partititions 'serial' graph data */
+
+    MultilevelPartitioning();
+
+    virtual ~MultilevelPartitioning();
+
+    /** Implementation of pure method Partitioning::rectangularPartitioning
+     *
+     *  The bipartite graph of rows and columns is partitioned, only the first
+     *  constraint of the vertex weights is taken into account.
+     */
+    virtual void rectangularPartitioning( hmemo::HArray<PartitionId>& rowMapping,
+                                          hmemo::HArray<PartitionId>& colMapping,
+                                          const lama::_Matrix& matrix,
+                                          const hmemo::HArray<float>& processorWeights ) const;
+
+    using Partitioning::squarePartitioning;
+    using Partitioning::squarePartitioningW;
+
+    /** Implementation of pure method Partitioning::squarePartitioning */
+
+    virtual void squarePartitioning( hmemo::HArray<PartitionId>& newLocalOwners,
+                                     const lama::_Matrix& matrix,
+                                     const hmemo::HArray<float>& processorWeights ) const;
+
+    /** Override Partitioning::squarePartitioningW, vertex weights are taken into account. */
+
+    virtual void squarePartitioningW( hmemo::HArray<PartitionId>& newLocalOwners,
+                                      const lama::_Matrix& matrix,
+                                      const hmemo::HArray<float>& vertexWeights,
+                                      const hmemo::HArray<float>& processorWeights ) const;
+
+    /** Partitioning of a serial graph given in CSR format.
+     *
+     *  @param[out] owners           new owner for each vertex, size is ia.size() - 1
+     *  @param[in]  ia, ja           CSR graph data, diagonal elements are ignored
+     *  @param[in]  vertexWeights    weight for each vertex, might be empty for unit weights
+     *  @param[in]  processorWeights desired weight for each part, size is number of parts
+     *
+     *  Edge weights are all 1, but coarsened graphs accumulate the weights of merged edges.
+     */
+    static void partitionGraph( hmemo::HArray<PartitionId>& owners,
+                                const hmemo::HArray<IndexType>& ia,
+                                const hmemo::HArray<IndexType>& ja,
+                                const hmemo::HArray<IndexType>& vertexWeights,
+                                const hmemo::HArray<float>& processorWeights );
+
+    /** Compute the edge cut of a partitioning for a serial CSR graph, each edge counts once. */
+
+    static IndexType edgeCut( const hmemo::HArray<PartitionId>& owners,
+                              const hmemo::HArray<IndexType>& ia,
+                              const hmemo::HArray<IndexType>& ja );
+
+    /** Override Printable::writeAt */
+
+    virtual void writeAt( std::ostream& stream ) const;
+
+    /** Static method required for create to use in Partitioning::Register */
+
+    static PartitioningPtr create();
+
+    /** Static method required for Partitioning::Register */
+
+    static std::string createValue();
+
+private:
+
+    /** Serial graph with vertex and edge weights as used on each level of the multilevel scheme. */
+
+    struct Graph
+    {
+        std::vector<IndexType> ia;
+        std::vector<IndexType> ja;
+        std::vector<IndexType> edgeWeights;
+        std::vector<IndexType> vertexWeights;
+
+        IndexType numVertices() const
+        {
+            return static_cast<IndexType>( ia.size() ) - 1;
+        }
+
+        IndexType totalWeight() const;
+    };
+
+    /** Partition graph in nParts parts starting with firstPart, owners are set for vertexIds */
+
+    static void recursiveBisection(
+        std::vector<PartitionId>& owners,
+        const Graph& graph,
+        const std::vector<IndexType>& vertexIds,
+        const std::vector<float>& processorWeights,
+        const PartitionId firstPart,
+        const PartitionId nParts );
+
+    /** Multilevel bisection, side[i] is 0 or 1, fraction is the desired weight of part 0 */
+
+    static void bisect( std::vector<IndexType>& side, const Graph& graph, const float fraction );
+
+    /** Coarsen a graph by heavy edge matching, cmap is the mapping of the fine to the coarse vertices */
+
+    static void coarsen( Graph& coarseGraph, std::vector<IndexType>& cmap, const Graph& graph, const IndexType maxVertexWeight );
+
+    /** Bisection of (coarsest) graph by greedy graph growing, best of several trials */
+
+    static void initialBisection( std::vector<IndexType>& side, const Graph& graph, const IndexType target[], const IndexType maxWeight[] );
+
+    /** Fiduccia-Mattheyses refinement of a bisection, returns the edge cut */
+
+    static IndexType refine( std::vector<IndexType>& side, const Graph& graph, const IndexType target[], const IndexType maxWeight[] );
+
+    /** Build the subgraph of all vertices with side[i] == s, edges to the other side are dropped */
+
+    static void extractSubgraph( Graph& subGraph, std::vector<IndexType>& subVertexIds,
+                                 const Graph& graph, const std::vector<IndexType>& vertexIds,
+                                 const std::vector<IndexType>& side, const IndexType s );
+
+    /** Partitioning of the whole graph on the master processor */
+
+    void squarePartitioningMaster( hmemo::HArray<PartitionId>& newOwners,
+                                   const lama::_Matrix& matrix,
+                                   const hmemo::HArray<float>& vertexWeights,
+                                   const hmemo::HArray<float>& processorWeights ) const;
+
+    SCAI_LOG_DECL_STATIC_LOGGER( logger )
+
+    static const char theCreateValue[];
+};
+
+} /* end namespace partitioning */
+
+} /* end namespace scai */
@@ -0,0 +1,208 @@
+/**
+ * @file GeometricPartitioningTest.cpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Test of the partitioning by coordinates.
+ * @author Thomas Brandes
+ * @date 18.10.2018
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <scai/partitioning/GeometricPartitioning.hpp>
+
+#include <scai/dmemo/BlockDistribution.hpp>
+#include <scai/dmemo/GridDistribution.hpp>
+#include <scai/utilskernel/HArrayUtils.hpp>
+
+using namespace scai;
+using namespace hmemo;
+using namespace dmemo;
+using namespace lama;
+using namespace utilskernel;
+using namespace partitioning;
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_SUITE( GeometricPartitioningTest )
+
+/* --------------------------------------------------------------------- */
+
+SCAI_LOG_DEF_LOGGER( logger, "Test.GeometricPartitioningTest" );
+
+/* --------------------------------------------------------------------- */
+
+/** Check that the global weights of the parts match the processor weights. */
+
+static void checkBalance( 
+    const HArray<PartitionId>& owners, 
+    const HArray<float>& weights, 
+    const HArray<float>& processorWeights, 
+    const Communicator& comm,
+    const float tolerance )
+{
+    const IndexType np = processorWeights.size();
+
+    HArray<float> partWeights( np, 0.0f );
+
+    {
+        auto rOwners = hostReadAccess( owners );
+        auto rWeights = hostReadAccess( weights );
+        auto wPartWeights = hostWriteAccess( partWeights );
+
+        for ( IndexType i = 0; i < owners.size(); ++i )
+        {
+            BOOST_REQUIRE( rOwners[i] < np );
+            wPartWeights[ rOwners[i] ] += rWeights.size() ? rWeights[i] : 1.0f;
+        }
+    }
+
+    comm.sumArray( partWeights );
+
+    float total = HArrayUtils::sum( partWeights );
+    float totalP = HArrayUtils::sum( processorWeights );
+
+    auto rPartWeights = hostReadAccess( partWeights );
+    auto rProcessorWeights = hostReadAccess( processorWeights );
+
+    for ( IndexType p = 0; p < np; ++p )
+    {
+        float expected = total * rProcessorWeights[p] / totalP;
+
+        SCAI_LOG_DEBUG( logger, "part " << p << ": weight = " << rPartWeights[p] << ", expected = " << expected )
+
+        BOOST_CHECK( common::Math::abs( rPartWeights[p] - expected ) <= tolerance * total );
+    }
+}
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE( gridTest )
+{
+    CommunicatorPtr comm = Communicator::getCommunicatorPtr();
+
+    const common::Grid3D grid( 12, 10, 8 );
+
+    auto dist = std::make_shared<GridDistribution>( grid, comm );
+
+    HArray<float> processorWeights( { 1.0f, 2.0f, 1.0f, 1.5f, 1.0f } );
+
+    HArray<float> weights;   // unit weights
+
+    GeometricPartitioning::Method methods[] = { GeometricPartitioning::Method::RCB,
+                                                GeometricPartitioning::Method::HILBERT,
+                                                GeometricPartitioning::Method::MORTON };
+
+    for ( size_t k = 0; k < sizeof( methods ) / sizeof( methods[0] ); ++k )
+    {
+        GeometricPartitioning partitioning( methods[k] );
+
+        partitioning.setGridCoordinates( grid, dist );
+
+        BOOST_CHECK( !partitioning.isIncremental() );
+
+        HArray<PartitionId> owners;
+
+        partitioning.partition( owners, weights, processorWeights );
+
+        BOOST_CHECK_EQUAL( owners.size(), dist->getLocalSize() );
+
+        SCAI_LOG_INFO( logger, partitioning << ": check balance" )
+
+        // RCB cannot split points with the same coordinate, so only whole grid planes are moved
+
+        float tolerance = methods[k] == GeometricPartitioning::Method::RCB ? 0.1f : 0.02f;
+
+        checkBalance( owners, weights, processorWeights, *comm, tolerance );
+
+        BOOST_CHECK( partitioning.isIncremental() );
+    }
+}
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE( incrementalTest )
+{
+    CommunicatorPtr comm = Communicator::getCommunicatorPtr();
+
+    const IndexType n = 1000;
+
+    auto dist = blockDistribution( n, comm );
+
+    // random points in the unit square
+
+    std::vector<DenseVector<double> > coordinates;
+
+    coordinates.push_back( denseVectorZero<double>( dist ) );
+    coordinates.push_back( denseVectorZero<double>( dist ) );
+
+    coordinates[0].fillRandom( 1 );
+    coordinates[1].fillRandom( 1 );
+
+    HArray<float> processorWeights( 4, 1.0f );
+
+    GeometricPartitioning::Method methods[] = { GeometricPartitioning::Method::RCB,
+                                                GeometricPartitioning::Method::HILBERT };
+
+    for ( size_t k = 0; k < sizeof( methods ) / sizeof( methods[0] ); ++k )
+    {
+        GeometricPartitioning partitioning( methods[k] );
+
+        partitioning.setCoordinates( coordinates );
+
+        HArray<float> weights( dist->getLocalSize(), 1.0f );
+        HArray<PartitionId> owners;
+
+        partitioning.partition( owners, weights, processorWeights );
+
+        checkBalance( owners, weights, processorWeights, *comm, 0.01f );
+
+        // now change the weights, points in the first half get double weight
+
+        {
+            auto wWeights = hostWriteAccess( weights );
+
+            for ( IndexType i = 0; i < dist->getLocalSize(); ++i )
+            {
+                if ( dist->local2Global( i ) < n / 2 )
+                {
+                    wWeights[i] = 2.0f;
+                }
+            }
+        }
+
+        BOOST_CHECK( partitioning.isIncremental() );
+
+        partitioning.partition( owners, weights, processorWeights );
+
+        checkBalance( owners, weights, processorWeights, *comm, 0.01f );
+
+        DistributionPtr newDist = partitioning.partitionIt( weights, 1.0f );
+
+        BOOST_CHECK_EQUAL( newDist->getGlobalSize(), n );
+    }
+}
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_SUITE_END();
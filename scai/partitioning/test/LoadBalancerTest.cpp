@@ -0,0 +1,221 @@
+/**
+ * @file LoadBalancerTest.cpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Test of dynamic load balancing by measured runtimes
+ * @author Thomas Brandes
+ * @date 18.10.2018
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <scai/partitioning/LoadBalancer.hpp>
+
+#include <scai/lama/matrix/CSRSparseMatrix.hpp>
+#include <scai/lama/matrix/StencilMatrix.hpp>
+#include <scai/lama/DenseVector.hpp>
+#include <scai/dmemo/BlockDistribution.hpp>
+#include <scai/utilskernel/HArrayUtils.hpp>
+#include <scai/common/Math.hpp>
+
+using namespace scai;
+using namespace hmemo;
+using namespace dmemo;
+using namespace lama;
+using namespace utilskernel;
+using namespace partitioning;
+
+using common::Grid2D;
+using common::Stencil2D;
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_SUITE( LoadBalancerTest )
+
+/* --------------------------------------------------------------------- */
+
+SCAI_LOG_DEF_LOGGER( logger, "Test.LoadBalancerTest" );
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE( shiftTest )
+{
+    const IndexType N = 1000;
+
+    CommunicatorPtr comm = Communicator::getCommunicatorPtr();
+
+    auto dist = blockDistribution( N, comm );
+
+    const IndexType localN = dist->getLocalSize();
+
+    HArray<float> rowWeights( localN, 1.0f );
+
+    // weights for 4 parts, the first part gets half of all rows
+
+    HArray<float> processorWeights( { 3.0f, 1.0f, 1.0f, 1.0f } );
+
+    HArray<PartitionId> newLocalOwners;
+
+    LoadBalancer::shiftPartitioning( newLocalOwners, rowWeights, processorWeights, *comm );
+
+    BOOST_REQUIRE_EQUAL( newLocalOwners.size(), localN );
+
+    IndexType counts[4] = { 0, 0, 0, 0 };
+
+    {
+        auto rOwners = hostReadAccess( newLocalOwners );
+
+        for ( IndexType i = 0; i < localN; ++i )
+        {
+            BOOST_REQUIRE( rOwners[i] >= 0 && rOwners[i] < 4 );
+
+            counts[rOwners[i]]++;
+
+            // owners are increasing with the global index
+
+            if ( i > 0 )
+            {
+                BOOST_CHECK( rOwners[i - 1] <= rOwners[i] );
+            }
+        }
+    }
+
+    BOOST_CHECK_EQUAL( comm->sum( counts[0] ), N / 2 );
+    BOOST_CHECK( common::Math::abs( comm->sum( counts[1] ) - N / 6 ) <= 1 );
+    BOOST_CHECK( common::Math::abs( comm->sum( counts[3] ) - N / 6 ) <= 1 );
+
+    if ( N % comm->getSize() != 0 )
+    {
+        return;
+    }
+
+    // same weights for all processors, nothing changes for a block distribution
+
+    HArray<float> sameWeights( comm->getSize(), 1.0f );
+
+    LoadBalancer::shiftPartitioning( newLocalOwners, rowWeights, sameWeights, *comm );
+
+    auto rOwners = hostReadAccess( newLocalOwners );
+
+    for ( IndexType i = 0; i < localN; ++i )
+    {
+        BOOST_CHECK_EQUAL( rOwners[i], comm->getRank() );
+    }
+}
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE( weightsTest )
+{
+    CommunicatorPtr comm = Communicator::getCommunicatorPtr();
+
+    const PartitionId np = comm->getSize();
+
+    // processor 0 is twice as slow as the other ones
+
+    LoadBalancer balancer( 0.05f, 0.0f );
+
+    balancer.addTime( comm->getRank() == 0 ? 2.0 : 1.0 );
+
+    if ( np > 1 )
+    {
+        BOOST_CHECK( balancer.getImbalance( *comm ) > 1.1f );
+    }
+    else
+    {
+        BOOST_CHECK_CLOSE( balancer.getImbalance( *comm ), 1.0f, 0.01 );
+    }
+
+    HArray<float> processorWeights;
+
+    balancer.computeWeights( processorWeights, 100.0, *comm );
+
+    BOOST_REQUIRE_EQUAL( processorWeights.size(), np );
+
+    auto rWeights = hostReadAccess( processorWeights );
+
+    float sum = 0.0f;
+
+    for ( PartitionId p = 0; p < np; ++p )
+    {
+        sum += rWeights[p];
+
+        if ( p > 0 )
+        {
+            BOOST_CHECK_CLOSE( rWeights[p], 2.0f * rWeights[0], 0.1 );
+        }
+    }
+
+    BOOST_CHECK_CLOSE( sum, 1.0f, 0.01 );
+}
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE( rebalanceTest )
+{
+    typedef DefaultReal ValueType;
+
+    const IndexType N = 20;
+
+    CommunicatorPtr comm = Communicator::getCommunicatorPtr();
+
+    CSRSparseMatrix<ValueType> matrix( StencilMatrix<ValueType>( Grid2D( N, N ), Stencil2D<ValueType>( 5 ) ) );
+
+    auto dist = blockDistribution( N * N, comm );
+
+    matrix.redistribute( dist, dist );
+
+    auto x = denseVectorLinear<ValueType>( N * N, 1, 1 );
+    x.redistribute( dist );
+    auto y = denseVectorEval( matrix * x );
+
+    // the last processor pretends to be slow
+
+    LoadBalancer balancer;
+
+    balancer.addTime( comm->getRank() == comm->getSize() - 1 ? 3.0 : 1.0 );
+
+    bool done = balancer.rebalance( matrix, { &x, &y } );
+
+    BOOST_CHECK_EQUAL( done, comm->getSize() > 1 );
+    BOOST_CHECK_EQUAL( balancer.getTime(), 0.0 );
+
+    BOOST_CHECK_EQUAL( matrix.getRowDistribution(), x.getDistribution() );
+    BOOST_CHECK_EQUAL( matrix.getColDistribution(), x.getDistribution() );
+    BOOST_CHECK_EQUAL( matrix.getRowDistribution(), y.getDistribution() );
+
+    if ( done )
+    {
+        BOOST_CHECK( matrix.getRowDistribution().getLocalSize() != dist->getLocalSize() );
+    }
+
+    // the redistributed data must give the same result
+
+    auto y1 = denseVectorEval( matrix * x );
+
+    BOOST_CHECK( y1.maxDiffNorm( y ) < 0.0001 );
+}
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_SUITE_END();
@@ -0,0 +1,176 @@
+/**
+ * @file MultilevelPartitioningTest.cpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Test of the native multilevel graph partitioning.
+ * @author Thomas Brandes
+ * @date 18.10.2018
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <scai/partitioning/MultilevelPartitioning.hpp>
+
+#include <scai/lama/matrix/CSRSparseMatrix.hpp>
+#include <scai/lama/matrix/StencilMatrix.hpp>
+#include <scai/dmemo/BlockDistribution.hpp>
+#include <scai/utilskernel/HArrayUtils.hpp>
+
+using namespace scai;
+using namespace hmemo;
+using namespace dmemo;
+using namespace lama;
+using namespace utilskernel;
+using namespace partitioning;
+
+using common::Grid2D;
+using common::Stencil2D;
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_SUITE( MultilevelPartitioningTest )
+
+/* --------------------------------------------------------------------- */
+
+SCAI_LOG_DEF_LOGGER( logger, "Test.MultilevelPartitioningTest" );
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE( graphTest )
+{
+    // 5-point stencil on a 2D grid, an optimal partitioning in 4 parts has an edge cut of 2 * N
+
+    const IndexType N = 30;
+
+    CSRSparseMatrix<DefaultReal> matrix( StencilMatrix<DefaultReal>( Grid2D( N, N ), Stencil2D<DefaultReal>( 5 ) ) );
+
+    const HArray<IndexType>& ia = matrix.getLocalStorage().getIA();
+    const HArray<IndexType>& ja = matrix.getLocalStorage().getJA();
+
+    HArray<float> processorWeights( 4, 1.0f );
+    HArray<IndexType> vertexWeights;    // unit weights
+    HArray<PartitionId> owners;
+
+    MultilevelPartitioning::partitionGraph( owners, ia, ja, vertexWeights, processorWeights );
+
+    BOOST_REQUIRE_EQUAL( owners.size(), N * N );
+    BOOST_CHECK( HArrayUtils::validIndexes( owners, 4 ) );
+
+    HArray<IndexType> sizes;
+    HArrayUtils::bucketCount( sizes, owners, 4 );
+
+    BOOST_CHECK( HArrayUtils::max( sizes ) <= IndexType( 1.05 * N * N / 4 ) + 1 );
+
+    IndexType cut = MultilevelPartitioning::edgeCut( owners, ia, ja );
+
+    SCAI_LOG_INFO( logger, "multilevel partitioning of grid " << N << " x " << N << ", cut = " << cut )
+
+    BOOST_CHECK( cut <= 3 * N );
+
+    // cyclic mapping for comparison
+
+    HArray<PartitionId> cyclicOwners;
+    HArrayUtils::setOrder( cyclicOwners, N * N );
+    HArrayUtils::binaryOpScalar( cyclicOwners, cyclicOwners, PartitionId( 4 ), common::BinaryOp::MODULO, false );
+
+    BOOST_CHECK( cut < MultilevelPartitioning::edgeCut( cyclicOwners, ia, ja ) );
+}
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE( weightedTest )
+{
+    const IndexType N = 20;
+
+    CSRSparseMatrix<DefaultReal> matrix( StencilMatrix<DefaultReal>( Grid2D( N, N ), Stencil2D<DefaultReal>( 9 ) ) );
+
+    HArray<float> processorWeights( { 1.0f, 3.0f } );
+    HArray<IndexType> vertexWeights;    // unit weights
+    HArray<PartitionId> owners;
+
+    MultilevelPartitioning::partitionGraph( owners, matrix.getLocalStorage().getIA(), matrix.getLocalStorage().getJA(),
+                                            vertexWeights, processorWeights );
+
+    HArray<IndexType> sizes;
+    HArrayUtils::bucketCount( sizes, owners, 2 );
+
+    IndexType size0 = sizes[0];
+
+    // part 0 should get a quarter of all vertices
+
+    BOOST_CHECK( size0 >= IndexType( 0.95 * N * N / 4 ) );
+    BOOST_CHECK( size0 <= IndexType( 1.05 * N * N / 4 ) + 1 );
+}
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE( distributedTest )
+{
+    const IndexType N = 25;
+
+    CommunicatorPtr comm = Communicator::getCommunicatorPtr();
+
+    CSRSparseMatrix<DefaultReal> matrix( StencilMatrix<DefaultReal>( Grid2D( N, N ), Stencil2D<DefaultReal>( 5 ) ) );
+
+    auto dist = blockDistribution( N * N, comm );
+
+    matrix.redistribute( dist, dist );
+
+    MultilevelPartitioning partitioning;
+
+    HArray<PartitionId> newLocalOwners;
+
+    partitioning.squarePartitioning( newLocalOwners, matrix, 1.0f );
+
+    BOOST_CHECK_EQUAL( newLocalOwners.size(), dist->getLocalSize() );
+    BOOST_CHECK( HArrayUtils::validIndexes( newLocalOwners, comm->getSize() ) );
+
+    // vertex weights: all vertices of the first half have double weight
+
+    HArray<float> vertexWeights( dist->getLocalSize(), 1.0f );
+
+    {
+        auto wWeights = hostWriteAccess( vertexWeights );
+
+        for ( IndexType i = 0; i < dist->getLocalSize(); ++i )
+        {
+            if ( dist->local2Global( i ) < N * N / 2 )
+            {
+                wWeights[i] = 2.0f;
+            }
+        }
+    }
+
+    partitioning.squarePartitioningW( newLocalOwners, matrix, vertexWeights, 1.0f );
+
+    BOOST_CHECK_EQUAL( newLocalOwners.size(), dist->getLocalSize() );
+    BOOST_CHECK( HArrayUtils::validIndexes( newLocalOwners, comm->getSize() ) );
+
+    DistributionPtr newDist = partitioning.partitionIt( comm, matrix, 1.0f );
+
+    BOOST_CHECK_EQUAL( newDist->getGlobalSize(), N * N );
+}
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_SUITE_END();
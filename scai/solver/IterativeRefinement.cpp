@@ -0,0 +1,237 @@
+/**
+ * @file IterativeRefinement.cpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Implementation of methods for the mixed precision IterativeRefinement solver.
+ * @author Thomas Brandes
+ * @date 19.10.2026
+ */
+
+// hpp
+#include <scai/solver/IterativeRefinement.hpp>
+
+// local library
+#include <scai/solver/CG.hpp>
+#include <scai/solver/criteria/IterationCount.hpp>
+
+// scai internal libraries
+#include <scai/lama/expression/CastVectorExpression.hpp>
+#include <scai/lama/expression/CastMatrixExpression.hpp>
+#include <scai/common/macros/instantiate.hpp>
+
+namespace scai
+{
+
+namespace solver
+{
+
+SCAI_LOG_DEF_TEMPLATE_LOGGER( template<typename ValueType>, IterativeRefinement<ValueType>::logger,
+                              "Solver.IterativeSolver.IterativeRefinement" )
+
+using lama::Matrix;
+using lama::Vector;
+using lama::DenseVector;
+
+/* ========================================================================= */
+/*    static methods (for factory)                                           */
+/* ========================================================================= */
+
+template<typename ValueType>
+_Solver* IterativeRefinement<ValueType>::create()
+{
+    return new IterativeRefinement<ValueType>( "_genByFactory" );
+}
+
+template<typename ValueType>
+SolverCreateKeyType IterativeRefinement<ValueType>::createValue()
+{
+    return SolverCreateKeyType( common::getScalarType<ValueType>(), "IterativeRefinement" );
+}
+
+/* ========================================================================= */
+/*    Constructors / Destructors                                             */
+/* ========================================================================= */
+
+template<typename ValueType>
+IterativeRefinement<ValueType>::IterativeRefinement( const std::string& id ) :
+
+    IterativeSolver<ValueType>( id )
+{
+}
+
+template<typename ValueType>
+IterativeRefinement<ValueType>::IterativeRefinement( const std::string& id, LoggerPtr logger ) :
+
+    IterativeSolver<ValueType>( id, logger )
+{
+}
+
+template<typename ValueType>
+IterativeRefinement<ValueType>::IterativeRefinement( const IterativeRefinement& other ) :
+
+    IterativeSolver<ValueType>( other )
+{
+    if ( other.mInnerSolver )
+    {
+        mInnerSolver.reset( other.mInnerSolver->copy() );
+    }
+}
+
+template<typename ValueType>
+IterativeRefinement<ValueType>::~IterativeRefinement()
+{
+}
+
+/* ========================================================================= */
+/*    Inner solver                                                           */
+/* ========================================================================= */
+
+template<typename ValueType>
+void IterativeRefinement<ValueType>::setInnerSolver( SolverPtr<LowValueType> innerSolver )
+{
+    mInnerSolver = innerSolver;
+}
+
+template<typename ValueType>
+SolverPtr<typename IterativeRefinement<ValueType>::LowValueType> IterativeRefinement<ValueType>::getInnerSolver() const
+{
+    return mInnerSolver;
+}
+
+/* ========================================================================= */
+/*    Initializaition                                                        */
+/* ========================================================================= */
+
+template<typename ValueType>
+void IterativeRefinement<ValueType>::initialize( const Matrix<ValueType>& coefficients )
+{
+    SCAI_LOG_DEBUG( logger, "Initialization started for coefficients = " << coefficients )
+
+    IterativeSolver<ValueType>::initialize( coefficients );
+
+    IterativeRefinementRuntime& runtime = getRuntime();
+
+    // copy of the matrix in lower precision, keep the format if possible
+
+    lama::Format format = coefficients.getFormat();
+
+    if ( !lama::_Matrix::canCreate( lama::MatrixCreateKeyType( format, common::TypeTraits<LowValueType>::stype ) ) )
+    {
+        format = lama::Format::CSR;
+    }
+
+    runtime.mLowCoefficients.reset( Matrix<LowValueType>::getMatrix( format ) );
+
+    *runtime.mLowCoefficients = lama::cast<LowValueType>( coefficients );
+
+    if ( !mInnerSolver )
+    {
+        // default: CG with a fixed number of iterations, a relative residual threshold
+        // cannot be used here as it keeps the initial residual of the first solve
+
+        CriterionPtr<LowValueType> criterion( new IterationCount<LowValueType>( 50 ) );
+
+        auto innerSolver = std::make_shared<CG<LowValueType>>( "IterativeRefinement::InnerSolver" );
+        innerSolver->setStoppingCriterion( criterion );
+        mInnerSolver = innerSolver;
+    }
+
+    // setup of inner solver is done only once and reused in each refinement step
+
+    mInnerSolver->initialize( *runtime.mLowCoefficients );
+
+    SCAI_LOG_INFO( logger, "Initialized, inner solver = " << *mInnerSolver << ", low matrix = " << *runtime.mLowCoefficients )
+}
+
+/* ========================================================================= */
+/*    Solver Iteration                                                       */
+/* ========================================================================= */
+
+template<typename ValueType>
+void IterativeRefinement<ValueType>::iterate()
+{
+    IterativeRefinementRuntime& runtime = getRuntime();
+
+    // residual r = b - A * x in full precision
+
+    const Vector<ValueType>& residual = this->getResidual();
+
+    DenseVector<LowValueType>& lowResidual   = runtime.mLowResidual;
+    DenseVector<LowValueType>& lowCorrection = runtime.mLowCorrection;
+
+    lowResidual = lama::cast<LowValueType>( residual );
+
+    if ( lowResidual.maxNorm() == RealType<LowValueType>( 0 ) )
+    {
+        SCAI_LOG_INFO( logger, "residual is zero, no correction required" )
+        return;
+    }
+
+    // solve A * d = r in low precision
+
+    lowCorrection.setSameValue( residual.getDistributionPtr(), LowValueType( 0 ) );
+
+    mInnerSolver->solve( lowCorrection, lowResidual );
+
+    // update x = x + d in full precision
+
+    Vector<ValueType>& solution = runtime.mSolution.getReference(); // dirty
+
+    solution += lama::cast<ValueType>( lowCorrection );
+}
+
+template<typename ValueType>
+typename IterativeRefinement<ValueType>::IterativeRefinementRuntime& IterativeRefinement<ValueType>::getRuntime()
+{
+    return mIterativeRefinementRuntime;
+}
+
+template<typename ValueType>
+const typename IterativeRefinement<ValueType>::IterativeRefinementRuntime& IterativeRefinement<ValueType>::getRuntime() const
+{
+    return mIterativeRefinementRuntime;
+}
+
+template<typename ValueType>
+IterativeRefinement<ValueType>* IterativeRefinement<ValueType>::copy()
+{
+    return new IterativeRefinement<ValueType>( *this );
+}
+
+template<typename ValueType>
+void IterativeRefinement<ValueType>::writeAt( std::ostream& stream ) const
+{
+    stream << "IterativeRefinement<" << common::TypeTraits<ValueType>::id() << ", "
+           << common::TypeTraits<LowValueType>::id() << "> ( id = " << Solver<ValueType>::getId()
+           << ", #iter = " << getRuntime().mIterations << " )";
+}
+
+/* ========================================================================= */
+/*       Template instantiations                                             */
+/* ========================================================================= */
+
+SCAI_COMMON_INST_CLASS( IterativeRefinement, SCAI_NUMERIC_TYPES_HOST )
+
+} /* end namespace solver */
+
+} /* end namespace scai */
@@ -0,0 +1,191 @@
+/**
+ * @file solver/IterativeRefinement.hpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Mixed precision iterative refinement with an inner solver of lower precision
+ * @author Thomas Brandes
+ * @date 19.10.2026
+ */
+
+#pragma once
+
+// for dll_import
+#include <scai/common/config.hpp>
+
+// base classes
+#include <scai/solver/IterativeSolver.hpp>
+
+#include <scai/lama/DenseVector.hpp>
+
+// logging
+#include <scai/logging/Logger.hpp>
+
+#include <scai/common/SCAITypes.hpp>
+
+#include <memory>
+
+namespace scai
+{
+
+namespace solver
+{
+
+/** Type trait that gives the value type with the next lower precision, used for the inner solver. */
+
+template<typename ValueType>
+struct LowerPrecision
+{
+    typedef ValueType type;
+};
+
+template<>
+struct LowerPrecision<double>
+{
+    typedef float type;
+};
+
+template<>
+struct LowerPrecision<LongDouble>
+{
+    typedef double type;
+};
+
+template<>
+struct LowerPrecision<ComplexDouble>
+{
+    typedef ComplexFloat type;
+};
+
+template<>
+struct LowerPrecision<ComplexLongDouble>
+{
+    typedef ComplexDouble type;
+};
+
+/**
+ * @brief Mixed precision iterative refinement.
+ *
+ * Each iteration computes the residual r = b - A * x in ValueType, solves A * d = r
+ * with an inner solver in lower precision (e.g. float for double) and updates x = x + d in ValueType.
+ * The inner solver works on a copy of the matrix in lower precision that is built and
+ * set up only once in initialize, so the setup (e.g. a factorization or an AMG hierarchy)
+ * is reused in all refinement steps.
+ *
+ * The default inner solver is CG with 50 iterations.
+ */
+template<typename ValueType>
+class COMMON_DLL_IMPORTEXPORT IterativeRefinement:
+
+    public IterativeSolver<ValueType>,
+    public _Solver::Register<IterativeRefinement<ValueType> >
+
+{
+public:
+
+    /** Value type used for the inner solver and for the copy of the matrix. */
+
+    typedef typename LowerPrecision<ValueType>::type LowValueType;
+
+    IterativeRefinement( const std::string& id );
+
+    IterativeRefinement( const std::string& id, LoggerPtr logger );
+
+    /**
+     * @brief Copy constructor that copies the status independent solver information
+     */
+    IterativeRefinement( const IterativeRefinement& other );
+
+    virtual ~IterativeRefinement();
+
+    /**
+     * @brief Set the solver used for the correction equation in lower precision.
+     *
+     * The inner solver must be set before this solver is initialized.
+     */
+    void setInnerSolver( SolverPtr<LowValueType> innerSolver );
+
+    /**
+     * @brief Query the solver used for the correction equation.
+     */
+    SolverPtr<LowValueType> getInnerSolver() const;
+
+    /**
+     * @brief Initialize the solver, builds the matrix in lower precision and initializes the inner solver with it.
+     */
+    virtual void initialize( const lama::Matrix<ValueType>& coefficients );
+
+    /**
+     * @brief Copies the status independent solver informations to create a new instance of the same
+     * type
+     *
+     * @return shared pointer of the copied solver
+     */
+    virtual IterativeRefinement<ValueType>* copy();
+
+    struct IterativeRefinementRuntime: IterativeSolver<ValueType>::IterativeSolverRuntime
+    {
+        std::unique_ptr<lama::Matrix<LowValueType>> mLowCoefficients;  //!< matrix in lower precision
+        lama::DenseVector<LowValueType> mLowResidual;                  //!< residual in lower precision
+        lama::DenseVector<LowValueType> mLowCorrection;                //!< correction in lower precision
+    };
+
+    /**
+     * @brief Returns the complete configuration of the derived class
+     */
+    virtual IterativeRefinementRuntime& getRuntime();
+
+    /**
+     * @brief Returns the complete const configuration of the derived class
+     */
+    virtual const IterativeRefinementRuntime& getRuntime() const;
+
+    // static method that delivers the key for registration in solver factor
+
+    static SolverCreateKeyType createValue();
+
+    // static method for create by factory
+
+    static _Solver* create();
+
+protected:
+
+    IterativeRefinementRuntime mIterativeRefinementRuntime;
+
+    SolverPtr<LowValueType> mInnerSolver;
+
+    /**
+     * @brief Performs one refinement step
+     */
+    virtual void iterate();
+
+    SCAI_LOG_DECL_STATIC_LOGGER( logger )
+
+    /**
+     *  @brief own implementation of Printable::writeAt
+     */
+    virtual void writeAt( std::ostream& stream ) const;
+};
+
+} /* end namespace solver */
+
+} /* end namespace scai */
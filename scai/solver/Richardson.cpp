@@ -34,6 +34,7 @@
 #include <scai/lama/expression/VectorExpressions.hpp>
 #include <scai/lama/expression/MatrixExpressions.hpp>
 #include <scai/lama/expression/MatrixVectorExpressions.hpp>
+#include <scai/lama/expression/FusedVectorExpression.hpp>
 #include <scai/lama/norm/L2Norm.hpp>
 #include <scai/lama/Vector.hpp>
 #include <scai/common/macros/instantiate.hpp>
@@ -169,16 +170,14 @@ void Richardson<ValueType>::iterate()
     lama::Vector<ValueType>& x = *runtime.mX;
 
     x = A * oldSolution;
-    solution = rhs - x;
 
     ValueType omega = OmegaSolver<ValueType>::getOmega();
 
-    if ( omega != ValueType( 1 ) )
-    {
-        solution *= omega;
-    }
+    // solution = oldSolution + omega * ( rhs - x ) in one single pass
+
+    using namespace lama::fused;
 
-    solution += oldSolution;
+    assign( solution, vec( oldSolution ) + omega * ( vec( rhs ) - vec( x ) ) );
 }
 
 template<typename ValueType>
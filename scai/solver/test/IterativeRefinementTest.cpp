@@ -0,0 +1,121 @@
+/**
+ * @file IterativeRefinementTest.cpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Test routines for the mixed precision solver class IterativeRefinement.
+ * @author Thomas Brandes
+ * @date 19.10.2026
+ */
+
+#include <boost/test/unit_test.hpp>
+
+#include <scai/solver/IterativeRefinement.hpp>
+#include <scai/solver/Jacobi.hpp>
+#include <scai/solver/TrivialPreconditioner.hpp>
+#include <scai/solver/criteria/IterationCount.hpp>
+#include <scai/solver/logger/Timer.hpp>
+#include <scai/solver/logger/CommonLogger.hpp>
+
+#include <scai/lama/matrix/CSRSparseMatrix.hpp>
+#include <scai/lama/matutils/MatrixCreator.hpp>
+#include <scai/lama/expression/MatrixVectorExpressions.hpp>
+
+#include <scai/solver/test/TestMacros.hpp>
+
+using namespace scai;
+using namespace solver;
+using namespace lama;
+
+// ---------------------------------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE( IterativeRefinementTest )
+
+SCAI_LOG_DEF_LOGGER( logger, "Test.IterativeRefinementTest" )
+
+// ---------------------------------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( ConstructorTest, ValueType, scai_numeric_test_types )
+{
+    typedef typename IterativeRefinement<ValueType>::LowValueType LowValueType;
+
+    LoggerPtr slogger( new CommonLogger( "<IterativeRefinement>: ", LogLevel::noLogging, LoggerWriteBehaviour::toConsoleOnly ) );
+    IterativeRefinement<ValueType> irSolver( "IRTestSolver", slogger );
+    BOOST_CHECK_EQUAL( irSolver.getId(), "IRTestSolver" );
+    IterativeRefinement<ValueType> irSolver2( "IRTestSolver2" );
+    BOOST_CHECK_EQUAL( irSolver2.getId(), "IRTestSolver2" );
+    BOOST_CHECK( !irSolver2.getInnerSolver() );
+
+    SolverPtr<LowValueType> innerSolver( new Jacobi<LowValueType>( "InnerJacobi" ) );
+    irSolver2.setInnerSolver( innerSolver );
+    CriterionPtr<ValueType> criterion( new IterationCount<ValueType>( 10 ) );
+    irSolver2.setStoppingCriterion( criterion );
+
+    // copy constructor makes a copy of the inner solver
+
+    IterativeRefinement<ValueType> irSolver3( irSolver2 );
+    BOOST_CHECK_EQUAL( irSolver3.getId(), irSolver2.getId() );
+    BOOST_REQUIRE( irSolver3.getInnerSolver() );
+    BOOST_CHECK_EQUAL( irSolver3.getInnerSolver()->getId(), "InnerJacobi" );
+    BOOST_CHECK( irSolver3.getInnerSolver() != innerSolver );
+}
+
+// ---------------------------------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE( RefinementTest )
+{
+    // the inner solver works in single precision but the solution must be accurate in double
+
+    typedef double ValueType;
+    typedef IterativeRefinement<ValueType>::LowValueType LowValueType;
+
+    BOOST_CHECK_EQUAL( common::TypeTraits<LowValueType>::stype, common::ScalarType::FLOAT );
+
+    CSRSparseMatrix<ValueType> matrix;
+    MatrixCreator::buildPoisson2D( matrix, 5, 10, 10 );
+
+    auto colDist       = matrix.getColDistributionPtr();
+    auto exactSolution = denseVectorLinear<ValueType>( colDist, 1.0, 0.125 );
+    auto rhs           = denseVectorEval( matrix * exactSolution );
+    auto solution      = denseVector<ValueType>( colDist, 0 );
+
+    IterativeRefinement<ValueType> irSolver( "RefinementTestSolver" );
+    irSolver.setStoppingCriterion( std::make_shared<IterationCount<ValueType>>( 10 ) );
+    irSolver.initialize( matrix );
+    irSolver.solve( solution, rhs );
+
+    BOOST_CHECK_EQUAL( irSolver.getIterationCount(), IndexType( 10 ) );
+
+    auto diff = denseVectorEval( solution - exactSolution );
+
+    ValueType maxDiff = diff.maxNorm();
+
+    SCAI_LOG_INFO( logger, "refinement: max diff = " << maxDiff )
+
+    // single precision alone cannot get below 1e-6
+
+    BOOST_CHECK_MESSAGE( maxDiff < 1e-10, "max diff = " << maxDiff );
+}
+
+// ---------------------------------------------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_SUITE_END();
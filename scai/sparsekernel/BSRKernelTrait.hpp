@@ -0,0 +1,281 @@
+/**
+ * @file BSRKernelTrait.hpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Struct with traits for all BSR storage methods provided as kernels.
+ * @author Thomas Brandes
+ * @date 19.10.2026
+ */
+#pragma once
+
+// for dll_import
+#include <scai/common/config.hpp>
+#include <scai/common/MatrixOp.hpp>
+
+namespace scai
+{
+
+namespace sparsekernel
+{
+
+/** Traits for LAMA kernels used in BSR storage.
+ *
+ *  The BSR (block compressed sparse row) format stores dense blocks of size b x b:
+ *
+ *   - bsrIA contains the offsets for each block row, size is numBlockRows + 1
+ *   - bsrJA contains the block column index for each stored block, sorted within each block row
+ *   - bsrValues contains b * b values for each stored block, each block in row-major order
+ *
+ *  numBlockRows = ( numRows + b - 1 ) / b, blocks at the border might be padded with zeros.
+ */
+
+struct BSRKernelTrait
+{
+    struct getValuePos
+    {
+        /** Returns position of element (i,j) in values array
+         *
+         *  @param[in] i is the row of the element
+         *  @param[in] j is the column of the element
+         *  @param[in] blockSize is the size b of the blocks
+         *  @param[in] bsrIA block row offsets
+         *  @param[in] bsrJA block column indexes
+         *  @returns  offset of element in values array, invalidIndex if not found
+         */
+
+        typedef IndexType ( *FuncType ) (
+            const IndexType i,
+            const IndexType j,
+            const IndexType blockSize,
+            const IndexType bsrIA[],
+            const IndexType bsrJA[] );
+
+        static const char* getId()
+        {
+            return "BSR.getValuePos";
+        }
+    };
+
+    struct getCSRSizes
+    {
+        /** Compute the number of entries in each row of the corresponding CSR storage
+         *
+         *  @param[out] csrSizes array with number of entries in each row, size is numRows
+         *  @param[in] numRows is the number of rows
+         *  @param[in] numColumns is the number of columns
+         *  @param[in] blockSize is the size b of the blocks
+         *  @param[in] bsrIA block row offsets
+         *  @param[in] bsrJA block column indexes
+         *
+         *  All entries of a stored block are counted (also explicit zeros) unless
+         *  they are in the padded part of a border block.
+         */
+
+        typedef void ( *FuncType )(
+            IndexType csrSizes[],
+            const IndexType numRows,
+            const IndexType numColumns,
+            const IndexType blockSize,
+            const IndexType bsrIA[],
+            const IndexType bsrJA[] );
+
+        static const char* getId()
+        {
+            return "BSR.getCSRSizes";
+        }
+    };
+
+    template<typename ValueType>
+    struct getCSRValues
+    {
+        /** Conversion of BSR storage data to CSR data.
+         *
+         *  @param[out] csrJA will contain the column indexes
+         *  @param[out] csrValues will contain the matrix elements
+         *  @param[in] csrIA is the array with the offsets (must already be available before)
+         *  @param[in] numRows is the number of rows
+         *  @param[in] numColumns is the number of columns
+         *  @param[in] blockSize is the size b of the blocks
+         *  @param[in] bsrIA block row offsets
+         *  @param[in] bsrJA block column indexes
+         *  @param[in] bsrValues values of the blocks
+         *
+         *  The column indexes in each row of the CSR data will be sorted.
+         */
+        typedef void ( *FuncType ) (
+            IndexType csrJA[],
+            ValueType csrValues[],
+            const IndexType csrIA[],
+            const IndexType numRows,
+            const IndexType numColumns,
+            const IndexType blockSize,
+            const IndexType bsrIA[],
+            const IndexType bsrJA[],
+            const ValueType bsrValues[] );
+
+        static const char* getId()
+        {
+            return "BSR.getCSRValues";
+        }
+    };
+
+    template<typename ValueType>
+    struct normalGEMV
+    {
+        /** result = alpha * BSR-Matrix * x + b * y.
+         *
+         *  @param[out] result is the result vector
+         *  @param[in] alpha is scaling factor for matrix x vector
+         *  @param[in] x is input vector for matrix multiplication
+         *  @param[in] beta is scaling factor for additional vector
+         *  @param[in] y is additional input vector to add, can be NULL if beta is zero
+         *  @param[in] numRows is number of rows for matrix
+         *  @param[in] numColumns is number of columns for matrix
+         *  @param[in] blockSize is the size b of the blocks
+         *  @param[in] bsrIA block row offsets, size is numBlockRows + 1
+         *  @param[in] bsrJA block column indexes
+         *  @param[in] bsrValues values of the blocks
+         *  @param[in] op specifies if matrix or its transpose is used
+         *
+         *  The implementation might provide specialized versions for small block sizes
+         *  where the block loops are completely unrolled.
+         */
+        typedef void ( *FuncType ) (
+            ValueType result[],
+            const ValueType alpha,
+            const ValueType x[],
+            const ValueType beta,
+            const ValueType y[],
+            const IndexType numRows,
+            const IndexType numColumns,
+            const IndexType blockSize,
+            const IndexType bsrIA[],
+            const IndexType bsrJA[],
+            const ValueType bsrValues[],
+            const common::MatrixOp op );
+
+        static const char* getId()
+        {
+            return "BSR.normalGEMV";
+        }
+    };
+
+    template<typename ValueType>
+    struct invertDiagonalBlocks
+    {
+        /** Compute the inverse of each diagonal block of a square BSR matrix.
+         *
+         *  @param[out] invDiagonal contains the inverted diagonal blocks, size is numBlockRows * b * b
+         *  @param[in] numRows is number of rows (and columns) for matrix
+         *  @param[in] blockSize is the size b of the blocks
+         *  @param[in] bsrIA block row offsets, size is numBlockRows + 1
+         *  @param[in] bsrJA block column indexes
+         *  @param[in] bsrValues values of the blocks
+         *  @returns invalidIndex if all blocks could be inverted, otherwise the first block row with a singular block
+         *
+         *  Padded diagonal entries of the last block are considered as 1. A missing diagonal
+         *  block is singular.
+         */
+        typedef IndexType ( *FuncType ) (
+            ValueType invDiagonal[],
+            const IndexType numRows,
+            const IndexType blockSize,
+            const IndexType bsrIA[],
+            const IndexType bsrJA[],
+            const ValueType bsrValues[] );
+
+        static const char* getId()
+        {
+            return "BSR.invertDiagonalBlocks";
+        }
+    };
+
+    template<typename ValueType>
+    struct jacobi
+    {
+        /** Method to compute one iteration step of the block Jacobi method
+         *
+         *  \code
+         *     solution = oldSolution + omega * invDiagonal * ( rhs - A * oldSolution )
+         *  \endcode
+         *
+         *  @param[out] solution is the new solution
+         *  @param[in] numRows is number of rows (and columns) for matrix
+         *  @param[in] blockSize is the size b of the blocks
+         *  @param[in] bsrIA block row offsets, size is numBlockRows + 1
+         *  @param[in] bsrJA block column indexes
+         *  @param[in] bsrValues values of the blocks
+         *  @param[in] invDiagonal inverted diagonal blocks as computed by invertDiagonalBlocks
+         *  @param[in] oldSolution is the previous solution
+         *  @param[in] rhs is the right hand side
+         *  @param[in] omega is the damping factor
+         */
+        typedef void ( *FuncType )(
+            ValueType solution[],
+            const IndexType numRows,
+            const IndexType blockSize,
+            const IndexType bsrIA[],
+            const IndexType bsrJA[],
+            const ValueType bsrValues[],
+            const ValueType invDiagonal[],
+            const ValueType oldSolution[],
+            const ValueType rhs[],
+            const ValueType omega );
+
+        static const char* getId()
+        {
+            return "BSR.jacobi";
+        }
+    };
+
+    template<typename ValueType>
+    struct jacobiHalo
+    {
+        /** Method to update the solution by the halo part of a distributed matrix
+         *
+         *  \code
+         *     solution -= omega * ( B(halo) * oldSolution) ./ diagonal
+         *  \endcode
+         */
+        typedef void ( *FuncType )(
+            ValueType solution[],
+            const ValueType diagonal[],
+            const IndexType numRows,
+            const IndexType numColumns,
+            const IndexType blockSize,
+            const IndexType bsrIA[],
+            const IndexType bsrJA[],
+            const ValueType bsrValues[],
+            const ValueType oldSolution[],
+            const ValueType omega );
+
+        static const char* getId()
+        {
+            return "BSR.jacobiHalo";
+        }
+    };
+};
+
+} /* end namespace sparsekernel */
+
+} /* end namespace scai */
@@ -0,0 +1,665 @@
+/**
+ * @file BSRUtils.cpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Implementation of utility functions for BSR data
+ * @author Thomas Brandes
+ * @date 19.10.2026
+ */
+
+#include <scai/sparsekernel/BSRUtils.hpp>
+
+#include <scai/sparsekernel/BSRKernelTrait.hpp>
+
+#include <scai/utilskernel/HArrayUtils.hpp>
+#include <scai/utilskernel/LAMAKernel.hpp>
+#include <scai/hmemo/HostWriteAccess.hpp>
+#include <scai/hmemo/HostReadAccess.hpp>
+
+#include <scai/tracing.hpp>
+#include <scai/common/macros/loop.hpp>
+#include <scai/common/Math.hpp>
+
+#include <algorithm>
+#include <memory>
+
+namespace scai
+{
+
+using namespace hmemo;
+
+using utilskernel::LAMAKernel;
+using utilskernel::HArrayUtils;
+using tasking::SyncToken;
+
+namespace sparsekernel
+{
+
+SCAI_LOG_DEF_LOGGER( BSRUtils::logger, "BSRUtils" )
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRUtils::convertBSR2CSR(
+    HArray<IndexType>& csrIA,
+    HArray<IndexType>& csrJA,
+    HArray<ValueType>& csrValues,
+    const IndexType numRows,
+    const IndexType numColumns,
+    const IndexType blockSize,
+    const HArray<IndexType>& bsrIA,
+    const HArray<IndexType>& bsrJA,
+    const HArray<ValueType>& bsrValues,
+    ContextPtr prefLoc )
+{
+    getCSRSizes( csrIA, numRows, numColumns, blockSize, bsrIA, bsrJA, prefLoc );
+
+    IndexType numValues = HArrayUtils::scan1( csrIA, prefLoc );
+
+    static LAMAKernel<BSRKernelTrait::getCSRValues<ValueType> > getCSRValues;
+
+    ContextPtr loc = prefLoc;
+    getCSRValues.getSupportedContext( loc );
+
+    ReadAccess<IndexType> rBsrIA( bsrIA, loc );
+    ReadAccess<IndexType> rBsrJA( bsrJA, loc );
+    ReadAccess<ValueType> rBsrValues( bsrValues, loc );
+
+    ReadAccess<IndexType> rIA( csrIA, loc );
+    WriteOnlyAccess<IndexType> wJA( csrJA, loc, numValues );
+    WriteOnlyAccess<ValueType> wValues( csrValues, loc, numValues );
+
+    SCAI_CONTEXT_ACCESS( loc )
+
+    getCSRValues[loc]( wJA.get(), wValues.get(), rIA.get(), numRows, numColumns, blockSize,
+                       rBsrIA.get(), rBsrJA.get(), rBsrValues.get() );
+}
+
+/* -------------------------------------------------------------------------- */
+
+void BSRUtils::getCSRSizes(
+    HArray<IndexType>& csrSizes,
+    const IndexType numRows,
+    const IndexType numColumns,
+    const IndexType blockSize,
+    const HArray<IndexType>& bsrIA,
+    const HArray<IndexType>& bsrJA,
+    ContextPtr prefLoc )
+{
+    static LAMAKernel<BSRKernelTrait::getCSRSizes> getCSRSizes;
+
+    ContextPtr loc = prefLoc;
+    getCSRSizes.getSupportedContext( loc );
+    SCAI_CONTEXT_ACCESS( loc )
+
+    ReadAccess<IndexType> rIA( bsrIA, loc );
+    ReadAccess<IndexType> rJA( bsrJA, loc );
+
+    // allocate one more entry so the array can be used for offsets
+
+    WriteOnlyAccess<IndexType> wSizes( csrSizes, loc, numRows + 1 );
+
+    getCSRSizes[loc]( wSizes.get(), numRows, numColumns, blockSize, rIA.get(), rJA.get() );
+
+    wSizes.resize( numRows );
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRUtils::convertCSR2BSR(
+    HArray<IndexType>& bsrIA,
+    HArray<IndexType>& bsrJA,
+    HArray<ValueType>& bsrValues,
+    const IndexType numRows,
+    const IndexType numColumns,
+    const IndexType blockSize,
+    const HArray<IndexType>& csrIA,
+    const HArray<IndexType>& csrJA,
+    const HArray<ValueType>& csrValues,
+    ContextPtr )
+{
+    SCAI_REGION( "Sparse.BSR.fromCSR" )
+
+    SCAI_ASSERT_GT_ERROR( blockSize, 0, "illegal block size" )
+
+    SCAI_LOG_INFO( logger, "convert CSR " << numRows << " x " << numColumns << " to BSR, block size = " << blockSize
+                     << ", ia = " << csrIA << ", ja = " << csrJA << ", values = " << csrValues )
+
+    const IndexType numBlockRows    = ( numRows + blockSize - 1 ) / blockSize;
+    const IndexType numBlockColumns = ( numColumns + blockSize - 1 ) / blockSize;
+    const IndexType blockSize2      = blockSize * blockSize;
+
+    auto rIA = hostReadAccess( csrIA );
+    auto rJA = hostReadAccess( csrJA );
+    auto rValues = hostReadAccess( csrValues );
+
+    auto wIA = hostWriteOnlyAccess( bsrIA, numBlockRows + 1 );
+
+    // count the different block columns used in each block row, marker[jb] == ib if already counted
+
+    #pragma omp parallel
+    {
+        std::unique_ptr<IndexType[]> marker( new IndexType[numBlockColumns] );
+
+        std::fill_n( marker.get(), numBlockColumns, invalidIndex );
+
+        #pragma omp for
+
+        for ( IndexType ib = 0; ib < numBlockRows; ++ib )
+        {
+            IndexType count = 0;
+
+            const IndexType iEnd = common::Math::min( ( ib + 1 ) * blockSize, numRows );
+
+            for ( IndexType i = ib * blockSize; i < iEnd; ++i )
+            {
+                for ( IndexType jj = rIA[i]; jj < rIA[i + 1]; ++jj )
+                {
+                    const IndexType jb = rJA[jj] / blockSize;
+
+                    if ( marker[jb] != ib )
+                    {
+                        marker[jb] = ib;
+                        count++;
+                    }
+                }
+            }
+
+            wIA[ib] = count;
+        }
+    }
+
+    // build offsets, serial scan is fine as there are only few block rows
+
+    IndexType numBlocks = 0;
+
+    for ( IndexType ib = 0; ib < numBlockRows; ++ib )
+    {
+        IndexType tmp = wIA[ib];
+        wIA[ib] = numBlocks;
+        numBlocks += tmp;
+    }
+
+    wIA[numBlockRows] = numBlocks;
+
+    auto wJA = hostWriteOnlyAccess( bsrJA, numBlocks );
+    auto wValues = hostWriteOnlyAccess( bsrValues, numBlocks * blockSize2 );
+
+    #pragma omp parallel
+    {
+        std::unique_ptr<IndexType[]> marker( new IndexType[numBlockColumns] );
+
+        std::fill_n( marker.get(), numBlockColumns, invalidIndex );
+
+        #pragma omp for
+
+        for ( IndexType ib = 0; ib < numBlockRows; ++ib )
+        {
+            IndexType offset = wIA[ib];
+
+            const IndexType iEnd = common::Math::min( ( ib + 1 ) * blockSize, numRows );
+
+            for ( IndexType i = ib * blockSize; i < iEnd; ++i )
+            {
+                for ( IndexType jj = rIA[i]; jj < rIA[i + 1]; ++jj )
+                {
+                    const IndexType jb = rJA[jj] / blockSize;
+
+                    if ( marker[jb] != ib )
+                    {
+                        marker[jb] = ib;
+                        wJA[offset++] = jb;
+                    }
+                }
+            }
+
+            IndexType* firstJA = wJA.get() + wIA[ib];
+            IndexType* lastJA  = wJA.get() + wIA[ib + 1];
+
+            std::sort( firstJA, lastJA );
+
+            std::fill( wValues.get() + wIA[ib] * blockSize2, wValues.get() + wIA[ib + 1] * blockSize2, ValueType( 0 ) );
+
+            for ( IndexType i = ib * blockSize; i < iEnd; ++i )
+            {
+                const IndexType r = i - ib * blockSize;
+
+                for ( IndexType jj = rIA[i]; jj < rIA[i + 1]; ++jj )
+                {
+                    const IndexType j  = rJA[jj];
+                    const IndexType jb = j / blockSize;
+                    const IndexType k  = std::lower_bound( firstJA, lastJA, jb ) - wJA.get();
+
+                    wValues[k * blockSize2 + r * blockSize + j - jb * blockSize] = rValues[jj];
+                }
+            }
+        }
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+
+IndexType BSRUtils::getValuePos(
+    const IndexType i,
+    const IndexType j,
+    const IndexType blockSize,
+    const HArray<IndexType>& bsrIA,
+    const HArray<IndexType>& bsrJA,
+    ContextPtr prefLoc )
+{
+    static LAMAKernel<BSRKernelTrait::getValuePos> getValuePos;
+
+    ContextPtr loc = prefLoc;
+    getValuePos.getSupportedContext( loc );
+    SCAI_CONTEXT_ACCESS( loc )
+
+    ReadAccess<IndexType> rIA( bsrIA, loc );
+    ReadAccess<IndexType> rJA( bsrJA, loc );
+
+    return getValuePos[loc]( i, j, blockSize, rIA.get(), rJA.get() );
+}
+
+/* -------------------------------------------------------------------------- */
+
+void BSRUtils::getRowPositions(
+    HArray<IndexType>& indexes,
+    HArray<IndexType>& positions,
+    const IndexType i,
+    const IndexType numColumns,
+    const IndexType blockSize,
+    const HArray<IndexType>& bsrIA,
+    const HArray<IndexType>& bsrJA,
+    ContextPtr )
+{
+    auto rIA = hostReadAccess( bsrIA );
+    auto rJA = hostReadAccess( bsrJA );
+
+    const IndexType ib = i / blockSize;
+    const IndexType r  = i - ib * blockSize;
+
+    // number of blocks * blockSize is an upper bound for the number of entries in the row
+
+    const IndexType maxEntries = ( rIA[ib + 1] - rIA[ib] ) * blockSize;
+
+    auto wIndexes   = hostWriteOnlyAccess( indexes, maxEntries );
+    auto wPositions = hostWriteOnlyAccess( positions, maxEntries );
+
+    IndexType cnt = 0;
+
+    for ( IndexType k = rIA[ib]; k < rIA[ib + 1]; ++k )
+    {
+        const IndexType jFirst = rJA[k] * blockSize;
+        const IndexType nc     = common::Math::min( blockSize, numColumns - jFirst );
+
+        for ( IndexType c = 0; c < nc; ++c )
+        {
+            wIndexes[cnt]   = jFirst + c;
+            wPositions[cnt] = k * blockSize * blockSize + r * blockSize + c;
+            ++cnt;
+        }
+    }
+
+    wIndexes.resize( cnt );
+    wPositions.resize( cnt );
+}
+
+/* -------------------------------------------------------------------------- */
+
+void BSRUtils::getColPositions(
+    HArray<IndexType>& indexes,
+    HArray<IndexType>& positions,
+    const IndexType j,
+    const IndexType numRows,
+    const IndexType blockSize,
+    const HArray<IndexType>& bsrIA,
+    const HArray<IndexType>& bsrJA,
+    ContextPtr )
+{
+    auto rIA = hostReadAccess( bsrIA );
+    auto rJA = hostReadAccess( bsrJA );
+
+    const IndexType numBlockRows = bsrIA.size() - 1;
+
+    const IndexType jb = j / blockSize;
+    const IndexType c  = j - jb * blockSize;
+
+    // count the block rows that contain block column jb
+
+    IndexType cnt = 0;
+
+    for ( IndexType ib = 0; ib < numBlockRows; ++ib )
+    {
+        if ( std::binary_search( rJA.get() + rIA[ib], rJA.get() + rIA[ib + 1], jb ) )
+        {
+            cnt += common::Math::min( blockSize, numRows - ib * blockSize );
+        }
+    }
+
+    auto wIndexes   = hostWriteOnlyAccess( indexes, cnt );
+    auto wPositions = hostWriteOnlyAccess( positions, cnt );
+
+    cnt = 0;
+
+    for ( IndexType ib = 0; ib < numBlockRows; ++ib )
+    {
+        const IndexType* first = rJA.get() + rIA[ib];
+        const IndexType* last  = rJA.get() + rIA[ib + 1];
+        const IndexType* pos   = std::lower_bound( first, last, jb );
+
+        if ( pos == last || *pos != jb )
+        {
+            continue;
+        }
+
+        const IndexType k  = pos - rJA.get();
+        const IndexType nr = common::Math::min( blockSize, numRows - ib * blockSize );
+
+        for ( IndexType r = 0; r < nr; ++r )
+        {
+            wIndexes[cnt]   = ib * blockSize + r;
+            wPositions[cnt] = k * blockSize * blockSize + r * blockSize + c;
+            ++cnt;
+        }
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRUtils::invertDiagonalBlocks(
+    HArray<ValueType>& invDiagonal,
+    const IndexType numRows,
+    const IndexType blockSize,
+    const HArray<IndexType>& bsrIA,
+    const HArray<IndexType>& bsrJA,
+    const HArray<ValueType>& bsrValues,
+    ContextPtr prefLoc )
+{
+    static LAMAKernel<BSRKernelTrait::invertDiagonalBlocks<ValueType> > invertDiagonalBlocks;
+
+    const IndexType numBlockRows = ( numRows + blockSize - 1 ) / blockSize;
+
+    ContextPtr loc = prefLoc;
+    invertDiagonalBlocks.getSupportedContext( loc );
+    SCAI_CONTEXT_ACCESS( loc )
+
+    ReadAccess<IndexType> rIA( bsrIA, loc );
+    ReadAccess<IndexType> rJA( bsrJA, loc );
+    ReadAccess<ValueType> rValues( bsrValues, loc );
+    WriteOnlyAccess<ValueType> wInv( invDiagonal, loc, numBlockRows * blockSize * blockSize );
+
+    IndexType singularRow = invertDiagonalBlocks[loc]( wInv.get(), numRows, blockSize, rIA.get(), rJA.get(), rValues.get() );
+
+    SCAI_ASSERT_ERROR( singularRow == invalidIndex,
+                       "diagonal block of block row " << singularRow << " is singular or not available" )
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRUtils::jacobi(
+    HArray<ValueType>& solution,
+    const ValueType omega,
+    const HArray<ValueType>& oldSolution,
+    const HArray<ValueType>& rhs,
+    const IndexType numRows,
+    const IndexType blockSize,
+    const HArray<IndexType>& bsrIA,
+    const HArray<IndexType>& bsrJA,
+    const HArray<ValueType>& bsrValues,
+    const HArray<ValueType>& invDiagonal,
+    ContextPtr prefLoc )
+{
+    SCAI_ASSERT_EQ_DEBUG( numRows, oldSolution.size(), "size mismatch" )
+    SCAI_ASSERT_EQ_DEBUG( numRows, rhs.size(), "size mismatch" )
+
+    static LAMAKernel<BSRKernelTrait::jacobi<ValueType> > jacobi;
+
+    ContextPtr loc = prefLoc;
+    jacobi.getSupportedContext( loc );
+    SCAI_CONTEXT_ACCESS( loc )
+
+    ReadAccess<IndexType> rIA( bsrIA, loc );
+    ReadAccess<IndexType> rJA( bsrJA, loc );
+    ReadAccess<ValueType> rValues( bsrValues, loc );
+    ReadAccess<ValueType> rInv( invDiagonal, loc );
+    ReadAccess<ValueType> rOldSolution( oldSolution, loc );
+    ReadAccess<ValueType> rRhs( rhs, loc );
+    WriteOnlyAccess<ValueType> wSolution( solution, loc, numRows );
+
+    jacobi[loc]( wSolution.get(), numRows, blockSize, rIA.get(), rJA.get(), rValues.get(), rInv.get(),
+                 rOldSolution.get(), rRhs.get(), omega );
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void BSRUtils::jacobiHalo(
+    HArray<ValueType>& solution,
+    const ValueType omega,
+    const HArray<ValueType>& diagonal,
+    const HArray<ValueType>& oldSolution,
+    const IndexType numRows,
+    const IndexType numColumns,
+    const IndexType blockSize,
+    const HArray<IndexType>& bsrIA,
+    const HArray<IndexType>& bsrJA,
+    const HArray<ValueType>& bsrValues,
+    ContextPtr prefLoc )
+{
+    static LAMAKernel<BSRKernelTrait::jacobiHalo<ValueType> > jacobiHalo;
+
+    ContextPtr loc = prefLoc;
+    jacobiHalo.getSupportedContext( loc );
+    SCAI_CONTEXT_ACCESS( loc )
+
+    ReadAccess<IndexType> rIA( bsrIA, loc );
+    ReadAccess<IndexType> rJA( bsrJA, loc );
+    ReadAccess<ValueType> rValues( bsrValues, loc );
+    ReadAccess<ValueType> rOldSolution( oldSolution, loc );
+    ReadAccess<ValueType> rDiagonal( diagonal, loc );
+    WriteAccess<ValueType> wSolution( solution, loc );
+
+    jacobiHalo[loc]( wSolution.get(), rDiagonal.get(), numRows, numColumns, blockSize,
+                     rIA.get(), rJA.get(), rValues.get(), rOldSolution.get(), omega );
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+SyncToken* BSRUtils::gemv(
+    HArray<ValueType>& result,
+    const ValueType alpha,
+    const HArray<ValueType>& x,
+    const ValueType beta,
+    const HArray<ValueType>& y,
+    const IndexType numRows,
+    const IndexType numColumns,
+    const IndexType blockSize,
+    const HArray<IndexType>& bsrIA,
+    const HArray<IndexType>& bsrJA,
+    const HArray<ValueType>& bsrValues,
+    const common::MatrixOp op,
+    bool async,
+    ContextPtr prefLoc )
+{
+    SCAI_REGION( "Sparse.BSR.gemv" )
+
+    const IndexType nSource = common::isTranspose( op ) ? numRows : numColumns;
+    const IndexType nTarget = common::isTranspose( op ) ? numColumns : numRows;
+
+    SCAI_ASSERT_EQUAL_ERROR( x.size(), nSource )
+
+    static LAMAKernel<BSRKernelTrait::normalGEMV<ValueType> > normalGEMV;
+
+    ContextPtr loc = prefLoc;
+
+    normalGEMV.getSupportedContext( loc );
+
+    std::unique_ptr<SyncToken> syncToken;
+
+    if ( async )
+    {
+        syncToken.reset( loc->getSyncToken() );
+    }
+
+    SCAI_ASYNCHRONOUS( syncToken.get() );
+
+    SCAI_CONTEXT_ACCESS( loc )
+
+    ReadAccess<IndexType> rIA( bsrIA, loc );
+    ReadAccess<IndexType> rJA( bsrJA, loc );
+    ReadAccess<ValueType> rValues( bsrValues, loc );
+    ReadAccess<ValueType> rX( x, loc );
+
+    if ( beta != ValueType( 0 ) )
+    {
+        SCAI_ASSERT_EQ_ERROR( y.size(), nTarget, "y has illegal size" )
+
+        ReadAccess<ValueType> rY( y, loc );
+        WriteOnlyAccess<ValueType> wResult( result, loc, nTarget );  // result might be aliased to y
+
+        normalGEMV[loc]( wResult.get(), alpha, rX.get(), beta, rY.get(),
+                         numRows, numColumns, blockSize,
+                         rIA.get(), rJA.get(), rValues.get(), op );
+
+        if ( async )
+        {
+            syncToken->pushRoutine( rY.releaseDelayed() );
+            syncToken->pushRoutine( wResult.releaseDelayed() );
+        }
+    }
+    else
+    {
+        // do not access y at all
+
+        WriteOnlyAccess<ValueType> wResult( result, loc, nTarget );
+
+        normalGEMV[loc]( wResult.get(), alpha, rX.get(), ValueType( 0 ), NULL,
+                         numRows, numColumns, blockSize,
+                         rIA.get(), rJA.get(), rValues.get(), op );
+
+        if ( async )
+        {
+            syncToken->pushRoutine( wResult.releaseDelayed() );
+        }
+    }
+
+    if ( async )
+    {
+        syncToken->pushRoutine( rX.releaseDelayed() );
+        syncToken->pushRoutine( rValues.releaseDelayed() );
+        syncToken->pushRoutine( rJA.releaseDelayed() );
+        syncToken->pushRoutine( rIA.releaseDelayed() );
+    }
+
+    return syncToken.release();
+}
+
+/* -------------------------------------------------------------------------- */
+
+#define BSR_UTILS_SPECIFIER( ValueType )             \
+                                                     \
+    template void BSRUtils::convertBSR2CSR(          \
+        HArray<IndexType>&,                          \
+        HArray<IndexType>&,                          \
+        HArray<ValueType>&,                          \
+        const IndexType,                             \
+        const IndexType,                             \
+        const IndexType,                             \
+        const HArray<IndexType>&,                    \
+        const HArray<IndexType>&,                    \
+        const HArray<ValueType>&,                    \
+        ContextPtr );                                \
+                                                     \
+    template void BSRUtils::convertCSR2BSR(          \
+        HArray<IndexType>&,                          \
+        HArray<IndexType>&,                          \
+        HArray<ValueType>&,                          \
+        const IndexType,                             \
+        const IndexType,                             \
+        const IndexType,                             \
+        const HArray<IndexType>&,                    \
+        const HArray<IndexType>&,                    \
+        const HArray<ValueType>&,                    \
+        ContextPtr );                                \
+                                                     \
+    template void BSRUtils::invertDiagonalBlocks(    \
+        HArray<ValueType>&,                          \
+        const IndexType,                             \
+        const IndexType,                             \
+        const HArray<IndexType>&,                    \
+        const HArray<IndexType>&,                    \
+        const HArray<ValueType>&,                    \
+        ContextPtr );                                \
+                                                     \
+    template void BSRUtils::jacobi(                  \
+        HArray<ValueType>&,                          \
+        const ValueType,                             \
+        const HArray<ValueType>&,                    \
+        const HArray<ValueType>&,                    \
+        const IndexType,                             \
+        const IndexType,                             \
+        const HArray<IndexType>&,                    \
+        const HArray<IndexType>&,                    \
+        const HArray<ValueType>&,                    \
+        const HArray<ValueType>&,                    \
+        ContextPtr );                                \
+                                                     \
+    template void BSRUtils::jacobiHalo(              \
+        HArray<ValueType>&,                          \
+        const ValueType,                             \
+        const HArray<ValueType>&,                    \
+        const HArray<ValueType>&,                    \
+        const IndexType,                             \
+        const IndexType,                             \
+        const IndexType,                             \
+        const HArray<IndexType>&,                    \
+        const HArray<IndexType>&,                    \
+        const HArray<ValueType>&,                    \
+        ContextPtr );                                \
+                                                     \
+    template SyncToken* BSRUtils::gemv(              \
+        HArray<ValueType>&,                          \
+        const ValueType,                             \
+        const HArray<ValueType>&,                    \
+        const ValueType,                             \
+        const HArray<ValueType>&,                    \
+        const IndexType,                             \
+        const IndexType,                             \
+        const IndexType,                             \
+        const HArray<IndexType>&,                    \
+        const HArray<IndexType>&,                    \
+        const HArray<ValueType>&,                    \
+        const common::MatrixOp op,                   \
+        const bool,                                  \
+        ContextPtr );                                \
+
+SCAI_COMMON_LOOP( BSR_UTILS_SPECIFIER, SCAI_NUMERIC_TYPES_HOST )
+
+#undef BSR_UTILS_SPECIFIER
+
+} /* end namespace sparsekernel */
+
+} /* end namespace scai */
@@ -0,0 +1,248 @@
+/**
+ * @file BSRUtils.hpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Utility functions for BSR data
+ * @author Thomas Brandes
+ * @date 19.10.2026
+ */
+#pragma once
+
+// for dll_import
+#include <scai/common/config.hpp>
+
+// internal scai libraries
+#include <scai/hmemo.hpp>
+
+#include <scai/tasking/SyncToken.hpp>
+
+#include <scai/common/SCAITypes.hpp>
+#include <scai/common/MatrixOp.hpp>
+
+namespace scai
+{
+
+namespace sparsekernel
+{
+
+/**
+ *  This class provides utility functions regarding the BSR (block compressed sparse row)
+ *  storage format that contains the following arrays:
+ *
+ *   - array ia contains the offsets for each block row, size is numBlockRows + 1
+ *   - array ja contains the block column index for each stored block (sorted in each block row)
+ *   - array values contains blockSize x blockSize entries for each stored block, row-major
+ *
+ *   An entry values[ k * b * b + r * b + c ] stands for entry ( ib * b + r, ja[k] * b + c )
+ *   in the matrix, where ia[ib] <= k < ia[ib + 1]. The number of block rows is
+ *   ( numRows + b - 1 ) / b, entries of border blocks beyond numRows or numColumns are zero.
+ */
+class COMMON_DLL_IMPORTEXPORT BSRUtils
+{
+public:
+
+    /**
+     *  @brief Conversion of BSR storage data to the CSR storage format.
+     *
+     *  All entries of the stored blocks become entries of the CSR data, i.e. also
+     *  explicit zeros that are part of a block.
+     */
+    template<typename ValueType>
+    static void convertBSR2CSR(
+        hmemo::HArray<IndexType>& csrIA,
+        hmemo::HArray<IndexType>& csrJA,
+        hmemo::HArray<ValueType>& csrValues,
+        const IndexType numRows,
+        const IndexType numColumns,
+        const IndexType blockSize,
+        const hmemo::HArray<IndexType>& bsrIA,
+        const hmemo::HArray<IndexType>& bsrJA,
+        const hmemo::HArray<ValueType>& bsrValues,
+        hmemo::ContextPtr loc );
+
+    /**
+     *  @brief Get the number of entries for each row of the corresponding CSR data.
+     */
+    static void getCSRSizes(
+        hmemo::HArray<IndexType>& csrSizes,
+        const IndexType numRows,
+        const IndexType numColumns,
+        const IndexType blockSize,
+        const hmemo::HArray<IndexType>& bsrIA,
+        const hmemo::HArray<IndexType>& bsrJA,
+        hmemo::ContextPtr loc );
+
+    /**
+     *  @brief Convert CSR storage data to BSR storage data
+     *
+     *  Each block that contains at least one entry of the CSR data is stored,
+     *  the other entries of the block are filled with zero.
+     */
+    template<typename ValueType>
+    static void convertCSR2BSR(
+        hmemo::HArray<IndexType>& bsrIA,
+        hmemo::HArray<IndexType>& bsrJA,
+        hmemo::HArray<ValueType>& bsrValues,
+        const IndexType numRows,
+        const IndexType numColumns,
+        const IndexType blockSize,
+        const hmemo::HArray<IndexType>& csrIA,
+        const hmemo::HArray<IndexType>& csrJA,
+        const hmemo::HArray<ValueType>& csrValues,
+        hmemo::ContextPtr loc );
+
+    /**
+     *  @brief Get the position for the matrix entry (i, j) in the values array.
+     *
+     *  @returns the position or invalidIndex if the block containing (i, j) is not available
+     */
+    static IndexType getValuePos(
+        const IndexType i,
+        const IndexType j,
+        const IndexType blockSize,
+        const hmemo::HArray<IndexType>& bsrIA,
+        const hmemo::HArray<IndexType>& bsrJA,
+        hmemo::ContextPtr prefLoc );
+
+    /**
+     *  @brief Get the positions for the matrix row (i, : )
+     *
+     *  @param[out] indexes contains all column indexes j where entry (i, j ) is available
+     *  @param[out] positions contains the positions in values array where to find the matrix value
+     *  @param[in]  i is the index of the row for which positions are required
+     *  @param[in]  numColumns is the number of columns for the storage
+     *  @param[in]  blockSize is the size of the blocks
+     *  @param[in]  bsrIA, bsrJA are the block row offsets and block column indexes
+     *  @param[in]  prefLoc specifies context where operation should be done
+     */
+    static void getRowPositions(
+        hmemo::HArray<IndexType>& indexes,
+        hmemo::HArray<IndexType>& positions,
+        const IndexType i,
+        const IndexType numColumns,
+        const IndexType blockSize,
+        const hmemo::HArray<IndexType>& bsrIA,
+        const hmemo::HArray<IndexType>& bsrJA,
+        hmemo::ContextPtr prefLoc );
+
+    /**
+     *  @brief Get the positions for the matrix column (:, j )
+     *
+     *  @param[out] indexes contains all row indexes i where entry (i, j ) is available
+     *  @param[out] positions contains the positions in values array where to find the matrix value
+     *  @param[in]  j is the index of the column for which positions are required
+     *  @param[in]  numRows is the number of rows for the storage
+     *  @param[in]  blockSize is the size of the blocks
+     *  @param[in]  bsrIA, bsrJA are the block row offsets and block column indexes
+     *  @param[in]  prefLoc specifies context where operation should be done
+     */
+    static void getColPositions(
+        hmemo::HArray<IndexType>& indexes,
+        hmemo::HArray<IndexType>& positions,
+        const IndexType j,
+        const IndexType numRows,
+        const IndexType blockSize,
+        const hmemo::HArray<IndexType>& bsrIA,
+        const hmemo::HArray<IndexType>& bsrJA,
+        hmemo::ContextPtr prefLoc );
+
+    /**
+     *  @brief Compute the inverse of all diagonal blocks of a square BSR matrix.
+     *
+     *  An exception is thrown if one diagonal block is singular or missing.
+     */
+    template<typename ValueType>
+    static void invertDiagonalBlocks(
+        hmemo::HArray<ValueType>& invDiagonal,
+        const IndexType numRows,
+        const IndexType blockSize,
+        const hmemo::HArray<IndexType>& bsrIA,
+        const hmemo::HArray<IndexType>& bsrJA,
+        const hmemo::HArray<ValueType>& bsrValues,
+        hmemo::ContextPtr prefLoc );
+
+    /**
+     *  @brief Block Jacobi iteration step with BSR storage
+     *
+     *  solution = oldSolution + omega * invDiagonal * ( rhs - A * oldSolution )
+     */
+    template<typename ValueType>
+    static void jacobi(
+        hmemo::HArray<ValueType>& solution,
+        const ValueType omega,
+        const hmemo::HArray<ValueType>& oldSolution,
+        const hmemo::HArray<ValueType>& rhs,
+        const IndexType numRows,
+        const IndexType blockSize,
+        const hmemo::HArray<IndexType>& bsrIA,
+        const hmemo::HArray<IndexType>& bsrJA,
+        const hmemo::HArray<ValueType>& bsrValues,
+        const hmemo::HArray<ValueType>& invDiagonal,
+        hmemo::ContextPtr prefLoc );
+
+    /**
+     *  @brief Jacobi halo iteration step with BSR storage
+     *
+     *  solution -= omega * ( B(halo) * oldSolution) ./ diagonal
+     */
+    template<typename ValueType>
+    static void jacobiHalo(
+        hmemo::HArray<ValueType>& solution,
+        const ValueType omega,
+        const hmemo::HArray<ValueType>& diagonal,
+        const hmemo::HArray<ValueType>& oldSolution,
+        const IndexType numRows,
+        const IndexType numColumns,
+        const IndexType blockSize,
+        const hmemo::HArray<IndexType>& bsrIA,
+        const hmemo::HArray<IndexType>& bsrJA,
+        const hmemo::HArray<ValueType>& bsrValues,
+        hmemo::ContextPtr prefLoc );
+
+    template<typename ValueType>
+    static tasking::SyncToken* gemv(
+        hmemo::HArray<ValueType>& result,
+        const ValueType alpha,
+        const hmemo::HArray<ValueType>& x,
+        const ValueType beta,
+        const hmemo::HArray<ValueType>& y,
+        const IndexType numRows,
+        const IndexType numColumns,
+        const IndexType blockSize,
+        const hmemo::HArray<IndexType>& bsrIA,
+        const hmemo::HArray<IndexType>& bsrJA,
+        const hmemo::HArray<ValueType>& bsrValues,
+        const common::MatrixOp op,
+        bool async,
+        hmemo::ContextPtr prefLoc );
+
+private:
+
+    SCAI_LOG_DECL_STATIC_LOGGER( logger )
+};
+
+/* -------------------------------------------------------------------------- */
+
+} /* end namespace sparsekernel */
+
+} /* end namespace scai */
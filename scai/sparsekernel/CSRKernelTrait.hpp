@@ -778,6 +778,145 @@ struct CSRKernelTrait
         }
     };
 
+    template<typename ValueType>
+    struct symmetricGEMV
+    {
+        /** result = alpha * A * x + b * y, A is symmetric and only its upper triangle is stored in CSR format.
+         *
+         *  @param result is the result vector
+         *  @param alpha is scaling factor for matrix x vector
+         *  @param x is input vector for matrix multiplication
+         *  @param beta is scaling factor for additional vector
+         *  @param y is additional input vector to add, might be NULL
+         *  @param numRows is number of elements for all vectors and number of rows/columns of the matrix
+         *  @param csrIA, csrJA, csrValues are the CSR arrays of the upper triangle (column j >= row i)
+         *
+         *  Each stored entry ( i, j ) with j > i contributes also as entry ( j, i ). The contributions
+         *  to other rows are not added by atomic operations but to partial results of each thread that
+         *  are summed up finally.
+         */
+
+        typedef void ( *FuncType ) ( ValueType result[],
+                                     const ValueType alpha,
+                                     const ValueType x[],
+                                     const ValueType beta,
+                                     const ValueType y[],
+                                     const IndexType numRows,
+                                     const IndexType csrIA[],
+                                     const IndexType csrJA[],
+                                     const ValueType csrValues[] );
+
+        static const char* getId()
+        {
+            return "CSR.symmetricGEMV";
+        }
+    };
+
+    template<typename ValueType>
+    struct gramianGEMV
+    {
+        /** result = alpha * transpose( A ) * ( A * x ), A = [ L H ] is given by a local and an optional halo part.
+         *
+         *  @param result is the result vector for the local columns, size is numColumns
+         *  @param haloResult is the result vector for the halo columns, size is numHaloColumns
+         *  @param alpha is scaling factor
+         *  @param x is input vector for the local columns
+         *  @param haloX is the input vector for the halo columns
+         *  @param numRows is the number of rows for local and halo part
+         *  @param numColumns is the number of columns of the local part
+         *  @param numHaloColumns is the number of columns of the halo part
+         *  @param csrIA, csrJA, csrValues are the CSR arrays of the local part
+         *  @param haloIA, haloJA, haloValues are the CSR arrays of the halo part, haloIA is NULL if there is no halo
+         *
+         *  Each row i is used twice directly one after the other, for t = a_i * x and for adding t * a_i
+         *  to the result, so the matrix is read only once from memory. Each thread adds to its own
+         *  partial result that are summed up finally.
+         */
+
+        typedef void ( *FuncType ) ( ValueType result[],
+                                     ValueType haloResult[],
+                                     const ValueType alpha,
+                                     const ValueType x[],
+                                     const ValueType haloX[],
+                                     const IndexType numRows,
+                                     const IndexType numColumns,
+                                     const IndexType numHaloColumns,
+                                     const IndexType csrIA[],
+                                     const IndexType csrJA[],
+                                     const ValueType csrValues[],
+                                     const IndexType haloIA[],
+                                     const IndexType haloJA[],
+                                     const ValueType haloValues[] );
+
+        static const char* getId()
+        {
+            return "CSR.gramianGEMV";
+        }
+    };
+
+    /** Matrix-vector multiplication where matrix values have another type than the vectors.
+     *
+     *  @tparam ValueType is the type of the vectors and used for the accumulation
+     *  @tparam MatrixValueType is the type of the matrix values
+     *
+     *  This routine allows to keep the matrix in a lower precision (e.g. float) while all
+     *  vector operations are done in higher precision (e.g. double) without converting the matrix.
+     */
+    template<typename ValueType, typename MatrixValueType>
+    struct mixedGEMV
+    {
+        /** result = alpha * CSR-Matrix * x + b * y, y might be NULL for beta == 0
+         *
+         *  Arguments as for normalGEMV, but only csrValues has the type MatrixValueType.
+         */
+        typedef void ( *FuncType ) ( ValueType result[],
+                                     const ValueType alpha,
+                                     const ValueType x[],
+                                     const ValueType beta,
+                                     const ValueType y[],
+                                     const IndexType numRows,
+                                     const IndexType numColumns,
+                                     const IndexType csrIA[],
+                                     const IndexType csrJA[],
+                                     const MatrixValueType csrValues[],
+                                     const common::MatrixOp op );
+
+        static const char* getId()
+        {
+            return "CSR.mixedGEMV";
+        }
+    };
+
+    /** Matrix-vector multiplication for CSR data with offset and column arrays of type LocalIndexType.
+     *
+     *  The compact index arrays are used for the local and halo part of distributed matrices where the
+     *  global IndexType might be a 64-bit type.
+     */
+    template<typename ValueType>
+    struct compactGEMV
+    {
+        /** result = alpha * CSR-Matrix * x + b * y, y might be NULL for beta == 0
+         *
+         *  Arguments as for normalGEMV, but csrIA and csrJA have the type LocalIndexType.
+         */
+        typedef void ( *FuncType ) ( ValueType result[],
+                                     const ValueType alpha,
+                                     const ValueType x[],
+                                     const ValueType beta,
+                                     const ValueType y[],
+                                     const IndexType numRows,
+                                     const IndexType numColumns,
+                                     const LocalIndexType csrIA[],
+                                     const LocalIndexType csrJA[],
+                                     const ValueType csrValues[],
+                                     const common::MatrixOp op );
+
+        static const char* getId()
+        {
+            return "CSR.compactGEMV";
+        }
+    };
+
     template<typename ValueType>
     struct sparseGEMV
     {
@@ -1040,6 +1179,61 @@ struct CSRKernelTrait
             return "CSR.compress";
         }
     };
+
+    struct reverseCuthillMcKee
+    {
+        /** Compute a reverse Cuthill-McKee ordering for the (symmetric) pattern of CSR data
+         *
+         *  @param[out] perm     new ordering, perm[i] is the old index of the row that becomes row i
+         *  @param[in]  csrIA    row offsets, size is numRows + 1
+         *  @param[in]  csrJA    column indexes, diagonal elements are ignored
+         *  @param[in]  numRows  number of rows, the pattern must be square
+         *
+         *  Each connected component is ordered separately starting with a pseudo-peripheral vertex.
+         *  An unsymmetric pattern is handled like its symmetric part.
+         */
+        typedef void ( *FuncType )(
+            IndexType perm[],
+            const IndexType csrIA[],
+            const IndexType csrJA[],
+            const IndexType numRows );
+
+        static const char* getId()
+        {
+            return "CSR.reverseCuthillMcKee";
+        }
+    };
+
+    template<typename ValueType>
+    struct permute
+    {
+        /** Fill CSR data where rows and columns are permuted
+         *
+         * @param[out] newJA, newValues column indexes and data of the new CSR data
+         * @param[in] newIA   new offsets, computed by gatherSizes with rowPerm + sizes2offsets
+         * @param[in] ia, ja, values are the data of the current CSR storage
+         * @param[in] rowPerm new row i is the old row rowPerm[i], size is numRows
+         * @param[in] colMap  old column j becomes the new column colMap[j], might be NULL for identity
+         * @param[in] numRows number of rows
+         *
+         * The column indexes of the new rows are not sorted.
+         */
+        typedef void ( *FuncType )(
+            IndexType newJA[],
+            ValueType newValues[],
+            const IndexType newIA[],
+            const IndexType ia[],
+            const IndexType ja[],
+            const ValueType values[],
+            const IndexType rowPerm[],
+            const IndexType colMap[],
+            const IndexType numRows );
+
+        static const char* getId()
+        {
+            return "CSR.permute";
+        }
+    };
 };
 
 } /* end namespace sparsekernel */
@@ -42,6 +42,9 @@
 #include <scai/common/Constants.hpp>
 
 #include <algorithm>
+#include <limits>
+#include <memory>
+#include <vector>
 
 namespace scai
 {
@@ -283,6 +286,99 @@ void CSRUtils::compress(
 
 /* -------------------------------------------------------------------------- */
 
+void CSRUtils::reverseCuthillMcKee(
+    HArray<IndexType>& perm,
+    const IndexType numRows,
+    const HArray<IndexType>& csrIA,
+    const HArray<IndexType>& csrJA,
+    ContextPtr prefLoc )
+{
+    SCAI_REGION( "Sparse.CSR.reverseCuthillMcKee" )
+
+    SCAI_ASSERT_EQ_ERROR( csrIA.size(), numRows + 1, "illegal offset array" )
+
+    static LAMAKernel<CSRKernelTrait::reverseCuthillMcKee> reverseCuthillMcKee;
+
+    ContextPtr loc = prefLoc;
+    reverseCuthillMcKee.getSupportedContext( loc );
+
+    SCAI_CONTEXT_ACCESS( loc )
+
+    ReadAccess<IndexType> rIA( csrIA, loc );
+    ReadAccess<IndexType> rJA( csrJA, loc );
+    WriteOnlyAccess<IndexType> wPerm( perm, loc, numRows );
+
+    reverseCuthillMcKee[loc]( wPerm.get(), rIA.get(), rJA.get(), numRows );
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void CSRUtils::permute(
+    HArray<IndexType>& csrIA,
+    HArray<IndexType>& csrJA,
+    HArray<ValueType>& csrValues,
+    const HArray<IndexType>& rowPerm,
+    const HArray<IndexType>& colPerm,
+    ContextPtr prefLoc )
+{
+    SCAI_REGION( "Sparse.CSR.permute" )
+
+    const IndexType numRows = csrIA.size() - 1;
+
+    SCAI_ASSERT_EQ_ERROR( rowPerm.size(), numRows, "row permutation has illegal size" )
+    SCAI_ASSERT_DEBUG( HArrayUtils::validIndexes( rowPerm, numRows ), "illegal row permutation" )
+
+    // colMap is the inverse permutation of colPerm, maps old columns to new columns
+
+    HArray<IndexType> colMap;
+
+    if ( colPerm.size() > 0 )
+    {
+        HArrayUtils::inversePerm( colMap, colPerm, prefLoc );
+    }
+
+    HArray<IndexType> newIA;
+
+    gatherSizes( newIA, csrIA, rowPerm, prefLoc );
+
+    const IndexType numValues = sizes2offsets( newIA, newIA, prefLoc );
+
+    SCAI_ASSERT_EQ_ERROR( numValues, csrJA.size(), "row permutation is not a permutation" )
+
+    HArray<IndexType> newJA;
+    HArray<ValueType> newValues;
+
+    {
+        static LAMAKernel<CSRKernelTrait::permute<ValueType> > permute;
+
+        ContextPtr loc = prefLoc;
+        permute.getSupportedContext( loc );
+
+        SCAI_CONTEXT_ACCESS( loc )
+
+        ReadAccess<IndexType> rNewIA( newIA, loc );
+        ReadAccess<IndexType> rIA( csrIA, loc );
+        ReadAccess<IndexType> rJA( csrJA, loc );
+        ReadAccess<ValueType> rValues( csrValues, loc );
+        ReadAccess<IndexType> rPerm( rowPerm, loc );
+        ReadAccess<IndexType> rMap( colMap, loc );
+        WriteOnlyAccess<IndexType> wNewJA( newJA, loc, numValues );
+        WriteOnlyAccess<ValueType> wNewValues( newValues, loc, numValues );
+
+        const IndexType* map = colMap.size() > 0 ? rMap.get() : NULL;
+
+        permute[loc]( wNewJA.get(), wNewValues.get(), rNewIA.get(), rIA.get(), rJA.get(), rValues.get(),
+                      rPerm.get(), map, numRows );
+    }
+
+    csrIA.swap( newIA );
+    csrJA.swap( newJA );
+    csrValues.swap( newValues );
+}
+
+/* -------------------------------------------------------------------------- */
+
 template<typename ValueType>
 void CSRUtils::sortRows(
     HArray<IndexType>& ja,
@@ -1096,6 +1192,520 @@ SyncToken* CSRUtils::gemv(
 
 /* -------------------------------------------------------------------------- */
 
+template<typename ValueType>
+SyncToken* CSRUtils::gemvSymmetric(
+    HArray<ValueType>& result,
+    const ValueType alpha,
+    const HArray<ValueType>& x,
+    const ValueType beta,
+    const HArray<ValueType>& y,
+    const IndexType numRows,
+    const HArray<IndexType>& csrIA,
+    const HArray<IndexType>& csrJA,
+    const HArray<ValueType>& csrValues,
+    const bool async,
+    ContextPtr prefLoc )
+{
+    if ( alpha == common::Constants::ZERO  || numRows == 0 )
+    {
+        if ( beta == common::Constants::ZERO )
+        {
+            HArrayUtils::setSameValue( result, numRows, ValueType( 0 ), prefLoc );
+        }
+        else
+        {
+            HArrayUtils::compute( result, beta, common::BinaryOp::MULT, y, prefLoc );
+        }
+
+        return NULL;
+    }
+
+    SCAI_REGION( "Sparse.CSR.gemvSymmetric" )
+
+    ContextPtr loc = prefLoc;
+
+    static LAMAKernel<CSRKernelTrait::symmetricGEMV<ValueType> > symmetricGEMV;
+
+    symmetricGEMV.getSupportedContext( loc );
+
+    std::unique_ptr<SyncToken> syncToken;
+
+    if ( async )
+    {
+        syncToken.reset( loc->getSyncToken() );
+    }
+
+    SCAI_ASYNCHRONOUS( syncToken.get() );
+
+    SCAI_CONTEXT_ACCESS( loc )
+
+    ReadAccess<IndexType> rIA( csrIA, loc );
+    ReadAccess<IndexType> rJA( csrJA, loc );
+    ReadAccess<ValueType> rValues( csrValues, loc );
+    ReadAccess<ValueType> rX( x, loc );
+
+    // if beta is 0, y is not accessed
+
+    const bool useY = beta != common::Constants::ZERO;
+
+    std::unique_ptr<ReadAccess<ValueType> > rY;
+
+    if ( useY )
+    {
+        rY.reset( new ReadAccess<ValueType>( y, loc ) );
+    }
+
+    WriteOnlyAccess<ValueType> wResult( result, loc, numRows );  // okay if alias to y
+
+    symmetricGEMV[loc]( wResult.get(), alpha, rX.get(), beta, useY ? rY->get() : NULL,
+                        numRows, rIA.get(), rJA.get(), rValues.get() );
+
+    if ( async )
+    {
+        syncToken->pushRoutine( wResult.releaseDelayed() );
+
+        if ( useY )
+        {
+            syncToken->pushRoutine( rY->releaseDelayed() );
+        }
+
+        syncToken->pushRoutine( rX.releaseDelayed() );
+        syncToken->pushRoutine( rIA.releaseDelayed() );
+        syncToken->pushRoutine( rJA.releaseDelayed() );
+        syncToken->pushRoutine( rValues.releaseDelayed() );
+    }
+
+    return syncToken.release();
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType, typename MatrixValueType>
+void CSRUtils::gemvMixed(
+    HArray<ValueType>& result,
+    const ValueType alpha,
+    const HArray<ValueType>& x,
+    const ValueType beta,
+    const HArray<ValueType>& y,
+    const IndexType numRows,
+    const IndexType numColumns,
+    const HArray<IndexType>& csrIA,
+    const HArray<IndexType>& csrJA,
+    const HArray<MatrixValueType>& csrValues,
+    const common::MatrixOp op,
+    ContextPtr prefLoc )
+{
+    SCAI_REGION( "Sparse.CSR.gemvMixed" )
+
+    const IndexType nSource = common::isTranspose( op ) ? numRows : numColumns;
+    const IndexType nTarget = common::isTranspose( op ) ? numColumns : numRows;
+
+    SCAI_ASSERT_EQ_ERROR( x.size(), nSource, "x has illegal size" )
+    SCAI_ASSERT_EQ_ERROR( csrIA.size(), numRows + 1, "illegal offset array" )
+
+    const bool hasY = beta != common::Constants::ZERO;
+
+    if ( hasY )
+    {
+        SCAI_ASSERT_EQ_ERROR( y.size(), nTarget, "y has illegal size" )
+    }
+
+    ContextPtr loc = prefLoc;
+
+    static LAMAKernel<CSRKernelTrait::mixedGEMV<ValueType, MatrixValueType> > mixedGEMV;
+
+    mixedGEMV.getSupportedContext( loc );
+
+    SCAI_CONTEXT_ACCESS( loc )
+
+    ReadAccess<IndexType> rIA( csrIA, loc );
+    ReadAccess<IndexType> rJA( csrJA, loc );
+    ReadAccess<MatrixValueType> rValues( csrValues, loc );
+    ReadAccess<ValueType> rX( x, loc );
+
+    if ( hasY )
+    {
+        ReadAccess<ValueType> rY( y, loc );
+        WriteOnlyAccess<ValueType> wResult( result, loc, nTarget );  // okay if alias to y
+
+        mixedGEMV[loc]( wResult.get(), alpha, rX.get(), beta, rY.get(), numRows, numColumns,
+                        rIA.get(), rJA.get(), rValues.get(), op );
+    }
+    else
+    {
+        WriteOnlyAccess<ValueType> wResult( result, loc, nTarget );
+
+        mixedGEMV[loc]( wResult.get(), alpha, rX.get(), beta, NULL, numRows, numColumns,
+                        rIA.get(), rJA.get(), rValues.get(), op );
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void CSRUtils::gemvCompact(
+    HArray<ValueType>& result,
+    const ValueType alpha,
+    const HArray<ValueType>& x,
+    const ValueType beta,
+    const HArray<ValueType>& y,
+    const IndexType numRows,
+    const IndexType numColumns,
+    const HArray<LocalIndexType>& csrIA,
+    const HArray<LocalIndexType>& csrJA,
+    const HArray<ValueType>& csrValues,
+    const common::MatrixOp op,
+    ContextPtr prefLoc )
+{
+    SCAI_REGION( "Sparse.CSR.gemvCompact" )
+
+    const IndexType nSource = common::isTranspose( op ) ? numRows : numColumns;
+    const IndexType nTarget = common::isTranspose( op ) ? numColumns : numRows;
+
+    SCAI_ASSERT_EQ_ERROR( x.size(), nSource, "x has illegal size" )
+    SCAI_ASSERT_EQ_ERROR( csrIA.size(), numRows + 1, "illegal offset array" )
+
+    const bool hasY = beta != common::Constants::ZERO;
+
+    if ( hasY )
+    {
+        SCAI_ASSERT_EQ_ERROR( y.size(), nTarget, "y has illegal size" )
+    }
+
+    ContextPtr loc = prefLoc;
+
+    static LAMAKernel<CSRKernelTrait::compactGEMV<ValueType> > compactGEMV;
+
+    compactGEMV.getSupportedContext( loc );
+
+    SCAI_CONTEXT_ACCESS( loc )
+
+    ReadAccess<LocalIndexType> rIA( csrIA, loc );
+    ReadAccess<LocalIndexType> rJA( csrJA, loc );
+    ReadAccess<ValueType> rValues( csrValues, loc );
+    ReadAccess<ValueType> rX( x, loc );
+
+    if ( hasY )
+    {
+        ReadAccess<ValueType> rY( y, loc );
+        WriteOnlyAccess<ValueType> wResult( result, loc, nTarget );  // okay if alias to y
+
+        compactGEMV[loc]( wResult.get(), alpha, rX.get(), beta, rY.get(), numRows, numColumns,
+                          rIA.get(), rJA.get(), rValues.get(), op );
+    }
+    else
+    {
+        WriteOnlyAccess<ValueType> wResult( result, loc, nTarget );
+
+        compactGEMV[loc]( wResult.get(), alpha, rX.get(), beta, NULL, numRows, numColumns,
+                          rIA.get(), rJA.get(), rValues.get(), op );
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+
+void CSRUtils::compactIndexes( HArray<LocalIndexType>& compactIndexes, const HArray<IndexType>& indexes )
+{
+    SCAI_REGION( "Sparse.CSR.compactIndexes" )
+
+    // Note: done on host, only called once when a compact representation is built
+
+    const IndexType n = indexes.size();
+
+    auto rIndexes = hostReadAccess( indexes );
+    auto wCompact = hostWriteOnlyAccess( compactIndexes, n );
+
+    const IndexType maxLocal = static_cast<IndexType>( std::numeric_limits<LocalIndexType>::max() );
+
+    IndexType maxIndex = 0;
+
+    for ( IndexType i = 0; i < n; ++i )
+    {
+        maxIndex = std::max( maxIndex, rIndexes[i] );
+        wCompact[i] = static_cast<LocalIndexType>( rIndexes[i] );
+    }
+
+    SCAI_ASSERT_LE_ERROR( maxIndex, maxLocal, "index values cannot be represented by LocalIndexType" )
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void CSRUtils::gemvGramian(
+    HArray<ValueType>& result,
+    HArray<ValueType>& haloResult,
+    const ValueType alpha,
+    const HArray<ValueType>& x,
+    const HArray<ValueType>& haloX,
+    const HArray<IndexType>& csrIA,
+    const HArray<IndexType>& csrJA,
+    const HArray<ValueType>& csrValues,
+    const HArray<IndexType>& haloIA,
+    const HArray<IndexType>& haloJA,
+    const HArray<ValueType>& haloValues,
+    ContextPtr prefLoc )
+{
+    SCAI_REGION( "Sparse.CSR.gemvGramian" )
+
+    const IndexType numRows        = csrIA.size() - 1;
+    const IndexType numColumns     = x.size();
+    const IndexType numHaloColumns = haloX.size();
+
+    const bool hasHalo = haloJA.size() > 0;
+
+    if ( hasHalo )
+    {
+        SCAI_ASSERT_EQ_ERROR( haloIA.size(), numRows + 1, "halo part has illegal offset array" )
+    }
+
+    ContextPtr loc = prefLoc;
+
+    static LAMAKernel<CSRKernelTrait::gramianGEMV<ValueType> > gramianGEMV;
+
+    gramianGEMV.getSupportedContext( loc );
+
+    SCAI_CONTEXT_ACCESS( loc )
+
+    ReadAccess<IndexType> rIA( csrIA, loc );
+    ReadAccess<IndexType> rJA( csrJA, loc );
+    ReadAccess<ValueType> rValues( csrValues, loc );
+    ReadAccess<ValueType> rX( x, loc );
+
+    // halo arrays are only accessed if there are halo entries
+
+    std::unique_ptr<ReadAccess<IndexType> > rHaloIA;
+    std::unique_ptr<ReadAccess<IndexType> > rHaloJA;
+    std::unique_ptr<ReadAccess<ValueType> > rHaloValues;
+
+    if ( hasHalo )
+    {
+        rHaloIA.reset( new ReadAccess<IndexType>( haloIA, loc ) );
+        rHaloJA.reset( new ReadAccess<IndexType>( haloJA, loc ) );
+        rHaloValues.reset( new ReadAccess<ValueType>( haloValues, loc ) );
+    }
+
+    ReadAccess<ValueType> rHaloX( haloX, loc );
+
+    WriteOnlyAccess<ValueType> wResult( result, loc, numColumns );
+    WriteOnlyAccess<ValueType> wHaloResult( haloResult, loc, numHaloColumns );
+
+    gramianGEMV[loc]( wResult.get(), wHaloResult.get(), alpha, rX.get(), rHaloX.get(),
+                      numRows, numColumns, numHaloColumns,
+                      rIA.get(), rJA.get(), rValues.get(),
+                      hasHalo ? rHaloIA->get() : NULL,
+                      hasHalo ? rHaloJA->get() : NULL,
+                      hasHalo ? rHaloValues->get() : NULL );
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+bool CSRUtils::isSymmetric(
+    const IndexType numRows,
+    const IndexType numColumns,
+    const HArray<IndexType>& csrIA,
+    const HArray<IndexType>& csrJA,
+    const HArray<ValueType>& csrValues,
+    ContextPtr )
+{
+    if ( numRows != numColumns )
+    {
+        return false;
+    }
+
+    SCAI_REGION( "Sparse.CSR.isSymmetric" )
+
+    // Note: done on host, for each entry ( i, j ) search ( j, i ) in row j
+
+    auto ia = hostReadAccess( csrIA );
+    auto ja = hostReadAccess( csrJA );
+    auto values = hostReadAccess( csrValues );
+
+    bool symmetric = true;
+
+    #pragma omp parallel for reduction( && : symmetric )
+
+    for ( IndexType i = 0; i < numRows; ++i )
+    {
+        for ( IndexType jj = ia[i]; jj < ia[i + 1] && symmetric; ++jj )
+        {
+            const IndexType j = ja[jj];
+
+            if ( j == i )
+            {
+                continue;
+            }
+
+            bool found = false;
+
+            for ( IndexType kk = ia[j]; kk < ia[j + 1]; ++kk )
+            {
+                if ( ja[kk] == i )
+                {
+                    found = values[kk] == values[jj];
+                    break;
+                }
+            }
+
+            symmetric = found;
+        }
+    }
+
+    SCAI_LOG_INFO( logger, "isSymmetric, " << numRows << " x " << numColumns << ", nnz = " << csrJA.size() 
+                            << ": " << symmetric )
+
+    return symmetric;
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void CSRUtils::getUpperTriangle(
+    HArray<IndexType>& upperIA,
+    HArray<IndexType>& upperJA,
+    HArray<ValueType>& upperValues,
+    const HArray<IndexType>& csrIA,
+    const HArray<IndexType>& csrJA,
+    const HArray<ValueType>& csrValues,
+    ContextPtr prefLoc )
+{
+    SCAI_REGION( "Sparse.CSR.getUpperTriangle" )
+
+    const IndexType numRows = csrIA.size() - 1;
+
+    HArray<IndexType> sizes;
+
+    {
+        auto ia = hostReadAccess( csrIA );
+        auto ja = hostReadAccess( csrJA );
+        auto wSizes = hostWriteOnlyAccess( sizes, numRows );
+
+        #pragma omp parallel for
+
+        for ( IndexType i = 0; i < numRows; ++i )
+        {
+            IndexType cnt = 0;
+
+            for ( IndexType jj = ia[i]; jj < ia[i + 1]; ++jj )
+            {
+                if ( ja[jj] >= i )
+                {
+                    cnt++;
+                }
+            }
+
+            wSizes[i] = cnt;
+        }
+    }
+
+    const IndexType numValues = sizes2offsets( upperIA, sizes, prefLoc );
+
+    {
+        auto ia = hostReadAccess( csrIA );
+        auto ja = hostReadAccess( csrJA );
+        auto values = hostReadAccess( csrValues );
+        auto rUpperIA = hostReadAccess( upperIA );
+        auto wUpperJA = hostWriteOnlyAccess( upperJA, numValues );
+        auto wUpperValues = hostWriteOnlyAccess( upperValues, numValues );
+
+        #pragma omp parallel for
+
+        for ( IndexType i = 0; i < numRows; ++i )
+        {
+            IndexType pos = rUpperIA[i];
+
+            for ( IndexType jj = ia[i]; jj < ia[i + 1]; ++jj )
+            {
+                if ( ja[jj] >= i )
+                {
+                    wUpperJA[pos] = ja[jj];
+                    wUpperValues[pos] = values[jj];
+                    pos++;
+                }
+            }
+        }
+    }
+
+    sortRows( upperJA, upperValues, numRows, numRows, upperIA, prefLoc );
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void CSRUtils::expandSymmetric(
+    HArray<IndexType>& csrIA,
+    HArray<IndexType>& csrJA,
+    HArray<ValueType>& csrValues,
+    const HArray<IndexType>& upperIA,
+    const HArray<IndexType>& upperJA,
+    const HArray<ValueType>& upperValues,
+    ContextPtr prefLoc )
+{
+    SCAI_REGION( "Sparse.CSR.expandSymmetric" )
+
+    const IndexType numRows = upperIA.size() - 1;
+
+    HArray<IndexType> sizes;
+
+    {
+        auto ia = hostReadAccess( upperIA );
+        auto ja = hostReadAccess( upperJA );
+        auto wSizes = hostWriteOnlyAccess( sizes, numRows );
+
+        for ( IndexType i = 0; i < numRows; ++i )
+        {
+            wSizes[i] = ia[i + 1] - ia[i];
+        }
+
+        // mirrored entries ( j, i ) of the strict upper triangle
+
+        for ( IndexType i = 0; i < numRows; ++i )
+        {
+            for ( IndexType jj = ia[i]; jj < ia[i + 1]; ++jj )
+            {
+                if ( ja[jj] != i )
+                {
+                    wSizes[ja[jj]]++;
+                }
+            }
+        }
+    }
+
+    const IndexType numValues = sizes2offsets( csrIA, sizes, prefLoc );
+
+    {
+        auto ia = hostReadAccess( upperIA );
+        auto ja = hostReadAccess( upperJA );
+        auto values = hostReadAccess( upperValues );
+        auto rCSRIA = hostReadAccess( csrIA );
+        auto wJA = hostWriteOnlyAccess( csrJA, numValues );
+        auto wValues = hostWriteOnlyAccess( csrValues, numValues );
+
+        std::vector<IndexType> pos( rCSRIA.begin(), rCSRIA.end() - 1 );
+
+        for ( IndexType i = 0; i < numRows; ++i )
+        {
+            for ( IndexType jj = ia[i]; jj < ia[i + 1]; ++jj )
+            {
+                const IndexType j = ja[jj];
+
+                wJA[pos[i]] = j;
+                wValues[pos[i]++] = values[jj];
+
+                if ( j != i )
+                {
+                    wJA[pos[j]] = i;
+                    wValues[pos[j]++] = values[jj];
+                }
+            }
+        }
+    }
+
+    sortRows( csrJA, csrValues, numRows, numRows, csrIA, prefLoc );
+}
+
+/* -------------------------------------------------------------------------- */
+
 template<typename ValueType>
 tasking::SyncToken* CSRUtils::gemvSp(
     HArray<ValueType>& result,
@@ -1580,6 +2190,14 @@ void CSRUtils::setColumns(
             const RealType<ValueType>,                     \
             ContextPtr );                                  \
                                                            \
+    template void CSRUtils::permute(                       \
+            HArray<IndexType>&,                            \
+            HArray<IndexType>&,                            \
+            HArray<ValueType>&,                            \
+            const HArray<IndexType>&,                      \
+            const HArray<IndexType>&,                      \
+            ContextPtr );                                  \
+                                                           \
     template void CSRUtils::convertCSR2CSC(                \
             HArray<IndexType>&,                            \
             HArray<IndexType>&,                            \
@@ -1763,6 +2381,73 @@ void CSRUtils::setColumns(
         const common::BinaryOp,                            \
         ContextPtr );                                      \
                                                            \
+    template tasking::SyncToken* CSRUtils::gemvSymmetric(  \
+        HArray<ValueType>&,                                \
+        const ValueType,                                   \
+        const HArray<ValueType>&,                          \
+        const ValueType,                                   \
+        const HArray<ValueType>&,                          \
+        const IndexType,                                   \
+        const HArray<IndexType>&,                          \
+        const HArray<IndexType>&,                          \
+        const HArray<ValueType>&,                          \
+        bool,                                              \
+        ContextPtr );                                      \
+                                                           \
+    template void CSRUtils::gemvGramian(                   \
+        HArray<ValueType>&,                                \
+        HArray<ValueType>&,                                \
+        const ValueType,                                   \
+        const HArray<ValueType>&,                          \
+        const HArray<ValueType>&,                          \
+        const HArray<IndexType>&,                          \
+        const HArray<IndexType>&,                          \
+        const HArray<ValueType>&,                          \
+        const HArray<IndexType>&,                          \
+        const HArray<IndexType>&,                          \
+        const HArray<ValueType>&,                          \
+        ContextPtr );                                      \
+                                                           \
+    template void CSRUtils::gemvCompact(                   \
+        HArray<ValueType>&,                                \
+        const ValueType,                                   \
+        const HArray<ValueType>&,                          \
+        const ValueType,                                   \
+        const HArray<ValueType>&,                          \
+        const IndexType,                                   \
+        const IndexType,                                   \
+        const HArray<LocalIndexType>&,                     \
+        const HArray<LocalIndexType>&,                     \
+        const HArray<ValueType>&,                          \
+        const common::MatrixOp,                            \
+        ContextPtr );                                      \
+                                                           \
+    template bool CSRUtils::isSymmetric(                   \
+        const IndexType,                                   \
+        const IndexType,                                   \
+        const HArray<IndexType>&,                          \
+        const HArray<IndexType>&,                          \
+        const HArray<ValueType>&,                          \
+        ContextPtr );                                      \
+                                                           \
+    template void CSRUtils::getUpperTriangle(              \
+        HArray<IndexType>&,                                \
+        HArray<IndexType>&,                                \
+        HArray<ValueType>&,                                \
+        const HArray<IndexType>&,                          \
+        const HArray<IndexType>&,                          \
+        const HArray<ValueType>&,                          \
+        ContextPtr );                                      \
+                                                           \
+    template void CSRUtils::expandSymmetric(               \
+        HArray<IndexType>&,                                \
+        HArray<IndexType>&,                                \
+        HArray<ValueType>&,                                \
+        const HArray<IndexType>&,                          \
+        const HArray<IndexType>&,                          \
+        const HArray<ValueType>&,                          \
+        ContextPtr );                                      \
+                                                           \
     template void CSRUtils::solve(                         \
         HArray<ValueType>&,                                \
         const HArray<ValueType>&,                          \
@@ -1778,6 +2463,29 @@ SCAI_COMMON_LOOP( CSRUTILS_SPECIFIER, SCAI_NUMERIC_TYPES_HOST )
 
 #undef CSRUTILS_SPECIFIER
 
+#define CSRUTILS_SPECIFIER_LVL2( ValueType, MatrixValueType )     \
+    template void CSRUtils::gemvMixed(                            \
+        HArray<ValueType>&,                                       \
+        const ValueType,                                          \
+        const HArray<ValueType>&,                                 \
+        const ValueType,                                          \
+        const HArray<ValueType>&,                                 \
+        const IndexType,                                          \
+        const IndexType,                                          \
+        const HArray<IndexType>&,                                 \
+        const HArray<IndexType>&,                                 \
+        const HArray<MatrixValueType>&,                           \
+        const common::MatrixOp,                                   \
+        ContextPtr );
+
+#define CSRUTILS_SPECIFIER_LVL1( ValueType )                      \
+    SCAI_COMMON_LOOP_LVL2( ValueType, CSRUTILS_SPECIFIER_LVL2, SCAI_NUMERIC_TYPES_HOST )
+
+SCAI_COMMON_LOOP( CSRUTILS_SPECIFIER_LVL1, SCAI_NUMERIC_TYPES_HOST )
+
+#undef CSRUTILS_SPECIFIER_LVL2
+#undef CSRUTILS_SPECIFIER_LVL1
+
 } /* end namespace utilskernel */
 
 } /* end namespace scai */
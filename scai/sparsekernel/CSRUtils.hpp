@@ -129,6 +129,43 @@ public:
         const RealType<ValueType> eps, 
         hmemo::ContextPtr prefLoc );
 
+    /** 
+     *  @brief Compute a reverse Cuthill-McKee ordering for square CSR data
+     *
+     *  @param[out] perm contains the new ordering, perm[i] is the old index of the new index i
+     *  @param[in] numRows number of rows (and columns) of the CSR data
+     *  @param[in] csrIA, csrJA the sparsity pattern, should be symmetric
+     *  @param[in] prefLoc specifies the context where the operation should be executed
+     *
+     *  The ordering reduces the bandwidth and the profile of the matrix.
+     */
+    static void reverseCuthillMcKee(
+        hmemo::HArray<IndexType>& perm,
+        const IndexType numRows,
+        const hmemo::HArray<IndexType>& csrIA,
+        const hmemo::HArray<IndexType>& csrJA,
+        hmemo::ContextPtr prefLoc );
+
+    /** 
+     *  @brief Permute the rows and the columns of CSR data
+     *
+     *  @param[in,out] csrIA, csrJA, csrValues is the CSR data that is permuted
+     *  @param[in] rowPerm new row i is the old row rowPerm[i]
+     *  @param[in] colPerm new column j is the old column colPerm[j], empty array keeps the columns
+     *  @param[in] prefLoc specifies the context where the operation should be executed
+     *
+     *  The order of the entries within a row remains the same, i.e. rows are no more sorted 
+     *  if columns are permuted.
+     */
+    template<typename ValueType>
+    static void permute(
+        hmemo::HArray<IndexType>& csrIA,
+        hmemo::HArray<IndexType>& csrJA,
+        hmemo::HArray<ValueType>& csrValues,
+        const hmemo::HArray<IndexType>& rowPerm,
+        const hmemo::HArray<IndexType>& colPerm,
+        hmemo::ContextPtr prefLoc );
+
     /** 
      *  @brief sort column entries in each row of CSR data
      *
@@ -445,6 +482,152 @@ public:
         bool async,
         hmemo::ContextPtr prefLoc );
 
+    /**
+     *  @brief matrix-vector multiplication for a symmetric matrix where only the upper triangle is stored
+     *
+     *  result = alpha * A * x + beta * y, A is a square matrix of size numRows x numRows, the CSR arrays
+     *  contain only the entries ( i, j ) with j >= i.
+     */
+    template<typename ValueType>
+    static tasking::SyncToken* gemvSymmetric(
+        hmemo::HArray<ValueType>& result,
+        const ValueType alpha,
+        const hmemo::HArray<ValueType>& x,
+        const ValueType beta,
+        const hmemo::HArray<ValueType>& y,
+        const IndexType numRows,
+        const hmemo::HArray<IndexType>& csrIA,
+        const hmemo::HArray<IndexType>& csrJA,
+        const hmemo::HArray<ValueType>& csrValues,
+        bool async,
+        hmemo::ContextPtr prefLoc );
+
+    /**
+     *  @brief Fused computation of result = alpha * transpose( A ) * ( A * x ) that reads the matrix only once
+     *
+     *  @param[out] result     is the result for the local columns, same size as x
+     *  @param[out] haloResult is the result for the halo columns, same size as haloX
+     *  @param[in]  alpha      scaling factor
+     *  @param[in]  x          input vector for the local columns
+     *  @param[in]  haloX      input vector for the halo columns
+     *  @param[in]  csrIA, csrJA, csrValues are the CSR arrays of the local part
+     *  @param[in]  haloIA, haloJA, haloValues are the CSR arrays of the halo part
+     *  @param[in]  prefLoc    is the preferred context where the computation is done
+     *
+     *  The matrix A is the local part and the halo part joined column-wise, both with the same number of rows.
+     *  The halo part is ignored if haloJA is empty.
+     */
+    template<typename ValueType>
+    static void gemvGramian(
+        hmemo::HArray<ValueType>& result,
+        hmemo::HArray<ValueType>& haloResult,
+        const ValueType alpha,
+        const hmemo::HArray<ValueType>& x,
+        const hmemo::HArray<ValueType>& haloX,
+        const hmemo::HArray<IndexType>& csrIA,
+        const hmemo::HArray<IndexType>& csrJA,
+        const hmemo::HArray<ValueType>& csrValues,
+        const hmemo::HArray<IndexType>& haloIA,
+        const hmemo::HArray<IndexType>& haloJA,
+        const hmemo::HArray<ValueType>& haloValues,
+        hmemo::ContextPtr prefLoc );
+
+    /**
+     *  @brief Matrix-vector multiplication where the matrix has a different value type than the vectors.
+     *
+     *  result = alpha * op( A ) * x + beta * y, y is not used if beta is zero
+     *
+     *  The matrix values are converted on the fly, the accumulation is done with ValueType.
+     *  Alias of result and y is supported.
+     */
+    template<typename ValueType, typename MatrixValueType>
+    static void gemvMixed(
+        hmemo::HArray<ValueType>& result,
+        const ValueType alpha,
+        const hmemo::HArray<ValueType>& x,
+        const ValueType beta,
+        const hmemo::HArray<ValueType>& y,
+        const IndexType numRows,
+        const IndexType numColumns,
+        const hmemo::HArray<IndexType>& csrIA,
+        const hmemo::HArray<IndexType>& csrJA,
+        const hmemo::HArray<MatrixValueType>& csrValues,
+        const common::MatrixOp op,
+        hmemo::ContextPtr prefLoc );
+
+    /**
+     *  @brief Matrix-vector multiplication for CSR data with compact index arrays of type LocalIndexType.
+     *
+     *  result = alpha * op( A ) * x + beta * y, y is not used if beta is zero
+     *
+     *  Alias of result and y is supported.
+     */
+    template<typename ValueType>
+    static void gemvCompact(
+        hmemo::HArray<ValueType>& result,
+        const ValueType alpha,
+        const hmemo::HArray<ValueType>& x,
+        const ValueType beta,
+        const hmemo::HArray<ValueType>& y,
+        const IndexType numRows,
+        const IndexType numColumns,
+        const hmemo::HArray<LocalIndexType>& csrIA,
+        const hmemo::HArray<LocalIndexType>& csrJA,
+        const hmemo::HArray<ValueType>& csrValues,
+        const common::MatrixOp op,
+        hmemo::ContextPtr prefLoc );
+
+    /**
+     *  @brief Convert an offset or column index array to an array with the type LocalIndexType.
+     *
+     *  An exception is thrown if one of the values cannot be represented by LocalIndexType.
+     */
+    static void compactIndexes(
+        hmemo::HArray<LocalIndexType>& compactIndexes,
+        const hmemo::HArray<IndexType>& indexes );
+
+    /**
+     *  @brief Check if CSR data stands for a symmetric matrix, i.e. for each entry ( i, j ) there is 
+     *         an entry ( j, i ) with the same value.
+     *
+     *  Note: an explicit zero entry without counterpart results in false.
+     */
+    template<typename ValueType>
+    static bool isSymmetric(
+        const IndexType numRows,
+        const IndexType numColumns,
+        const hmemo::HArray<IndexType>& csrIA,
+        const hmemo::HArray<IndexType>& csrJA,
+        const hmemo::HArray<ValueType>& csrValues,
+        hmemo::ContextPtr prefLoc );
+
+    /**
+     *  @brief Extract the upper triangle ( j >= i ) of square CSR data, the rows of the result are sorted.
+     */
+    template<typename ValueType>
+    static void getUpperTriangle(
+        hmemo::HArray<IndexType>& upperIA,
+        hmemo::HArray<IndexType>& upperJA,
+        hmemo::HArray<ValueType>& upperValues,
+        const hmemo::HArray<IndexType>& csrIA,
+        const hmemo::HArray<IndexType>& csrJA,
+        const hmemo::HArray<ValueType>& csrValues,
+        hmemo::ContextPtr prefLoc );
+
+    /**
+     *  @brief Build the full CSR data of a symmetric matrix from its upper triangle, 
+     *         inverse operation to getUpperTriangle.
+     */
+    template<typename ValueType>
+    static void expandSymmetric(
+        hmemo::HArray<IndexType>& csrIA,
+        hmemo::HArray<IndexType>& csrJA,
+        hmemo::HArray<ValueType>& csrValues,
+        const hmemo::HArray<IndexType>& upperIA,
+        const hmemo::HArray<IndexType>& upperJA,
+        const hmemo::HArray<ValueType>& upperValues,
+        hmemo::ContextPtr prefLoc );
+
     /**
      *  @brief matrix-vector multiplication, result = alpha * CSRstorage * x
      */
@@ -400,6 +400,66 @@ struct ELLKernelTrait
         }
     };
 
+    template<typename ValueType, typename MatrixValueType>
+    struct mixedGEMV
+    {
+        /** result = alpha * ELL-Matrix * x + b * y, y might be NULL for beta == 0
+         *
+         *  Arguments as for normalGEMV, but only ellValues has the type MatrixValueType,
+         *  accumulation is done with ValueType.
+         */
+        typedef void ( *FuncType ) (
+            ValueType result[],
+            const ValueType alpha,
+            const ValueType x[],
+            const ValueType beta,
+            const ValueType y[],
+            const IndexType numRows,
+            const IndexType numColumns,
+            const IndexType numValuesPerRow,
+            const IndexType ellSizes[],
+            const IndexType ellJA[],
+            const MatrixValueType ellValues[],
+            const common::MatrixOp op );
+
+        static const char* getId()
+        {
+            return "ELL.mixedGEMV";
+        }
+    };
+
+    template<typename ValueType>
+    struct gemmSD
+    {
+        /** result = alpha * ELL-Matrix * x + beta * y with dense row-major blocks result, x, y
+         *
+         *  @param[out] result has size numRows x k
+         *  @param[in]  x has size numColumns x k
+         *  @param[in]  y has size numRows x k, might be NULL for beta == 0
+         *  @param[in]  k is the number of columns in x, y and result
+         *
+         *  Each matrix entry is read only once for all k columns.
+         */
+        typedef void ( *FuncType ) (
+            ValueType result[],
+            const ValueType alpha,
+            const ValueType x[],
+            const ValueType beta,
+            const ValueType y[],
+            const IndexType numRows,
+            const IndexType numColumns,
+            const IndexType k,
+            const IndexType numValuesPerRow,
+            const IndexType ellSizes[],
+            const IndexType ellJA[],
+            const ValueType ellValues[] );
+
+        static const char* getId()
+        {
+            return "ELL.gemmSD";
+        }
+    };
+
     template<typename ValueType>
     struct sparseGEMV
     {
@@ -674,6 +674,129 @@ SyncToken* ELLUtils::gemv(
 
 /* -------------------------------------------------------------------------- */
 
+template<typename ValueType, typename MatrixValueType>
+void ELLUtils::gemvMixed(
+    HArray<ValueType>& result,
+    const ValueType alpha,
+    const HArray<ValueType>& x,
+    const ValueType beta,
+    const HArray<ValueType>& y,
+    const IndexType numRows,
+    const IndexType numColumns,
+    const IndexType numValuesPerRow,
+    const HArray<IndexType>& ellIA,
+    const HArray<IndexType>& ellJA,
+    const HArray<MatrixValueType>& ellValues,
+    const common::MatrixOp op,
+    ContextPtr prefLoc )
+{
+    SCAI_REGION( "Sparse.ELL.gemvMixed" )
+
+    const IndexType nSource = common::isTranspose( op ) ? numRows : numColumns;
+    const IndexType nTarget = common::isTranspose( op ) ? numColumns : numRows;
+
+    SCAI_ASSERT_EQ_ERROR( x.size(), nSource, "x has illegal size" )
+    SCAI_ASSERT_EQ_DEBUG( numValuesPerRow * numRows, ellJA.size(), "inconsistent ellJA" )
+
+    const bool hasY = beta != common::Constants::ZERO;
+
+    if ( hasY )
+    {
+        SCAI_ASSERT_EQ_ERROR( y.size(), nTarget, "y has illegal size" )
+    }
+
+    ContextPtr loc = prefLoc;
+
+    static LAMAKernel<ELLKernelTrait::mixedGEMV<ValueType, MatrixValueType> > mixedGEMV;
+
+    mixedGEMV.getSupportedContext( loc );
+
+    SCAI_CONTEXT_ACCESS( loc )
+
+    ReadAccess<IndexType> rIA( ellIA, loc );
+    ReadAccess<IndexType> rJA( ellJA, loc );
+    ReadAccess<MatrixValueType> rValues( ellValues, loc );
+    ReadAccess<ValueType> rX( x, loc );
+
+    if ( hasY )
+    {
+        ReadAccess<ValueType> rY( y, loc );
+        WriteOnlyAccess<ValueType> wResult( result, loc, nTarget );  // okay if alias to y
+
+        mixedGEMV[loc]( wResult.get(), alpha, rX.get(), beta, rY.get(), numRows, numColumns, numValuesPerRow,
+                        rIA.get(), rJA.get(), rValues.get(), op );
+    }
+    else
+    {
+        WriteOnlyAccess<ValueType> wResult( result, loc, nTarget );
+
+        mixedGEMV[loc]( wResult.get(), alpha, rX.get(), beta, NULL, numRows, numColumns, numValuesPerRow,
+                        rIA.get(), rJA.get(), rValues.get(), op );
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void ELLUtils::gemmSD(
+    HArray<ValueType>& result,
+    const ValueType alpha,
+    const HArray<ValueType>& x,
+    const ValueType beta,
+    const HArray<ValueType>& y,
+    const IndexType numRows,
+    const IndexType numColumns,
+    const IndexType k,
+    const IndexType numValuesPerRow,
+    const HArray<IndexType>& ellIA,
+    const HArray<IndexType>& ellJA,
+    const HArray<ValueType>& ellValues,
+    ContextPtr prefLoc )
+{
+    SCAI_REGION( "Sparse.ELL.gemmSD" )
+
+    SCAI_ASSERT_EQ_ERROR( x.size(), numColumns * k, "x has illegal size" )
+    SCAI_ASSERT_EQ_DEBUG( numValuesPerRow * numRows, ellJA.size(), "inconsistent ellJA" )
+
+    const bool hasY = beta != common::Constants::ZERO;
+
+    if ( hasY )
+    {
+        SCAI_ASSERT_EQ_ERROR( y.size(), numRows * k, "y has illegal size" )
+    }
+
+    ContextPtr loc = prefLoc;
+
+    static LAMAKernel<ELLKernelTrait::gemmSD<ValueType> > gemmSD;
+
+    gemmSD.getSupportedContext( loc );
+
+    SCAI_CONTEXT_ACCESS( loc )
+
+    ReadAccess<IndexType> rIA( ellIA, loc );
+    ReadAccess<IndexType> rJA( ellJA, loc );
+    ReadAccess<ValueType> rValues( ellValues, loc );
+    ReadAccess<ValueType> rX( x, loc );
+
+    if ( hasY )
+    {
+        ReadAccess<ValueType> rY( y, loc );
+        WriteOnlyAccess<ValueType> wResult( result, loc, numRows * k );  // okay if alias to y
+
+        gemmSD[loc]( wResult.get(), alpha, rX.get(), beta, rY.get(), numRows, numColumns, k, numValuesPerRow,
+                     rIA.get(), rJA.get(), rValues.get() );
+    }
+    else
+    {
+        WriteOnlyAccess<ValueType> wResult( result, loc, numRows * k );
+
+        gemmSD[loc]( wResult.get(), alpha, rX.get(), beta, NULL, numRows, numColumns, k, numValuesPerRow,
+                     rIA.get(), rJA.get(), rValues.get() );
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+
 template<typename ValueType>
 tasking::SyncToken* ELLUtils::gemvSp(
     HArray<ValueType>& result,
@@ -1061,6 +1184,21 @@ void ELLUtils::setColumns(
         const HArray<IndexType>&,                          \
         ContextPtr );                                      \
                                                            \
+    template void ELLUtils::gemmSD(                        \
+        HArray<ValueType>&,                                \
+        const ValueType,                                   \
+        const HArray<ValueType>&,                          \
+        const ValueType,                                   \
+        const HArray<ValueType>&,                          \
+        const IndexType,                                   \
+        const IndexType,                                   \
+        const IndexType,                                   \
+        const IndexType,                                   \
+        const HArray<IndexType>&,                          \
+        const HArray<IndexType>&,                          \
+        const HArray<ValueType>&,                          \
+        ContextPtr );                                      \
+                                                           \
     template void ELLUtils::setRows(                       \
         HArray<ValueType>&,                                \
         const IndexType,                                   \
@@ -1086,6 +1224,30 @@ SCAI_COMMON_LOOP( ELLUTILS_SPECIFIER, SCAI_NUMERIC_TYPES_HOST )
 
 #undef ELLUTILS_SPECIFIER
 
+#define ELLUTILS_SPECIFIER_LVL2( ValueType, MatrixValueType )     \
+    template void ELLUtils::gemvMixed(                            \
+        HArray<ValueType>&,                                       \
+        const ValueType,                                          \
+        const HArray<ValueType>&,                                 \
+        const ValueType,                                          \
+        const HArray<ValueType>&,                                 \
+        const IndexType,                                          \
+        const IndexType,                                          \
+        const IndexType,                                          \
+        const HArray<IndexType>&,                                 \
+        const HArray<IndexType>&,                                 \
+        const HArray<MatrixValueType>&,                           \
+        const common::MatrixOp,                                   \
+        ContextPtr );
+
+#define ELLUTILS_SPECIFIER_LVL1( ValueType )                      \
+    SCAI_COMMON_LOOP_LVL2( ValueType, ELLUTILS_SPECIFIER_LVL2, SCAI_NUMERIC_TYPES_HOST )
+
+SCAI_COMMON_LOOP( ELLUTILS_SPECIFIER_LVL1, SCAI_NUMERIC_TYPES_HOST )
+
+#undef ELLUTILS_SPECIFIER_LVL2
+#undef ELLUTILS_SPECIFIER_LVL1
+
 } /* end namespace utilskernel */
 
 } /* end namespace scai */
@@ -229,6 +229,51 @@ public:
         bool async,
         hmemo::ContextPtr prefLoc );
 
+    /**
+     *  @brief matrix-vector multiplication where the matrix has a different value type than the vectors.
+     *
+     *  result = alpha * op( ELLStorage ) * x + beta * y, y is not used if beta is zero.
+     *  The accumulation is done with ValueType, alias of result and y is supported.
+     */
+    template<typename ValueType, typename MatrixValueType>
+    static void gemvMixed(
+        hmemo::HArray<ValueType>& result,
+        const ValueType alpha,
+        const hmemo::HArray<ValueType>& x,
+        const ValueType beta,
+        const hmemo::HArray<ValueType>& y,
+        const IndexType numRows,
+        const IndexType numColumns,
+        const IndexType numValuesPerRow,
+        const hmemo::HArray<IndexType>& ellIA,
+        const hmemo::HArray<IndexType>& ellJA,
+        const hmemo::HArray<MatrixValueType>& ellValues,
+        const common::MatrixOp op,
+        hmemo::ContextPtr prefLoc );
+
+    /**
+     *  @brief sparse matrix times dense block, result = alpha * ELLStorage * x + beta * y
+     *
+     *  x, y and result are dense row-major blocks with k columns, i.e. x has size numColumns * k
+     *  and result and y have size numRows * k. y is not used if beta is zero, alias of result and y
+     *  is supported.
+     */
+    template<typename ValueType>
+    static void gemmSD(
+        hmemo::HArray<ValueType>& result,
+        const ValueType alpha,
+        const hmemo::HArray<ValueType>& x,
+        const ValueType beta,
+        const hmemo::HArray<ValueType>& y,
+        const IndexType numRows,
+        const IndexType numColumns,
+        const IndexType k,
+        const IndexType numValuesPerRow,
+        const hmemo::HArray<IndexType>& ellIA,
+        const hmemo::HArray<IndexType>& ellJA,
+        const hmemo::HArray<ValueType>& ellValues,
+        hmemo::ContextPtr prefLoc );
+
     /**
      *  @brief matrix-vector multiplication, result = alpha * ELLstorage * x
      */
@@ -197,6 +197,91 @@ struct StencilKernelTrait
             return "Stencil.normalGEMV";
         }
     };
+
+    template<typename ValueType>
+    struct normalSweeps
+    {
+        /** function that applies nSweeps times the update solution = solution + omega * ( rhs - StencilMatrix * solution )
+         *
+         *  @param[in,out] solution contains the values for all grid points
+         *  @param[in] rhs is the right-hand side with one value for each grid point
+         *  @param[in] omega is the scaling factor of the residual
+         *  @param[in] nSweeps is the number of updates
+         *  @param[in] nDims specifies the dimension of the grid
+         *  @param[in] gridSizes contains the sizes of the grid for each dimension
+         *  @param[in] gridDistances contains the distance between two neighbored points for each dim
+         *  @param[in] gridBorders contains for each dim left and right type of border
+         *  @param[in] gridStencilWidth contains maximal left/rights distance for each dimension given by stencil
+         *  @param[in] nPoints number of stencil points
+         *  @param[in] stencilNodes contins nDims * nPoints direction values for the stencil points
+         *  @param[in] stencilVal contains the scale value for each stencil point
+         *  @param[in] stencilOffset array with offset for each stencil point in linearized grid
+         *
+         *  With omega = w / diag this is a Jacobi iteration, otherwise a Richardson iteration.
+         *  The result is the same as nSweeps single updates but an implementation might
+         *  apply several updates to one part of the grid before it continues with the next one
+         *  (temporal blocking) to improve the reuse of data in the cache.
+         */
+        typedef void ( *FuncType )(
+            ValueType solution[],
+            const ValueType rhs[],
+            const ValueType omega,
+            const IndexType nSweeps,
+            const IndexType nDims,
+            const IndexType gridSizes[],
+            const IndexType gridDistances[],
+            const IndexType gridBorders[],
+            const IndexType gridStencilWidth[],
+            const IndexType nPoints,
+            const int stencilPositions[],
+            const ValueType stencilVal[],
+            const int stencilOffset[] );
+
+        static const char* getId()
+        {
+            return "Stencil.normalSweeps";
+        }
+    };
+
+    template<typename ValueType>
+    struct ghostGEMV
+    {
+        /** function that computes result = alpha * StencilMatrix * x + beta * y where x is given on a grid with ghost layers
+         *
+         *  @param[out] result contains values for updated grid points
+         *  @param[in] alpha is an additional scaling factor
+         *  @param[in] xGhost contains the values of x on the grid extended by the ghost layers
+         *  @param[in] beta is the scaling factor of y
+         *  @param[in] y is additional input vector to add (might be aliased with result)
+         *  @param[in] nDims specifies the dimension of the grid
+         *  @param[in] gridSizes contains the sizes of the (unextended) grid for each dimension
+         *  @param[in] ghostWidth contains the left/right number of ghost layers for each dimension
+         *  @param[in] nPoints number of stencil points
+         *  @param[in] stencilVal contains the scale value for each stencil point
+         *  @param[in] stencilOffset array with offset for each stencil point in the linearized extended grid
+         *
+         *  The ghost layers of xGhost must have been filled before, either by values of neighbored
+         *  processors or by zero at absorbing borders. So all grid points are handled like inner points,
+         *  the ghost width must not be smaller than the stencil width.
+         */
+        typedef void ( *FuncType )(
+            ValueType result[],
+            const ValueType alpha,
+            const ValueType xGhost[],
+            const ValueType beta,
+            const ValueType y[],
+            const IndexType nDims,
+            const IndexType gridSizes[],
+            const IndexType ghostWidth[],
+            const IndexType nPoints,
+            const ValueType stencilVal[],
+            const int stencilOffset[] );
+
+        static const char* getId()
+        {
+            return "Stencil.ghostGEMV";
+        }
+    };
 };
 
 }
@@ -225,6 +225,125 @@ SyncToken* StencilUtils::gemv(
 
 /* -------------------------------------------------------------------------- */
 
+template<typename ValueType>
+void StencilUtils::sweeps(
+    HArray<ValueType>& solution,
+    const HArray<ValueType>& rhs,
+    const ValueType omega,
+    const IndexType nSweeps,
+    const IndexType gridSize,
+    const IndexType nDims,
+    const IndexType nPoints,
+    const HArray<IndexType>& gridInfo,
+    const HArray<int>& stencilInfo,
+    const HArray<ValueType>& stencilValues,
+    ContextPtr prefLoc )
+{
+    SCAI_REGION( "Sparse.Stencil.sweeps" )
+
+    SCAI_ASSERT_EQ_ERROR( solution.size(), gridSize, "serious size mismatch" )
+    SCAI_ASSERT_EQ_ERROR( rhs.size(), gridSize, "serious size mismatch" )
+    SCAI_ASSERT_EQ_ERROR( gridInfo.size(), 6 * nDims, "serious mismatch"  );
+    SCAI_ASSERT_EQ_ERROR( stencilInfo.size(), nPoints * ( nDims + 1 ), 
+                             "serious mismatch for " << nDims << "D" << nPoints << "P stencil" );
+    SCAI_ASSERT_EQ_ERROR( stencilValues.size(), nPoints, "serious mismatch" );
+
+    static LAMAKernel<StencilKernelTrait::normalSweeps<ValueType> > normalSweeps;
+
+    ContextPtr loc = prefLoc;
+
+    normalSweeps.getSupportedContext( loc );
+
+    SCAI_CONTEXT_ACCESS( loc )
+
+    WriteAccess<ValueType> wSolution( solution, loc );
+    ReadAccess<ValueType> rRhs( rhs, loc );
+    ReadAccess<IndexType> rGridInfo( gridInfo, loc );
+    ReadAccess<int> rStencilInfo( stencilInfo, loc );
+    ReadAccess<ValueType> rStencilValues( stencilValues, loc );
+
+    const IndexType* dGridSizes = rGridInfo.get();
+    const IndexType* dDistances = dGridSizes + nDims;
+    const IndexType* dBorders = dDistances + nDims;
+    const IndexType* dStencilWidth = dBorders + 2 * nDims;
+
+    const int* dStencilPositions = rStencilInfo.get();
+    const int* dStencilOffsets   = dStencilPositions + nDims * nPoints;
+
+    SCAI_LOG_INFO( logger, "call kernel normalSweeps( omega = " << omega << ", nSweeps = " << nSweeps << " ) on " << *loc )
+
+    normalSweeps[loc]( wSolution.get(), rRhs.get(), omega, nSweeps,
+                       nDims, dGridSizes, dDistances, dBorders, dStencilWidth,
+                       nPoints, dStencilPositions, rStencilValues.get(), dStencilOffsets );
+}
+
+/* -------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void StencilUtils::ghostGEMV(
+    HArray<ValueType>& result,
+    const ValueType alpha,
+    const HArray<ValueType>& xGhost,
+    const ValueType beta,
+    const HArray<ValueType>& y,
+    const IndexType nDims,
+    const IndexType gridSizes[],
+    const IndexType ghostWidth[],
+    const HArray<ValueType>& stencilValues,
+    const HArray<int>& stencilOffsets,
+    ContextPtr prefLoc )
+{
+    SCAI_REGION( "Sparse.Stencil.ghostGEMV" )
+
+    IndexType gridSize  = 1;
+    IndexType ghostSize = 1;
+
+    for ( IndexType d = 0; d < nDims; ++d )
+    {
+        gridSize  *= gridSizes[d];
+        ghostSize *= gridSizes[d] + ghostWidth[2 * d] + ghostWidth[2 * d + 1];
+    }
+
+    const IndexType nPoints = stencilValues.size();
+
+    SCAI_ASSERT_EQ_ERROR( xGhost.size(), ghostSize, "serious size mismatch" )
+    SCAI_ASSERT_EQ_ERROR( stencilOffsets.size(), nPoints, "serious mismatch" )
+
+    static LAMAKernel<StencilKernelTrait::ghostGEMV<ValueType> > ghostGEMV;
+
+    ContextPtr loc = prefLoc;
+
+    ghostGEMV.getSupportedContext( loc );
+
+    SCAI_CONTEXT_ACCESS( loc )
+
+    ReadAccess<ValueType> rX( xGhost, loc );
+    ReadAccess<ValueType> rStencilValues( stencilValues, loc );
+    ReadAccess<int> rStencilOffsets( stencilOffsets, loc );
+
+    SCAI_LOG_INFO( logger, "call kernel ghostGEMV( beta = " << beta << " ) on " << *loc )
+
+    if ( beta != ValueType( 0 ) )
+    {
+        SCAI_ASSERT_EQ_ERROR( y.size(), gridSize, "y has illegal size" )
+
+        ReadAccess<ValueType> rY( y, loc );
+        WriteOnlyAccess<ValueType> wResult( result, loc, gridSize );  // result might be aliased to y
+
+        ghostGEMV[loc]( wResult.get(), alpha, rX.get(), beta, rY.get(), nDims, gridSizes, ghostWidth,
+                        nPoints, rStencilValues.get(), rStencilOffsets.get() );
+    }
+    else
+    {
+        WriteOnlyAccess<ValueType> wResult( result, loc, gridSize );
+
+        ghostGEMV[loc]( wResult.get(), alpha, rX.get(), ValueType( 0 ), NULL, nDims, gridSizes, ghostWidth,
+                        nPoints, rStencilValues.get(), rStencilOffsets.get() );
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+
 #define STENCIL_UTILS_SPECIFIER( ValueType )         \
                                                      \
     template void StencilUtils::setup(               \
@@ -250,6 +369,32 @@ SyncToken* StencilUtils::gemv(
         const bool,                                  \
         ContextPtr );                                \
                                                      \
+    template void StencilUtils::sweeps(              \
+        HArray<ValueType>&,                          \
+        const HArray<ValueType>&,                    \
+        const ValueType,                             \
+        const IndexType,                             \
+        const IndexType,                             \
+        const IndexType,                             \
+        const IndexType,                             \
+        const HArray<IndexType>&,                    \
+        const HArray<int>&,                          \
+        const HArray<ValueType>&,                    \
+        ContextPtr );                                \
+                                                     \
+    template void StencilUtils::ghostGEMV(           \
+        HArray<ValueType>&,                          \
+        const ValueType,                             \
+        const HArray<ValueType>&,                    \
+        const ValueType,                             \
+        const HArray<ValueType>&,                    \
+        const IndexType,                             \
+        const IndexType[],                           \
+        const IndexType[],                           \
+        const HArray<ValueType>&,                    \
+        const HArray<int>&,                          \
+        ContextPtr );                                \
+                                                     \
 
 SCAI_COMMON_LOOP( STENCIL_UTILS_SPECIFIER, SCAI_NUMERIC_TYPES_HOST )
 
@@ -99,6 +99,58 @@ public:
         bool async,
         hmemo::ContextPtr prefLoc );
 
+    /** 
+     *  @brief Apply nSweeps times the update solution = solution + omega * ( rhs - A * solution ) for a stencil matrix A
+     *
+     *  With omega = w / diagonal this is a (damped) Jacobi iteration, otherwise a Richardson iteration.
+     *  The kernel might apply several sweeps to one part of the grid (temporal blocking) that 
+     *  gives better cache reuse than single sweeps on the whole grid.
+     */
+    template<typename ValueType>
+    static void sweeps(
+        hmemo::HArray<ValueType>& solution,
+        const hmemo::HArray<ValueType>& rhs,
+        const ValueType omega,
+        const IndexType nSweeps,
+        const IndexType gridSize,
+        const IndexType nDim,
+        const IndexType nPoints,
+        const hmemo::HArray<IndexType>& gridInfo,
+        const hmemo::HArray<int>& stencilInfo,
+        const hmemo::HArray<ValueType>& stencilValues,
+        hmemo::ContextPtr prefLoc );
+
+    /** 
+     *  @brief Stencil matrix-vector multiplication where x is given on a grid extended by ghost layers
+     *
+     *  @param[out] result is the result vector, one value for each grid point
+     *  @param[in] alpha scaling factor for the stencil matrix
+     *  @param[in] xGhost contains the values of x on the extended grid, ghost layers are already set
+     *  @param[in] beta scaling factor for y
+     *  @param[in] y is the additional vector, not accessed for beta == 0
+     *  @param[in] nDims number of grid dimensions
+     *  @param[in] gridSizes are the sizes of the grid without ghost layers
+     *  @param[in] ghostWidth contains the left/right number of ghost layers for each dimension
+     *  @param[in] stencilValues contains the stencil values
+     *  @param[in] stencilOffsets contains the linear offsets of the stencil points in the extended grid
+     *  @param[in] prefLoc is the context where the operation should be done
+     *
+     *  As there are no more border points, the same operation is applied to all grid points.
+     */
+    template<typename ValueType>
+    static void ghostGEMV(
+        hmemo::HArray<ValueType>& result,
+        const ValueType alpha,
+        const hmemo::HArray<ValueType>& xGhost,
+        const ValueType beta,
+        const hmemo::HArray<ValueType>& y,
+        const IndexType nDims,
+        const IndexType gridSizes[],
+        const IndexType ghostWidth[],
+        const hmemo::HArray<ValueType>& stencilValues,
+        const hmemo::HArray<int>& stencilOffsets,
+        hmemo::ContextPtr prefLoc );
+
 private:
 
     SCAI_LOG_DECL_STATIC_LOGGER( logger )
@@ -0,0 +1,833 @@
+/**
+ * @file OpenMPBSRUtils.cpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief OpenMP implementations of the kernels for BSR sparse matrices.
+ * @author Thomas Brandes
+ * @date 19.10.2026
+ */
+
+// local library
+#include <scai/sparsekernel/openmp/OpenMPBSRUtils.hpp>
+#include <scai/sparsekernel/BSRKernelTrait.hpp>
+
+// internal scai libraries
+#include <scai/utilskernel/openmp/OpenMPUtils.hpp>
+#include <scai/kregistry/KernelRegistry.hpp>
+#include <scai/tracing.hpp>
+#include <scai/tasking/TaskSyncToken.hpp>
+
+#include <scai/common/OpenMP.hpp>
+#include <scai/common/macros/assert.hpp>
+#include <scai/common/TypeTraits.hpp>
+#include <scai/common/Math.hpp>
+#include <scai/common/Utils.hpp>
+#include <scai/common/Constants.hpp>
+
+// std
+#include <functional>
+#include <memory>
+
+namespace scai
+{
+
+namespace sparsekernel
+{
+
+using common::TypeTraits;
+using common::Math;
+using tasking::TaskSyncToken;
+
+SCAI_LOG_DEF_LOGGER( OpenMPBSRUtils::logger, "OpenMP.BSRUtils" )
+
+/* --------------------------------------------------------------------------- */
+/*   Implementation of methods                                                 */
+/* --------------------------------------------------------------------------- */
+
+IndexType OpenMPBSRUtils::getValuePos(
+    const IndexType i,
+    const IndexType j,
+    const IndexType blockSize,
+    const IndexType bsrIA[],
+    const IndexType bsrJA[] )
+{
+    const IndexType ib = i / blockSize;
+    const IndexType jb = j / blockSize;
+
+    // block column indexes are sorted, so binary search is possible
+
+    IndexType first = bsrIA[ib];
+    IndexType last  = bsrIA[ib + 1];
+
+    while ( first < last )
+    {
+        IndexType middle = first + ( last - first ) / 2;
+
+        if ( bsrJA[middle] == jb )
+        {
+            return middle * blockSize * blockSize + ( i - ib * blockSize ) * blockSize + ( j - jb * blockSize );
+        }
+        else if ( bsrJA[middle] > jb )
+        {
+            last = middle;
+        }
+        else
+        {
+            first = middle + 1;
+        }
+    }
+
+    return invalidIndex;
+}
+
+/* --------------------------------------------------------------------------- */
+
+void OpenMPBSRUtils::getCSRSizes(
+    IndexType csrSizes[],
+    const IndexType numRows,
+    const IndexType numColumns,
+    const IndexType blockSize,
+    const IndexType bsrIA[],
+    const IndexType bsrJA[] )
+{
+    SCAI_LOG_INFO( logger, "get CSR sizes, #rows = " << numRows << ", #cols = " << numColumns
+                            << ", block size = " << blockSize )
+
+    #pragma omp parallel for
+
+    for ( IndexType i = 0; i < numRows; ++i )
+    {
+        const IndexType ib = i / blockSize;
+
+        IndexType count = 0;
+
+        for ( IndexType k = bsrIA[ib]; k < bsrIA[ib + 1]; ++k )
+        {
+            count += Math::min( blockSize, numColumns - bsrJA[k] * blockSize );
+        }
+
+        csrSizes[i] = count;
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void OpenMPBSRUtils::getCSRValues(
+    IndexType csrJA[],
+    ValueType csrValues[],
+    const IndexType csrIA[],
+    const IndexType numRows,
+    const IndexType numColumns,
+    const IndexType blockSize,
+    const IndexType bsrIA[],
+    const IndexType bsrJA[],
+    const ValueType bsrValues[] )
+{
+    SCAI_LOG_INFO( logger, "get CSRValues<" << TypeTraits<ValueType>::id() << ">"
+                            << ", #rows = " << numRows << ", block size = " << blockSize )
+
+    const IndexType blockSize2 = blockSize * blockSize;
+
+    #pragma omp parallel for
+
+    for ( IndexType i = 0; i < numRows; ++i )
+    {
+        const IndexType ib = i / blockSize;
+        const IndexType r  = i - ib * blockSize;
+
+        IndexType offset = csrIA[i];
+
+        for ( IndexType k = bsrIA[ib]; k < bsrIA[ib + 1]; ++k )
+        {
+            const IndexType jFirst = bsrJA[k] * blockSize;
+            const IndexType nc     = Math::min( blockSize, numColumns - jFirst );
+
+            const ValueType* blockRow = bsrValues + k * blockSize2 + r * blockSize;
+
+            for ( IndexType c = 0; c < nc; ++c )
+            {
+                csrJA[offset]     = jFirst + c;
+                csrValues[offset] = blockRow[c];
+                offset++;
+            }
+        }
+
+        SCAI_ASSERT_EQ_DEBUG( offset, csrIA[i + 1], "serious mismatch for sizes of row " << i )
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+/*   normalGEMV                                                                */
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void OpenMPBSRUtils::gemvAny(
+    ValueType result[],
+    const ValueType alpha,
+    const ValueType x[],
+    const ValueType beta,
+    const ValueType y[],
+    const IndexType numRows,
+    const IndexType numColumns,
+    const IndexType blockSize,
+    const IndexType firstBlockRow,
+    const IndexType lastBlockRow,
+    const IndexType bsrIA[],
+    const IndexType bsrJA[],
+    const ValueType bsrValues[] )
+{
+    const IndexType blockSize2 = blockSize * blockSize;
+
+    #pragma omp parallel for
+
+    for ( IndexType ib = firstBlockRow; ib < lastBlockRow; ++ib )
+    {
+        const IndexType nr = Math::min( blockSize, numRows - ib * blockSize );
+
+        for ( IndexType r = 0; r < nr; ++r )
+        {
+            ValueType accu = 0;
+
+            for ( IndexType k = bsrIA[ib]; k < bsrIA[ib + 1]; ++k )
+            {
+                const IndexType jFirst = bsrJA[k] * blockSize;
+                const IndexType nc     = Math::min( blockSize, numColumns - jFirst );
+
+                const ValueType* blockRow = bsrValues + k * blockSize2 + r * blockSize;
+
+                for ( IndexType c = 0; c < nc; ++c )
+                {
+                    accu += blockRow[c] * x[jFirst + c];
+                }
+            }
+
+            const IndexType i = ib * blockSize + r;
+
+            if ( beta == common::Constants::ZERO )
+            {
+                result[i] = alpha * accu;
+            }
+            else
+            {
+                result[i] = alpha * accu + beta * y[i];
+            }
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType, IndexType B>
+void OpenMPBSRUtils::gemvBlock(
+    ValueType result[],
+    const ValueType alpha,
+    const ValueType x[],
+    const ValueType beta,
+    const ValueType y[],
+    const IndexType numRows,
+    const IndexType numColumns,
+    const IndexType bsrIA[],
+    const IndexType bsrJA[],
+    const ValueType bsrValues[] )
+{
+    // full block rows/columns are handled with unrolled loops, the
+    // border blocks that might be padded are handled separately
+
+    const IndexType numFullBlockRows    = numRows / B;
+    const IndexType numFullBlockColumns = numColumns / B;
+
+    #pragma omp parallel for
+
+    for ( IndexType ib = 0; ib < numFullBlockRows; ++ib )
+    {
+        ValueType accu[B];
+
+        for ( IndexType r = 0; r < B; ++r )
+        {
+            accu[r] = 0;
+        }
+
+        for ( IndexType k = bsrIA[ib]; k < bsrIA[ib + 1]; ++k )
+        {
+            const IndexType jb = bsrJA[k];
+
+            const ValueType* block = bsrValues + k * B * B;
+
+            if ( jb < numFullBlockColumns )
+            {
+                const ValueType* xBlock = x + jb * B;
+
+                for ( IndexType r = 0; r < B; ++r )
+                {
+                    for ( IndexType c = 0; c < B; ++c )
+                    {
+                        accu[r] += block[r * B + c] * xBlock[c];
+                    }
+                }
+            }
+            else
+            {
+                const IndexType nc = numColumns - jb * B;
+
+                for ( IndexType r = 0; r < B; ++r )
+                {
+                    for ( IndexType c = 0; c < nc; ++c )
+                    {
+                        accu[r] += block[r * B + c] * x[jb * B + c];
+                    }
+                }
+            }
+        }
+
+        ValueType* resultBlock = result + ib * B;
+
+        if ( beta == common::Constants::ZERO )
+        {
+            for ( IndexType r = 0; r < B; ++r )
+            {
+                resultBlock[r] = alpha * accu[r];
+            }
+        }
+        else
+        {
+            const ValueType* yBlock = y + ib * B;
+
+            for ( IndexType r = 0; r < B; ++r )
+            {
+                resultBlock[r] = alpha * accu[r] + beta * yBlock[r];
+            }
+        }
+    }
+
+    const IndexType numBlockRows = ( numRows + B - 1 ) / B;
+
+    gemvAny( result, alpha, x, beta, y, numRows, numColumns, B, numFullBlockRows, numBlockRows,
+             bsrIA, bsrJA, bsrValues );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType, IndexType B>
+void OpenMPBSRUtils::gemvTransBlock(
+    ValueType result[],
+    const ValueType alpha,
+    const ValueType x[],
+    const IndexType numRows,
+    const IndexType numColumns,
+    const IndexType blockSize,
+    const IndexType bsrIA[],
+    const IndexType bsrJA[],
+    const ValueType bsrValues[] )
+{
+    const IndexType b = B > 0 ? B : blockSize;
+
+    const IndexType numBlockRows = ( numRows + b - 1 ) / b;
+
+    #pragma omp parallel for
+
+    for ( IndexType ib = 0; ib < numBlockRows; ++ib )
+    {
+        const IndexType iFirst = ib * b;
+        const IndexType nr     = Math::min( b, numRows - iFirst );
+
+        for ( IndexType k = bsrIA[ib]; k < bsrIA[ib + 1]; ++k )
+        {
+            const IndexType jFirst = bsrJA[k] * b;
+            const IndexType nc     = Math::min( b, numColumns - jFirst );
+
+            const ValueType* block = bsrValues + k * b * b;
+
+            for ( IndexType c = 0; c < nc; ++c )
+            {
+                ValueType v = 0;
+
+                for ( IndexType r = 0; r < nr; ++r )
+                {
+                    v += block[r * b + c] * x[iFirst + r];
+                }
+
+                atomicAdd( result[jFirst + c], alpha * v );
+            }
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void OpenMPBSRUtils::normalGEMV(
+    ValueType result[],
+    const ValueType alpha,
+    const ValueType x[],
+    const ValueType beta,
+    const ValueType y[],
+    const IndexType numRows,
+    const IndexType numColumns,
+    const IndexType blockSize,
+    const IndexType bsrIA[],
+    const IndexType bsrJA[],
+    const ValueType bsrValues[],
+    const common::MatrixOp op )
+{
+    // Note: launching thread gets token here, asynchronous thread will get NULL
+
+    TaskSyncToken* syncToken = TaskSyncToken::getCurrentSyncToken();
+
+    if ( syncToken )
+    {
+        SCAI_LOG_INFO( logger, "normalGEMV<" << TypeTraits<ValueType>::id() << "> launch it asynchronously" )
+
+        syncToken->run( std::bind( normalGEMV<ValueType>, result,
+                                   alpha, x, beta, y,
+                                   numRows, numColumns, blockSize, bsrIA, bsrJA, bsrValues, op ) );
+        return;
+    }
+
+    SCAI_LOG_INFO( logger,
+                   "normalGEMV<" << TypeTraits<ValueType>::id() << ", #threads = " << omp_get_max_threads()
+                   << ">, result = " << alpha << " * A( bsr, " << numRows << " x " << numColumns
+                   << ", block size = " << blockSize << " ) * x + " << beta << " * y, op = " << op )
+
+    if ( op == common::MatrixOp::TRANSPOSE )
+    {
+        SCAI_REGION( "OpenMP.BSR.normalGEMV_t" )
+
+        // result := alpha * x * A + beta * y -> result:= beta * y; result += alpha * x * A
+
+        utilskernel::OpenMPUtils::binaryOpScalar( result, y, beta, numColumns, common::BinaryOp::MULT, false );
+
+        switch ( blockSize )
+        {
+            case 2 :
+                gemvTransBlock<ValueType, 2>( result, alpha, x, numRows, numColumns, blockSize, bsrIA, bsrJA, bsrValues );
+                break;
+            case 3 :
+                gemvTransBlock<ValueType, 3>( result, alpha, x, numRows, numColumns, blockSize, bsrIA, bsrJA, bsrValues );
+                break;
+            case 4 :
+                gemvTransBlock<ValueType, 4>( result, alpha, x, numRows, numColumns, blockSize, bsrIA, bsrJA, bsrValues );
+                break;
+            case 5 :
+                gemvTransBlock<ValueType, 5>( result, alpha, x, numRows, numColumns, blockSize, bsrIA, bsrJA, bsrValues );
+                break;
+            case 6 :
+                gemvTransBlock<ValueType, 6>( result, alpha, x, numRows, numColumns, blockSize, bsrIA, bsrJA, bsrValues );
+                break;
+            default :
+                gemvTransBlock<ValueType, 0>( result, alpha, x, numRows, numColumns, blockSize, bsrIA, bsrJA, bsrValues );
+        }
+    }
+    else if ( op == common::MatrixOp::NORMAL )
+    {
+        SCAI_REGION( "OpenMP.BSR.normalGEMV_n" )
+
+        switch ( blockSize )
+        {
+            case 2 :
+                gemvBlock<ValueType, 2>( result, alpha, x, beta, y, numRows, numColumns, bsrIA, bsrJA, bsrValues );
+                break;
+            case 3 :
+                gemvBlock<ValueType, 3>( result, alpha, x, beta, y, numRows, numColumns, bsrIA, bsrJA, bsrValues );
+                break;
+            case 4 :
+                gemvBlock<ValueType, 4>( result, alpha, x, beta, y, numRows, numColumns, bsrIA, bsrJA, bsrValues );
+                break;
+            case 5 :
+                gemvBlock<ValueType, 5>( result, alpha, x, beta, y, numRows, numColumns, bsrIA, bsrJA, bsrValues );
+                break;
+            case 6 :
+                gemvBlock<ValueType, 6>( result, alpha, x, beta, y, numRows, numColumns, bsrIA, bsrJA, bsrValues );
+                break;
+            default :
+            {
+                const IndexType numBlockRows = ( numRows + blockSize - 1 ) / blockSize;
+
+                gemvAny( result, alpha, x, beta, y, numRows, numColumns, blockSize, 0, numBlockRows,
+                         bsrIA, bsrJA, bsrValues );
+            }
+        }
+    }
+    else
+    {
+        COMMON_THROWEXCEPTION( "unsupported matrix op: " << op )
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+/*  Inversion of diagonal blocks                                               */
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+IndexType OpenMPBSRUtils::invertDiagonalBlocks(
+    ValueType invDiagonal[],
+    const IndexType numRows,
+    const IndexType blockSize,
+    const IndexType bsrIA[],
+    const IndexType bsrJA[],
+    const ValueType bsrValues[] )
+{
+    SCAI_REGION( "OpenMP.BSR.invertDiagonalBlocks" )
+
+    typedef typename TypeTraits<ValueType>::RealType RealType;
+
+    const IndexType b  = blockSize;
+    const IndexType b2 = blockSize * blockSize;
+
+    const IndexType numBlockRows = ( numRows + b - 1 ) / b;
+
+    SCAI_LOG_INFO( logger, "invertDiagonalBlocks<" << TypeTraits<ValueType>::id() << ">, #block rows = "
+                            << numBlockRows << ", block size = " << b )
+
+    // Note: exceptions must not be thrown within a parallel region, so the first
+    //       block row with a singular diagonal block is returned
+
+    IndexType singularRow = invalidIndex;
+
+    #pragma omp parallel
+    {
+        std::unique_ptr<ValueType[]> a( new ValueType[b2] );
+
+        #pragma omp for
+
+        for ( IndexType ib = 0; ib < numBlockRows; ++ib )
+        {
+            ValueType* inv = invDiagonal + ib * b2;
+
+            const IndexType nr = Math::min( b, numRows - ib * b );
+
+            IndexType diagPos = invalidIndex;
+
+            for ( IndexType k = bsrIA[ib]; k < bsrIA[ib + 1]; ++k )
+            {
+                if ( bsrJA[k] == ib )
+                {
+                    diagPos = k;
+                    break;
+                }
+            }
+
+            // a = diagonal block with identity for the padded part, inv = identity
+
+            for ( IndexType r = 0; r < b; ++r )
+            {
+                for ( IndexType c = 0; c < b; ++c )
+                {
+                    ValueType unit = r == c ? ValueType( 1 ) : ValueType( 0 );
+
+                    if ( r < nr && c < nr )
+                    {
+                        a[r * b + c] = diagPos == invalidIndex ? ValueType( 0 ) : bsrValues[diagPos * b2 + r * b + c];
+                    }
+                    else
+                    {
+                        a[r * b + c] = unit;
+                    }
+
+                    inv[r * b + c] = unit;
+                }
+            }
+
+            bool singular = false;
+
+            // Gauss-Jordan elimination with partial pivoting
+
+            for ( IndexType c = 0; c < b && !singular; ++c )
+            {
+                IndexType pivot = c;
+                RealType  pivotVal = Math::abs( a[c * b + c] );
+
+                for ( IndexType r = c + 1; r < b; ++r )
+                {
+                    RealType v = Math::abs( a[r * b + c] );
+
+                    if ( v > pivotVal )
+                    {
+                        pivot = r;
+                        pivotVal = v;
+                    }
+                }
+
+                if ( pivotVal == RealType( 0 ) )
+                {
+                    singular = true;
+                    break;
+                }
+
+                if ( pivot != c )
+                {
+                    for ( IndexType k = 0; k < b; ++k )
+                    {
+                        std::swap( a[c * b + k], a[pivot * b + k] );
+                        std::swap( inv[c * b + k], inv[pivot * b + k] );
+                    }
+                }
+
+                const ValueType scale = ValueType( 1 ) / a[c * b + c];
+
+                for ( IndexType k = 0; k < b; ++k )
+                {
+                    a[c * b + k] *= scale;
+                    inv[c * b + k] *= scale;
+                }
+
+                for ( IndexType r = 0; r < b; ++r )
+                {
+                    if ( r == c )
+                    {
+                        continue;
+                    }
+
+                    const ValueType factor = a[r * b + c];
+
+                    if ( factor == ValueType( 0 ) )
+                    {
+                        continue;
+                    }
+
+                    for ( IndexType k = 0; k < b; ++k )
+                    {
+                        a[r * b + k] -= factor * a[c * b + k];
+                        inv[r * b + k] -= factor * inv[c * b + k];
+                    }
+                }
+            }
+
+            if ( singular )
+            {
+                #pragma omp critical( BSR_invertDiagonalBlocks )
+                {
+                    if ( singularRow == invalidIndex || ib < singularRow )
+                    {
+                        singularRow = ib;
+                    }
+                }
+            }
+        }
+    }
+
+    return singularRow;
+}
+
+/* --------------------------------------------------------------------------- */
+/*  Jacobi                                                                     */
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void OpenMPBSRUtils::jacobi(
+    ValueType solution[],
+    const IndexType numRows,
+    const IndexType blockSize,
+    const IndexType bsrIA[],
+    const IndexType bsrJA[],
+    const ValueType bsrValues[],
+    const ValueType invDiagonal[],
+    const ValueType oldSolution[],
+    const ValueType rhs[],
+    const ValueType omega )
+{
+    SCAI_LOG_INFO( logger,
+                   "jacobi<" << TypeTraits<ValueType>::id() << ">" << ", " << numRows << " x " << numRows
+                    << ", block size = " << blockSize << ", omega = " << omega )
+
+    TaskSyncToken* syncToken = TaskSyncToken::getCurrentSyncToken();
+
+    if ( syncToken != NULL )
+    {
+        SCAI_LOG_ERROR( logger, "jacobi called asynchronously, not supported here" )
+    }
+
+    const IndexType b  = blockSize;
+    const IndexType b2 = blockSize * blockSize;
+
+    const IndexType numBlockRows = ( numRows + b - 1 ) / b;
+
+    #pragma omp parallel
+    {
+        SCAI_REGION( "OpenMP.BSR.jacobi" )
+
+        std::unique_ptr<ValueType[]> residual( new ValueType[b] );
+
+        #pragma omp for
+
+        for ( IndexType ib = 0; ib < numBlockRows; ++ib )
+        {
+            const IndexType iFirst = ib * b;
+            const IndexType nr     = Math::min( b, numRows - iFirst );
+
+            // residual = rhs - A * oldSolution for this block row, zero for padded rows
+
+            for ( IndexType r = 0; r < b; ++r )
+            {
+                residual[r] = r < nr ? rhs[iFirst + r] : ValueType( 0 );
+            }
+
+            for ( IndexType k = bsrIA[ib]; k < bsrIA[ib + 1]; ++k )
+            {
+                const IndexType jFirst = bsrJA[k] * b;
+                const IndexType nc     = Math::min( b, numRows - jFirst );
+
+                const ValueType* block = bsrValues + k * b2;
+
+                for ( IndexType r = 0; r < nr; ++r )
+                {
+                    for ( IndexType c = 0; c < nc; ++c )
+                    {
+                        residual[r] -= block[r * b + c] * oldSolution[jFirst + c];
+                    }
+                }
+            }
+
+            // solution = oldSolution + omega * inv( D ) * residual
+
+            const ValueType* inv = invDiagonal + ib * b2;
+
+            for ( IndexType r = 0; r < nr; ++r )
+            {
+                ValueType temp = 0;
+
+                for ( IndexType c = 0; c < b; ++c )
+                {
+                    temp += inv[r * b + c] * residual[c];
+                }
+
+                solution[iFirst + r] = oldSolution[iFirst + r] + omega * temp;
+            }
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void OpenMPBSRUtils::jacobiHalo(
+    ValueType solution[],
+    const ValueType diagonal[],
+    const IndexType numRows,
+    const IndexType numColumns,
+    const IndexType blockSize,
+    const IndexType bsrIA[],
+    const IndexType bsrJA[],
+    const ValueType bsrValues[],
+    const ValueType oldSolution[],
+    const ValueType omega )
+{
+    SCAI_LOG_INFO( logger,
+                   "jacobiHalo<" << TypeTraits<ValueType>::id() << ">" << ", " << numRows << " x " << numColumns
+                    << ", block size = " << blockSize << ", omega = " << omega )
+
+    const IndexType blockSize2 = blockSize * blockSize;
+
+    #pragma omp parallel
+    {
+        SCAI_REGION( "OpenMP.BSR.jacobiHalo" )
+
+        #pragma omp for
+
+        for ( IndexType i = 0; i < numRows; ++i )
+        {
+            const IndexType ib = i / blockSize;
+            const IndexType r  = i - ib * blockSize;
+
+            ValueType temp = 0;
+
+            for ( IndexType k = bsrIA[ib]; k < bsrIA[ib + 1]; ++k )
+            {
+                const IndexType jFirst = bsrJA[k] * blockSize;
+                const IndexType nc     = Math::min( blockSize, numColumns - jFirst );
+
+                const ValueType* blockRow = bsrValues + k * blockSize2 + r * blockSize;
+
+                for ( IndexType c = 0; c < nc; ++c )
+                {
+                    temp += blockRow[c] * oldSolution[jFirst + c];
+                }
+            }
+
+            solution[i] -= omega * temp / diagonal[i];
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+/* Registrator classes, method registerKernels                                 */
+/* --------------------------------------------------------------------------- */
+
+void OpenMPBSRUtils::Registrator::registerKernels( kregistry::KernelRegistry::KernelRegistryFlag flag )
+{
+    using kregistry::KernelRegistry;
+    common::ContextType ctx = common::ContextType::Host;
+    SCAI_LOG_DEBUG( logger, "register BSRUtils OpenMP-routines for Host at kernel registry [" << flag << "]" )
+    KernelRegistry::set<BSRKernelTrait::getValuePos>( getValuePos, ctx, flag );
+    KernelRegistry::set<BSRKernelTrait::getCSRSizes>( getCSRSizes, ctx, flag );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void OpenMPBSRUtils::RegistratorV<ValueType>::registerKernels( kregistry::KernelRegistry::KernelRegistryFlag flag )
+{
+    using kregistry::KernelRegistry;
+    common::ContextType ctx = common::ContextType::Host;
+    SCAI_LOG_DEBUG( logger, "register BSRUtils OpenMP-routines for Host at kernel registry [" << flag
+                    << " --> " << common::getScalarType<ValueType>() << "]" )
+    KernelRegistry::set<BSRKernelTrait::getCSRValues<ValueType> >( getCSRValues, ctx, flag );
+    KernelRegistry::set<BSRKernelTrait::normalGEMV<ValueType> >( normalGEMV, ctx, flag );
+    KernelRegistry::set<BSRKernelTrait::invertDiagonalBlocks<ValueType> >( invertDiagonalBlocks, ctx, flag );
+    KernelRegistry::set<BSRKernelTrait::jacobi<ValueType> >( jacobi, ctx, flag );
+    KernelRegistry::set<BSRKernelTrait::jacobiHalo<ValueType> >( jacobiHalo, ctx, flag );
+}
+
+/* --------------------------------------------------------------------------- */
+/*    Constructor/Desctructor with registration                                */
+/* --------------------------------------------------------------------------- */
+
+OpenMPBSRUtils::OpenMPBSRUtils()
+{
+    SCAI_LOG_INFO( logger, "register BSRUtils OpenMP-routines for Host at kernel registry" )
+
+    const kregistry::KernelRegistry::KernelRegistryFlag flag = kregistry::KernelRegistry::KERNEL_ADD;
+
+    Registrator::registerKernels( flag );
+    kregistry::mepr::RegistratorV<RegistratorV, SCAI_NUMERIC_TYPES_HOST_LIST>::registerKernels( flag );
+}
+
+OpenMPBSRUtils::~OpenMPBSRUtils()
+{
+    SCAI_LOG_INFO( logger, "unregister BSRUtils OpenMP-routines for Host at kernel registry" )
+
+    const kregistry::KernelRegistry::KernelRegistryFlag flag = kregistry::KernelRegistry::KERNEL_ERASE;
+
+    Registrator::registerKernels( flag );
+    kregistry::mepr::RegistratorV<RegistratorV, SCAI_NUMERIC_TYPES_HOST_LIST>::registerKernels( flag );
+}
+
+/* --------------------------------------------------------------------------- */
+/*    Static variable to force registration during static initialization      */
+/* --------------------------------------------------------------------------- */
+
+OpenMPBSRUtils OpenMPBSRUtils::guard;
+
+} /* end namespace sparsekernel */
+
+} /* end namespace scai */
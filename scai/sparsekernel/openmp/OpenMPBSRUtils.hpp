@@ -0,0 +1,236 @@
+/**
+ * @file OpenMPBSRUtils.hpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief OpenMP implementations of the kernels for BSR sparse matrices.
+ * @author Thomas Brandes
+ * @date 19.10.2026
+ */
+
+#pragma once
+
+// for dll_import
+#include <scai/common/config.hpp>
+
+// internal scai libraries
+#include <scai/kregistry/mepr/Registrator.hpp>
+
+#include <scai/logging.hpp>
+
+#include <scai/common/SCAITypes.hpp>
+#include <scai/common/MatrixOp.hpp>
+
+namespace scai
+{
+
+namespace sparsekernel
+{
+
+/** This class provides OpenMP implementations for the kernels of BSRKernelTrait.
+ *
+ *  The matrix-vector multiplication is specialized at compile time for the block sizes 2 up to 6
+ *  so that the loops over one block are completely unrolled. Other block sizes use a
+ *  generic implementation.
+ */
+
+class COMMON_DLL_IMPORTEXPORT OpenMPBSRUtils
+{
+public:
+
+    /** OpenMP implementation for BSRKernelTrait::getValuePos */
+
+    static IndexType getValuePos(
+        const IndexType i,
+        const IndexType j,
+        const IndexType blockSize,
+        const IndexType bsrIA[],
+        const IndexType bsrJA[] );
+
+    /** OpenMP implementation for BSRKernelTrait::getCSRSizes */
+
+    static void getCSRSizes(
+        IndexType csrSizes[],
+        const IndexType numRows,
+        const IndexType numColumns,
+        const IndexType blockSize,
+        const IndexType bsrIA[],
+        const IndexType bsrJA[] );
+
+    /** OpenMP implementation for BSRKernelTrait::getCSRValues */
+
+    template<typename ValueType>
+    static void getCSRValues(
+        IndexType csrJA[],
+        ValueType csrValues[],
+        const IndexType csrIA[],
+        const IndexType numRows,
+        const IndexType numColumns,
+        const IndexType blockSize,
+        const IndexType bsrIA[],
+        const IndexType bsrJA[],
+        const ValueType bsrValues[] );
+
+    /** OpenMP implementation for BSRKernelTrait::normalGEMV */
+
+    template<typename ValueType>
+    static void normalGEMV(
+        ValueType result[],
+        const ValueType alpha,
+        const ValueType x[],
+        const ValueType beta,
+        const ValueType y[],
+        const IndexType numRows,
+        const IndexType numColumns,
+        const IndexType blockSize,
+        const IndexType bsrIA[],
+        const IndexType bsrJA[],
+        const ValueType bsrValues[],
+        const common::MatrixOp op );
+
+    /** OpenMP implementation for BSRKernelTrait::invertDiagonalBlocks */
+
+    template<typename ValueType>
+    static IndexType invertDiagonalBlocks(
+        ValueType invDiagonal[],
+        const IndexType numRows,
+        const IndexType blockSize,
+        const IndexType bsrIA[],
+        const IndexType bsrJA[],
+        const ValueType bsrValues[] );
+
+    /** OpenMP implementation for BSRKernelTrait::jacobi */
+
+    template<typename ValueType>
+    static void jacobi(
+        ValueType solution[],
+        const IndexType numRows,
+        const IndexType blockSize,
+        const IndexType bsrIA[],
+        const IndexType bsrJA[],
+        const ValueType bsrValues[],
+        const ValueType invDiagonal[],
+        const ValueType oldSolution[],
+        const ValueType rhs[],
+        const ValueType omega );
+
+    /** OpenMP implementation for BSRKernelTrait::jacobiHalo */
+
+    template<typename ValueType>
+    static void jacobiHalo(
+        ValueType solution[],
+        const ValueType diagonal[],
+        const IndexType numRows,
+        const IndexType numColumns,
+        const IndexType blockSize,
+        const IndexType bsrIA[],
+        const IndexType bsrJA[],
+        const ValueType bsrValues[],
+        const ValueType oldSolution[],
+        const ValueType omega );
+
+private:
+
+    /** Matrix-vector multiplication for a fixed block size B. */
+
+    template<typename ValueType, IndexType B>
+    static void gemvBlock(
+        ValueType result[],
+        const ValueType alpha,
+        const ValueType x[],
+        const ValueType beta,
+        const ValueType y[],
+        const IndexType numRows,
+        const IndexType numColumns,
+        const IndexType bsrIA[],
+        const IndexType bsrJA[],
+        const ValueType bsrValues[] );
+
+    /** Matrix-vector multiplication for an arbitrary block size, restricted to a range of block rows. */
+
+    template<typename ValueType>
+    static void gemvAny(
+        ValueType result[],
+        const ValueType alpha,
+        const ValueType x[],
+        const ValueType beta,
+        const ValueType y[],
+        const IndexType numRows,
+        const IndexType numColumns,
+        const IndexType blockSize,
+        const IndexType firstBlockRow,
+        const IndexType lastBlockRow,
+        const IndexType bsrIA[],
+        const IndexType bsrJA[],
+        const ValueType bsrValues[] );
+
+    /** Transposed matrix-vector multiplication, B == 0 stands for the runtime block size. */
+
+    template<typename ValueType, IndexType B>
+    static void gemvTransBlock(
+        ValueType result[],
+        const ValueType alpha,
+        const ValueType x[],
+        const IndexType numRows,
+        const IndexType numColumns,
+        const IndexType blockSize,
+        const IndexType bsrIA[],
+        const IndexType bsrJA[],
+        const ValueType bsrValues[] );
+
+    /** Struct for registration of methods without template arguments */
+
+    struct Registrator
+    {
+        static void registerKernels( const kregistry::KernelRegistry::KernelRegistryFlag flag );
+    };
+
+    /** Struct for registration of methods with one template argument.
+     *
+     *  Registration function is wrapped in struct/class that can be used as template
+     *  argument for metaprogramming classes to expand for each supported type
+     */
+
+    template<typename ValueType>
+    struct RegistratorV
+    {
+        static void registerKernels( const kregistry::KernelRegistry::KernelRegistryFlag flag );
+    };
+
+    /** Constructor for registration. */
+
+    OpenMPBSRUtils();
+
+    /** Destructor for unregistration. */
+
+    ~OpenMPBSRUtils();
+
+    /** Static variable for registration at static initialization. */
+
+    static OpenMPBSRUtils guard;
+
+    SCAI_LOG_DECL_STATIC_LOGGER( logger )
+};
+
+} /* end namespace sparsekernel */
+
+} /* end namespace scai */
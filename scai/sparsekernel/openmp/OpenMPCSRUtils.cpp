@@ -54,6 +54,7 @@
 #include <vector>
 #include <memory>
 #include <functional>
+#include <algorithm>
 
 using std::unique_ptr;
 
@@ -472,6 +473,267 @@ void OpenMPCSRUtils::compress(
 
 /* --------------------------------------------------------------------------- */
 
+/** Level-synchronous breadth first search starting at root.
+ *
+ *  All vertices v with mark[v] < stamp are considered as unvisited and get mark[v] = stamp.
+ *  The vertices are appended to order in Cuthill-McKee order, i.e. the unvisited neighbors
+ *  of each vertex are appended by increasing degree. The neighbors of one level are collected
+ *  in parallel, only the final claiming of the vertices is done serially.
+ *
+ *  @returns the number of levels, lastLevel is the position in order where the last level starts
+ */
+static IndexType bfsLevels(
+    std::vector<IndexType>& order,
+    IndexType& lastLevel,
+    std::vector<IndexType>& mark,
+    const IndexType stamp,
+    const IndexType root,
+    const IndexType csrIA[],
+    const IndexType csrJA[],
+    const std::vector<IndexType>& degree )
+{
+    order.clear();
+    order.push_back( root );
+    mark[root] = stamp;
+
+    IndexType levelStart = 0;
+    IndexType numLevels  = 0;
+
+    std::vector<IndexType> offsets;
+    std::vector<IndexType> candidates;
+
+    while ( levelStart < static_cast<IndexType>( order.size() ) )
+    {
+        const IndexType levelEnd  = static_cast<IndexType>( order.size() );
+        const IndexType levelSize = levelEnd - levelStart;
+
+        lastLevel = levelStart;
+        numLevels++;
+
+        // count unvisited neighbors for each vertex of the current level
+
+        offsets.resize( levelSize + 1 );
+
+        #pragma omp parallel for if ( levelSize > 64 )
+        for ( IndexType k = 0; k < levelSize; ++k )
+        {
+            const IndexType v = order[levelStart + k];
+
+            IndexType cnt = 0;
+
+            for ( IndexType jj = csrIA[v]; jj < csrIA[v + 1]; ++jj )
+            {
+                if ( mark[csrJA[jj]] < stamp )
+                {
+                    cnt++;
+                }
+            }
+
+            offsets[k] = cnt;
+        }
+
+        IndexType total = 0;
+
+        for ( IndexType k = 0; k < levelSize; ++k )
+        {
+            IndexType cnt = offsets[k];
+            offsets[k] = total;
+            total += cnt;
+        }
+
+        offsets[levelSize] = total;
+
+        candidates.resize( offsets[levelSize] );
+
+        // fill in the neighbors of each vertex sorted by degree
+
+        #pragma omp parallel for if ( levelSize > 64 )
+        for ( IndexType k = 0; k < levelSize; ++k )
+        {
+            const IndexType v = order[levelStart + k];
+
+            IndexType pos = offsets[k];
+
+            for ( IndexType jj = csrIA[v]; jj < csrIA[v + 1]; ++jj )
+            {
+                if ( mark[csrJA[jj]] < stamp )
+                {
+                    candidates[pos++] = csrJA[jj];
+                }
+            }
+
+            std::sort( candidates.begin() + offsets[k], candidates.begin() + pos,
+                       [&degree]( const IndexType i1, const IndexType i2 )
+                       {
+                           return degree[i1] < degree[i2] || ( degree[i1] == degree[i2] && i1 < i2 );
+                       } );
+        }
+
+        // claim the vertices for the next level in order, a vertex might be neighbor of multiple vertices
+
+        for ( size_t k = 0; k < candidates.size(); ++k )
+        {
+            const IndexType v = candidates[k];
+
+            if ( mark[v] < stamp )
+            {
+                mark[v] = stamp;
+                order.push_back( v );
+            }
+        }
+
+        levelStart = levelEnd;
+    }
+
+    return numLevels;
+}
+
+/* --------------------------------------------------------------------------- */
+
+void OpenMPCSRUtils::reverseCuthillMcKee(
+    IndexType perm[],
+    const IndexType csrIA[],
+    const IndexType csrJA[],
+    const IndexType numRows )
+{
+    SCAI_REGION( "OpenMP.CSR.reverseCuthillMcKee" )
+
+    SCAI_LOG_INFO( logger, "reverse Cuthill-McKee ordering for CSR graph with " << numRows << " rows" )
+
+    // degree of each vertex, diagonal elements are ignored
+
+    std::vector<IndexType> degree( numRows );
+
+    #pragma omp parallel for
+    for ( IndexType i = 0; i < numRows; ++i )
+    {
+        IndexType cnt = 0;
+
+        for ( IndexType jj = csrIA[i]; jj < csrIA[i + 1]; ++jj )
+        {
+            if ( csrJA[jj] != i )
+            {
+                cnt++;
+            }
+        }
+
+        degree[i] = cnt;
+    }
+
+    // mark[v] == ORDERED stands for already ordered, other values are stamps of a search
+
+    const IndexType ORDERED = invalidIndex;
+
+    std::vector<IndexType> mark( numRows, 0 );
+    std::vector<IndexType> order;
+    std::vector<IndexType> order1;
+
+    IndexType stamp = 0;
+    IndexType numOrdered = 0;
+    IndexType numComponents = 0;
+
+    for ( IndexType seed = 0; seed < numRows; ++seed )
+    {
+        if ( mark[seed] == ORDERED )
+        {
+            continue;
+        }
+
+        numComponents++;
+
+        // find a pseudo-peripheral vertex as root (George, Liu)
+
+        IndexType root = seed;
+        IndexType lastLevel = 0;
+        IndexType eccentricity = bfsLevels( order, lastLevel, mark, ++stamp, root, csrIA, csrJA, degree );
+
+        while ( true )
+        {
+            // vertex with minimal degree in the last level
+
+            IndexType candidate = order[lastLevel];
+
+            for ( size_t k = lastLevel + 1; k < order.size(); ++k )
+            {
+                if ( degree[order[k]] < degree[candidate] )
+                {
+                    candidate = order[k];
+                }
+            }
+
+            IndexType lastLevel1 = 0;
+            IndexType eccentricity1 = bfsLevels( order1, lastLevel1, mark, ++stamp, candidate, csrIA, csrJA, degree );
+
+            if ( eccentricity1 <= eccentricity )
+            {
+                break;
+            }
+
+            root = candidate;
+            eccentricity = eccentricity1;
+            lastLevel = lastLevel1;
+            order.swap( order1 );
+        }
+
+        // order contains the Cuthill-McKee ordering of the component starting at root
+
+        for ( size_t k = 0; k < order.size(); ++k )
+        {
+            mark[order[k]] = ORDERED;
+            perm[numOrdered++] = order[k];
+        }
+
+        SCAI_LOG_DEBUG( logger, "component " << numComponents << ": root = " << root << ", #levels = " << eccentricity
+                                << ", size = " << order.size() )
+    }
+
+    SCAI_ASSERT_EQ_ERROR( numOrdered, numRows, "serious problem for ordering" )
+
+    SCAI_LOG_INFO( logger, "reverse Cuthill-McKee: " << numComponents << " components" )
+
+    // reverse the ordering
+
+    std::reverse( perm, perm + numRows );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void OpenMPCSRUtils::permute(
+    IndexType newJA[],
+    ValueType newValues[],
+    const IndexType newIA[],
+    const IndexType ia[],
+    const IndexType ja[],
+    const ValueType values[],
+    const IndexType rowPerm[],
+    const IndexType colMap[],
+    const IndexType numRows )
+{
+    SCAI_REGION( "OpenMP.CSR.permute" )
+
+    SCAI_LOG_INFO( logger, "permute CSR<" << TypeTraits<ValueType>::id() << ">( " << numRows << " )" )
+
+    #pragma omp parallel for
+    for ( IndexType i = 0; i < numRows; ++i )
+    {
+        const IndexType oldRow = rowPerm[i];
+
+        IndexType offs = newIA[i];
+
+        for ( IndexType jj = ia[oldRow]; jj < ia[oldRow + 1]; ++jj )
+        {
+            newJA[offs]     = colMap == NULL ? ja[jj] : colMap[ja[jj]];
+            newValues[offs] = values[jj];
+            ++offs;
+        }
+
+        SCAI_ASSERT_EQ_DEBUG( offs, newIA[i + 1], "new offsets do not fit to permutation" )
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
 template<typename ValueType>
 void OpenMPCSRUtils::getDiagonal(
     ValueType diagonal[],
@@ -989,6 +1251,81 @@ void OpenMPCSRUtils::reduce(
 
 /* --------------------------------------------------------------------------- */
 
+/** Decide whether the transposed matrix-vector multiplication should use thread-private results.
+ *
+ *  Each thread needs its own result array of size numColumns, so this is only done if
+ *  these arrays are not larger than the matrix itself. Otherwise atomic updates are used.
+ */
+static bool usePrivateGEVM( const IndexType numColumns, const IndexType numValues )
+{
+    const IndexType numThreads = omp_get_max_threads();
+
+    return numThreads > 1 && static_cast<double>( numColumns ) * numThreads <= static_cast<double>( numValues );
+}
+
+/** Transposed matrix-vector multiplication result += alpha * x * A where each thread
+ *  accumulates its contributions in a private array, the private arrays are summed up at the end.
+ */
+template<typename ValueType>
+static void privateGEVM(
+    ValueType result[],
+    const ValueType alpha,
+    const ValueType x[],
+    const IndexType numRows,
+    const IndexType numColumns,
+    const IndexType csrIA[],
+    const IndexType csrJA[],
+    const ValueType csrValues[] )
+{
+    const size_t n = numColumns;
+
+    unique_ptr<ValueType[]> partial( new ValueType[ n * omp_get_max_threads() ] );
+
+    #pragma omp parallel
+    {
+        SCAI_REGION( "OpenMP.CSR.privateGEVM" )
+
+        const int numThreads = omp_get_num_threads();
+
+        ValueType* myResult = partial.get() + n * omp_get_thread_num();
+
+        for ( IndexType j = 0; j < numColumns; ++j )
+        {
+            myResult[j] = ValueType( 0 );
+        }
+
+        #pragma omp for
+
+        for ( IndexType i = 0; i < numRows; ++i )
+        {
+            const ValueType xi = x[i];
+
+            for ( IndexType jj = csrIA[i]; jj < csrIA[i + 1]; ++jj )
+            {
+                myResult[csrJA[jj]] += csrValues[jj] * xi;
+            }
+        }
+
+        // implicit barrier, all partial results are available
+
+        #pragma omp for
+
+        for ( IndexType j = 0; j < numColumns; ++j )
+        {
+            ValueType temp = 0;
+
+            for ( int t = 0; t < numThreads; ++t )
+            {
+                temp += partial[n * t + j];
+            }
+
+            result[j] += alpha * temp;
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
 template<typename ValueType>
 void OpenMPCSRUtils::normalGEMV(
     ValueType result[],
@@ -1027,6 +1364,12 @@ void OpenMPCSRUtils::normalGEMV(
 
         utilskernel::OpenMPUtils::binaryOpScalar( result, y, beta, numColumns, common::BinaryOp::MULT, false );
 
+        if ( usePrivateGEVM( numColumns, numValues ) )
+        {
+            privateGEVM( result, alpha, x, numRows, numColumns, csrIA, csrJA, csrValues );
+            return;
+        }
+
         #pragma omp parallel
         {
             // Note: region will be entered by each thread
@@ -1084,6 +1427,446 @@ void OpenMPCSRUtils::normalGEMV(
 
 /* --------------------------------------------------------------------------- */
 
+template<typename ValueType>
+void OpenMPCSRUtils::symmetricGEMV(
+    ValueType result[],
+    const ValueType alpha,
+    const ValueType x[],
+    const ValueType beta,
+    const ValueType y[],
+    const IndexType numRows,
+    const IndexType csrIA[],
+    const IndexType csrJA[],
+    const ValueType csrValues[] )
+{
+    TaskSyncToken* syncToken = TaskSyncToken::getCurrentSyncToken();
+
+    if ( syncToken )
+    {
+        SCAI_LOG_INFO( logger, "symmetricGEMV<" << TypeTraits<ValueType>::id() << ", launch it as an asynchronous task" )
+
+        syncToken->run( std::bind( symmetricGEMV<ValueType>,
+                                   result, alpha, x, beta, y,
+                                   numRows, csrIA, csrJA, csrValues ) );
+        return;
+    }
+
+    SCAI_REGION( "OpenMP.CSR.symmetricGEMV" )
+
+    const IndexType numParts = omp_get_max_threads();
+
+    SCAI_LOG_INFO( logger,
+                   "symmetricGEMV<" << TypeTraits<ValueType>::id() << ", #parts = " << numParts
+                   << ">, result[" << numRows << "] = " << alpha << " * A * x + " << beta << " * y" )
+
+    // Partition the rows in contiguous blocks with nearly the same number of entries.
+    // A part owning the rows lb, ..., ub - 1 only contributes to the rows lb <= j < hi where
+    // hi - 1 is the largest column index in its rows. So each part has its own partial result
+    // of size hi - lb and no atomic updates are required. For matrices with a small bandwidth
+    // the partial results are not much larger than the owned rows.
+
+    const IndexType numValues = csrIA[numRows];
+
+    std::unique_ptr<IndexType[]> lb( new IndexType[numParts + 1] );
+    std::unique_ptr<IndexType[]> hi( new IndexType[numParts] );
+    std::unique_ptr<IndexType[]> offset( new IndexType[numParts + 1] );
+
+    lb[0] = 0;
+
+    for ( IndexType p = 1; p < numParts; ++p )
+    {
+        const IndexType target = static_cast<IndexType>( ( static_cast<double>( numValues ) * p ) / numParts );
+        const IndexType* pos = std::upper_bound( csrIA, csrIA + numRows + 1, target );
+        lb[p] = std::max( lb[p - 1], static_cast<IndexType>( pos - csrIA ) - 1 );
+    }
+
+    lb[numParts] = numRows;
+
+    #pragma omp parallel for schedule( static, 1 )
+
+    for ( IndexType p = 0; p < numParts; ++p )
+    {
+        IndexType maxCol = lb[p + 1];   // at least the owned rows
+
+        for ( IndexType jj = csrIA[lb[p]]; jj < csrIA[lb[p + 1]]; ++jj )
+        {
+            maxCol = std::max( maxCol, csrJA[jj] + 1 );
+        }
+
+        hi[p] = maxCol;
+    }
+
+    offset[0] = 0;
+
+    for ( IndexType p = 0; p < numParts; ++p )
+    {
+        offset[p + 1] = offset[p] + ( hi[p] - lb[p] );
+    }
+
+    std::unique_ptr<ValueType[]> partial( new ValueType[offset[numParts]] );
+
+    #pragma omp parallel for schedule( static, 1 )
+
+    for ( IndexType p = 0; p < numParts; ++p )
+    {
+        ValueType* myResult = partial.get() + offset[p] - lb[p];   // myResult[j] valid for lb[p] <= j < hi[p]
+
+        for ( IndexType j = lb[p]; j < hi[p]; ++j )
+        {
+            myResult[j] = ValueType( 0 );
+        }
+
+        for ( IndexType i = lb[p]; i < lb[p + 1]; ++i )
+        {
+            ValueType temp = 0;
+
+            const ValueType xi = x[i];
+
+            for ( IndexType jj = csrIA[i]; jj < csrIA[i + 1]; ++jj )
+            {
+                const IndexType j = csrJA[jj];
+                const ValueType v = csrValues[jj];
+
+                temp += v * x[j];
+
+                if ( j != i )
+                {
+                    myResult[j] += v * xi;
+                }
+            }
+
+            myResult[i] += temp;
+        }
+    }
+
+    // sum up the partial results, lb is sorted so only parts p with lb[p] <= j are relevant
+
+    #pragma omp parallel for
+
+    for ( IndexType j = 0; j < numRows; ++j )
+    {
+        ValueType temp = 0;
+
+        for ( IndexType p = 0; p < numParts && lb[p] <= j; ++p )
+        {
+            if ( j < hi[p] )
+            {
+                temp += partial[offset[p] + j - lb[p]];
+            }
+        }
+
+        if ( y == NULL )
+        {
+            result[j] = alpha * temp;
+        }
+        else
+        {
+            result[j] = alpha * temp + beta * y[j];
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void OpenMPCSRUtils::gramianGEMV(
+    ValueType result[],
+    ValueType haloResult[],
+    const ValueType alpha,
+    const ValueType x[],
+    const ValueType haloX[],
+    const IndexType numRows,
+    const IndexType numColumns,
+    const IndexType numHaloColumns,
+    const IndexType csrIA[],
+    const IndexType csrJA[],
+    const ValueType csrValues[],
+    const IndexType haloIA[],
+    const IndexType haloJA[],
+    const ValueType haloValues[] )
+{
+    SCAI_REGION( "OpenMP.CSR.gramianGEMV" )
+
+    const IndexType numParts = omp_get_max_threads();
+
+    SCAI_LOG_INFO( logger,
+                   "gramianGEMV<" << TypeTraits<ValueType>::id() << ", #parts = " << numParts
+                   << ">, result[" << numColumns << "] = " << alpha << " * A' * A * x, A is "
+                   << numRows << " x " << numColumns << ", #halo columns = " << numHaloColumns )
+
+    // Halo columns are numbered after the local columns, so a part contributes to the
+    // columns lo <= j < hi of ( result, haloResult ) where lo and hi are given by the
+    // smallest and largest column index in its rows. Each part has its own partial result
+    // of size hi - lo and no atomic updates are required.
+
+    const IndexType numValues = csrIA[numRows];
+
+    std::unique_ptr<IndexType[]> lb( new IndexType[numParts + 1] );
+    std::unique_ptr<IndexType[]> lo( new IndexType[numParts] );
+    std::unique_ptr<IndexType[]> hi( new IndexType[numParts] );
+    std::unique_ptr<IndexType[]> offset( new IndexType[numParts + 1] );
+
+    lb[0] = 0;
+
+    for ( IndexType p = 1; p < numParts; ++p )
+    {
+        const IndexType target = static_cast<IndexType>( ( static_cast<double>( numValues ) * p ) / numParts );
+        const IndexType* pos = std::upper_bound( csrIA, csrIA + numRows + 1, target );
+        lb[p] = std::max( lb[p - 1], static_cast<IndexType>( pos - csrIA ) - 1 );
+    }
+
+    lb[numParts] = numRows;
+
+    #pragma omp parallel for schedule( static, 1 )
+
+    for ( IndexType p = 0; p < numParts; ++p )
+    {
+        IndexType minCol = numColumns + numHaloColumns;
+        IndexType maxCol = 0;
+
+        for ( IndexType jj = csrIA[lb[p]]; jj < csrIA[lb[p + 1]]; ++jj )
+        {
+            minCol = std::min( minCol, csrJA[jj] );
+            maxCol = std::max( maxCol, csrJA[jj] + 1 );
+        }
+
+        if ( haloIA != NULL )
+        {
+            for ( IndexType jj = haloIA[lb[p]]; jj < haloIA[lb[p + 1]]; ++jj )
+            {
+                minCol = std::min( minCol, numColumns + haloJA[jj] );
+                maxCol = std::max( maxCol, numColumns + haloJA[jj] + 1 );
+            }
+        }
+
+        lo[p] = std::min( minCol, maxCol );
+        hi[p] = maxCol;
+    }
+
+    offset[0] = 0;
+
+    for ( IndexType p = 0; p < numParts; ++p )
+    {
+        offset[p + 1] = offset[p] + ( hi[p] - lo[p] );
+    }
+
+    std::unique_ptr<ValueType[]> partial( new ValueType[offset[numParts]] );
+
+    #pragma omp parallel for schedule( static, 1 )
+
+    for ( IndexType p = 0; p < numParts; ++p )
+    {
+        ValueType* myResult = partial.get() + offset[p] - lo[p];   // myResult[j] valid for lo[p] <= j < hi[p]
+        ValueType* myHaloResult = myResult + numColumns;
+
+        for ( IndexType j = lo[p]; j < hi[p]; ++j )
+        {
+            myResult[j] = ValueType( 0 );
+        }
+
+        for ( IndexType i = lb[p]; i < lb[p + 1]; ++i )
+        {
+            // t = a_i * x, the entries of row i are still in the cache for the update
+
+            ValueType t = 0;
+
+            for ( IndexType jj = csrIA[i]; jj < csrIA[i + 1]; ++jj )
+            {
+                t += csrValues[jj] * x[csrJA[jj]];
+            }
+
+            if ( haloIA != NULL )
+            {
+                for ( IndexType jj = haloIA[i]; jj < haloIA[i + 1]; ++jj )
+                {
+                    t += haloValues[jj] * haloX[haloJA[jj]];
+                }
+            }
+
+            for ( IndexType jj = csrIA[i]; jj < csrIA[i + 1]; ++jj )
+            {
+                myResult[csrJA[jj]] += csrValues[jj] * t;
+            }
+
+            if ( haloIA != NULL )
+            {
+                for ( IndexType jj = haloIA[i]; jj < haloIA[i + 1]; ++jj )
+                {
+                    myHaloResult[haloJA[jj]] += haloValues[jj] * t;
+                }
+            }
+        }
+    }
+
+    // sum up the partial results
+
+    #pragma omp parallel for
+
+    for ( IndexType j = 0; j < numColumns + numHaloColumns; ++j )
+    {
+        ValueType temp = 0;
+
+        for ( IndexType p = 0; p < numParts; ++p )
+        {
+            if ( lo[p] <= j && j < hi[p] )
+            {
+                temp += partial[offset[p] + j - lo[p]];
+            }
+        }
+
+        if ( j < numColumns )
+        {
+            result[j] = alpha * temp;
+        }
+        else
+        {
+            haloResult[j - numColumns] = alpha * temp;
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType, typename MatrixValueType>
+void OpenMPCSRUtils::mixedGEMV(
+    ValueType result[],
+    const ValueType alpha,
+    const ValueType x[],
+    const ValueType beta,
+    const ValueType y[],
+    const IndexType numRows,
+    const IndexType numColumns,
+    const IndexType csrIA[],
+    const IndexType csrJA[],
+    const MatrixValueType csrValues[],
+    const common::MatrixOp op )
+{
+    SCAI_REGION( "OpenMP.CSR.mixedGEMV" )
+
+    SCAI_LOG_INFO( logger,
+                   "mixedGEMV<" << TypeTraits<ValueType>::id() << ", " << TypeTraits<MatrixValueType>::id()
+                   << ", #threads = " << omp_get_max_threads() << ">, result[] = " << alpha
+                   << " * A * x + " << beta << " * y, A is " << numRows << " x " << numColumns << ", op = " << op )
+
+    // matrix values are converted on the fly, accumulation is always done with ValueType
+
+    if ( op == common::MatrixOp::TRANSPOSE )
+    {
+        #pragma omp parallel for
+
+        for ( IndexType j = 0; j < numColumns; ++j )
+        {
+            result[j] = y == NULL ? ValueType( 0 ) : beta * y[j];
+        }
+
+        #pragma omp parallel for
+
+        for ( IndexType i = 0; i < numRows; ++i )
+        {
+            const ValueType xi = alpha * x[i];
+
+            for ( IndexType jj = csrIA[i]; jj < csrIA[i + 1]; ++jj )
+            {
+                atomicAdd( result[csrJA[jj]], static_cast<ValueType>( csrValues[jj] ) * xi );
+            }
+        }
+    }
+    else
+    {
+        #pragma omp parallel for
+
+        for ( IndexType i = 0; i < numRows; ++i )
+        {
+            ValueType temp = 0;
+
+            for ( IndexType jj = csrIA[i]; jj < csrIA[i + 1]; ++jj )
+            {
+                temp += static_cast<ValueType>( csrValues[jj] ) * x[csrJA[jj]];
+            }
+
+            if ( y == NULL )
+            {
+                result[i] = alpha * temp;
+            }
+            else
+            {
+                result[i] = alpha * temp + beta * y[i];
+            }
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void OpenMPCSRUtils::compactGEMV(
+    ValueType result[],
+    const ValueType alpha,
+    const ValueType x[],
+    const ValueType beta,
+    const ValueType y[],
+    const IndexType numRows,
+    const IndexType numColumns,
+    const LocalIndexType csrIA[],
+    const LocalIndexType csrJA[],
+    const ValueType csrValues[],
+    const common::MatrixOp op )
+{
+    SCAI_REGION( "OpenMP.CSR.compactGEMV" )
+
+    SCAI_LOG_INFO( logger,
+                   "compactGEMV<" << TypeTraits<ValueType>::id() << ", #threads = " << omp_get_max_threads() 
+                   << ">, result[] = " << alpha << " * A * x + " << beta << " * y, A is " 
+                   << numRows << " x " << numColumns << ", op = " << op )
+
+    if ( op == common::MatrixOp::TRANSPOSE )
+    {
+        #pragma omp parallel for
+
+        for ( IndexType j = 0; j < numColumns; ++j )
+        {
+            result[j] = y == NULL ? ValueType( 0 ) : beta * y[j];
+        }
+
+        #pragma omp parallel for
+
+        for ( IndexType i = 0; i < numRows; ++i )
+        {
+            const ValueType xi = alpha * x[i];
+
+            for ( LocalIndexType jj = csrIA[i]; jj < csrIA[i + 1]; ++jj )
+            {
+                atomicAdd( result[csrJA[jj]], csrValues[jj] * xi );
+            }
+        }
+    }
+    else
+    {
+        #pragma omp parallel for
+
+        for ( IndexType i = 0; i < numRows; ++i )
+        {
+            ValueType temp = 0;
+
+            for ( LocalIndexType jj = csrIA[i]; jj < csrIA[i + 1]; ++jj )
+            {
+                temp += csrValues[jj] * x[csrJA[jj]];
+            }
+
+            if ( y == NULL )
+            {
+                result[i] = alpha * temp;
+            }
+            else
+            {
+                result[i] = alpha * temp + beta * y[i];
+            }
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
 template<typename ValueType>
 void OpenMPCSRUtils::sparseGEMV(
     ValueType result[],
@@ -1194,25 +1977,25 @@ void OpenMPCSRUtils::gemmSD(
         #pragma omp for
         for ( IndexType i = 0; i < numRows; ++i )
         {
+            ValueType* resultRow = result + i * nv;
+
+            // y might be an alias of result, so each element of y is read before it is written
+
             for ( IndexType k = 0; k < nv; ++k )
             {
-                ValueType temp = 0;
-    
-                for ( IndexType jj = csrIA[i]; jj < csrIA[i + 1]; ++jj )
-                {
-                    IndexType j = csrJA[jj];
-                    // SCAI_ASSERT_DEBUG( j < p , "index j = " << j << " out of range " << p )
-                    // csrValues[jj] stands for CSR( i, j )
-                    temp += csrValues[jj] * x[j * nv + k]; // x(j,k)
-                }
+                resultRow[k] = y == NULL ? ValueType( 0 ) : beta * y[i * nv + k];
+            }
 
-                if ( y == NULL )
-                {
-                    result[i * nv + k] = alpha * temp;
-                }
-                else
+            // each matrix entry is read only once and applied to the whole row x(j,:)
+
+            for ( IndexType jj = csrIA[i]; jj < csrIA[i + 1]; ++jj )
+            {
+                const ValueType v = alpha * csrValues[jj];
+                const ValueType* xRow = x + csrJA[jj] * nv;
+
+                for ( IndexType k = 0; k < nv; ++k )
                 {
-                    result[i * nv + k] = alpha * temp + beta * y[i * nv + k];
+                    resultRow[k] += v * xRow[k];
                 }
             }
         }
@@ -2074,6 +2857,7 @@ void OpenMPCSRUtils::Registrator::registerKernels( kregistry::KernelRegistry::Ke
     KernelRegistry::set<CSRKernelTrait::matrixAddSizes>( matrixAddSizes, ctx, flag );
     KernelRegistry::set<CSRKernelTrait::binaryOpSizes>( binaryOpSizes, ctx, flag );
     KernelRegistry::set<CSRKernelTrait::matrixMultiplySizes>( matrixMultiplySizes, ctx, flag );
+    KernelRegistry::set<CSRKernelTrait::reverseCuthillMcKee>( reverseCuthillMcKee, ctx, flag );
 }
 
 template<typename ValueType>
@@ -2091,6 +2875,9 @@ void OpenMPCSRUtils::RegistratorV<ValueType>::registerKernels( kregistry::Kernel
     KernelRegistry::set<CSRKernelTrait::setDiagonalV<ValueType> >( setDiagonalV, ctx, flag );
     KernelRegistry::set<CSRKernelTrait::reduce<ValueType> >( reduce, ctx, flag );
     KernelRegistry::set<CSRKernelTrait::normalGEMV<ValueType> >( normalGEMV, ctx, flag );
+    KernelRegistry::set<CSRKernelTrait::symmetricGEMV<ValueType> >( symmetricGEMV, ctx, flag );
+    KernelRegistry::set<CSRKernelTrait::gramianGEMV<ValueType> >( gramianGEMV, ctx, flag );
+    KernelRegistry::set<CSRKernelTrait::compactGEMV<ValueType> >( compactGEMV, ctx, flag );
     KernelRegistry::set<CSRKernelTrait::sparseGEMV<ValueType> >( sparseGEMV, ctx, flag );
     KernelRegistry::set<CSRKernelTrait::gemmSD<ValueType> >( gemmSD, ctx, flag );
     KernelRegistry::set<CSRKernelTrait::gemmDS<ValueType> >( gemmDS, ctx, flag );
@@ -2102,11 +2889,22 @@ void OpenMPCSRUtils::RegistratorV<ValueType>::registerKernels( kregistry::Kernel
     KernelRegistry::set<CSRKernelTrait::absMaxDiffVal<ValueType> >( absMaxDiffVal, ctx, flag );
     KernelRegistry::set<CSRKernelTrait::countNonZeros<ValueType> >( countNonZeros, ctx, flag );
     KernelRegistry::set<CSRKernelTrait::compress<ValueType> >( compress, ctx, flag );
+    KernelRegistry::set<CSRKernelTrait::permute<ValueType> >( permute, ctx, flag );
     KernelRegistry::set<CSRKernelTrait::decomposition<ValueType> >( decomposition, ctx, flag );
     KernelRegistry::set<CSRKernelTrait::setRows<ValueType> >( setRows, ctx, flag );
     KernelRegistry::set<CSRKernelTrait::setColumns<ValueType> >( setColumns, ctx, flag );
 }
 
+template<typename ValueType, typename OtherValueType>
+void OpenMPCSRUtils::RegistratorVO<ValueType, OtherValueType>::registerKernels( kregistry::KernelRegistry::KernelRegistryFlag flag )
+{
+    using kregistry::KernelRegistry;
+    common::ContextType ctx = common::ContextType::Host;
+    SCAI_LOG_DEBUG( logger, "register CSRUtils OpenMP-routines for Host at kernel registry [" << flag
+                    << " --> " << common::getScalarType<ValueType>() << ", " << common::getScalarType<OtherValueType>() << "]" )
+    KernelRegistry::set<CSRKernelTrait::mixedGEMV<ValueType, OtherValueType> >( mixedGEMV, ctx, flag );
+}
+
 /* --------------------------------------------------------------------------- */
 /*    Constructor/Desctructor with registration                                */
 /* --------------------------------------------------------------------------- */
@@ -2118,6 +2916,7 @@ OpenMPCSRUtils::OpenMPCSRUtils()
     const kregistry::KernelRegistry::KernelRegistryFlag flag = kregistry::KernelRegistry::KERNEL_ADD;
     Registrator::registerKernels( flag );
     kregistry::mepr::RegistratorV<RegistratorV, SCAI_NUMERIC_TYPES_HOST_LIST>::registerKernels( flag );
+    kregistry::mepr::RegistratorVO<RegistratorVO, SCAI_NUMERIC_TYPES_HOST_LIST, SCAI_NUMERIC_TYPES_HOST_LIST>::registerKernels( flag );
 }
 
 OpenMPCSRUtils::~OpenMPCSRUtils()
@@ -2127,6 +2926,7 @@ OpenMPCSRUtils::~OpenMPCSRUtils()
     const kregistry::KernelRegistry::KernelRegistryFlag flag = kregistry::KernelRegistry::KERNEL_ERASE;
     Registrator::registerKernels( flag );
     kregistry::mepr::RegistratorV<RegistratorV, SCAI_NUMERIC_TYPES_HOST_LIST>::registerKernels( flag );
+    kregistry::mepr::RegistratorVO<RegistratorVO, SCAI_NUMERIC_TYPES_HOST_LIST, SCAI_NUMERIC_TYPES_HOST_LIST>::registerKernels( flag );
 }
 
 /* --------------------------------------------------------------------------- */
@@ -226,6 +226,71 @@ public:
         const ValueType csrValues[], 
         const common::MatrixOp op );
 
+    /** Implementation for CSRKernelTrait::symmetricGEMV  */
+
+    template<typename ValueType>
+    static void symmetricGEMV(
+        ValueType result[],
+        const ValueType alpha,
+        const ValueType x[],
+        const ValueType beta,
+        const ValueType y[],
+        const IndexType numRows,
+        const IndexType csrIA[],
+        const IndexType csrJA[],
+        const ValueType csrValues[] );
+
+    /** Implementation for CSRKernelTrait::gramianGEMV  */
+
+    template<typename ValueType>
+    static void gramianGEMV(
+        ValueType result[],
+        ValueType haloResult[],
+        const ValueType alpha,
+        const ValueType x[],
+        const ValueType haloX[],
+        const IndexType numRows,
+        const IndexType numColumns,
+        const IndexType numHaloColumns,
+        const IndexType csrIA[],
+        const IndexType csrJA[],
+        const ValueType csrValues[],
+        const IndexType haloIA[],
+        const IndexType haloJA[],
+        const ValueType haloValues[] );
+
+    /** Implementation for CSRKernelTrait::mixedGEMV  */
+
+    template<typename ValueType, typename MatrixValueType>
+    static void mixedGEMV(
+        ValueType result[],
+        const ValueType alpha,
+        const ValueType x[],
+        const ValueType beta,
+        const ValueType y[],
+        const IndexType numRows,
+        const IndexType numColumns,
+        const IndexType csrIA[],
+        const IndexType csrJA[],
+        const MatrixValueType csrValues[],
+        const common::MatrixOp op );
+
+    /** Implementation for CSRKernelTrait::compactGEMV  */
+
+    template<typename ValueType>
+    static void compactGEMV(
+        ValueType result[],
+        const ValueType alpha,
+        const ValueType x[],
+        const ValueType beta,
+        const ValueType y[],
+        const IndexType numRows,
+        const IndexType numColumns,
+        const LocalIndexType csrIA[],
+        const LocalIndexType csrJA[],
+        const ValueType csrValues[],
+        const common::MatrixOp op );
+
     /** Implementation for CSRKernelTrait::sparseGEMV  */
 
     template<typename ValueType>
@@ -437,6 +502,28 @@ public:
         const IndexType numRows,
         const RealType<ValueType> eps );
 
+    /** Implementation for CSRKernelTrait::reverseCuthillMcKee, each level of the BFS is built in parallel. */
+
+    static void reverseCuthillMcKee(
+        IndexType perm[],
+        const IndexType csrIA[],
+        const IndexType csrJA[],
+        const IndexType numRows );
+
+    /** Implementation for CSRKernelTrait::permute */
+
+    template<typename ValueType>
+    static void permute(
+        IndexType newJA[],
+        ValueType newValues[],
+        const IndexType newIA[],
+        const IndexType ia[],
+        const IndexType ja[],
+        const ValueType values[],
+        const IndexType rowPerm[],
+        const IndexType colMap[],
+        const IndexType numRows );
+
     template<typename ValueType>
     static void getDiagonal(
         ValueType diagonal[],
@@ -489,6 +576,14 @@ private:
         static void registerKernels( const kregistry::KernelRegistry::KernelRegistryFlag flag );
     };
 
+    /** Struct for registration of methods with two template arguments. */
+
+    template<typename ValueType, typename OtherValueType>
+    struct RegistratorVO
+    {
+        static void registerKernels( const kregistry::KernelRegistry::KernelRegistryFlag flag );
+    };
+
     /** Constructor for registration. */
 
     OpenMPCSRUtils();
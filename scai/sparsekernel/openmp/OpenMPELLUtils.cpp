@@ -1188,6 +1188,130 @@ void OpenMPELLUtils::normalGEMV(
 
 /* ------------------------------------------------------------------------------------------------------------------ */
 
+template<typename ValueType, typename MatrixValueType>
+void OpenMPELLUtils::mixedGEMV(
+    ValueType result[],
+    const ValueType alpha,
+    const ValueType x[],
+    const ValueType beta,
+    const ValueType y[],
+    const IndexType numRows,
+    const IndexType numColumns,
+    const IndexType numValuesPerRow,
+    const IndexType ellSizes[],
+    const IndexType ellJA[],
+    const MatrixValueType ellValues[],
+    const common::MatrixOp op )
+{
+    SCAI_REGION( "OpenMP.ELL.mixedGEMV" )
+
+    SCAI_LOG_INFO( logger,
+                   "mixedGEMV<" << TypeTraits<ValueType>::id() << ", " << TypeTraits<MatrixValueType>::id()
+                   << ", #threads = " << omp_get_max_threads() << ">, result[] = " << alpha
+                   << " * A( ell, #maxNZ/row = " << numValuesPerRow << " ) * x + " << beta << " * y, op = " << op )
+
+    if ( op == common::MatrixOp::TRANSPOSE )
+    {
+        #pragma omp parallel for
+
+        for ( IndexType j = 0; j < numColumns; ++j )
+        {
+            result[j] = y == NULL ? ValueType( 0 ) : beta * y[j];
+        }
+
+        #pragma omp parallel for
+
+        for ( IndexType i = 0; i < numRows; ++i )
+        {
+            const ValueType xi = alpha * x[i];
+
+            for ( IndexType jj = 0; jj < ellSizes[i]; ++jj )
+            {
+                IndexType pos = ellindex( i, jj, numRows, numValuesPerRow );
+                atomicAdd( result[ellJA[pos]], static_cast<ValueType>( ellValues[pos] ) * xi );
+            }
+        }
+    }
+    else
+    {
+        #pragma omp parallel for
+
+        for ( IndexType i = 0; i < numRows; ++i )
+        {
+            ValueType temp = 0;
+
+            for ( IndexType jj = 0; jj < ellSizes[i]; ++jj )
+            {
+                IndexType pos = ellindex( i, jj, numRows, numValuesPerRow );
+                temp += static_cast<ValueType>( ellValues[pos] ) * x[ellJA[pos]];
+            }
+
+            if ( y == NULL )
+            {
+                result[i] = alpha * temp;
+            }
+            else
+            {
+                result[i] = alpha * temp + beta * y[i];
+            }
+        }
+    }
+}
+
+/* ------------------------------------------------------------------------------------------------------------------ */
+
+template<typename ValueType>
+void OpenMPELLUtils::gemmSD(
+    ValueType result[],
+    const ValueType alpha,
+    const ValueType x[],
+    const ValueType beta,
+    const ValueType y[],
+    const IndexType numRows,
+    const IndexType,
+    const IndexType k,
+    const IndexType numValuesPerRow,
+    const IndexType ellSizes[],
+    const IndexType ellJA[],
+    const ValueType ellValues[] )
+{
+    SCAI_REGION( "OpenMP.ELL.gemmSD" )
+
+    SCAI_LOG_INFO( logger,
+                   "gemmSD<" << TypeTraits<ValueType>::id() << ", #threads = " << omp_get_max_threads() 
+                   << ">, result[ " << numRows << " x " << k << " ] = " << alpha
+                   << " * A( ell, #maxNZ/row = " << numValuesPerRow << " ) * x + " << beta << " * y" )
+
+    #pragma omp parallel for
+
+    for ( IndexType i = 0; i < numRows; ++i )
+    {
+        ValueType* resultRow = result + i * k;
+
+        // y might be an alias of result, so each element of y is read before it is written
+
+        for ( IndexType l = 0; l < k; ++l )
+        {
+            resultRow[l] = y == NULL ? ValueType( 0 ) : beta * y[i * k + l];
+        }
+
+        for ( IndexType jj = 0; jj < ellSizes[i]; ++jj )
+        {
+            IndexType pos = ellindex( i, jj, numRows, numValuesPerRow );
+
+            const ValueType v = alpha * ellValues[pos];
+            const ValueType* xRow = x + ellJA[pos] * k;
+
+            for ( IndexType l = 0; l < k; ++l )
+            {
+                resultRow[l] += v * xRow[l];
+            }
+        }
+    }
+}
+
+/* ------------------------------------------------------------------------------------------------------------------ */
+
 template<typename ValueType>
 void OpenMPELLUtils::sparseGEMV(
     ValueType result[],
@@ -1303,6 +1427,7 @@ void OpenMPELLUtils::RegistratorV<ValueType>::registerKernels( kregistry::Kernel
     KernelRegistry::set<ELLKernelTrait::matrixAdd<ValueType> >( matrixAdd, ctx, flag );
     KernelRegistry::set<ELLKernelTrait::matrixMultiply<ValueType> >( matrixMultiply, ctx, flag );
     KernelRegistry::set<ELLKernelTrait::normalGEMV<ValueType> >( normalGEMV, ctx, flag );
+    KernelRegistry::set<ELLKernelTrait::gemmSD<ValueType> >( gemmSD, ctx, flag );
     KernelRegistry::set<ELLKernelTrait::sparseGEMV<ValueType> >( sparseGEMV, ctx, flag );
     KernelRegistry::set<ELLKernelTrait::getRow<ValueType> >( getRow, ctx, flag );
     KernelRegistry::set<ELLKernelTrait::jacobi<ValueType> >( jacobi, ctx, flag );
@@ -1314,6 +1439,16 @@ void OpenMPELLUtils::RegistratorV<ValueType>::registerKernels( kregistry::Kernel
     KernelRegistry::set<ELLKernelTrait::getCSRValues<ValueType> >( getCSRValues, ctx, flag );
 }
 
+template<typename ValueType, typename OtherValueType>
+void OpenMPELLUtils::RegistratorVO<ValueType, OtherValueType>::registerKernels( kregistry::KernelRegistry::KernelRegistryFlag flag )
+{
+    using kregistry::KernelRegistry;
+    common::ContextType ctx = common::ContextType::Host;
+    SCAI_LOG_DEBUG( logger, "register ELLUtils OpenMP-routines for Host at kernel registry [" << flag
+                    << " --> " << common::getScalarType<ValueType>() << ", " << common::getScalarType<OtherValueType>() << "]" )
+    KernelRegistry::set<ELLKernelTrait::mixedGEMV<ValueType, OtherValueType> >( mixedGEMV, ctx, flag );
+}
+
 /* --------------------------------------------------------------------------- */
 /*    Constructor/Desctructor with registration                                */
 /* --------------------------------------------------------------------------- */
@@ -1325,6 +1460,7 @@ OpenMPELLUtils::OpenMPELLUtils()
     const kregistry::KernelRegistry::KernelRegistryFlag flag = kregistry::KernelRegistry::KERNEL_ADD;
     Registrator::registerKernels( flag );
     kregistry::mepr::RegistratorV<RegistratorV, SCAI_NUMERIC_TYPES_HOST_LIST>::registerKernels( flag );
+    kregistry::mepr::RegistratorVO<RegistratorVO, SCAI_NUMERIC_TYPES_HOST_LIST, SCAI_NUMERIC_TYPES_HOST_LIST>::registerKernels( flag );
 }
 
 OpenMPELLUtils::~OpenMPELLUtils()
@@ -1334,6 +1470,7 @@ OpenMPELLUtils::~OpenMPELLUtils()
     const kregistry::KernelRegistry::KernelRegistryFlag flag = kregistry::KernelRegistry::KERNEL_ERASE;
     Registrator::registerKernels( flag );
     kregistry::mepr::RegistratorV<RegistratorV, SCAI_NUMERIC_TYPES_HOST_LIST>::registerKernels( flag );
+    kregistry::mepr::RegistratorVO<RegistratorVO, SCAI_NUMERIC_TYPES_HOST_LIST, SCAI_NUMERIC_TYPES_HOST_LIST>::registerKernels( flag );
 }
 
 /* --------------------------------------------------------------------------- */
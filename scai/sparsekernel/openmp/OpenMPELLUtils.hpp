@@ -350,6 +350,40 @@ private:
         const ValueType csrValues[],
         const common::MatrixOp op );
 
+    /** Implementation for ELLKernelTrait::mixedGEMV  */
+
+    template<typename ValueType, typename MatrixValueType>
+    static void mixedGEMV(
+        ValueType result[],
+        const ValueType alpha,
+        const ValueType x[],
+        const ValueType beta,
+        const ValueType y[],
+        const IndexType numRows,
+        const IndexType numColumns,
+        const IndexType numNonZerosPerRow,
+        const IndexType ellSizes[],
+        const IndexType ellJA[],
+        const MatrixValueType ellValues[],
+        const common::MatrixOp op );
+
+    /** Implementation for ELLKernelTrait::gemmSD  */
+
+    template<typename ValueType>
+    static void gemmSD(
+        ValueType result[],
+        const ValueType alpha,
+        const ValueType x[],
+        const ValueType beta,
+        const ValueType y[],
+        const IndexType numRows,
+        const IndexType numColumns,
+        const IndexType k,
+        const IndexType numValuesPerRow,
+        const IndexType ellSizes[],
+        const IndexType ellJA[],
+        const ValueType ellValues[] );
+
     /** Implementation for ELLKernelTrait::sparseGEMV  */
 
     template<typename ValueType>
@@ -387,6 +421,14 @@ private:
         static void registerKernels( const kregistry::KernelRegistry::KernelRegistryFlag flag );
     };
 
+    /** Struct for registration of methods with two template arguments. */
+
+    template<typename ValueType, typename OtherValueType>
+    struct RegistratorVO
+    {
+        static void registerKernels( const kregistry::KernelRegistry::KernelRegistryFlag flag );
+    };
+
     /** Constructor for registration. */
 
     OpenMPELLUtils();
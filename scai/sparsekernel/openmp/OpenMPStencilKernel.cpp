@@ -41,6 +41,9 @@
 #include <scai/sparsekernel/StencilKernelTrait.hpp>
 #include <scai/tasking/TaskSyncToken.hpp>
 
+#include <memory>
+#include <algorithm>
+
 namespace scai
 {
 namespace sparsekernel
@@ -50,6 +53,18 @@ namespace sparsekernel
 
 SCAI_LOG_DEF_LOGGER( OpenMPStencilKernel::logger, "OpenMP.StencilKernel" )
 
+/** Cache size (in bytes) that should be used by one thread for the temporal blocking of sweeps */
+
+static const size_t SWEEP_CACHE_SIZE = 2 * 1024 * 1024;
+
+/** Maximal number of sweeps applied to one slab before continuing with the next one */
+
+static const IndexType SWEEP_MAX_DEPTH = 8;
+
+/** Number of contiguous grid points that are processed as one chunk by the ghost GEMV */
+
+static const IndexType GHOST_CHUNK_SIZE = 4096;
+
 /* --------------------------------------------------------------------------- */
 
 void OpenMPStencilKernel::stencilLocalSizes1(
@@ -1276,6 +1291,205 @@ void OpenMPStencilKernel::stencilGEMV4Inner(
 
 /* --------------------------------------------------------------------------- */
 
+template<typename ValueType, IndexType nPoints>
+void OpenMPStencilKernel::stencilGEMV1InnerN(
+    ValueType result[], 
+    const ValueType alpha,  
+    const ValueType x[],
+    const IndexType gridBounds[],
+    const ValueType stencilVal[],
+    const int stencilOffset[] )
+{
+    SCAI_REGION( "OpenMP.Stencil.GEMV1InnerN" )
+
+    const IndexType i0 = gridBounds[0];
+    const IndexType i1 = gridBounds[1];
+
+    SCAI_LOG_INFO( logger,  "stencilGEMV1InnerN<" << nPoints << "> on " << i0 << " - " << i1 )
+
+    ValueType val[nPoints];
+    int offset[nPoints];
+
+    for ( IndexType p = 0; p < nPoints; ++p )
+    {
+        val[p] = stencilVal[p];
+        offset[p] = stencilOffset[p];
+    }
+
+    #pragma omp parallel for simd
+    for ( IndexType i = i0; i < i1; i++ )
+    {
+        ValueType v = 0;
+
+        for ( IndexType p = 0; p < nPoints; ++p )
+        {   
+            v += val[p] * x[ i + offset[p] ];
+        }
+
+        result[i] += alpha * v;
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType, IndexType nPoints>
+void OpenMPStencilKernel::stencilGEMV2InnerN(
+    ValueType result[], 
+    const ValueType alpha,  
+    const ValueType x[],
+    const IndexType gridBounds[],
+    const IndexType gridDistances[],
+    const ValueType stencilVal[],
+    const int stencilOffset[] )
+{
+    SCAI_REGION( "OpenMP.Stencil.GEMV2InnerN" )
+
+    const IndexType i0 = gridBounds[0];
+    const IndexType i1 = gridBounds[1];
+    const IndexType j0 = gridBounds[2];
+    const IndexType j1 = gridBounds[3];
+
+    SCAI_LOG_INFO( logger,  "stencilGEMV2InnerN<" << nPoints << "> on " << i0 << " - " << i1 << " x " << j0 << " - " << j1 )
+
+    ValueType val[nPoints];
+    int offset[nPoints];
+
+    for ( IndexType p = 0; p < nPoints; ++p )
+    {
+        val[p] = stencilVal[p];
+        offset[p] = stencilOffset[p];
+    }
+
+    #pragma omp parallel for
+    for ( IndexType i = i0; i < i1; i++ )
+    {
+        // last dimension has unit stride
+
+        ValueType* resultRow = result + i * gridDistances[0];
+        const ValueType* xRow = x + i * gridDistances[0];
+
+        #pragma omp simd
+        for ( IndexType j = j0; j < j1; j++ )
+        {
+            ValueType v = 0;
+
+            for ( IndexType p = 0; p < nPoints; ++p )
+            {   
+                v += val[p] * xRow[ j + offset[p] ];
+            }
+
+            resultRow[j] += alpha * v;
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType, IndexType nPoints>
+void OpenMPStencilKernel::stencilGEMV3InnerN(
+    ValueType result[], 
+    const ValueType alpha,  
+    const ValueType x[],
+    const IndexType gridBounds[],
+    const IndexType gridDistances[],
+    const ValueType stencilVal[],
+    const int stencilOffset[] )
+{
+    SCAI_REGION( "OpenMP.Stencil.GEMV3InnerN" )
+
+    const IndexType i0 = gridBounds[0];
+    const IndexType i1 = gridBounds[1];
+    const IndexType j0 = gridBounds[2];
+    const IndexType j1 = gridBounds[3];
+    const IndexType k0 = gridBounds[4];
+    const IndexType k1 = gridBounds[5];
+
+    SCAI_LOG_DEBUG( logger,  "stencilGEMV3InnerN<" << nPoints << "> on " << i0 << " - " << i1 
+                             << " x " << j0 << " - " << j1 
+                             << " x " << k0 << " - " << k1  )
+
+    ValueType val[nPoints];
+    int offset[nPoints];
+
+    for ( IndexType p = 0; p < nPoints; ++p )
+    {
+        val[p] = stencilVal[p];
+        offset[p] = stencilOffset[p];
+    }
+
+    #pragma omp parallel for collapse( 2 )
+    for ( IndexType i = i0; i < i1; i++ )
+    {
+        for ( IndexType j = j0; j < j1; j++ )
+        {
+            // last dimension has unit stride
+
+            const IndexType rowPos = i * gridDistances[0] + j * gridDistances[1];
+
+            ValueType* resultRow = result + rowPos;
+            const ValueType* xRow = x + rowPos;
+
+            #pragma omp simd
+            for ( IndexType k = k0; k < k1; k++ )
+            {
+                ValueType v = 0;
+    
+                for ( IndexType p = 0; p < nPoints; ++p )
+                {   
+                    v += val[p] * xRow[ k + offset[p] ];
+                }
+    
+                resultRow[k] += alpha * v;
+            }
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+bool OpenMPStencilKernel::stencilGEMVInnerSpecialized(
+    ValueType result[], 
+    const ValueType alpha,  
+    const ValueType x[],
+    const IndexType nDims,
+    const IndexType gridBounds[],
+    const IndexType gridDistances[],
+    const IndexType nPoints,
+    const ValueType stencilVal[],
+    const int stencilOffset[] )
+{
+    if ( gridDistances[nDims - 1] != 1 )
+    {
+        return false;   // vectorization along the last dimension requires unit stride
+    }
+
+    switch ( nDims * 100 + nPoints )
+    {
+        case 103 : stencilGEMV1InnerN<ValueType, 3>( result, alpha, x, gridBounds, stencilVal, stencilOffset );
+                   return true;
+
+        case 205 : stencilGEMV2InnerN<ValueType, 5>( result, alpha, x, gridBounds, gridDistances, stencilVal, stencilOffset );
+                   return true;
+
+        case 209 : stencilGEMV2InnerN<ValueType, 9>( result, alpha, x, gridBounds, gridDistances, stencilVal, stencilOffset );
+                   return true;
+
+        case 307 : stencilGEMV3InnerN<ValueType, 7>( result, alpha, x, gridBounds, gridDistances, stencilVal, stencilOffset );
+                   return true;
+
+        case 319 : stencilGEMV3InnerN<ValueType, 19>( result, alpha, x, gridBounds, gridDistances, stencilVal, stencilOffset );
+                   return true;
+
+        case 327 : stencilGEMV3InnerN<ValueType, 27>( result, alpha, x, gridBounds, gridDistances, stencilVal, stencilOffset );
+                   return true;
+
+        default :  return false;
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
 template<typename ValueType>
 void OpenMPStencilKernel::stencilGEMVInner(
     ValueType result[], 
@@ -1288,6 +1502,11 @@ void OpenMPStencilKernel::stencilGEMVInner(
     const ValueType stencilVal[],
     const int stencilOffset[] )
 {
+    if ( stencilGEMVInnerSpecialized( result, alpha, x, nDims, gridBounds, gridDistances, nPoints, stencilVal, stencilOffset ) )
+    {
+        return;
+    }
+
     switch ( nDims ) 
     {
         case 1 : stencilGEMV1Inner( result, alpha, x, gridBounds, gridDistances,
@@ -1753,6 +1972,506 @@ void OpenMPStencilKernel::normalGEMV(
 
 /* --------------------------------------------------------------------------- */
 
+template<typename ValueType>
+void OpenMPStencilKernel::sweep(
+    ValueType solution[],
+    const ValueType x[],
+    const ValueType rhs[],
+    const ValueType omega,
+    const IndexType nDims,
+    const IndexType gridSizes[],
+    const IndexType gridDistances[],
+    const IndexType gridBorders[],
+    const IndexType gridStencilWidth[],
+    const IndexType nPoints,
+    const int stencilPositions[],
+    const ValueType stencilVal[],
+    const int stencilOffset[] )
+{
+    IndexType gridBounds[ 2 * SCAI_GRID_MAX_DIMENSION ];
+
+    IndexType nValues = 1;
+
+    for ( IndexType i = 0; i < nDims; ++i )
+    {
+        gridBounds[2 * i] = 0;
+        gridBounds[2 * i + 1] = gridSizes[i];
+        nValues *= gridSizes[i];
+    }
+
+    // solution = x + omega * rhs - omega * A * x
+
+    #pragma omp parallel for
+    for ( IndexType i = 0; i < nValues; ++i )
+    {
+        solution[i] = x[i] + omega * rhs[i];
+    }
+
+    IndexType currentDim = 0;
+
+    stencilGEMVCaller( gridBounds, solution, -omega, x, nDims, gridSizes, gridDistances, gridBorders, gridStencilWidth, currentDim,
+                       nPoints, stencilPositions, stencilVal, stencilOffset );
+}
+
+/* --------------------------------------------------------------------------- */
+
+/** Copy a box of an n-dimensional array, the last dimension is copied contiguously.
+ *
+ *  @param[out] target is the array with the distances targetDistances, box starts at targetLB
+ *  @param[in] source is the array with the distances sourceDistances, box starts at sourceLB
+ *  @param[in] sizes are the sizes of the box
+ */
+template<typename ValueType>
+static void copyBox(
+    ValueType target[],
+    const IndexType targetDistances[],
+    const IndexType targetLB[],
+    const ValueType source[],
+    const IndexType sourceDistances[],
+    const IndexType sourceLB[],
+    const IndexType sizes[],
+    const IndexType nDims )
+{
+    const IndexType last = nDims - 1;
+
+    IndexType nRows = 1;
+
+    for ( IndexType d = 0; d < last; ++d )
+    {
+        nRows *= sizes[d];
+    }
+
+    for ( IndexType row = 0; row < nRows; ++row )
+    {
+        IndexType targetPos = targetLB[last];
+        IndexType sourcePos = sourceLB[last];
+
+        IndexType k = row;
+
+        for ( IndexType d = last; d-- > 0; )
+        {
+            const IndexType i = k % sizes[d];
+            k /= sizes[d];
+            targetPos += ( targetLB[d] + i ) * targetDistances[d];
+            sourcePos += ( sourceLB[d] + i ) * sourceDistances[d];
+        }
+
+        std::copy( source + sourcePos, source + sourcePos + sizes[last], target + targetPos );
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+/** Compute result = x + omega * rhs for the box [lb, ub) of n-dimensional arrays with the same distances. */
+
+template<typename ValueType>
+static void boxPlusScaled(
+    ValueType result[],
+    const ValueType x[],
+    const ValueType omega,
+    const ValueType rhs[],
+    const IndexType distances[],
+    const IndexType lb[],
+    const IndexType ub[],
+    const IndexType nDims )
+{
+    const IndexType last = nDims - 1;
+
+    IndexType nRows = 1;
+
+    for ( IndexType d = 0; d < last; ++d )
+    {
+        nRows *= ub[d] - lb[d];
+    }
+
+    for ( IndexType row = 0; row < nRows; ++row )
+    {
+        IndexType pos = 0;
+
+        IndexType k = row;
+
+        for ( IndexType d = last; d-- > 0; )
+        {
+            const IndexType size = ub[d] - lb[d];
+            pos += ( lb[d] + k % size ) * distances[d];
+            k /= size;
+        }
+
+        for ( IndexType i = pos + lb[last]; i < pos + ub[last]; ++i )
+        {
+            result[i] = x[i] + omega * rhs[i];
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void OpenMPStencilKernel::normalSweeps(
+    ValueType solution[],
+    const ValueType rhs[],
+    const ValueType omega,
+    const IndexType nSweeps,
+    const IndexType nDims,
+    const IndexType gridSizes[],
+    const IndexType gridDistances[],
+    const IndexType gridBorders[],
+    const IndexType gridStencilWidth[],
+    const IndexType nPoints,
+    const int stencilPositions[],
+    const ValueType stencilVal[],
+    const int stencilOffset[] )
+{
+    SCAI_REGION( "OpenMP.Stencil.sweeps" )
+
+    IndexType nValues = 1;
+
+    for ( IndexType d = 0; d < nDims; ++d )
+    {
+        nValues *= gridSizes[d];
+    }
+
+    if ( nSweeps <= 0 || nValues == 0 )
+    {
+        return;
+    }
+
+    // all dimensions but the last one (unit stride) are tiled, tiles get a ghost layer of zeros
+    // at the grid borders, so temporal blocking is only supported for absorbing borders
+
+    const IndexType periodic = static_cast<IndexType>( common::BorderType::PERIODIC );
+
+    bool tiled[ SCAI_GRID_MAX_DIMENSION ];
+    IndexType width[ SCAI_GRID_MAX_DIMENSION ];
+
+    IndexType maxWidth = 0;
+
+    bool hasPeriodic = false;
+
+    for ( IndexType d = 0; d < nDims; ++d )
+    {
+        width[d] = std::max( gridStencilWidth[2 * d], gridStencilWidth[2 * d + 1] );
+        tiled[d] = d < nDims - 1 || nDims == 1;
+        hasPeriodic = hasPeriodic || gridBorders[2 * d] == periodic || gridBorders[2 * d + 1] == periodic;
+
+        if ( tiled[d] )
+        {
+            maxWidth = std::max( maxWidth, width[d] );
+        }
+    }
+
+    // find the largest depth for which a tile has at least twice the size of its overlap and
+    // where three arrays of an extended tile (x, solution, rhs) fit in the cache
+
+    const IndexType maxTileValues = static_cast<IndexType>( SWEEP_CACHE_SIZE / ( 3 * sizeof( ValueType ) ) );
+
+    const IndexType nThreads = omp_get_max_threads();
+
+    // number of values of an extended tile and number of tiles for a certain tile size
+
+    auto tileValues = [&]( const IndexType size, const IndexType depth ) -> IndexType
+    {
+        IndexType n = 1;
+
+        for ( IndexType d = 0; d < nDims; ++d )
+        {
+            n *= tiled[d] ? std::min( gridSizes[d] + 2 * width[d], size + 2 * depth * width[d] ) : gridSizes[d] + 2 * width[d];
+        }
+
+        return n;
+    };
+
+    auto countTiles = [&]( const IndexType size ) -> IndexType
+    {
+        IndexType n = 1;
+
+        for ( IndexType d = 0; d < nDims; ++d )
+        {
+            n *= tiled[d] ? ( gridSizes[d] + size - 1 ) / size : 1;
+        }
+
+        return n;
+    };
+
+    IndexType depth = std::min( nSweeps, SWEEP_MAX_DEPTH );
+    IndexType tileSize = 0;
+    IndexType nTiles = 0;
+
+    for ( ; !hasPeriodic && depth > 1; --depth )
+    {
+        const IndexType minTileSize = std::max( IndexType( 1 ), 2 * depth * maxWidth );
+
+        if ( tileValues( minTileSize, depth ) > maxTileValues )
+        {
+            continue;
+        }
+
+        tileSize = minTileSize;
+
+        while ( tileValues( tileSize + 1, depth ) <= maxTileValues && countTiles( tileSize + 1 ) >= nThreads && countTiles( tileSize ) > 1 )
+        {
+            tileSize++;
+        }
+
+        nTiles = countTiles( tileSize );
+
+        break;
+    }
+
+    const bool blocking = depth > 1 && nTiles > 1;
+
+    SCAI_LOG_INFO( logger, "normalSweeps<" << common::TypeTraits<ValueType>::id() << ">: " << nSweeps << " sweeps, blocking = " << blocking
+                            << ", depth = " << depth << ", tile size = " << tileSize << ", #tiles = " << nTiles )
+
+    std::unique_ptr<ValueType[]> tmp( new ValueType[ nValues ] );
+
+    ValueType* src = solution;
+    ValueType* dst = tmp.get();
+
+    if ( !blocking )
+    {
+        for ( IndexType iter = 0; iter < nSweeps; ++iter )
+        {
+            sweep( dst, src, rhs, omega, nDims, gridSizes, gridDistances, gridBorders, gridStencilWidth,
+                   nPoints, stencilPositions, stencilVal, stencilOffset );
+
+            std::swap( src, dst );
+        }
+    }
+    else
+    {
+        IndexType nBlocks[ SCAI_GRID_MAX_DIMENSION ];
+
+        for ( IndexType d = 0; d < nDims; ++d )
+        {
+            nBlocks[d] = tiled[d] ? ( gridSizes[d] + tileSize - 1 ) / tileSize : 1;
+        }
+
+        const IndexType tileCapacity = tileValues( tileSize, depth );
+
+        for ( IndexType done = 0; done < nSweeps; done += depth )
+        {
+            const IndexType steps = std::min( depth, nSweeps - done );
+
+            #pragma omp parallel
+            {
+                std::unique_ptr<ValueType[]> tileX( new ValueType[ tileCapacity ] );
+                std::unique_ptr<ValueType[]> tileY( new ValueType[ tileCapacity ] );
+                std::unique_ptr<ValueType[]> tileRhs( new ValueType[ tileCapacity ] );
+                std::unique_ptr<int[]> tileOffset( new int[ nPoints ] );
+
+                // all positions are relative to the tile, the tile has the global position tileLB
+
+                IndexType core[ 2 * SCAI_GRID_MAX_DIMENSION ];          // global range of the tile
+                IndexType tileLB[ SCAI_GRID_MAX_DIMENSION ];
+                IndexType tileDistances[ SCAI_GRID_MAX_DIMENSION ];
+                IndexType gridLB[ SCAI_GRID_MAX_DIMENSION ];            // part of the tile within the grid
+                IndexType gridSizesInTile[ SCAI_GRID_MAX_DIMENSION ];
+                IndexType gridOffset[ SCAI_GRID_MAX_DIMENSION ];
+                IndexType coreLB[ SCAI_GRID_MAX_DIMENSION ];
+                IndexType coreSizes[ SCAI_GRID_MAX_DIMENSION ];
+                IndexType coreOffset[ SCAI_GRID_MAX_DIMENSION ];
+                IndexType lb[ SCAI_GRID_MAX_DIMENSION ];                // range of one sweep
+                IndexType ub[ SCAI_GRID_MAX_DIMENSION ];
+                IndexType bounds[ 2 * SCAI_GRID_MAX_DIMENSION ];
+
+                #pragma omp for schedule( dynamic )
+                for ( IndexType t = 0; t < nTiles; ++t )
+                {
+                    IndexType tileSizes[ SCAI_GRID_MAX_DIMENSION ];
+
+                    IndexType k = t;
+
+                    for ( IndexType d = nDims; d-- > 0; )
+                    {
+                        const IndexType b = k % nBlocks[d];
+
+                        k /= nBlocks[d];
+
+                        core[2 * d] = tiled[d] ? b * tileSize : 0;
+                        core[2 * d + 1] = tiled[d] ? std::min( gridSizes[d], core[2 * d] + tileSize ) : gridSizes[d];
+
+                        // extended tile, values outside the grid are zero (absorbing)
+
+                        tileLB[d] = std::max( -width[d], core[2 * d] - steps * width[d] );
+                        tileSizes[d] = std::min( gridSizes[d] + width[d], core[2 * d + 1] + steps * width[d] ) - tileLB[d];
+
+                        gridLB[d] = std::max( IndexType( 0 ), tileLB[d] );
+                        gridSizesInTile[d] = std::min( gridSizes[d], tileLB[d] + tileSizes[d] ) - gridLB[d];
+                        gridOffset[d] = gridLB[d] - tileLB[d];
+
+                        coreLB[d] = core[2 * d];
+                        coreSizes[d] = core[2 * d + 1] - core[2 * d];
+                        coreOffset[d] = core[2 * d] - tileLB[d];
+                    }
+
+                    tileDistances[nDims - 1] = 1;
+
+                    for ( IndexType d = nDims - 1; d-- > 0; )
+                    {
+                        tileDistances[d] = tileDistances[d + 1] * tileSizes[d + 1];
+                    }
+
+                    IndexType nTileValues = tileDistances[0] * tileSizes[0];
+
+                    for ( IndexType p = 0; p < nPoints; ++p )
+                    {
+                        tileOffset[p] = 0;
+
+                        for ( IndexType d = 0; d < nDims; ++d )
+                        {
+                            tileOffset[p] += stencilPositions[p * nDims + d] * static_cast<int>( tileDistances[d] );
+                        }
+                    }
+
+                    ValueType* cur = tileX.get();
+                    ValueType* next = tileY.get();
+
+                    std::fill( cur, cur + nTileValues, ValueType( 0 ) );
+                    std::fill( next, next + nTileValues, ValueType( 0 ) );
+
+                    copyBox( cur, tileDistances, gridOffset, src, gridDistances, gridLB, gridSizesInTile, nDims );
+                    copyBox( tileRhs.get(), tileDistances, gridOffset, rhs, gridDistances, gridLB, gridSizesInTile, nDims );
+
+                    for ( IndexType iter = 1; iter <= steps; ++iter )
+                    {
+                        // after each sweep the valid range shrinks by the stencil width
+
+                        for ( IndexType d = 0; d < nDims; ++d )
+                        {
+                            lb[d] = std::max( IndexType( 0 ), core[2 * d] - ( steps - iter ) * width[d] ) - tileLB[d];
+                            ub[d] = std::min( gridSizes[d], core[2 * d + 1] + ( steps - iter ) * width[d] ) - tileLB[d];
+                            bounds[2 * d] = lb[d];
+                            bounds[2 * d + 1] = ub[d];
+                        }
+
+                        boxPlusScaled( next, cur, omega, tileRhs.get(), tileDistances, lb, ub, nDims );
+
+                        stencilGEMVInner( next, -omega, cur, nDims, bounds, tileDistances, nPoints, stencilVal, tileOffset.get() );
+
+                        std::swap( cur, next );
+                    }
+
+                    copyBox( dst, gridDistances, coreLB, cur, tileDistances, coreOffset, coreSizes, nDims );
+                }
+            }
+
+            std::swap( src, dst );
+        }
+    }
+
+    if ( src != solution )
+    {
+        #pragma omp parallel for
+        for ( IndexType i = 0; i < nValues; ++i )
+        {
+            solution[i] = src[i];
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void OpenMPStencilKernel::ghostGEMV(
+    ValueType result[],
+    const ValueType alpha,
+    const ValueType xGhost[],
+    const ValueType beta,
+    const ValueType y[],
+    const IndexType nDims,
+    const IndexType gridSizes[],
+    const IndexType ghostWidth[],
+    const IndexType nPoints,
+    const ValueType stencilVal[],
+    const int stencilOffset[] )
+{
+    SCAI_REGION( "OpenMP.Stencil.ghostGEMV" )
+
+    const IndexType last = nDims - 1;
+
+    // distances of the grid extended by the ghost layers, row-major
+
+    IndexType ghostDistances[SCAI_GRID_MAX_DIMENSION];
+
+    ghostDistances[last] = 1;
+
+    for ( IndexType d = last; d-- > 0; )
+    {
+        ghostDistances[d] = ghostDistances[d + 1] * ( gridSizes[d + 1] + ghostWidth[2 * d + 2] + ghostWidth[2 * d + 3] );
+    }
+
+    IndexType nRows = 1;
+
+    for ( IndexType d = 0; d < last; ++d )
+    {
+        nRows *= gridSizes[d];
+    }
+
+    const IndexType n = gridSizes[last];
+
+    // rows are split into chunks so that there is enough parallelism also for few long rows
+
+    const IndexType nChunks = ( n + GHOST_CHUNK_SIZE - 1 ) / GHOST_CHUNK_SIZE;
+
+    SCAI_LOG_INFO( logger, "ghostGEMV<" << common::TypeTraits<ValueType>::id() << ">: " << nDims << "D, " 
+                            << nRows << " rows of size " << n << ", " << nPoints << " stencil points" )
+
+    #pragma omp parallel for schedule( static )
+    for ( IndexType chunk = 0; chunk < nRows * nChunks; ++chunk )
+    {
+        const IndexType row = chunk / nChunks;
+        const IndexType lb  = ( chunk % nChunks ) * GHOST_CHUNK_SIZE;
+        const IndexType len = std::min( n - lb, GHOST_CHUNK_SIZE );
+
+        IndexType xPos = ghostWidth[2 * last] + lb;
+
+        IndexType k = row;
+
+        for ( IndexType d = last; d-- > 0; )
+        {
+            const IndexType i = k % gridSizes[d];
+            k /= gridSizes[d];
+            xPos += ( ghostWidth[2 * d] + i ) * ghostDistances[d];
+        }
+
+        ValueType* res = result + row * n + lb;
+        const ValueType* xRow = xGhost + xPos;
+
+        if ( beta == ValueType( 0 ) )
+        {
+            for ( IndexType i = 0; i < len; ++i )
+            {
+                res[i] = ValueType( 0 );
+            }
+        }
+        else
+        {
+            const ValueType* yRow = y + row * n + lb;
+
+            #pragma omp simd
+            for ( IndexType i = 0; i < len; ++i )
+            {
+                res[i] = beta * yRow[i];
+            }
+        }
+
+        for ( IndexType p = 0; p < nPoints; ++p )
+        {
+            const ValueType v = alpha * stencilVal[p];
+            const ValueType* xp = xRow + stencilOffset[p];
+
+            #pragma omp simd
+            for ( IndexType i = 0; i < len; ++i )
+            {
+                res[i] += v * xp[i];
+            }
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
 void OpenMPStencilKernel::Registrator::registerKernels( kregistry::KernelRegistry::KernelRegistryFlag flag )
 {
     using kregistry::KernelRegistry; 
@@ -1780,6 +2499,8 @@ void OpenMPStencilKernel::RegistratorV<ValueType>::registerKernels( kregistry::K
     KernelRegistry::set<StencilKernelTrait::stencilLocalCSR<ValueType> >( stencilLocalCSR, ctx, flag );
     KernelRegistry::set<StencilKernelTrait::stencilHaloCSR<ValueType> >( stencilHaloCSR, ctx, flag );
     KernelRegistry::set<StencilKernelTrait::normalGEMV<ValueType> >( normalGEMV, ctx, flag );
+    KernelRegistry::set<StencilKernelTrait::normalSweeps<ValueType> >( normalSweeps, ctx, flag );
+    KernelRegistry::set<StencilKernelTrait::ghostGEMV<ValueType> >( ghostGEMV, ctx, flag );
 }
 
 /* --------------------------------------------------------------------------- */
@@ -126,6 +126,49 @@ public:
         const ValueType stencilVal[],
         const int stencilOffset[] );
 
+    /** OpenMP implementation for StencilKernelTrait::normalSweeps 
+     *
+     *  Several sweeps are applied to one tile of the grid before the next one is processed,
+     *  each tile is extended by the stencil width for each sweep (overlapped temporal blocking).
+     *  All dimensions but the last one (unit stride) are tiled.
+     */
+
+    template<typename ValueType>
+    static void normalSweeps(
+        ValueType solution[],
+        const ValueType rhs[],
+        const ValueType omega,
+        const IndexType nSweeps,
+        const IndexType nDims,
+        const IndexType gridSizes[],
+        const IndexType gridDistances[],
+        const IndexType gridBorders[],
+        const IndexType gridStencilWidth[],
+        const IndexType nPoints,
+        const int stencilPositions[],
+        const ValueType stencilVal[],
+        const int stencilOffset[] );
+
+    /** OpenMP implementation for StencilKernelTrait::ghostGEMV 
+     *
+     *  Rows of the last dimension (unit stride) are split into chunks, each chunk is updated
+     *  point by point of the stencil so that the inner loop can be vectorized.
+     */
+
+    template<typename ValueType>
+    static void ghostGEMV(
+        ValueType result[],
+        const ValueType alpha,
+        const ValueType xGhost[],
+        const ValueType beta,
+        const ValueType y[],
+        const IndexType nDims,
+        const IndexType gridSizes[],
+        const IndexType ghostWidth[],
+        const IndexType nPoints,
+        const ValueType stencilVal[],
+        const int stencilOffset[] );
+
 private:
 
     /** Implementation of stencilLocalSizes for nDims == 1 */
@@ -392,6 +435,56 @@ private:
         const ValueType stencilVal[],
         const int stencilOffset[] );
 
+    /** Inner kernels with the number of stencil points as compile-time constant.
+     *
+     *  Stencil values and offsets are kept in local arrays and the loop over the points
+     *  is completely unrolled so the loop over the last (unit-stride) dimension can be vectorized.
+     */
+    template<typename ValueType, IndexType nPoints>
+    static void stencilGEMV1InnerN(
+        ValueType result[],
+        const ValueType alpha,
+        const ValueType x[],
+        const IndexType gridBounds[],
+        const ValueType stencilVal[],
+        const int stencilOffset[] );
+
+    template<typename ValueType, IndexType nPoints>
+    static void stencilGEMV2InnerN(
+        ValueType result[],
+        const ValueType alpha,
+        const ValueType x[],
+        const IndexType gridBounds[],
+        const IndexType gridDistances[],
+        const ValueType stencilVal[],
+        const int stencilOffset[] );
+
+    template<typename ValueType, IndexType nPoints>
+    static void stencilGEMV3InnerN(
+        ValueType result[],
+        const ValueType alpha,
+        const ValueType x[],
+        const IndexType gridBounds[],
+        const IndexType gridDistances[],
+        const ValueType stencilVal[],
+        const int stencilOffset[] );
+
+    /** Try to use one of the specialized inner kernels for the stencils 3P (1D), 5P, 9P (2D) and 7P, 19P, 27P (3D).
+     *
+     *  @returns false if there is no specialized kernel and the generic one must be used.
+     */
+    template<typename ValueType>
+    static bool stencilGEMVInnerSpecialized(
+        ValueType result[],
+        const ValueType alpha,
+        const ValueType x[],
+        const IndexType nDims,
+        const IndexType gridBounds[],
+        const IndexType gridDistances[],
+        const IndexType nPoints,
+        const ValueType stencilVal[],
+        const int stencilOffset[] );
+
     template<typename ValueType>
     static void stencilGEMVInner(
         ValueType result[],
@@ -492,6 +585,24 @@ private:
         const ValueType stencilVal[],
         const int stencilOffset[] );
 
+    /** Single update solution = x + omega * ( rhs - A * x ), solution and x must not be aliased */
+
+    template<typename ValueType>
+    static void sweep(
+        ValueType solution[],
+        const ValueType x[],
+        const ValueType rhs[],
+        const ValueType omega,
+        const IndexType nDims,
+        const IndexType gridSizes[],
+        const IndexType gridDistances[],
+        const IndexType gridBorders[],
+        const IndexType gridStencilWidth[],
+        const IndexType nPoints,
+        const int stencilPositions[],
+        const ValueType stencilVal[],
+        const int stencilOffset[] );
+
     /** Struct for registration of methods without template arguments */
 
     struct Registrator
@@ -0,0 +1,477 @@
+/**
+ * @file BSRUtilsTest.cpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Contains tests for the BSRUtils interface to be tested on different devices
+ * @author Thomas Brandes
+ * @date 19.10.2026
+ */
+
+// boost
+#include <boost/test/unit_test.hpp>
+
+// others
+#include <scai/hmemo.hpp>
+#include <scai/sparsekernel/BSRUtils.hpp>
+#include <scai/utilskernel/HArrayUtils.hpp>
+
+#include <scai/sparsekernel/test/TestMacros.hpp>
+
+#include <scai/sparsekernel/test/TestData1.hpp>
+#include <scai/sparsekernel/test/TestData2.hpp>
+
+/*--------------------------------------------------------------------- */
+
+using namespace scai;
+
+using namespace hmemo;
+using namespace sparsekernel;
+using namespace utilskernel;
+
+using common::TypeTraits;
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_SUITE( BSRUtilsTest )
+
+/* --------------------------------------------------------------------- */
+
+SCAI_LOG_DEF_LOGGER( logger, "Test.BSRUtilsTest" )
+
+/* ------------------------------------------------------------------------------------- */
+
+/** Block sizes used for the tests, covers the specialized and the generic kernels. */
+
+static const IndexType theBlockSizes[] = { 1, 2, 3, 4, 5, 7 };
+
+static const IndexType nBlockSizes = sizeof( theBlockSizes ) / sizeof( IndexType );
+
+/* ------------------------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE( convertCSRTest )
+{
+    typedef DefaultReal ValueType;
+
+    ContextPtr testContext = ContextFix::testContext;
+
+    // Matrix:  6 1 0 0 4
+    //         -2 8 0 0 0
+    //          0 0 9 4 0
+    //          0 0 1 3 0
+    //          0 0 0 0 5
+
+    const IndexType numRows    = 5;
+    const IndexType numColumns = 5;
+
+    HArray<IndexType> csrIA(     { 0,       3,    5,    7,    9, 10 } );
+    HArray<IndexType> csrJA(     { 0, 1, 4, 0, 1, 2, 3, 2, 3, 4 } );
+    HArray<ValueType> csrValues( { 6, 1, 4, -2, 8, 9, 4, 1, 3, 5 } );
+
+    HArray<IndexType> bsrIA;
+    HArray<IndexType> bsrJA;
+    HArray<ValueType> bsrValues;
+
+    BSRUtils::convertCSR2BSR( bsrIA, bsrJA, bsrValues, numRows, numColumns, 2, csrIA, csrJA, csrValues, testContext );
+
+    HArray<IndexType> expIA( { 0, 2, 3, 4 } );
+    HArray<IndexType> expJA( { 0, 2, 1, 2 } );
+    HArray<ValueType> expValues( { 6, 1, -2, 8,   4, 0, 0, 0,   9, 4, 1, 3,   5, 0, 0, 0 } );
+
+    BOOST_TEST( hostReadAccess( bsrIA ) == hostReadAccess( expIA ), boost::test_tools::per_element() );
+    BOOST_TEST( hostReadAccess( bsrJA ) == hostReadAccess( expJA ), boost::test_tools::per_element() );
+    BOOST_TEST( hostReadAccess( bsrValues ) == hostReadAccess( expValues ), boost::test_tools::per_element() );
+
+    HArray<IndexType> newIA;
+    HArray<IndexType> newJA;
+    HArray<ValueType> newValues;
+
+    BSRUtils::convertBSR2CSR( newIA, newJA, newValues, numRows, numColumns, 2, bsrIA, bsrJA, bsrValues, testContext );
+
+    // explicit zeros of the blocks are kept, e.g. ( 1, 4 ), padded entries not
+
+    HArray<IndexType> expCSRIA( { 0, 3, 6, 8, 10, 11 } );
+    HArray<IndexType> expCSRJA( { 0, 1, 4, 0, 1, 4, 2, 3, 2, 3, 4 } );
+    HArray<ValueType> expCSRValues( { 6, 1, 4, -2, 8, 0, 9, 4, 1, 3, 5 } );
+
+    BOOST_TEST( hostReadAccess( newIA ) == hostReadAccess( expCSRIA ), boost::test_tools::per_element() );
+    BOOST_TEST( hostReadAccess( newJA ) == hostReadAccess( expCSRJA ), boost::test_tools::per_element() );
+    BOOST_TEST( hostReadAccess( newValues ) == hostReadAccess( expCSRValues ), boost::test_tools::per_element() );
+}
+
+/* ------------------------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( getValueTest, ValueType, scai_numeric_test_types )
+{
+    ContextPtr testContext = ContextFix::testContext;
+
+    HArray<IndexType> csrIA;
+    HArray<IndexType> csrJA;
+    HArray<ValueType> csrValues;
+
+    IndexType numRows;
+    IndexType numColumns;
+    IndexType numValues;
+
+    data1::getCSRTestData( numRows, numColumns, numValues, csrIA, csrJA, csrValues );
+
+    HArray<ValueType> dense;
+
+    data1::getDenseTestData( numRows, numColumns, dense );
+
+    auto rDense = hostReadAccess( dense );
+
+    for ( IndexType k = 0; k < nBlockSizes; ++k )
+    {
+        const IndexType blockSize = theBlockSizes[k];
+
+        HArray<IndexType> bsrIA;
+        HArray<IndexType> bsrJA;
+        HArray<ValueType> bsrValues;
+
+        BSRUtils::convertCSR2BSR( bsrIA, bsrJA, bsrValues, numRows, numColumns, blockSize, csrIA, csrJA, csrValues, testContext );
+
+        auto rValues = hostReadAccess( bsrValues );
+
+        for ( IndexType i = 0; i < numRows; ++i )
+        {
+            for ( IndexType j = 0; j < numColumns; ++j )
+            {
+                IndexType pos = BSRUtils::getValuePos( i, j, blockSize, bsrIA, bsrJA, testContext );
+
+                ValueType v = pos == invalidIndex ? ValueType( 0 ) : rValues[pos];
+
+                BOOST_CHECK_EQUAL( v, rDense[ i * numColumns + j ] );
+            }
+
+            HArray<IndexType> indexes;
+            HArray<IndexType> positions;
+
+            BSRUtils::getRowPositions( indexes, positions, i, numColumns, blockSize, bsrIA, bsrJA, testContext );
+
+            BOOST_REQUIRE_EQUAL( indexes.size(), positions.size() );
+
+            auto rIndexes = hostReadAccess( indexes );
+            auto rPositions = hostReadAccess( positions );
+
+            for ( IndexType ii = 0; ii < indexes.size(); ++ii )
+            {
+                BOOST_CHECK_EQUAL( rValues[ rPositions[ii] ], rDense[ i * numColumns + rIndexes[ii] ] );
+            }
+        }
+
+        for ( IndexType j = 0; j < numColumns; ++j )
+        {
+            HArray<IndexType> indexes;
+            HArray<IndexType> positions;
+
+            BSRUtils::getColPositions( indexes, positions, j, numRows, blockSize, bsrIA, bsrJA, testContext );
+
+            auto rIndexes = hostReadAccess( indexes );
+            auto rPositions = hostReadAccess( positions );
+
+            for ( IndexType ii = 0; ii < indexes.size(); ++ii )
+            {
+                BOOST_CHECK_EQUAL( rValues[ rPositions[ii] ], rDense[ rIndexes[ii] * numColumns + j ] );
+            }
+        }
+    }
+}
+
+/* ------------------------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( gemvTest, ValueType, scai_numeric_test_types )
+{
+    ContextPtr testContext = ContextFix::testContext;
+
+    SCAI_LOG_INFO( logger, "normalGEMV test @ " << *testContext )
+
+    HArray<IndexType> csrIA;
+    HArray<IndexType> csrJA;
+    HArray<ValueType> csrValues;
+
+    IndexType numRows;
+    IndexType numColumns;
+    IndexType numValues;
+
+    data1::getCSRTestData( numRows, numColumns, numValues, csrIA, csrJA, csrValues );
+
+    HArray<ValueType> x( { 3, -3, 2, -2 }, testContext );
+    HArray<ValueType> y( { 1, -1, 2, -2, 1, 1, -1 }, testContext );
+
+    const ValueType alpha_values[] = { -3, 1, -1, 0, 2 };
+    const ValueType beta_values[]  = { -2, 0, 1 };
+
+    const IndexType n_alpha = sizeof( alpha_values ) / sizeof( ValueType );
+    const IndexType n_beta  = sizeof( beta_values ) / sizeof( ValueType );
+
+    for ( IndexType k = 0; k < nBlockSizes; ++k )
+    {
+        const IndexType blockSize = theBlockSizes[k];
+
+        HArray<IndexType> bsrIA;
+        HArray<IndexType> bsrJA;
+        HArray<ValueType> bsrValues;
+
+        BSRUtils::convertCSR2BSR( bsrIA, bsrJA, bsrValues, numRows, numColumns, blockSize, csrIA, csrJA, csrValues, testContext );
+
+        for ( IndexType icase = 0; icase < n_alpha * n_beta; ++icase )
+        {
+            ValueType alpha = alpha_values[icase % n_alpha ];
+            ValueType beta  = beta_values[icase / n_alpha ];
+
+            HArray<ValueType> res( testContext );
+
+            BSRUtils::gemv( res, alpha, x, beta, y,
+                            numRows, numColumns, blockSize, bsrIA, bsrJA, bsrValues,
+                            common::MatrixOp::NORMAL, false, testContext );
+
+            HArray<ValueType> expectedRes = data1::getGEMVNormalResult( alpha, x, beta, y );
+
+            BOOST_TEST( hostReadAccess( expectedRes ) == hostReadAccess( res ), boost::test_tools::per_element() );
+        }
+    }
+}
+
+/* ------------------------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( gemvTransposeTest, ValueType, scai_numeric_test_types )
+{
+    ContextPtr testContext = ContextFix::testContext;
+
+    SCAI_LOG_INFO( logger, "normalGEMV (transpose) @ " << *testContext )
+
+    HArray<IndexType> csrIA;
+    HArray<IndexType> csrJA;
+    HArray<ValueType> csrValues;
+
+    IndexType numRows;
+    IndexType numColumns;
+    IndexType numValues;
+
+    data1::getCSRTestData( numRows, numColumns, numValues, csrIA, csrJA, csrValues );
+
+    HArray<ValueType> x( { 3, -2, -2, 3, 1, 0, 1 }, testContext );
+    HArray<ValueType> y( { 1, -1, 2, -2 }, testContext );
+
+    const ValueType alpha_values[] = { -3, 1, -1, 0, 2 };
+    const ValueType beta_values[]  = { -2, 0, 1 };
+
+    const IndexType n_alpha = sizeof( alpha_values ) / sizeof( ValueType );
+    const IndexType n_beta  = sizeof( beta_values ) / sizeof( ValueType );
+
+    for ( IndexType k = 0; k < nBlockSizes; ++k )
+    {
+        const IndexType blockSize = theBlockSizes[k];
+
+        HArray<IndexType> bsrIA;
+        HArray<IndexType> bsrJA;
+        HArray<ValueType> bsrValues;
+
+        BSRUtils::convertCSR2BSR( bsrIA, bsrJA, bsrValues, numRows, numColumns, blockSize, csrIA, csrJA, csrValues, testContext );
+
+        for ( IndexType icase = 0; icase < n_alpha * n_beta; ++icase )
+        {
+            ValueType alpha = alpha_values[icase % n_alpha ];
+            ValueType beta  = beta_values[icase / n_alpha ];
+
+            HArray<ValueType> res( testContext );
+
+            BSRUtils::gemv( res, alpha, x, beta, y,
+                            numRows, numColumns, blockSize, bsrIA, bsrJA, bsrValues,
+                            common::MatrixOp::TRANSPOSE, false, testContext );
+
+            HArray<ValueType> expectedRes = data1::getGEMVTransposeResult( alpha, x, beta, y );
+
+            BOOST_TEST( hostReadAccess( expectedRes ) == hostReadAccess( res ), boost::test_tools::per_element() );
+        }
+    }
+}
+
+/* ------------------------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( jacobiTest, ValueType, scai_numeric_test_types )
+{
+    ContextPtr testContext = ContextFix::testContext;
+
+    SCAI_LOG_INFO( logger, "block jacobi test for " << *testContext )
+
+    HArray<IndexType> csrIA;
+    HArray<IndexType> csrJA;
+    HArray<ValueType> csrValues;
+
+    IndexType numRows;
+    IndexType numColumns;
+    IndexType numValues;
+
+    data2::getCSRTestData( numRows, numColumns, numValues, csrIA, csrJA, csrValues );
+
+    HArray<ValueType> dense;
+
+    data2::getDenseTestData( numRows, numColumns, dense );
+
+    HArray<ValueType> rhs(  { 1, -1, 2, -2 }, testContext );
+    HArray<ValueType> oldSolution( { 3, -2, -2, 3 }, testContext );
+
+    const ValueType omega = 0.5;
+
+    for ( IndexType blockSize = 1; blockSize <= numRows; ++blockSize )
+    {
+        HArray<IndexType> bsrIA;
+        HArray<IndexType> bsrJA;
+        HArray<ValueType> bsrValues;
+        HArray<ValueType> invDiagonal;
+
+        BSRUtils::convertCSR2BSR( bsrIA, bsrJA, bsrValues, numRows, numColumns, blockSize, csrIA, csrJA, csrValues, testContext );
+        BSRUtils::invertDiagonalBlocks( invDiagonal, numRows, blockSize, bsrIA, bsrJA, bsrValues, testContext );
+
+        HArray<ValueType> res( testContext );
+
+        BSRUtils::jacobi( res, omega, oldSolution, rhs, numRows, blockSize, bsrIA, bsrJA, bsrValues, invDiagonal, testContext );
+
+        if ( blockSize == 1 )
+        {
+            // block Jacobi with block size 1 is the usual Jacobi method
+
+            HArray<ValueType> expectedRes( testContext );
+
+            data2::getJacobiResult( expectedRes, oldSolution, omega, rhs );
+
+            BOOST_CHECK( HArrayUtils::maxDiffNorm( expectedRes, res ) < 0.001 );
+        }
+
+        // verify: D_block * ( res - oldSolution ) == omega * ( rhs - A * oldSolution ) in each block row
+
+        auto rDense = hostReadAccess( dense );
+        auto rRes   = hostReadAccess( res );
+        auto rOld   = hostReadAccess( oldSolution );
+        auto rRhs   = hostReadAccess( rhs );
+
+        for ( IndexType i = 0; i < numRows; ++i )
+        {
+            const IndexType ib = i / blockSize;
+
+            ValueType residual = rRhs[i];
+            ValueType update   = 0;
+
+            for ( IndexType j = 0; j < numColumns; ++j )
+            {
+                residual -= rDense[ i * numColumns + j ] * rOld[j];
+
+                if ( j / blockSize == ib )
+                {
+                    update += rDense[ i * numColumns + j ] * ( rRes[j] - rOld[j] );
+                }
+            }
+
+            BOOST_CHECK( common::Math::abs( update - omega * residual ) < 0.001 );
+        }
+    }
+}
+
+/* ------------------------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE( singularTest )
+{
+    typedef DefaultReal ValueType;
+
+    ContextPtr testContext = ContextFix::testContext;
+
+    // Matrix:  1 2 0
+    //          2 4 0
+    //          0 0 1    first 2 x 2 block is singular
+
+    HArray<IndexType> csrIA(     { 0, 2, 4, 5 } );
+    HArray<IndexType> csrJA(     { 0, 1, 0, 1, 2 } );
+    HArray<ValueType> csrValues( { 1, 2, 2, 4, 1 } );
+
+    HArray<IndexType> bsrIA;
+    HArray<IndexType> bsrJA;
+    HArray<ValueType> bsrValues;
+    HArray<ValueType> invDiagonal;
+
+    BSRUtils::convertCSR2BSR( bsrIA, bsrJA, bsrValues, 3, 3, 2, csrIA, csrJA, csrValues, testContext );
+
+    BOOST_CHECK_THROW(
+    {
+        BSRUtils::invertDiagonalBlocks( invDiagonal, 3, 2, bsrIA, bsrJA, bsrValues, testContext );
+    }, common::Exception );
+
+    // block size 1 and 3 are not singular
+
+    BSRUtils::convertCSR2BSR( bsrIA, bsrJA, bsrValues, 3, 3, 1, csrIA, csrJA, csrValues, testContext );
+    BSRUtils::invertDiagonalBlocks( invDiagonal, 3, 1, bsrIA, bsrJA, bsrValues, testContext );
+
+    HArray<ValueType> expInv( { 1, 0.25, 1 } );
+
+    BOOST_TEST( hostReadAccess( invDiagonal ) == hostReadAccess( expInv ), boost::test_tools::per_element() );
+}
+
+/* ------------------------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( jacobiHaloTest, ValueType, scai_numeric_test_types )
+{
+    ContextPtr testContext = ContextFix::testContext;
+
+    SCAI_LOG_INFO( logger, "jacobi halo test @ " << *testContext )
+
+    HArray<IndexType> csrIA;
+    HArray<IndexType> csrJA;
+    HArray<ValueType> csrValues;
+
+    IndexType numRows;
+    IndexType numColumns;
+    IndexType numValues;
+
+    data1::getCSRTestData( numRows, numColumns, numValues, csrIA, csrJA, csrValues );
+
+    HArray<ValueType> oldSolution( { 3, -2, -2, 3, 1, 0, 2 }, testContext );
+    HArray<ValueType> diag( { 9, 8, 7, 6, 7, 8, 9 }, testContext );
+
+    const ValueType omega = 0.7;
+
+    for ( IndexType k = 0; k < nBlockSizes; ++k )
+    {
+        const IndexType blockSize = theBlockSizes[k];
+
+        HArray<IndexType> bsrIA;
+        HArray<IndexType> bsrJA;
+        HArray<ValueType> bsrValues;
+
+        BSRUtils::convertCSR2BSR( bsrIA, bsrJA, bsrValues, numRows, numColumns, blockSize, csrIA, csrJA, csrValues, testContext );
+
+        HArray<ValueType> res( numRows, ValueType( 0 ), testContext );
+
+        BSRUtils::jacobiHalo( res, omega, diag, oldSolution, numRows, numColumns, blockSize,
+                              bsrIA, bsrJA, bsrValues, testContext );
+
+        HArray<ValueType> expectedRes( numRows, ValueType( 0 ), testContext );
+
+        data1::getJacobiHaloResult( expectedRes, oldSolution, diag, omega );
+
+        BOOST_CHECK( HArrayUtils::maxDiffNorm( expectedRes, res ) < 0.001 );
+    }
+}
+
+/* ------------------------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_SUITE_END();
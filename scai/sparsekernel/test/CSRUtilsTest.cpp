@@ -556,6 +556,93 @@ BOOST_AUTO_TEST_CASE( compressTest )
 
 /* ------------------------------------------------------------------------------------------------------------------ */
 
+BOOST_AUTO_TEST_CASE( reverseCuthillMcKeeTest )
+{
+    ContextPtr testContext = ContextFix::testContext;
+
+    // chain 0 - 5 - 1 - 4 - 2 - 3, diagonal elements are first entries
+
+    HArray<IndexType> ia( { 0,    2,       5,       8,    10,      13,      16 }, testContext );
+    HArray<IndexType> ja( { 0, 5, 1, 5, 4, 2, 4, 3, 3, 2, 4, 1, 2, 5, 0, 1 }, testContext );
+
+    const IndexType numRows = ia.size() - 1;
+
+    HArray<IndexType> perm;
+
+    CSRUtils::reverseCuthillMcKee( perm, numRows, ia, ja, testContext );
+
+    HArray<IndexType> expPerm( { 3, 2, 4, 1, 5, 0 } );
+
+    BOOST_TEST( hostReadAccess( perm ) == hostReadAccess( expPerm ), per_element() );
+
+    // permuted pattern is tridiagonal
+
+    HArray<DefaultReal> values( ja.size(), 1, testContext );
+
+    CSRUtils::permute( ia, ja, values, perm, perm, testContext );
+
+    auto rIA = hostReadAccess( ia );
+    auto rJA = hostReadAccess( ja );
+
+    for ( IndexType i = 0; i < numRows; ++i )
+    {
+        BOOST_CHECK_EQUAL( rJA[rIA[i]], i );   // diagonal remains first
+
+        for ( IndexType jj = rIA[i]; jj < rIA[i + 1]; ++jj )
+        {
+            BOOST_CHECK( rJA[jj] >= i - 1 && rJA[jj] <= i + 1 );
+        }
+    }
+}
+
+/* ------------------------------------------------------------------------------------------------------------------ */
+
+BOOST_AUTO_TEST_CASE( permuteTest )
+{
+    typedef DefaultReal ValueType;
+
+    ContextPtr testContext = ContextFix::testContext;
+
+    //    1   -   2            6   4   5
+    //    -   3   -     ->     2   1   -
+    //    4   5   6            -   -   3
+
+    HArray<IndexType> ia(     { 0,    2, 3,       6 }, testContext );
+    HArray<IndexType> ja(     { 0, 2, 1, 0, 1, 2 }, testContext );
+    HArray<ValueType> values( { 1, 2, 3, 4, 5, 6 }, testContext );
+
+    HArray<IndexType> perm( { 2, 0, 1 }, testContext );
+
+    HArray<IndexType> expIA(     { 0,       3,    5, 6 } );
+    HArray<IndexType> expJA(     { 1, 2, 0, 1, 0, 2 } );
+    HArray<ValueType> expValues( { 4, 5, 6, 1, 2, 3 } );
+
+    CSRUtils::permute( ia, ja, values, perm, perm, testContext );
+
+    BOOST_TEST( hostReadAccess( ia ) == hostReadAccess( expIA ), per_element() );
+    BOOST_TEST( hostReadAccess( ja ) == hostReadAccess( expJA ), per_element() );
+    BOOST_TEST( hostReadAccess( values ) == hostReadAccess( expValues ), per_element() );
+
+    // permute only rows, take back the row permutation
+
+    HArray<IndexType> invPerm;
+    HArray<IndexType> noPerm;
+
+    HArrayUtils::inversePerm( invPerm, perm );
+
+    CSRUtils::permute( ia, ja, values, invPerm, noPerm, testContext );
+
+    HArray<IndexType> expIA1(     { 0,    2, 3,       6 } );
+    HArray<IndexType> expJA1(     { 1, 0, 2, 1, 2, 0 } );
+    HArray<ValueType> expValues1( { 1, 2, 3, 4, 5, 6 } );
+
+    BOOST_TEST( hostReadAccess( ia ) == hostReadAccess( expIA1 ), per_element() );
+    BOOST_TEST( hostReadAccess( ja ) == hostReadAccess( expJA1 ), per_element() );
+    BOOST_TEST( hostReadAccess( values ) == hostReadAccess( expValues1 ), per_element() );
+}
+
+/* ------------------------------------------------------------------------------------------------------------------ */
+
 BOOST_AUTO_TEST_CASE( diagonalTest )
 {
     typedef DefaultReal ValueType;
@@ -1149,6 +1236,139 @@ BOOST_AUTO_TEST_CASE_TEMPLATE( gemvTest, ValueType, scai_numeric_test_types )
 
 /* ------------------------------------------------------------------------------------- */
 
+BOOST_AUTO_TEST_CASE_TEMPLATE( symmetricTest, ValueType, scai_numeric_test_types )
+{
+    ContextPtr testContext = ContextFix::testContext;
+
+    //    4 -1  0  0  2
+    //   -1  4 -1  0  0
+    //    0 -1  4 -1  0
+    //    0  0 -1  4  0
+    //    2  0  0  0  3
+
+    const IndexType n = 5;
+
+    HArray<IndexType> csrIA( { 0, 3, 6, 9, 11, 13 }, testContext );
+    HArray<IndexType> csrJA( { 0, 1, 4, 0, 1, 2, 1, 2, 3, 2, 3, 0, 4 }, testContext );
+    HArray<ValueType> csrValues( { 4, -1, 2, -1, 4, -1, -1, 4, -1, -1, 4, 2, 3 }, testContext );
+
+    BOOST_CHECK( CSRUtils::isSymmetric( n, n, csrIA, csrJA, csrValues, testContext ) );
+
+    HArray<IndexType> upperIA;
+    HArray<IndexType> upperJA;
+    HArray<ValueType> upperValues;
+
+    CSRUtils::getUpperTriangle( upperIA, upperJA, upperValues, csrIA, csrJA, csrValues, testContext );
+
+    HArray<IndexType> expUpperIA( { 0, 3, 5, 7, 8, 9 } );
+    HArray<IndexType> expUpperJA( { 0, 1, 4, 1, 2, 2, 3, 3, 4 } );
+    HArray<ValueType> expUpperValues( { 4, -1, 2, 4, -1, 4, -1, 4, 3 } );
+
+    BOOST_TEST( hostReadAccess( upperIA ) == hostReadAccess( expUpperIA ), per_element() );
+    BOOST_TEST( hostReadAccess( upperJA ) == hostReadAccess( expUpperJA ), per_element() );
+    BOOST_TEST( hostReadAccess( upperValues ) == hostReadAccess( expUpperValues ), per_element() );
+
+    // expand the upper triangle must give the original data
+
+    HArray<IndexType> fullIA;
+    HArray<IndexType> fullJA;
+    HArray<ValueType> fullValues;
+
+    CSRUtils::expandSymmetric( fullIA, fullJA, fullValues, upperIA, upperJA, upperValues, testContext );
+
+    BOOST_TEST( hostReadAccess( fullIA ) == hostReadAccess( csrIA ), per_element() );
+    BOOST_TEST( hostReadAccess( fullJA ) == hostReadAccess( csrJA ), per_element() );
+    BOOST_TEST( hostReadAccess( fullValues ) == hostReadAccess( csrValues ), per_element() );
+
+    // symmetric gemv with upper triangle gives same result as gemv with full data
+
+    HArray<ValueType> x( { 3, -3, 2, -2, 1 }, testContext );
+    HArray<ValueType> y( { 1, -1, 2, -2, 1 }, testContext );
+
+    const ValueType alpha_values[] = { -3, 1, 0, 2 };
+    const ValueType beta_values[]  = { -2, 0, 1 };
+
+    const IndexType n_alpha = sizeof( alpha_values ) / sizeof( ValueType );
+    const IndexType n_beta  = sizeof( beta_values ) / sizeof( ValueType );
+
+    for ( IndexType icase = 0; icase < n_alpha * n_beta; ++icase )
+    {
+        ValueType alpha = alpha_values[icase % n_alpha ];
+        ValueType beta  = beta_values[icase / n_alpha ];
+
+        HArray<ValueType> expRes( testContext );
+        HArray<ValueType> res( testContext );
+
+        CSRUtils::gemv( expRes, alpha, x, beta, y, n, n, csrIA, csrJA, csrValues,
+                        common::MatrixOp::NORMAL, false, testContext );
+
+        CSRUtils::gemvSymmetric( res, alpha, x, beta, y, n, upperIA, upperJA, upperValues, false, testContext );
+
+        BOOST_TEST( hostReadAccess( res ) == hostReadAccess( expRes ), per_element() );
+    }
+
+    // changing one value destroys the symmetry
+
+    HArrayUtils::setVal( csrValues, 2, ValueType( 1 ) );
+
+    BOOST_CHECK( !CSRUtils::isSymmetric( n, n, csrIA, csrJA, csrValues, testContext ) );
+}
+
+/* ------------------------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( gramianTest, ValueType, scai_numeric_test_types )
+{
+    ContextPtr testContext = ContextFix::testContext;
+
+    // local part:   1  2    halo part:   0  1
+    //               0 -1                 2  0
+    //               3  0                 0  0
+
+    HArray<IndexType> csrIA( { 0, 2, 3, 4 }, testContext );
+    HArray<IndexType> csrJA( { 0, 1, 1, 0 }, testContext );
+    HArray<ValueType> csrValues( { 1, 2, -1, 3 }, testContext );
+
+    HArray<IndexType> haloIA( { 0, 1, 2, 2 }, testContext );
+    HArray<IndexType> haloJA( { 1, 0 }, testContext );
+    HArray<ValueType> haloValues( { 1, 2 }, testContext );
+
+    HArray<ValueType> x( { 1, 2 }, testContext );
+    HArray<ValueType> haloX( { -1, 1 }, testContext );
+
+    const ValueType alpha = 2;
+
+    HArray<ValueType> result;
+    HArray<ValueType> haloResult;
+
+    // A * x = ( 6, -4, 3 ), A' * A * x = ( 15, 16, -8, 6 )
+
+    CSRUtils::gemvGramian( result, haloResult, alpha, x, haloX, csrIA, csrJA, csrValues,
+                           haloIA, haloJA, haloValues, testContext );
+
+    HArray<ValueType> expResult( { 30, 32 } );
+    HArray<ValueType> expHaloResult( { -16, 12 } );
+
+    BOOST_TEST( hostReadAccess( result ) == hostReadAccess( expResult ), per_element() );
+    BOOST_TEST( hostReadAccess( haloResult ) == hostReadAccess( expHaloResult ), per_element() );
+
+    // without halo: A * x = ( 5, -2, 3 ), A' * A * x = ( 14, 12 )
+
+    HArray<IndexType> noIA;
+    HArray<IndexType> noJA;
+    HArray<ValueType> noValues;
+    HArray<ValueType> noX;
+
+    CSRUtils::gemvGramian( result, haloResult, alpha, x, noX, csrIA, csrJA, csrValues,
+                           noIA, noJA, noValues, testContext );
+
+    expResult = HArray<ValueType>( { 28, 24 } );
+
+    BOOST_TEST( hostReadAccess( result ) == hostReadAccess( expResult ), per_element() );
+    BOOST_CHECK_EQUAL( haloResult.size(), IndexType( 0 ) );
+}
+
+/* ------------------------------------------------------------------------------------- */
+
 BOOST_AUTO_TEST_CASE_TEMPLATE( gemvTransTest, ValueType, scai_numeric_test_types )
 {
     ContextPtr testContext = ContextFix::testContext;
@@ -1205,6 +1425,119 @@ BOOST_AUTO_TEST_CASE_TEMPLATE( gemvTransTest, ValueType, scai_numeric_test_types
 
 /* ------------------------------------------------------------------------------------- */
 
+BOOST_AUTO_TEST_CASE_TEMPLATE( mixedGEMVTest, ValueType, scai_numeric_test_types )
+{
+    // matrix values are float, vectors and results have ValueType
+
+    ContextPtr testContext = ContextFix::testContext;
+
+    HArray<IndexType> csrIA( testContext );
+    HArray<IndexType> csrJA( testContext );
+    HArray<float> csrValues( testContext );
+
+    IndexType numRows;
+    IndexType numColumns;
+    IndexType numValues;
+
+    data1::getCSRTestData( numRows, numColumns, numValues, csrIA, csrJA, csrValues );
+
+    const ValueType alpha_values[] = { -3, 1, 2 };
+    const ValueType beta_values[]  = { -2, 0, 1 };
+
+    const IndexType n_alpha = sizeof( alpha_values ) / sizeof( ValueType );
+    const IndexType n_beta  = sizeof( beta_values ) / sizeof( ValueType );
+
+    for ( IndexType icase = 0; icase < 2 * n_alpha * n_beta; ++icase )
+    {
+        ValueType alpha = alpha_values[icase % n_alpha ];
+        ValueType beta  = beta_values[( icase / n_alpha ) % n_beta ];
+
+        auto op = icase < n_alpha * n_beta ? common::MatrixOp::NORMAL : common::MatrixOp::TRANSPOSE;
+
+        HArray<ValueType> x( { 3, -3, 2, -2 }, testContext );
+        HArray<ValueType> y( { 1, -1, 2, -2, 1, 1, -1 }, testContext );
+
+        if ( op == common::MatrixOp::TRANSPOSE )
+        {
+            x = HArray<ValueType>( { 3, -2, -2, 3, 1, 0, 1 }, testContext );
+            y = HArray<ValueType>( { 1, -1, 2, -2 }, testContext );
+        }
+
+        HArray<ValueType> res( testContext );
+
+        CSRUtils::gemvMixed( res, alpha, x, beta, y, numRows, numColumns,
+                             csrIA, csrJA, csrValues, op, testContext );
+
+        HArray<ValueType> expectedRes = op == common::MatrixOp::NORMAL ? data1::getGEMVNormalResult( alpha, x, beta, y )
+                                                                         : data1::getGEMVTransposeResult( alpha, x, beta, y );
+
+        BOOST_TEST( hostReadAccess( res ) == hostReadAccess( expectedRes ), per_element() );
+    }
+}
+
+/* ------------------------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( compactGEMVTest, ValueType, scai_numeric_test_types )
+{
+    // offset and column arrays are converted to LocalIndexType
+
+    ContextPtr testContext = ContextFix::testContext;
+
+    HArray<IndexType> csrIA( testContext );
+    HArray<IndexType> csrJA( testContext );
+    HArray<ValueType> csrValues( testContext );
+
+    IndexType numRows;
+    IndexType numColumns;
+    IndexType numValues;
+
+    data1::getCSRTestData( numRows, numColumns, numValues, csrIA, csrJA, csrValues );
+
+    HArray<LocalIndexType> compactIA;
+    HArray<LocalIndexType> compactJA;
+
+    CSRUtils::compactIndexes( compactIA, csrIA );
+    CSRUtils::compactIndexes( compactJA, csrJA );
+
+    BOOST_REQUIRE_EQUAL( compactIA.size(), numRows + 1 );
+    BOOST_REQUIRE_EQUAL( compactJA.size(), numValues );
+
+    const ValueType alpha_values[] = { -3, 1, 2 };
+    const ValueType beta_values[]  = { -2, 0, 1 };
+
+    const IndexType n_alpha = sizeof( alpha_values ) / sizeof( ValueType );
+    const IndexType n_beta  = sizeof( beta_values ) / sizeof( ValueType );
+
+    for ( IndexType icase = 0; icase < 2 * n_alpha * n_beta; ++icase )
+    {
+        ValueType alpha = alpha_values[icase % n_alpha ];
+        ValueType beta  = beta_values[( icase / n_alpha ) % n_beta ];
+
+        auto op = icase < n_alpha * n_beta ? common::MatrixOp::NORMAL : common::MatrixOp::TRANSPOSE;
+
+        HArray<ValueType> x( { 3, -3, 2, -2 }, testContext );
+        HArray<ValueType> y( { 1, -1, 2, -2, 1, 1, -1 }, testContext );
+
+        if ( op == common::MatrixOp::TRANSPOSE )
+        {
+            x = HArray<ValueType>( { 3, -2, -2, 3, 1, 0, 1 }, testContext );
+            y = HArray<ValueType>( { 1, -1, 2, -2 }, testContext );
+        }
+
+        HArray<ValueType> res( testContext );
+
+        CSRUtils::gemvCompact( res, alpha, x, beta, y, numRows, numColumns,
+                               compactIA, compactJA, csrValues, op, testContext );
+
+        HArray<ValueType> expectedRes = op == common::MatrixOp::NORMAL ? data1::getGEMVNormalResult( alpha, x, beta, y )
+                                                                         : data1::getGEMVTransposeResult( alpha, x, beta, y );
+
+        BOOST_TEST( hostReadAccess( res ) == hostReadAccess( expectedRes ), per_element() );
+    }
+}
+
+/* ------------------------------------------------------------------------------------- */
+
 BOOST_AUTO_TEST_CASE_TEMPLATE( spGEMVTest, ValueType, scai_numeric_test_types )
 {
     ContextPtr testContext = ContextFix::testContext;
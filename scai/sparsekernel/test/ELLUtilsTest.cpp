@@ -1302,6 +1302,139 @@ BOOST_AUTO_TEST_CASE_TEMPLATE( gemvTest, ValueType, scai_numeric_test_types )
 
 /* ------------------------------------------------------------------------------------- */
 
+BOOST_AUTO_TEST_CASE_TEMPLATE( mixedGEMVTest, ValueType, scai_numeric_test_types )
+{
+    // matrix values are float, vectors and results have ValueType
+
+    ContextPtr testContext = ContextFix::testContext;
+
+    HArray<IndexType> ellIA( testContext );
+    HArray<IndexType> ellJA( testContext );
+    HArray<float> ellValues( testContext );
+
+    IndexType numRows;
+    IndexType numColumns;
+    IndexType numValuesPerRow;
+
+    data1::getELLTestData( numRows, numColumns, numValuesPerRow, ellIA, ellJA, ellValues );
+
+    const ValueType alpha_values[] = { -3, 1, 2 };
+    const ValueType beta_values[]  = { -2, 0, 1 };
+
+    const IndexType n_alpha = sizeof( alpha_values ) / sizeof( ValueType );
+    const IndexType n_beta  = sizeof( beta_values ) / sizeof( ValueType );
+
+    for ( IndexType icase = 0; icase < 2 * n_alpha * n_beta; ++icase )
+    {
+        ValueType alpha = alpha_values[icase % n_alpha ];
+        ValueType beta  = beta_values[( icase / n_alpha ) % n_beta ];
+
+        auto op = icase < n_alpha * n_beta ? common::MatrixOp::NORMAL : common::MatrixOp::TRANSPOSE;
+
+        HArray<ValueType> x( { 3, -3, 2, -2 }, testContext );
+        HArray<ValueType> y( { 1, -1, 2, -2, 1, 1, -1 }, testContext );
+
+        if ( op == common::MatrixOp::TRANSPOSE )
+        {
+            x = HArray<ValueType>( { 3, -2, -2, 3, 1, 0, 1 }, testContext );
+            y = HArray<ValueType>( { 1, -1, 2, -2 }, testContext );
+        }
+
+        HArray<ValueType> res( testContext );
+
+        ELLUtils::gemvMixed( res, alpha, x, beta, y, numRows, numColumns, numValuesPerRow,
+                             ellIA, ellJA, ellValues, op, testContext );
+
+        HArray<ValueType> expectedRes = op == common::MatrixOp::NORMAL ? data1::getGEMVNormalResult( alpha, x, beta, y )
+                                                                         : data1::getGEMVTransposeResult( alpha, x, beta, y );
+
+        BOOST_TEST( hostReadAccess( res ) == hostReadAccess( expectedRes ), per_element() );
+    }
+}
+
+/* ------------------------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( gemmSDTest, ValueType, scai_numeric_test_types )
+{
+    ContextPtr testContext = ContextFix::testContext;
+
+    HArray<IndexType> ellIA( testContext );
+    HArray<IndexType> ellJA( testContext );
+    HArray<ValueType> ellValues( testContext );
+
+    IndexType numRows;
+    IndexType numColumns;
+    IndexType numValuesPerRow;
+
+    data1::getELLTestData( numRows, numColumns, numValuesPerRow, ellIA, ellJA, ellValues );
+
+    // we compare gemmSD with two individual gemv operations
+
+    const IndexType nVectors = 2;
+
+    HArray<ValueType> x( { 3, -3, 2, -2,
+                           2, -1, 1,  2 }, testContext );
+
+    HArray<ValueType> y( { 1, -1, 2, -2, 1, 1, -1 ,
+                           2, -3, 4,  1, 5, 3,  2  }, testContext );
+
+    SCAI_ASSERT_EQ_ERROR( numColumns * nVectors, x.size(), "size mismatch" );
+    SCAI_ASSERT_EQ_ERROR( numRows * nVectors, y.size(), "size mismatch" );
+
+    HArray<ValueType> x1( numColumns );  // becomes x[ :, 0 ]
+    HArray<ValueType> x2( numColumns );  // becomes x[ :, 1 ]
+    HArray<ValueType> y1( numRows ) ;    // becomes y[ :, 0 ]
+    HArray<ValueType> y2( numRows );     // becomes y[ :, 1 ]
+
+    HArrayUtils::setArraySection( y1, 0, 1, y, 0, nVectors, numRows );
+    HArrayUtils::setArraySection( y2, 0, 1, y, 1, nVectors, numRows );
+    HArrayUtils::setArraySection( x1, 0, 1, x, 0, nVectors, numColumns );
+    HArrayUtils::setArraySection( x2, 0, 1, x, 1, nVectors, numColumns );
+
+    const ValueType alpha_values[] = { -3, 1, -1, 0, 2 };
+    const ValueType beta_values[]  = { -2, 0, 1 };
+
+    const IndexType n_alpha = sizeof( alpha_values ) / sizeof( ValueType );
+    const IndexType n_beta  = sizeof( beta_values ) / sizeof( ValueType );
+
+    for ( IndexType icase = 0; icase < n_alpha * n_beta; ++icase )
+    {
+        ValueType alpha = alpha_values[icase % n_alpha ];
+        ValueType beta  = beta_values[icase / n_alpha ];
+
+        HArray<ValueType> res( testContext );
+
+        ELLUtils::gemmSD( res, alpha, x, beta, y, numRows, numColumns, nVectors, numValuesPerRow,
+                          ellIA, ellJA, ellValues, testContext );
+
+        HArray<ValueType> expectedRes1 = data1::getGEMVNormalResult( alpha, x1, beta, y1 );
+        HArray<ValueType> expectedRes2 = data1::getGEMVNormalResult( alpha, x2, beta, y2 );
+
+        {
+            auto rComputed = hostReadAccess( res );
+            auto rExpected1 = hostReadAccess( expectedRes1 );
+            auto rExpected2 = hostReadAccess( expectedRes2 );
+
+            for ( IndexType i = 0; i < numRows; ++i )
+            {
+                BOOST_CHECK_EQUAL( rExpected1[i], rComputed[ nVectors * i + 0 ] );
+                BOOST_CHECK_EQUAL( rExpected2[i], rComputed[ nVectors * i + 1 ] );
+            }
+        }
+
+        // alias of result and y
+
+        HArray<ValueType> yAlias( y );
+
+        ELLUtils::gemmSD( yAlias, alpha, x, beta, yAlias, numRows, numColumns, nVectors, numValuesPerRow,
+                          ellIA, ellJA, ellValues, testContext );
+
+        BOOST_TEST( hostReadAccess( res ) == hostReadAccess( yAlias ), per_element() );
+    }
+}
+
+/* ------------------------------------------------------------------------------------- */
+
 BOOST_AUTO_TEST_CASE_TEMPLATE( gevmTest, ValueType, scai_numeric_test_types )
 {
     ContextPtr testContext = ContextFix::testContext;
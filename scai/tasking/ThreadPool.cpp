@@ -38,6 +38,8 @@
 #include <scai/common/OpenMP.hpp>
 
 #include <memory>
+#include <chrono>
+#include <cstdint>
 
 namespace scai
 {
@@ -54,6 +56,191 @@ SCAI_LOG_DEF_LOGGER( ThreadPool::logger, "ThreadPool" )
 
 /* ------------------------------------------------------------------------- */
 
+/** Number of attempts to find a task before an idle worker thread goes to sleep */
+
+static const int MAX_IDLE_SPINS = 64;
+
+/** Pool and worker id of the calling thread, used to identify recursive scheduling */
+
+static thread_local const ThreadPool* theCurrentPool = NULL;
+static thread_local int theCurrentWorker = -1;
+
+/* ------------------------------------------------------------------------- */
+
+/** Lock-free work stealing deque (Chase, Lev) and a lock-free list for incoming tasks.
+ *
+ *  Only the owner thread pushes and pops at the bottom of the deque, other threads steal at the top.
+ *  Any thread might add a task to the incoming list, the whole list is always taken at once.
+ *
+ *  The memory orderings follow N.M. Le et al., "Correct and Efficient Work-Stealing for Weak Memory Models", 2013.
+ */
+struct ThreadPool::WorkerQueue
+{
+    struct Array
+    {
+        Array( const int64_t n ) : size( n ), buffer( new std::atomic<ThreadPoolTask*>[n] )
+        {
+        }
+
+        ThreadPoolTask* get( const int64_t i ) const
+        {
+            return buffer[i & ( size - 1 )].load( std::memory_order_relaxed );
+        }
+
+        void put( const int64_t i, ThreadPoolTask* task )
+        {
+            buffer[i & ( size - 1 )].store( task, std::memory_order_relaxed );
+        }
+
+        int64_t size;   // always a power of 2
+
+        std::unique_ptr<std::atomic<ThreadPoolTask*>[]> buffer;
+    };
+
+    WorkerQueue() : top( 0 ), bottom( 0 ), incoming( NULL )
+    {
+        arrays.push_back( std::unique_ptr<Array>( new Array( 64 ) ) );
+        array.store( arrays.back().get(), std::memory_order_relaxed );
+    }
+
+    /** Push a task at the bottom, only called by the owner */
+
+    void push( ThreadPoolTask* task )
+    {
+        int64_t b = bottom.load( std::memory_order_relaxed );
+        int64_t t = top.load( std::memory_order_acquire );
+        Array* a = array.load( std::memory_order_relaxed );
+
+        if ( b - t > a->size - 1 )
+        {
+            // grow the array, old arrays are kept as thieves might still read from them
+
+            Array* newArray = new Array( 2 * a->size );
+
+            for ( int64_t i = t; i < b; ++i )
+            {
+                newArray->put( i, a->get( i ) );
+            }
+
+            arrays.push_back( std::unique_ptr<Array>( newArray ) );
+            array.store( newArray, std::memory_order_release );
+            a = newArray;
+        }
+
+        a->put( b, task );
+        std::atomic_thread_fence( std::memory_order_release );
+        bottom.store( b + 1, std::memory_order_relaxed );
+    }
+
+    /** Pop a task at the bottom, only called by the owner */
+
+    ThreadPoolTask* pop()
+    {
+        int64_t b = bottom.load( std::memory_order_relaxed ) - 1;
+        Array* a = array.load( std::memory_order_relaxed );
+        bottom.store( b, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        int64_t t = top.load( std::memory_order_relaxed );
+
+        ThreadPoolTask* task = NULL;
+
+        if ( t <= b )
+        {
+            task = a->get( b );
+
+            if ( t == b )
+            {
+                // last element, race with thieves
+
+                if ( !top.compare_exchange_strong( t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed ) )
+                {
+                    task = NULL;
+                }
+
+                bottom.store( b + 1, std::memory_order_relaxed );
+            }
+        }
+        else
+        {
+            bottom.store( b + 1, std::memory_order_relaxed );
+        }
+
+        return task;
+    }
+
+    /** Steal a task at the top, might be called by any thread */
+
+    ThreadPoolTask* steal()
+    {
+        int64_t t = top.load( std::memory_order_acquire );
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        int64_t b = bottom.load( std::memory_order_acquire );
+
+        if ( t < b )
+        {
+            Array* a = array.load( std::memory_order_acquire );
+
+            ThreadPoolTask* task = a->get( t );
+
+            if ( top.compare_exchange_strong( t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed ) )
+            {
+                return task;
+            }
+        }
+
+        return NULL;
+    }
+
+    /** Add a task to the incoming list, might be called by any thread */
+
+    void add( ThreadPoolTask* task )
+    {
+        ThreadPoolTask* head = incoming.load( std::memory_order_relaxed );
+
+        do
+        {
+            task->mNext = head;
+        }
+        while ( !incoming.compare_exchange_weak( head, task, std::memory_order_release, std::memory_order_relaxed ) );
+    }
+
+    /** Take all incoming tasks, returns them in the order they have been added */
+
+    ThreadPoolTask* takeIncoming()
+    {
+        if ( incoming.load( std::memory_order_relaxed ) == NULL )
+        {
+            return NULL;
+        }
+
+        ThreadPoolTask* list = incoming.exchange( NULL, std::memory_order_acquire );
+
+        // reverse the list
+
+        ThreadPoolTask* first = NULL;
+
+        while ( list != NULL )
+        {
+            ThreadPoolTask* next = list->mNext;
+            list->mNext = first;
+            first = list;
+            list = next;
+        }
+
+        return first;
+    }
+
+    std::atomic<int64_t> top;
+    std::atomic<int64_t> bottom;
+    std::atomic<Array*> array;
+
+    std::vector<std::unique_ptr<Array> > arrays;   // all allocated arrays, only accessed by owner
+
+    std::atomic<ThreadPoolTask*> incoming;
+};
+
+/* ------------------------------------------------------------------------- */
+
 shared_ptr<ThreadPoolTask> ThreadPoolTask::create(
     function<void()> work,
     unsigned int taskId,
@@ -74,6 +261,8 @@ shared_ptr<ThreadPoolTask> ThreadPoolTask::create(
     task->mState = DEFINED;
     task->mTaskId = taskId;
     task->mException = false;
+    task->mPredecessors = 0;
+    task->mNext = NULL;
     return task;
 }
 
@@ -85,13 +274,21 @@ static void threadRoutine( ThreadPool::ThreadData& args )
     args.pool->worker( args.i );
 }
 
-ThreadPool::ThreadPool( int size )
+ThreadPool::ThreadPool( int size ) :
+
+    mTaskId( 0 ),
+    mNextWorker( 0 ),
+    mPending( 0 ),
+    mActive( 0 ),
+    mNumSleeping( 0 ),
+    mNumWaiting( 0 ),
+    mShutdown( false )
 {
     SCAI_LOG_INFO( logger, "Construct thread pool with " << size << " threads" )
     mMaxSize = size;
     mThreads.reset( new std::thread[ mMaxSize ] );
     mThreadArgs.reset( new ThreadData[ mMaxSize ] );
-    mTaskId = 0; // Initialize counter for task ids
+    mQueues.reset( new WorkerQueue[ mMaxSize ] );
 
     // Create all threads just from the beginning, on demand might be possible later
 
@@ -105,64 +302,330 @@ ThreadPool::ThreadPool( int size )
 
 /* ------------------------------------------------------------------------- */
 
+int ThreadPool::getWorkerId() const
+{
+    return theCurrentPool == this ? theCurrentWorker : -1;
+}
+
+/* ------------------------------------------------------------------------- */
+
+void ThreadPool::enqueue( ThreadPoolTask* task, const int worker )
+{
+    task->mState = ThreadPoolTask::QUEUED;
+
+    if ( worker >= 0 )
+    {
+        // recursive task or continuation, worker pushes it in its own deque
+
+        mQueues[worker].push( task );
+    }
+    else if ( mMaxSize > 0 )
+    {
+        unsigned int target = mNextWorker.fetch_add( 1, std::memory_order_relaxed ) % mMaxSize;
+        mQueues[target].add( task );
+    }
+    else
+    {
+        COMMON_THROWEXCEPTION( "thread pool has no worker threads" )
+    }
+
+    mPending.fetch_add( 1 );
+
+    SCAI_LOG_DEBUG( logger, "Added task " << task->mTaskId << " to task queue" )
+
+    //  notify one waiting worker, lock only if there is one
+
+    if ( mNumSleeping.load() > 0 )
+    {
+        std::unique_lock<std::mutex> lock( mSleepMutex );
+        mNotifyTask.notify_one();
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
 shared_ptr<ThreadPoolTask> ThreadPool::schedule( std::function<void()> work, int numOmpThreads /* = 0 */ )
+{
+    std::vector<shared_ptr<ThreadPoolTask> > noDependencies;
+
+    return schedule( work, noDependencies, numOmpThreads );
+}
+
+/* ------------------------------------------------------------------------- */
+
+shared_ptr<ThreadPoolTask> ThreadPool::schedule(
+    std::function<void()> work,
+    const std::vector<shared_ptr<ThreadPoolTask> >& dependencies,
+    int numOmpThreads )
 {
     SCAI_REGION( "ThreadPool::schedule" )
-    std::thread::id thisThread = std::this_thread::get_id();
-    bool isRecursiveTask = false;
 
-    for ( int i = 0; i < mMaxSize; ++i )
+    shared_ptr<ThreadPoolTask> task = ThreadPoolTask::create( work, mTaskId++, numOmpThreads );
+
+    // the pool keeps the task alive until it is finished
+
+    task->mSelf = task;
+
+    mActive.fetch_add( 1 );
+
+    // one additional predecessor avoids that the task is started before all dependencies are registered
+
+    task->mPredecessors = 1;
+
+    for ( size_t i = 0; i < dependencies.size(); ++i )
     {
-        if ( mThreads[i].get_id() == thisThread )
+        ThreadPoolTask& dep = *dependencies[i];
+
+        std::unique_lock<std::mutex> lock( dep.mMutex );
+
+        if ( dep.mState != ThreadPoolTask::FINISHED )
         {
-            isRecursiveTask = true;
-            break;
+            task->mPredecessors++;
+            dep.mSuccessors.push_back( task );
         }
     }
 
-    shared_ptr<ThreadPoolTask> task = ThreadPoolTask::create( work, mTaskId++, numOmpThreads );
-
-    if ( isRecursiveTask )
+    if ( --task->mPredecessors == 0 )
     {
-        SCAI_LOG_WARN( logger, "Executing recursive taks synchronously to avoid deadlocks." )
-        work();
-        task->mState = ThreadPoolTask::FINISHED;
-        return task;
+        enqueue( task.get(), getWorkerId() );
     }
 
-    std::unique_lock<std::mutex> lock( mTaskQueueMutex );
-    mTaskQueue.push( task );
-    SCAI_LOG_DEBUG( logger, "Added task " << task->mTaskId << " to task queue" )
-    task->mState = ThreadPoolTask::QUEUED;
-    //  notifiy one waiting worker
-    mNotifyTask.notify_one();
     return task;
 }
 
 /* ------------------------------------------------------------------------- */
 
-void ThreadPool::wait( shared_ptr<ThreadPoolTask> task )
+shared_ptr<ThreadPoolTask> ThreadPool::then( shared_ptr<ThreadPoolTask> task, std::function<void()> work, int numOmpThreads )
 {
-    if ( !task )
+    SCAI_ASSERT_ERROR( task, "NULL pointer for task" )
+
+    std::vector<shared_ptr<ThreadPoolTask> > dependencies( 1, task );
+
+    return schedule( work, dependencies, numOmpThreads );
+}
+
+/* ------------------------------------------------------------------------- */
+
+ThreadPoolTask* ThreadPool::findTask( const int worker )
+{
+    if ( mMaxSize == 0 )
     {
-        COMMON_THROWEXCEPTION( "NULL pointer for task" )
+        return NULL;
     }
 
-    SCAI_LOG_DEBUG( logger, "wait on task id = " << task->mTaskId << ", state = " << task->mState )
+    ThreadPoolTask* task = NULL;
 
-    while ( task->mState != ThreadPoolTask::FINISHED )
+    if ( worker >= 0 )
     {
+        WorkerQueue& own = mQueues[worker];
+
+        task = own.pop();
+
+        if ( task )
+        {
+            return task;
+        }
+
+        // move the incoming tasks into the own deque
+
+        ThreadPoolTask* list = own.takeIncoming();
+
+        if ( list )
+        {
+            // first task is executed directly, others are pushed in reverse order as pop takes the last one
+
+            task = list;
+            list = list->mNext;
+
+            std::vector<ThreadPoolTask*> others;
+
+            for ( ; list != NULL; list = list->mNext )
+            {
+                others.push_back( list );
+            }
+
+            for ( size_t k = others.size(); k-- > 0; )
+            {
+                own.push( others[k] );
+            }
+
+            return task;
+        }
+    }
+
+    // steal from the other workers, start at a different worker each time
+
+    const int start = worker >= 0 ? worker + 1 : static_cast<int>( mNextWorker.load( std::memory_order_relaxed ) );
+
+    for ( int k = 0; k < mMaxSize; ++k )
+    {
+        const int victim = ( start + k ) % mMaxSize;
+
+        if ( victim == worker )
+        {
+            continue;
+        }
+
+        task = mQueues[victim].steal();
+
+        if ( task )
+        {
+            return task;
+        }
+
+        if ( worker >= 0 )
+        {
+            // take over the incoming tasks of a busy worker
+
+            ThreadPoolTask* list = mQueues[victim].takeIncoming();
+
+            if ( list )
+            {
+                for ( ThreadPoolTask* next = list->mNext; next != NULL; )
+                {
+                    ThreadPoolTask* t = next;
+                    next = next->mNext;
+                    mQueues[worker].add( t );
+                }
+
+                return list;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/* ------------------------------------------------------------------------- */
+
+void ThreadPool::execute( ThreadPoolTask* task, const int worker, int& ompThreads )
+{
+    mPending.fetch_sub( 1 );
+
+    SCAI_LOG_DEBUG( logger,
+                    "thread " << worker << " runs task " << task->mTaskId << " with " << task->ompThreads << " OMP threads" )
+
+    task->mState = ThreadPoolTask::RUNNING;
+
+    if ( task->ompThreads != ompThreads )
+    {
+        omp_set_num_threads( task->ompThreads );
+        ompThreads = task->ompThreads;
+    }
+
+    try
+    {
+        task->mWork();
+    }
+    catch ( common::Exception& ex )
+    {
+        SCAI_LOG_WARN( logger, "worker thread got exception, has been caught: " << ex.what() )
+        task->mException = true;
+    }
+    catch ( ... )
+    {
+        SCAI_LOG_WARN( logger, "worker thread got exception, has been caught" )
+        task->mException = true;
+    }
+
+    std::vector<shared_ptr<ThreadPoolTask> > successors;
+
+    {
+        std::unique_lock<std::mutex> lock( task->mMutex );
+        task->mState = ThreadPoolTask::FINISHED;
+        successors.swap( task->mSuccessors );
+    }
+
+    SCAI_LOG_DEBUG( logger, "thread " << worker << " finished task " << task->mTaskId )
+
+    // start the continuations whose dependencies are all finished now
+
+    for ( size_t i = 0; i < successors.size(); ++i )
+    {
+        if ( --successors[i]->mPredecessors == 0 )
+        {
+            enqueue( successors[i].get(), worker );
+        }
+    }
+
+    // release the reference of the pool, task might be freed here
+
+    shared_ptr<ThreadPoolTask> self;
+    self.swap( task->mSelf );
+
+    mActive.fetch_sub( 1 );
+
+    // notify threads waiting on a finished task, lock only if there is one
+
+    if ( mNumWaiting.load() > 0 )
+    {
+        std::unique_lock<std::mutex> lock( mNotifyFinishMutex );
+        mNotifyFinished.notify_all();
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+void ThreadPool::helpUntil( const std::function<bool()>& done )
+{
+    const int worker = getWorkerId();
+
+    // execution of tasks by a thread not belonging to the pool must not change its OpenMP threads
+
+    const int ompThreads = omp_get_max_threads();
+
+    int currentOmpThreads = ompThreads;
+
+    while ( !done() )
+    {
+        ThreadPoolTask* task = findTask( worker );
+
+        if ( task )
+        {
+            execute( task, worker, currentOmpThreads );
+            continue;
+        }
+
         std::unique_lock<std::mutex> lock( mNotifyFinishMutex );
 
-        if ( task->mState != ThreadPoolTask::FINISHED )
+        mNumWaiting++;
+
+        if ( !done() )
         {
-            // wait on signal for a finishing thread
+            // timeout as new tasks might become available for helping
             // Attention: do not output here, as worker thread might finish and notify before wait
-            mNotifyFinished.wait( lock );
+
+            mNotifyFinished.wait_for( lock, std::chrono::milliseconds( 1 ) );
         }
 
-        SCAI_LOG_DEBUG( logger, "notified, task state = " << task->mState )
+        mNumWaiting--;
+    }
+
+    if ( currentOmpThreads != ompThreads )
+    {
+        omp_set_num_threads( ompThreads );
+    }
+}
+
+/* ------------------------------------------------------------------------- */
+
+void ThreadPool::wait( shared_ptr<ThreadPoolTask> task )
+{
+    if ( !task )
+    {
+        COMMON_THROWEXCEPTION( "NULL pointer for task" )
+    }
+
+    SCAI_LOG_DEBUG( logger, "wait on task id = " << task->mTaskId << ", state = " << task->mState )
+
+    if ( task->mState == ThreadPoolTask::FINISHED )
+    {
+        return;
     }
+
+    helpUntil( [&task]() { return task->mState == ThreadPoolTask::FINISHED; } );
+
+    SCAI_LOG_DEBUG( logger, "wait on task id = " << task->mTaskId << " done" )
 }
 
 /* ------------------------------------------------------------------------- */
@@ -170,78 +633,63 @@ void ThreadPool::wait( shared_ptr<ThreadPoolTask> task )
 void ThreadPool::worker( int id )
 {
     // This method will be executed by all threads in the pool
-    // Each thread picks up a task if available in the task queue
-    // No busy wait, waits on signal mNotifyTask
+    // Each thread picks up a task from its own queue or steals one
+    // No busy wait if there is no work at all, waits on signal mNotifyTask
+
     SCAI_LOG_INFO( logger, "worker thread " << id << " starts" )
-    mWorkerState = WORKING;
+
+    theCurrentPool   = this;
+    theCurrentWorker = id;
+
     int ompThreads = -1;
-    // wait for a new task
+
+    int idleSpins = 0;
 
     while ( true )
     {
-        shared_ptr<ThreadPoolTask> task;
-        // pick up a new task if available
-        {
-            std::unique_lock<std::mutex> lock( mTaskQueueMutex );
+        ThreadPoolTask* task = findTask( id );
 
-            if ( mTaskQueue.empty() )
-            {
-                // Instead of busy wait this thread waits on notification
-                SCAI_LOG_DEBUG( logger, "worker thread " << id << " waits on notify for new task" )
-                mWorkerState = WAITING;
-                mNotifyTask.wait( lock );
-                mWorkerState = WORKING;
-                SCAI_LOG_DEBUG( logger, "worker thread " << id << " notified about a new task" )
-            }
-            else
-            {
-                task = mTaskQueue.front();
-                mTaskQueue.pop();
+        if ( task )
+        {
+            execute( task, id, ompThreads );
+            idleSpins = 0;
+            continue;
+        }
 
-                if ( !task )
-                {
-                    SCAI_LOG_DEBUG( logger, "worker thread " << id << " picked shutdown task" )
-                    // this is the shutdown task
-                    break;
-                }
-            }
+        if ( mShutdown.load() )
+        {
+            break;
         }
 
-        if ( task )
+        if ( ++idleSpins < MAX_IDLE_SPINS || mPending.load() > 0 )
         {
-            SCAI_LOG_DEBUG( logger,
-                            "worker thread " << id << " runs task " << task->mTaskId << " with " << task->ompThreads << " OMP threads" )
-            task->mState = ThreadPoolTask::RUNNING;
+            std::this_thread::yield();
+            continue;
+        }
 
-            if ( task->ompThreads != ompThreads )
-            {
-                omp_set_num_threads( task->ompThreads );
-                ompThreads = task->ompThreads;
-            }
+        // Instead of busy wait this thread waits on notification
 
-            try
-            {
-                task->mWork();
-            }
-            catch ( common::Exception& ex )
-            {
-                SCAI_LOG_WARN( logger, "worker thread got exception, has been caught: " << ex.what() )
-                task->mException = true;
-            }
-            catch ( ... )
-            {
-                SCAI_LOG_WARN( logger, "worker thread got exception, has been caught" )
-                task->mException = true;
-            }
+        std::unique_lock<std::mutex> lock( mSleepMutex );
+
+        mNumSleeping++;
 
-            std::unique_lock<std::mutex> lock( mNotifyFinishMutex );
-            task->mState = ThreadPoolTask::FINISHED;
-            SCAI_LOG_DEBUG( logger, "worker thread " << id << " finished task " << task->mTaskId )
-            // notify threads waiting on a finished task
-            mNotifyFinished.notify_all();
+        SCAI_LOG_DEBUG( logger, "worker thread " << id << " waits on notify for new task" )
+
+        while ( mPending.load() == 0 && !mShutdown.load() )
+        {
+            mNotifyTask.wait( lock );
         }
+
+        mNumSleeping--;
+
+        SCAI_LOG_DEBUG( logger, "worker thread " << id << " notified about a new task" )
+
+        idleSpins = 0;
     }
 
+    theCurrentPool   = NULL;
+    theCurrentWorker = -1;
+
     // worker is finished
     SCAI_LOG_INFO( logger, "worker thread " << id << " finishes" )
 }
@@ -250,22 +698,27 @@ void ThreadPool::worker( int id )
 
 void ThreadPool::shutdown()
 {
-    SCAI_LOG_INFO( logger, "shut down " << mMaxSize << " threads, "
-                   << mTaskQueue.size() << " tasks in queue" )
-    shared_ptr<ThreadPoolTask> shutdownTask; // NULL pointer
+    if ( mShutdown.load() )
     {
-        // lock access to the task queue before adding shutdown tasks
-        std::unique_lock<std::mutex> lock( mTaskQueueMutex );
+        return;   // already done
+    }
 
-        for ( int i = 0; i < mMaxSize; i++ )
-        {
-            mTaskQueue.push( shutdownTask );
-        }
+    SCAI_LOG_INFO( logger, "shut down " << mMaxSize << " threads, "
+                   << mActive.load() << " tasks not finished" )
+
+    // wait for completion of all tasks
 
-        // notifiy all waiting worker threads about new task
+    if ( mMaxSize > 0 )
+    {
+        helpUntil( [this]() { return mActive.load() == 0; } );
+    }
+
+    {
+        std::unique_lock<std::mutex> lock( mSleepMutex );
+        mShutdown = true;
+        // notifiy all waiting worker threads
         mNotifyTask.notify_all();
     }
-    SCAI_LOG_DEBUG( logger, "added " << mMaxSize << " shutdown tasks" )
 
     // and now wait for completion of all worker threads and delete them
 
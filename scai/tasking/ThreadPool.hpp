@@ -37,9 +37,13 @@
 
 // std
 #include <climits>
-#include <queue>
 #include <memory>
 #include <functional>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
 
 namespace scai
 {
@@ -62,7 +66,7 @@ struct COMMON_DLL_IMPORTEXPORT ThreadPoolTask
 {
     enum TaskState
     {
-        DEFINED,    //!< The task structure has been filled
+        DEFINED,    //!< The task structure has been filled, might wait for its dependencies
         QUEUED,     //!< Task is queued in the pool, ready for execution
         RUNNING,    //!< Task is executed by free thread
         FINISHED    //!< Task is terminated, structure still exists
@@ -70,7 +74,7 @@ struct COMMON_DLL_IMPORTEXPORT ThreadPoolTask
 
     std::function<void()> mWork;  //!< task function to be executed
 
-    volatile TaskState mState; //!< current state of the task
+    std::atomic<TaskState> mState; //!< current state of the task
 
     bool mException; //!< true if task got an exception
 
@@ -84,6 +88,16 @@ struct COMMON_DLL_IMPORTEXPORT ThreadPoolTask
         std::function<void()> work,
         unsigned int taskId,
         int numOmpThreads = 0 );
+
+private:
+
+    friend class ThreadPool;
+
+    std::mutex mMutex;                                         // protects state FINISHED and successors
+    std::vector<std::shared_ptr<ThreadPoolTask> > mSuccessors; // tasks that depend on this task
+    std::atomic<int> mPredecessors;                            // number of unfinished dependencies
+    std::shared_ptr<ThreadPoolTask> mSelf;                     // keeps the task alive while it is in the pool
+    ThreadPoolTask* mNext;                                     // link in the incoming list of a worker
 };
 
 /** Class that defines a pool of threads that will execute scheduled tasks
@@ -92,6 +106,14 @@ struct COMMON_DLL_IMPORTEXPORT ThreadPoolTask
  The main advantage of this class is that creation of running threads is
  only done once. Non-busy threads will wait on notification for new tasks.
 
+ The pool uses work stealing: each worker thread has its own lock-free deque of tasks.
+ A worker executes the tasks of its own deque (LIFO) and steals tasks from the other
+ workers (FIFO) if it has no more work. Tasks scheduled by other threads are
+ distributed round-robin to lock-free incoming lists of the workers.
+
+ A thread that waits for a task helps to execute pending tasks instead of blocking.
+ Therefore a task might schedule and wait for other tasks.
+
  Note: tasks will be handled by shared pointers so task data might be freed
  either here or at its creation.
  */
@@ -120,7 +142,26 @@ public:
 
     std::shared_ptr<ThreadPoolTask> schedule( std::function<void()> work, int numOmpThreads = 0 );
 
-    /** Wait on completion of a task. */
+    /** Schedules a new function that will be executed after other tasks have been finished.
+     *
+     *  @param[in] work         is function to be executed by available thread
+     *  @param[in] dependencies tasks that must be finished before work is started
+     *  @param[in] numOmpThreads number of openmp threads the task should use
+     *  @return shared pointer for the task
+     */
+    std::shared_ptr<ThreadPoolTask> schedule(
+        std::function<void()> work,
+        const std::vector<std::shared_ptr<ThreadPoolTask> >& dependencies,
+        int numOmpThreads = 0 );
+
+    /** Schedules a continuation, i.e. a function that will be executed after a task has been finished. */
+
+    std::shared_ptr<ThreadPoolTask> then(
+        std::shared_ptr<ThreadPoolTask> task,
+        std::function<void()> work,
+        int numOmpThreads = 0 );
+
+    /** Wait on completion of a task, the calling thread executes pending tasks meanwhile. */
 
     void wait( std::shared_ptr<ThreadPoolTask> task );
 
@@ -148,7 +189,31 @@ private:
 
     SCAI_LOG_DECL_STATIC_LOGGER( logger )
 
-    unsigned int mTaskId; // last given task id
+    /** Work stealing queue of a worker, defined in implementation file */
+
+    struct WorkerQueue;
+
+    /** Make a task ready for execution, worker is the id of the calling worker thread or -1 */
+
+    void enqueue( ThreadPoolTask* task, const int worker );
+
+    /** Find a task for execution by own queue or stealing, returns NULL if no task is available */
+
+    ThreadPoolTask* findTask( const int worker );
+
+    /** Execute a task, ompThreads is the current number of OpenMP threads of the calling thread */
+
+    void execute( ThreadPoolTask* task, const int worker, int& ompThreads );
+
+    /** Help executing tasks until the condition becomes true */
+
+    void helpUntil( const std::function<bool()>& done );
+
+    /** Get the id of the calling thread if it is a worker of this pool, otherwise -1 */
+
+    int getWorkerId() const;
+
+    std::atomic<unsigned int> mTaskId; // last given task id
 
     int mMaxSize;         // number of worker threads
 
@@ -156,22 +221,21 @@ private:
 
     std::unique_ptr<std::thread[]> mThreads;    // worker threads of this pool
     std::unique_ptr<ThreadData[]> mThreadArgs;     // arguments for each worker thread
+    std::unique_ptr<WorkerQueue[]> mQueues;     // work stealing queue for each worker thread
 
-    std::queue<std::shared_ptr<ThreadPoolTask> > mTaskQueue;
-
-    std::condition_variable_any mNotifyFinished;// notify about finished tasks
-    std::condition_variable_any mNotifyTask;// notify about new task
+    std::atomic<unsigned int> mNextWorker;  // round-robin distribution of tasks from other threads
 
-    std::mutex mTaskQueueMutex;      // make access to taskqueue thread-safe
-    std::mutex mNotifyFinishMutex;   // used for wait on mNotifyFinished
+    std::atomic<int> mPending;       // number of queued tasks not started yet
+    std::atomic<int> mActive;        // number of scheduled tasks not finished yet
+    std::atomic<int> mNumSleeping;   // number of worker threads waiting on mNotifyTask
+    std::atomic<int> mNumWaiting;    // number of threads waiting on mNotifyFinished
+    std::atomic<bool> mShutdown;     // set if worker threads should terminate
 
-    enum WorkerState
-    {
-        WORKING,
-        WAITING
-    };
+    std::condition_variable mNotifyFinished;// notify about finished tasks
+    std::condition_variable mNotifyTask;// notify about new task
 
-    WorkerState mWorkerState; //used to indicate the state of the worker
+    std::mutex mSleepMutex;          // used for wait on mNotifyTask, only if there is no work
+    std::mutex mNotifyFinishMutex;   // used for wait on mNotifyFinished
 };
 
 } /* end namespace tasking */
@@ -190,4 +190,100 @@ BOOST_AUTO_TEST_CASE( singleTest )
 
 /* --------------------------------------------------------------------- */
 
+BOOST_AUTO_TEST_CASE( dependencyTest )
+{
+    SCAI_LOG_INFO( logger, "dependencyTest" );
+
+    int thread_sizes[] = POOL_SIZES;
+    int thread_configs = sizeof( thread_sizes ) / sizeof( int );
+
+    for ( int j = 0; j < thread_configs; ++j )
+    {
+        ThreadPool pool( thread_sizes[j] );
+
+        int x1 = -1;
+        int x2 = -1;
+        int sum = -1;
+
+        shared_ptr<ThreadPoolTask> task1 = pool.schedule( bind( &work, 1, ref( x1 ) ) );
+        shared_ptr<ThreadPoolTask> task2 = pool.schedule( bind( &work, 2, ref( x2 ) ) );
+
+        // task3 must not start before task1 and task2 are finished
+
+        shared_ptr<ThreadPoolTask> task3 = pool.schedule( [&]() { sum = x1 + x2; }, { task1, task2 } );
+
+        // continuation of task3
+
+        int result = -1;
+
+        shared_ptr<ThreadPoolTask> task4 = pool.then( task3, [&]() { result = 2 * sum; } );
+
+        pool.wait( task4 );
+
+        BOOST_CHECK_EQUAL( 3, sum );
+        BOOST_CHECK_EQUAL( 6, result );
+        BOOST_CHECK_EQUAL( ThreadPoolTask::FINISHED, task3->mState );
+
+        // continuation of a task that is already finished
+
+        shared_ptr<ThreadPoolTask> task5 = pool.then( task1, [&]() { result = x1; } );
+        pool.wait( task5 );
+        BOOST_CHECK_EQUAL( 1, result );
+    }
+}
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE( recursiveTest )
+{
+    SCAI_LOG_INFO( logger, "recursiveTest" );
+
+    // tasks running in the pool schedule and wait for other tasks, waiting threads help to execute them
+
+    const int NTASKS = 4;
+    const int NSUBTASKS = 8;
+
+    int thread_sizes[] = POOL_SIZES;
+    int thread_configs = sizeof( thread_sizes ) / sizeof( int );
+
+    for ( int j = 0; j < thread_configs; ++j )
+    {
+        ThreadPool pool( thread_sizes[j] );
+
+        std::vector<int> x( NTASKS * NSUBTASKS, -1 );
+        std::vector<shared_ptr<ThreadPoolTask> > tasks;
+
+        for ( int i = 0; i < NTASKS; ++i )
+        {
+            tasks.push_back( pool.schedule( [&pool, &x, i, NSUBTASKS]()
+            {
+                std::vector<shared_ptr<ThreadPoolTask> > subtasks;
+
+                for ( int k = 0; k < NSUBTASKS; ++k )
+                {
+                    int pos = i * NSUBTASKS + k;
+                    subtasks.push_back( pool.schedule( [&x, pos]() { x[pos] = pos; } ) );
+                }
+
+                for ( size_t k = 0; k < subtasks.size(); ++k )
+                {
+                    pool.wait( subtasks[k] );
+                }
+            } ) );
+        }
+
+        for ( int i = 0; i < NTASKS; ++i )
+        {
+            pool.wait( tasks[i] );
+        }
+
+        for ( int i = 0; i < NTASKS * NSUBTASKS; ++i )
+        {
+            BOOST_CHECK_EQUAL( i, x[i] );
+        }
+    }
+}
+
+/* --------------------------------------------------------------------- */
+
 BOOST_AUTO_TEST_SUITE_END();
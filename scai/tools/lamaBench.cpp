@@ -0,0 +1,996 @@
+/**
+ * @file lamaBench.cpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Benchmark of the sparse matrix and utility kernels with roofline metrics.
+ * @author Thomas Brandes
+ * @date 19.10.2026
+ */
+
+#include <scai/lama.hpp>
+
+#include <scai/lama/matrix/CSRSparseMatrix.hpp>
+#include <scai/lama/matutils/MatrixCreator.hpp>
+#include <scai/lama/storage/CSRStorage.hpp>
+#include <scai/lama/storage/MatrixStorage.hpp>
+
+#include <scai/utilskernel/HArrayUtils.hpp>
+#include <scai/hmemo.hpp>
+
+#include <scai/common/mepr/TypeList.hpp>
+#include <scai/common/TypeTraits.hpp>
+#include <scai/common/MatrixOp.hpp>
+#include <scai/common/Settings.hpp>
+#include <scai/common/Walltime.hpp>
+#include <scai/common/OpenMP.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace scai;
+using namespace scai::lama;
+using namespace scai::hmemo;
+using namespace std;
+
+using common::Walltime;
+using utilskernel::HArrayUtils;
+
+#define HOST_PRINT( rank, msg )             \
+    {                                           \
+        if ( rank == 0 )                        \
+        {                                       \
+            std::cout << msg << std::endl;      \
+        }                                       \
+    }                                           \
+
+/* ---------------------------------------------------------------------------- */
+
+void printUsage( const char* prog_name )
+{
+    cout << "Usage: " << prog_name << " [options]" << endl;
+    cout << "   options:" << endl;
+    cout << "      --SCAI_BENCH_MATRICES=<m1>:<m2>:...  matrices for the sparse kernels (default 1D3P:2D5P:3D7P:3D27P:random)" << endl;
+    cout << "           <d>D<p>P   Poisson stencil matrix, e.g. 2D5P, 3D27P (see lamaGenStencilMatrix)" << endl;
+    cout << "           random     random matrix, random_<n> for a certain size" << endl;
+    cout << "           <filename> matrix read from a file" << endl;
+    cout << "      --SCAI_BENCH_SIZE=<n>                number of rows for the generated matrices and size of arrays (default 1000000)" << endl;
+    cout << "      --SCAI_BENCH_FORMATS=CSR:ELL:...     sparse formats to benchmark (default CSR:ELL:JDS:DIA:COO)" << endl;
+    cout << "      --SCAI_BENCH_TYPES=float:double:...  value types to benchmark (default all supported types)" << endl;
+    cout << "      --SCAI_BENCH_KERNELS=<k1>:<k2>:...   run only kernels with one of these prefixes, e.g. CSR:Util.scan" << endl;
+    cout << "      --SCAI_BENCH_WARMUP=<n>              number of warmup runs (default 2)" << endl;
+    cout << "      --SCAI_BENCH_REPEAT=<n>              number of measured runs (default 10)" << endl;
+    cout << "      --SCAI_BENCH_OUTPUT=<file>.json|csv  write the results to a file" << endl;
+    cout << "      --SCAI_BENCH_CHECK=<file>.json|csv   compare the results with a reference file written before" << endl;
+    cout << "      --SCAI_BENCH_TOLERANCE=<tol>         accepted slowdown for the check (default 0.1, i.e. 10%)" << endl;
+    cout << "      --SCAI_CONTEXT=Host|CUDA             context on which the kernels are executed" << endl;
+    cout << "      --SCAI_NUM_THREADS=<n>               number of OpenMP threads" << endl;
+}
+
+/* ---------------------------------------------------------------------------- */
+
+/** Result of one benchmark, i.e. one kernel for one value type and one matrix. */
+
+struct BenchResult
+{
+    std::string kernel;   // name of the kernel, e.g. CSR.normalGEMV
+    std::string type;     // value type
+    std::string matrix;   // matrix or array used as input
+    IndexType numRows;
+    IndexType numValues;
+    double minTime;       // minimal time of all repetitions
+    double avgTime;       // average time of all repetitions
+    double bytes;         // minimal number of bytes that must be moved from/to memory
+    double flops;         // number of useful floating point operations
+
+    double bandwidth() const
+    {
+        return minTime > 0 ? bytes / minTime * 1e-9 : 0.0;
+    }
+
+    double gflops() const
+    {
+        return minTime > 0 ? flops / minTime * 1e-9 : 0.0;
+    }
+
+    std::string key() const
+    {
+        return kernel + "|" + type + "|" + matrix;
+    }
+};
+
+/** Configuration of the benchmark as specified by the SCAI_BENCH_xxx arguments */
+
+struct BenchConfig
+{
+    std::vector<std::string> matrices;
+    std::vector<std::string> formats;
+    std::vector<std::string> types;
+    std::vector<std::string> kernels;
+
+    IndexType size;
+    int warmup;
+    int repeat;
+
+    std::string outputFileName;
+    std::string checkFileName;
+    double tolerance;
+
+    ContextPtr ctx;
+
+    BenchConfig()
+    {
+        size    = 1000000;
+        warmup  = 2;
+        repeat  = 10;
+        tolerance = 0.1;
+
+        common::Settings::getEnvironment( size, "SCAI_BENCH_SIZE" );
+        common::Settings::getEnvironment( warmup, "SCAI_BENCH_WARMUP" );
+        common::Settings::getEnvironment( repeat, "SCAI_BENCH_REPEAT" );
+        common::Settings::getEnvironment( tolerance, "SCAI_BENCH_TOLERANCE" );
+        common::Settings::getEnvironment( outputFileName, "SCAI_BENCH_OUTPUT" );
+        common::Settings::getEnvironment( checkFileName, "SCAI_BENCH_CHECK" );
+
+        if ( !common::Settings::getEnvironment( matrices, "SCAI_BENCH_MATRICES", ":" ) )
+        {
+            common::Settings::tokenize( matrices, "1D3P:2D5P:3D7P:3D27P:random", ":" );
+        }
+
+        if ( !common::Settings::getEnvironment( formats, "SCAI_BENCH_FORMATS", ":" ) )
+        {
+            common::Settings::tokenize( formats, "CSR:ELL:JDS:DIA:COO", ":" );
+        }
+
+        common::Settings::getEnvironment( types, "SCAI_BENCH_TYPES", ":" );
+        common::Settings::getEnvironment( kernels, "SCAI_BENCH_KERNELS", ":" );
+
+        repeat = std::max( repeat, 1 );
+
+        ctx = Context::getContextPtr();
+    }
+
+    bool useType( const char* type ) const
+    {
+        return types.empty() || std::find( types.begin(), types.end(), type ) != types.end();
+    }
+
+    bool useKernel( const std::string& kernel ) const
+    {
+        if ( kernels.empty() )
+        {
+            return true;
+        }
+
+        for ( size_t i = 0; i < kernels.size(); ++i )
+        {
+            if ( kernel.compare( 0, kernels[i].length(), kernels[i] ) == 0 )
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+};
+
+/* ---------------------------------------------------------------------------- */
+
+/** Run an operation warmup + repeat times and take the timing of the last repeat runs. */
+
+static void measure( BenchResult& result, const BenchConfig& config, std::function<void()> op )
+{
+    for ( int k = 0; k < config.warmup; ++k )
+    {
+        op();
+    }
+
+    double minTime = std::numeric_limits<double>::max();
+    double sumTime = 0;
+
+    for ( int k = 0; k < config.repeat; ++k )
+    {
+        double time = Walltime::get();
+        op();
+        time = Walltime::get() - time;
+        minTime = std::min( minTime, time );
+        sumTime += time;
+    }
+
+    result.minTime = minTime;
+    result.avgTime = sumTime / config.repeat;
+}
+
+/** Short message of an exception, i.e. without the stack */
+
+static std::string shortMessage( const common::Exception& e )
+{
+    std::string msg = e.what();
+
+    size_t pos = msg.find( "Message: " );
+
+    if ( pos != std::string::npos )
+    {
+        msg = msg.substr( pos + 9 );
+    }
+
+    return msg.substr( 0, msg.find( '\n' ) );
+}
+
+/** Run one benchmark and append its result, kernels not available for a context or type are skipped. */
+
+static void bench(
+    std::vector<BenchResult>& results,
+    const BenchConfig& config,
+    BenchResult result,
+    std::function<void()> op )
+{
+    if ( !config.useKernel( result.kernel ) )
+    {
+        return;
+    }
+
+    try
+    {
+        measure( result, config, op );
+    }
+    catch ( common::Exception& e )
+    {
+        cout << "  " << setw( 20 ) << left << result.kernel << right << " skipped: " << shortMessage( e ) << endl;
+        return;
+    }
+
+    cout << "  " << setw( 20 ) << left << result.kernel << right << fixed
+         << setprecision( 3 ) << setw( 10 ) << result.minTime * 1000.0 << " ms"
+         << setprecision( 2 ) << setw( 10 ) << result.bandwidth() << " GB/s"
+         << setprecision( 2 ) << setw( 10 ) << result.gflops() << " GFLOP/s" << endl;
+
+    results.push_back( result );
+}
+
+/* ---------------------------------------------------------------------------- */
+
+/** Build the CSR storage for one entry of the matrix corpus, returns name of the matrix. */
+
+template<typename ValueType>
+static std::string buildMatrix( CSRStorage<ValueType>& storage, const std::string& spec, const IndexType size )
+{
+    CSRSparseMatrix<ValueType> matrix;
+
+    std::ostringstream name;
+
+    int dim = 0;
+    int points = 0;
+    char d;
+    char p;
+
+    std::istringstream is( spec );
+
+    if ( spec.compare( 0, 6, "random" ) == 0 )
+    {
+        // random pattern is generated by dense loop, so limit the default size
+
+        IndexType n = std::min( size, IndexType( 10000 ) );
+
+        if ( spec.length() > 7 )
+        {
+            std::istringstream( spec.substr( 7 ) ) >> n;
+        }
+
+        // about 16 entries per row
+
+        float density = std::min( 1.0f, 16.0f / n );
+
+        MatrixCreator::buildRandom( matrix, n, density );
+
+        name << "random_" << n;
+    }
+    else if ( ( is >> dim >> d >> points >> p ) && d == 'D' && p == 'P' )
+    {
+        SCAI_ASSERT_ERROR( MatrixCreator::supportedStencilType( dim, points ), "unsupported stencil " << spec )
+
+        IndexType n = static_cast<IndexType>( std::pow( double( size ), 1.0 / dim ) + 0.5 );
+
+        IndexType nY = dim > 1 ? n : 1;
+        IndexType nZ = dim > 2 ? n : 1;
+
+        MatrixCreator::buildPoisson( matrix, dim, points, n, nY, nZ );
+
+        name << dim << "D" << points << "P_" << n;
+
+        if ( dim > 1 )
+        {
+            name << "_" << nY;
+        }
+
+        if ( dim > 2 )
+        {
+            name << "_" << nZ;
+        }
+    }
+    else
+    {
+        matrix.readFromFile( spec );
+
+        name << spec;
+    }
+
+    storage = matrix.getLocalStorage();
+
+    return name.str();
+}
+
+/** Number of diagonals of a matrix, used to avoid DIA storages that explode. */
+
+template<typename ValueType>
+static IndexType countDiagonals( const CSRStorage<ValueType>& csr )
+{
+    const IndexType numRows = csr.getNumRows();
+    const IndexType numColumns = csr.getNumColumns();
+
+    std::vector<bool> used( numRows + numColumns, false );
+
+    ReadAccess<IndexType> ia( csr.getIA() );
+    ReadAccess<IndexType> ja( csr.getJA() );
+
+    IndexType count = 0;
+
+    for ( IndexType i = 0; i < numRows; ++i )
+    {
+        for ( IndexType jj = ia[i]; jj < ia[i + 1]; ++jj )
+        {
+            IndexType k = ja[jj] - i + numRows;
+
+            if ( !used[k] )
+            {
+                used[k] = true;
+                count++;
+            }
+        }
+    }
+
+    return count;
+}
+
+/** Jacobi kernels require a non-zero diagonal, not given for random matrices. */
+
+template<typename ValueType>
+static bool hasNonZeroDiagonal( const CSRStorage<ValueType>& csr )
+{
+    if ( csr.getNumRows() != csr.getNumColumns() )
+    {
+        return false;
+    }
+
+    HArray<ValueType> diagonal;
+
+    csr.getDiagonal( diagonal );
+
+    ReadAccess<ValueType> rDiagonal( diagonal );
+
+    for ( IndexType i = 0; i < diagonal.size(); ++i )
+    {
+        if ( rDiagonal[i] == ValueType( 0 ) )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* ---------------------------------------------------------------------------- */
+
+/** Benchmark all storage kernels of one format for one matrix. */
+
+template<typename ValueType>
+static void benchStorage(
+    std::vector<BenchResult>& results,
+    const BenchConfig& config,
+    const CSRStorage<ValueType>& csr,
+    const std::string& matrixName,
+    const std::string& formatName )
+{
+    Format format = str2Format( formatName.c_str() );
+
+    if ( format == Format::UNDEFINED )
+    {
+        cout << "  " << formatName << ": unknown format, skipped" << endl;
+        return;
+    }
+
+    const IndexType numRows = csr.getNumRows();
+    const IndexType numColumns = csr.getNumColumns();
+    const IndexType numValues = csr.getNumValues();
+
+    if ( format == Format::DIA )
+    {
+        IndexType numDiagonals = countDiagonals( csr );
+
+        if ( double( numDiagonals ) * numRows > 8.0 * numValues )
+        {
+            cout << "  DIA: " << numDiagonals << " diagonals, storage too large, skipped" << endl;
+            return;
+        }
+    }
+
+    MatrixStorageCreateKeyType key( format, common::TypeTraits<ValueType>::stype );
+
+    std::unique_ptr<MatrixStorage<ValueType> > storage( MatrixStorage<ValueType>::create( key ) );
+
+    storage->setContextPtr( config.ctx );
+    storage->assign( csr );
+    storage->prefetch();
+    storage->wait();
+
+    const double valueSize = sizeof( ValueType );
+    const double csrBytes  = static_cast<double>( csr.getMemoryUsage() );
+    const double bytes     = static_cast<double>( storage->getMemoryUsage() );
+
+    BenchResult result;
+
+    result.type      = common::TypeTraits<ValueType>::id();
+    result.matrix    = matrixName;
+    result.numRows   = numRows;
+    result.numValues = numValues;
+
+    HArray<ValueType> x( numColumns, ValueType( 1 ), config.ctx );
+    HArray<ValueType> xT( numRows, ValueType( 1 ), config.ctx );
+    HArray<ValueType> y( numRows, ValueType( 1 ), config.ctx );
+    HArray<ValueType> yT( numColumns, ValueType( 1 ), config.ctx );
+    HArray<ValueType> res( config.ctx );
+    HArray<ValueType> rhs( numRows, ValueType( 1 ), config.ctx );
+    HArray<ValueType> oldSolution( numRows, ValueType( 0 ), config.ctx );
+    HArray<ValueType> solution( config.ctx );
+
+    // y = A * x: read matrix, x and y, write result
+
+    result.kernel = formatName + ".normalGEMV";
+    result.bytes  = bytes + valueSize * ( numColumns + 2 * numRows );
+    result.flops  = 2.0 * numValues + 2.0 * numRows;
+
+    bench( results, config, result, [&]()
+    {
+        storage->matrixTimesVector( res, ValueType( 1 ), x, ValueType( 1 ), y, common::MatrixOp::NORMAL );
+    } );
+
+    result.kernel = formatName + ".normalGEMV_T";
+    result.bytes  = bytes + valueSize * ( numRows + 2 * numColumns );
+    result.flops  = 2.0 * numValues + 2.0 * numColumns;
+
+    bench( results, config, result, [&]()
+    {
+        storage->matrixTimesVector( res, ValueType( 1 ), xT, ValueType( 1 ), yT, common::MatrixOp::TRANSPOSE );
+    } );
+
+    if ( hasNonZeroDiagonal( csr ) )
+    {
+        // solution = oldSolution + omega * ( rhs - A * oldSolution ) ./ diag
+
+        result.kernel = formatName + ".jacobi";
+        result.bytes  = bytes + valueSize * 3 * numRows;
+        result.flops  = 2.0 * numValues + 3.0 * numRows;
+
+        bench( results, config, result, [&]()
+        {
+            storage->jacobiIterate( solution, oldSolution, rhs, ValueType( 0.5 ) );
+        } );
+    }
+
+    std::unique_ptr<MatrixStorage<ValueType> > target( MatrixStorage<ValueType>::create( key ) );
+    target->setContextPtr( config.ctx );
+
+    result.kernel = formatName + ".fromCSR";
+    result.bytes  = csrBytes + bytes;
+    result.flops  = 0;
+
+    bench( results, config, result, [&]()
+    {
+        target->assign( csr );
+    } );
+
+    CSRStorage<ValueType> csrTarget;
+    csrTarget.setContextPtr( config.ctx );
+
+    result.kernel = formatName + ".toCSR";
+
+    bench( results, config, result, [&]()
+    {
+        csrTarget.assign( *storage );
+    } );
+}
+
+/* ---------------------------------------------------------------------------- */
+
+/** Benchmark the utility kernels on arrays for one value type. */
+
+template<typename ValueType>
+static void benchUtils( std::vector<BenchResult>& results, const BenchConfig& config )
+{
+    const IndexType n = config.size;
+
+    const double valueSize = sizeof( ValueType );
+    const double indexSize = sizeof( IndexType );
+
+    BenchResult result;
+
+    result.type      = common::TypeTraits<ValueType>::id();
+    result.numRows   = n;
+    result.numValues = n;
+
+    {
+        std::ostringstream name;
+        name << "array_" << n;
+        result.matrix = name.str();
+    }
+
+    HArray<ValueType> x( n, ValueType( 1 ), config.ctx );
+    HArray<ValueType> y( n, ValueType( 2 ), config.ctx );
+    HArray<ValueType> z( n, ValueType( 0 ), config.ctx );
+    HArray<ValueType> sorted( config.ctx );
+
+    HArrayUtils::setRandom( x, 1, config.ctx );
+
+    // random permutation for gather and scatter
+
+    HArray<IndexType> perm;
+
+    {
+        HArray<float> keys( n );
+        HArrayUtils::setRandom( keys, 1 );
+        HArrayUtils::sort<float>( &perm, NULL, keys, true );
+    }
+
+    perm.prefetch( config.ctx );
+
+    result.kernel = "Util.setVal";
+    result.bytes  = valueSize * n;
+    result.flops  = 0;
+
+    bench( results, config, result, [&]()
+    {
+        HArrayUtils::setScalar( z, ValueType( 1 ), common::BinaryOp::COPY, config.ctx );
+    } );
+
+    result.kernel = "Util.binaryOp";
+    result.bytes  = valueSize * 3 * n;
+    result.flops  = n;
+
+    bench( results, config, result, [&]()
+    {
+        HArrayUtils::binaryOp( z, x, y, common::BinaryOp::MULT, config.ctx );
+    } );
+
+    result.kernel = "Util.axpy";
+    result.bytes  = valueSize * 3 * n;
+    result.flops  = 3.0 * n;
+
+    bench( results, config, result, [&]()
+    {
+        HArrayUtils::arrayPlusArray( z, ValueType( 2 ), x, ValueType( 1 ), y, config.ctx );
+    } );
+
+    result.kernel = "Util.reduce";
+    result.bytes  = valueSize * n;
+    result.flops  = n;
+
+    bench( results, config, result, [&]()
+    {
+        HArrayUtils::reduce( x, common::BinaryOp::ADD, config.ctx );
+    } );
+
+    result.kernel = "Util.dotProduct";
+    result.bytes  = valueSize * 2 * n;
+    result.flops  = 2.0 * n;
+
+    bench( results, config, result, [&]()
+    {
+        HArrayUtils::dotProduct( x, y, config.ctx );
+    } );
+
+    result.kernel = "Util.scan";
+    result.bytes  = valueSize * 2 * n;
+    result.flops  = n;
+
+    bench( results, config, result, [&]()
+    {
+        HArrayUtils::scan( z, ValueType( 0 ), true, config.ctx );
+    } );
+
+    result.kernel = "Util.setGather";
+    result.bytes  = ( 2 * valueSize + indexSize ) * n;
+    result.flops  = 0;
+
+    bench( results, config, result, [&]()
+    {
+        HArrayUtils::gather( z, x, perm, common::BinaryOp::COPY, config.ctx );
+    } );
+
+    result.kernel = "Util.setScatter";
+
+    bench( results, config, result, [&]()
+    {
+        HArrayUtils::scatter( z, perm, true, x, common::BinaryOp::COPY, config.ctx );
+    } );
+
+    result.kernel = "Util.sort";
+    result.bytes  = ( 2 * valueSize + indexSize ) * n;
+    result.flops  = 0;
+
+    bench( results, config, result, [&]()
+    {
+        HArrayUtils::sort( &perm, &sorted, x, true, config.ctx );
+    } );
+}
+
+/* ---------------------------------------------------------------------------- */
+
+template<typename ValueType>
+static void benchType( std::vector<BenchResult>& results, const BenchConfig& config )
+{
+    const char* typeName = common::TypeTraits<ValueType>::id();
+
+    for ( size_t i = 0; i < config.matrices.size(); ++i )
+    {
+        CSRStorage<ValueType> csr;
+
+        std::string matrixName;
+
+        try
+        {
+            matrixName = buildMatrix( csr, config.matrices[i], config.size );
+        }
+        catch ( common::Exception& e )
+        {
+            cout << "Matrix " << config.matrices[i] << " skipped: " << shortMessage( e ) << endl;
+            continue;
+        }
+
+        cout << endl << typeName << ", matrix " << matrixName << ": " << csr.getNumRows() << " x "
+             << csr.getNumColumns() << ", nnz = " << csr.getNumValues() << endl;
+
+        for ( size_t j = 0; j < config.formats.size(); ++j )
+        {
+            benchStorage( results, config, csr, matrixName, config.formats[j] );
+        }
+    }
+
+    cout << endl << typeName << ", arrays of size " << config.size << endl;
+
+    benchUtils<ValueType>( results, config );
+}
+
+// Metaprogramming to run the benchmarks for all supported value types
+
+template<typename TList>
+struct BenchWrapper;
+
+template<>
+struct BenchWrapper<common::mepr::NullType>
+{
+    static void bench( std::vector<BenchResult>&, const BenchConfig& )
+    {
+    }
+};
+
+template<typename H, typename T>
+struct BenchWrapper<common::mepr::TypeList<H, T> >
+{
+    static void bench( std::vector<BenchResult>& results, const BenchConfig& config )
+    {
+        if ( config.useType( common::TypeTraits<H>::id() ) )
+        {
+            benchType<H>( results, config );
+        }
+
+        BenchWrapper<T>::bench( results, config );
+    }
+};
+
+/* ---------------------------------------------------------------------------- */
+
+static bool isJSON( const std::string& fileName )
+{
+    const std::string suffix = ".json";
+
+    return fileName.length() >= suffix.length()
+           && fileName.compare( fileName.length() - suffix.length(), suffix.length(), suffix ) == 0;
+}
+
+static std::string jsonString( const std::string& str )
+{
+    std::string result = "\"";
+
+    for ( size_t i = 0; i < str.length(); ++i )
+    {
+        if ( str[i] == '"' || str[i] == '\\' )
+        {
+            result += '\\';
+        }
+
+        result += str[i];
+    }
+
+    return result + "\"";
+}
+
+/** Write the results to a file, one result per line for JSON as well as CSV. */
+
+static void writeResults( const std::vector<BenchResult>& results, const BenchConfig& config )
+{
+    std::ofstream out( config.outputFileName.c_str() );
+
+    if ( out.fail() )
+    {
+        COMMON_THROWEXCEPTION( "Could not open file " << config.outputFileName << " for benchmark results" )
+    }
+
+    std::ostringstream ctxName;
+    ctxName << *config.ctx;
+
+    out << setprecision( 6 );
+
+    if ( isJSON( config.outputFileName ) )
+    {
+        out << "{" << endl;
+        out << "  \"context\": " << jsonString( ctxName.str() ) << "," << endl;
+        out << "  \"threads\": " << omp_get_max_threads() << "," << endl;
+        out << "  \"warmup\": " << config.warmup << "," << endl;
+        out << "  \"repeat\": " << config.repeat << "," << endl;
+        out << "  \"results\": [" << endl;
+
+        for ( size_t i = 0; i < results.size(); ++i )
+        {
+            const BenchResult& r = results[i];
+
+            out << "    { \"kernel\": " << jsonString( r.kernel )
+                << ", \"type\": " << jsonString( r.type )
+                << ", \"matrix\": " << jsonString( r.matrix )
+                << ", \"rows\": " << r.numRows
+                << ", \"nnz\": " << r.numValues
+                << ", \"min\": " << r.minTime
+                << ", \"avg\": " << r.avgTime
+                << ", \"bytes\": " << r.bytes
+                << ", \"flops\": " << r.flops
+                << ", \"GB/s\": " << r.bandwidth()
+                << ", \"GFLOP/s\": " << r.gflops()
+                << " }" << ( i + 1 < results.size() ? "," : "" ) << endl;
+        }
+
+        out << "  ]" << endl;
+        out << "}" << endl;
+    }
+    else
+    {
+        out << "kernel,type,matrix,rows,nnz,min,avg,bytes,flops,GB/s,GFLOP/s" << endl;
+
+        for ( size_t i = 0; i < results.size(); ++i )
+        {
+            const BenchResult& r = results[i];
+
+            out << r.kernel << "," << r.type << "," << r.matrix << "," << r.numRows << "," << r.numValues << ","
+                << r.minTime << "," << r.avgTime << "," << r.bytes << "," << r.flops << ","
+                << r.bandwidth() << "," << r.gflops() << endl;
+        }
+    }
+
+    cout << endl << "Written " << results.size() << " results to " << config.outputFileName << endl;
+}
+
+/** Get the value of a field from one line of a JSON result file written by writeResults */
+
+static std::string jsonField( const std::string& line, const std::string& field )
+{
+    std::string pattern = "\"" + field + "\": ";
+
+    size_t pos = line.find( pattern );
+
+    if ( pos == std::string::npos )
+    {
+        return "";
+    }
+
+    pos += pattern.length();
+
+    if ( line[pos] == '"' )
+    {
+        size_t end = line.find( '"', pos + 1 );
+        return line.substr( pos + 1, end - pos - 1 );
+    }
+
+    size_t end = line.find_first_of( ", }", pos );
+
+    return line.substr( pos, end - pos );
+}
+
+/** Read the minimal times from a result file, key is kernel|type|matrix */
+
+static void readReference( std::map<std::string, double>& reference, const std::string& fileName )
+{
+    std::ifstream in( fileName.c_str() );
+
+    if ( in.fail() )
+    {
+        COMMON_THROWEXCEPTION( "Could not open reference file " << fileName )
+    }
+
+    std::string line;
+
+    if ( isJSON( fileName ) )
+    {
+        while ( std::getline( in, line ) )
+        {
+            std::string kernel = jsonField( line, "kernel" );
+
+            if ( kernel.empty() )
+            {
+                continue;
+            }
+
+            std::string key = kernel + "|" + jsonField( line, "type" ) + "|" + jsonField( line, "matrix" );
+
+            reference[key] = std::atof( jsonField( line, "min" ).c_str() );
+        }
+
+        return;
+    }
+
+    // CSV file, first line is the header
+
+    std::vector<std::string> columns;
+
+    std::getline( in, line );
+    common::Settings::tokenize( columns, line, "," );
+
+    size_t posKernel = std::find( columns.begin(), columns.end(), "kernel" ) - columns.begin();
+    size_t posType   = std::find( columns.begin(), columns.end(), "type" ) - columns.begin();
+    size_t posMatrix = std::find( columns.begin(), columns.end(), "matrix" ) - columns.begin();
+    size_t posMin    = std::find( columns.begin(), columns.end(), "min" ) - columns.begin();
+
+    SCAI_ASSERT_LT_ERROR( std::max( std::max( posKernel, posType ), std::max( posMatrix, posMin ) ), columns.size(),
+                          "illegal header in reference file " << fileName << ": " << line )
+
+    while ( std::getline( in, line ) )
+    {
+        std::vector<std::string> values;
+
+        common::Settings::tokenize( values, line, "," );
+
+        if ( values.size() != columns.size() )
+        {
+            continue;
+        }
+
+        std::string key = values[posKernel] + "|" + values[posType] + "|" + values[posMatrix];
+
+        reference[key] = std::atof( values[posMin].c_str() );
+    }
+}
+
+/** Compare results with a reference, returns number of regressions. */
+
+static int checkResults( const std::vector<BenchResult>& results, const BenchConfig& config )
+{
+    std::map<std::string, double> reference;
+
+    readReference( reference, config.checkFileName );
+
+    int nCompared = 0;
+    int nRegressions = 0;
+
+    cout << endl << "Check against " << config.checkFileName << ", tolerance = " << config.tolerance << endl;
+
+    for ( size_t i = 0; i < results.size(); ++i )
+    {
+        const BenchResult& r = results[i];
+
+        std::map<std::string, double>::const_iterator it = reference.find( r.key() );
+
+        if ( it == reference.end() || it->second <= 0 )
+        {
+            continue;
+        }
+
+        nCompared++;
+
+        double ratio = r.minTime / it->second;
+
+        if ( ratio > 1.0 + config.tolerance )
+        {
+            nRegressions++;
+
+            cout << "  REGRESSION " << r.kernel << " " << r.type << " " << r.matrix << ": "
+                 << setprecision( 3 ) << r.minTime * 1000.0 << " ms, reference "
+                 << it->second * 1000.0 << " ms, slowdown " << setprecision( 2 ) << ratio << endl;
+        }
+    }
+
+    cout << "Compared " << nCompared << " of " << results.size() << " results, "
+         << nRegressions << " regressions" << endl;
+
+    return nRegressions;
+}
+
+/* ---------------------------------------------------------------------------- */
+
+int main( int argc, const char* argv[] )
+{
+    common::Settings::parseArgs( argc, argv );
+
+    int myRank = dmemo::Communicator::getCommunicatorPtr()->getRank();
+
+    if ( argc > 1 )
+    {
+        HOST_PRINT( myRank, "Unknown argument: " << argv[1] )
+
+        if ( myRank == 0 )
+        {
+            printUsage( argv[0] );
+        }
+
+        return -1;
+    }
+
+    try
+    {
+        BenchConfig config;
+
+        HOST_PRINT( myRank, "lamaBench on " << *config.ctx << ", threads = " << omp_get_max_threads()
+                    << ", warmup = " << config.warmup << ", repeat = " << config.repeat )
+
+        std::vector<BenchResult> results;
+
+        BenchWrapper<SCAI_NUMERIC_TYPES_HOST_LIST>::bench( results, config );
+
+        if ( myRank != 0 )
+        {
+            return 0;
+        }
+
+        if ( config.outputFileName.length() > 0 )
+        {
+            writeResults( results, config );
+        }
+
+        if ( config.checkFileName.length() > 0 && checkResults( results, config ) > 0 )
+        {
+            return 1;
+        }
+    }
+    catch ( common::Exception& e )
+    {
+        HOST_PRINT( myRank, "Caught exception: " << e.what() << "\n\nTERMINATE due to error" )
+        return -1;
+    }
+
+    return 0;
+}
@@ -188,10 +188,23 @@ void CallTreeTable::open( const char* prefix, const char* threadSuffix )
     outfile << "cmd program_name" << endl;
     outfile << "part 1" << endl;
     outfile << endl;
-    outfile << "# rate " << common::Walltime::timerate() << endl;
-    double rate = 1.0 / common::Walltime::timerate();
+    outfile << "# rate " << timerate() << endl;
+    double rate = 1.0 / timerate();
     outfile << "event WALL_TICKS wallticks" << endl;
-    outfile << "events WALL_TICKS" << endl;
+
+    for ( int i = 0; i < HardwareCounters::getNumEvents(); ++i )
+    {
+        outfile << "event " << HardwareCounters::getEventName( i ) << " " << HardwareCounters::getEventName( i ) << endl;
+    }
+
+    outfile << "events WALL_TICKS";
+
+    for ( int i = 0; i < HardwareCounters::getNumEvents(); ++i )
+    {
+        outfile << " " << HardwareCounters::getEventName( i );
+    }
+
+    outfile << endl;
     outfile << "define WALL_TIME " << rate << " WALL_TICKS" << endl;
 }
 
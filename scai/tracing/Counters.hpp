@@ -29,12 +29,17 @@
 
 #pragma once
 
+// local library
+#include <scai/tracing/HardwareCounters.hpp>
+
 // internal scai libraries
 #include <scai/common/Walltime.hpp>
 #include <scai/common/Printable.hpp>
 
 // std
 #include <ostream>
+#include <chrono>
+#include <cstdint>
 
 namespace scai
 {
@@ -42,13 +47,34 @@ namespace scai
 namespace tracing
 {
 
-static const int MAX_COUNTERS = 1;
+/** Maximal number of counters, first counter is always the time, others are hardware counters. */
+
+static const int MAX_COUNTERS = 1 + HardwareCounters::MAX_EVENTS;
 
-static const int usedCounters = 1;    //!< number of counters used, <= MAX_COUNTERS
+/** Number of counters used, <= MAX_COUNTERS */
 
 static inline int enabledCounters()
 {
-    return usedCounters;
+    return 1 + HardwareCounters::getNumEvents();
+}
+
+/** Get a time stamp in ticks of a monotonic clock.
+ *
+ *  The clock is the same for all threads and has a much higher resolution than
+ *  common::Walltime::timestamp, calls are cheap (no system call).
+ */
+static inline uint64_t timestamp()
+{
+    return static_cast<uint64_t>( std::chrono::steady_clock::now().time_since_epoch().count() );
+}
+
+/** Number of ticks of timestamp() per second. */
+
+static inline uint64_t timerate()
+{
+    typedef std::chrono::steady_clock::period Period;
+
+    return static_cast<uint64_t>( Period::den / Period::num );
 }
 
 class CounterArray : public scai::common::Printable
@@ -66,7 +92,7 @@ public:
         }
         else
         {
-            for ( int i = 0; i < usedCounters; ++i )
+            for ( int i = 0; i < enabledCounters(); ++i )
             {
                 values[i] = 0;
             }
@@ -81,7 +107,7 @@ public:
     {
         CounterArray result;
 
-        for ( int i = 0; i < usedCounters; ++i )
+        for ( int i = 0; i < enabledCounters(); ++i )
         {
             result.values[i] = this->values[i] - other.values[i];
         }
@@ -93,7 +119,7 @@ public:
 
     CounterArray& operator= ( const CounterArray& other )
     {
-        for ( int i = 0; i < usedCounters; ++i )
+        for ( int i = 0; i < enabledCounters(); ++i )
         {
             values[i] = other.values[i];
         }
@@ -110,7 +136,7 @@ public:
 
     CounterArray& operator += ( const CounterArray& other )
     {
-        for ( int i = 0; i < usedCounters; ++i )
+        for ( int i = 0; i < enabledCounters(); ++i )
         {
             values[i] += other.values[i];
         }
@@ -123,22 +149,31 @@ public:
         return values[i];
     }
 
+    /** Get the value of a hardware counter, i is the position of the event in HardwareCounters. */
+
+    uint64_t getEventValue( int i ) const
+    {
+        return values[i + 1];
+    }
+
     double getWalltime() const
     {
-        return double( values[0] ) / double( common::Walltime::timerate() );
+        return double( values[0] ) / double( timerate() );
     }
 
     /** Return walltime as difference to previous counter values */
 
     double getWalltime( const CounterArray& other ) const
     {
-        return double ( values[0] - other.values[0] ) / double( common::Walltime::timerate() );
+        return double ( values[0] - other.values[0] ) / double( timerate() );
     }
 
     /** This method writes just the counter values in a stream, separated by a given string. */
 
     void write( std::ostream& stream, const char* separator ) const
     {
+        const int usedCounters = enabledCounters();
+
         for ( int i = 0; i < usedCounters; ++i )
         {
             stream << values[i];
@@ -161,8 +196,12 @@ private:
 
     void stamp()
     {
-        // currently we count only time ticks
-        values[0] = common::Walltime::timestamp();
+        values[0] = timestamp();
+
+        if ( enabledCounters() > 1 )
+        {
+            HardwareCounters::read( values + 1 );
+        }
     }
 
     uint64_t values[MAX_COUNTERS];
@@ -0,0 +1,356 @@
+/**
+ * @file HardwareCounters.cpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Implementation of hardware performance counters by the Linux perf_event interface.
+ * @author Thomas Brandes
+ * @date 19.10.2018
+ */
+
+// hpp
+#include <scai/tracing/HardwareCounters.hpp>
+
+// internal scai libraries
+#include <scai/common/Settings.hpp>
+
+#if defined( __linux__ )
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// std
+#include <cstring>
+#include <cerrno>
+#include <cstdlib>
+
+namespace scai
+{
+
+namespace tracing
+{
+
+/* -------------------------------------------------------------------------- */
+
+SCAI_LOG_DEF_LOGGER( HardwareCounters::logger, "HardwareCounters" )
+
+int HardwareCounters::numEvents = 0;
+
+/* -------------------------------------------------------------------------- */
+
+namespace
+{
+
+/** Description of an event as it is opened by perf_event_open. */
+
+struct EventInfo
+{
+    std::string mName;
+    uint32_t mType;
+    uint64_t mConfig;
+};
+
+/** Events selected by configure, same for all threads. */
+
+static std::vector<EventInfo> theEvents;
+
+#if defined( __linux__ )
+
+/** Translate an event name into type and config of perf_event, returns false for unknown events */
+
+static bool getEventInfo( EventInfo& info, const std::string& name )
+{
+    info.mName = name;
+
+    if ( name == "cycles" )
+    {
+        info.mType = PERF_TYPE_HARDWARE;
+        info.mConfig = PERF_COUNT_HW_CPU_CYCLES;
+    }
+    else if ( name == "instructions" )
+    {
+        info.mType = PERF_TYPE_HARDWARE;
+        info.mConfig = PERF_COUNT_HW_INSTRUCTIONS;
+    }
+    else if ( name == "llc_misses" )
+    {
+        info.mType = PERF_TYPE_HARDWARE;
+        info.mConfig = PERF_COUNT_HW_CACHE_MISSES;
+    }
+    else if ( name == "branch_misses" )
+    {
+        info.mType = PERF_TYPE_HARDWARE;
+        info.mConfig = PERF_COUNT_HW_BRANCH_MISSES;
+    }
+    else if ( name == "page_faults" )
+    {
+        info.mType = PERF_TYPE_SOFTWARE;
+        info.mConfig = PERF_COUNT_SW_PAGE_FAULTS;
+    }
+    else if ( name.compare( 0, 6, "flops/" ) == 0 && name.length() > 6 )
+    {
+        char* end = NULL;
+        info.mName = "flops";
+        info.mType = PERF_TYPE_RAW;
+        info.mConfig = strtoull( name.c_str() + 6, &end, 16 );
+
+        if ( *end != '\0' )
+        {
+            return false;
+        }
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/** Open an event for the calling thread, returns file descriptor or -1 */
+
+static int openEvent( const EventInfo& info, const int groupFd )
+{
+    struct perf_event_attr attr;
+
+    memset( &attr, 0, sizeof( attr ) );
+
+    attr.size           = sizeof( attr );
+    attr.type           = info.mType;
+    attr.config         = info.mConfig;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+    attr.read_format    = PERF_FORMAT_GROUP;
+
+    // pid = 0, cpu = -1 : count the calling thread on any cpu
+
+    return static_cast<int>( syscall( __NR_perf_event_open, &attr, 0, -1, groupFd, 0 ) );
+}
+
+/** File descriptors of the event group for one thread, closed when the thread terminates. */
+
+struct ThreadEvents
+{
+    ThreadEvents()
+    {
+        mOpened = false;
+    }
+
+    ~ThreadEvents()
+    {
+        for ( size_t i = 0; i < mFds.size(); ++i )
+        {
+            if ( mFds[i] >= 0 )
+            {
+                close( mFds[i] );
+            }
+        }
+    }
+
+    void open()
+    {
+        mOpened = true;
+
+        int groupFd = -1;
+
+        for ( size_t i = 0; i < theEvents.size(); ++i )
+        {
+            int fd = openEvent( theEvents[i], groupFd );
+
+            if ( fd < 0 )
+            {
+                // all or nothing, values of this thread remain zero
+
+                groupFd = -1;
+                break;
+            }
+
+            if ( groupFd < 0 )
+            {
+                groupFd = fd;
+            }
+
+            mFds.push_back( fd );
+        }
+
+        if ( groupFd < 0 )
+        {
+            for ( size_t i = 0; i < mFds.size(); ++i )
+            {
+                close( mFds[i] );
+            }
+
+            mFds.clear();
+        }
+    }
+
+    bool mOpened;
+
+    std::vector<int> mFds;   // first one is group leader
+};
+
+static thread_local ThreadEvents threadEvents;
+
+#endif
+
+}
+
+/* -------------------------------------------------------------------------- */
+
+int HardwareCounters::configure( const std::string& eventList )
+{
+    theEvents.clear();
+    numEvents = 0;
+
+    std::vector<std::string> names;
+
+    common::Settings::tokenize( names, eventList, "+" );
+
+#if defined( __linux__ )
+
+    int groupFd = -1;
+
+    std::vector<int> fds;
+
+    for ( size_t i = 0; i < names.size(); ++i )
+    {
+        EventInfo info;
+
+        if ( !getEventInfo( info, names[i] ) )
+        {
+            SCAI_LOG_WARN( logger, names[i] << " is unknown counter event, ignored" )
+            continue;
+        }
+
+        if ( static_cast<int>( theEvents.size() ) == MAX_EVENTS )
+        {
+            SCAI_LOG_WARN( logger, "counter event " << names[i] << " ignored, max " << MAX_EVENTS << " events" )
+            continue;
+        }
+
+        // check by the calling thread whether the event can be counted
+
+        int fd = openEvent( info, groupFd );
+
+        if ( fd < 0 )
+        {
+            SCAI_LOG_WARN( logger, "counter event " << names[i] << " not available: " << strerror( errno ) )
+            continue;
+        }
+
+        if ( groupFd < 0 )
+        {
+            groupFd = fd;
+        }
+
+        fds.push_back( fd );
+
+        theEvents.push_back( info );
+    }
+
+    for ( size_t i = 0; i < fds.size(); ++i )
+    {
+        close( fds[i] );
+    }
+
+#else
+
+    if ( names.size() > 0 )
+    {
+        SCAI_LOG_WARN( logger, "hardware counters are only supported on Linux, counters ignored" )
+    }
+
+#endif
+
+    numEvents = static_cast<int>( theEvents.size() );
+
+    SCAI_LOG_INFO( logger, "configured " << numEvents << " counter events of " << eventList )
+
+    return numEvents;
+}
+
+/* -------------------------------------------------------------------------- */
+
+const char* HardwareCounters::getEventName( const int i )
+{
+    return theEvents[i].mName.c_str();
+}
+
+/* -------------------------------------------------------------------------- */
+
+int HardwareCounters::findEvent( const char* name )
+{
+    for ( int i = 0; i < numEvents; ++i )
+    {
+        if ( theEvents[i].mName == name )
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+/* -------------------------------------------------------------------------- */
+
+void HardwareCounters::read( uint64_t values[] )
+{
+#if defined( __linux__ )
+
+    ThreadEvents& events = threadEvents;
+
+    if ( !events.mOpened )
+    {
+        events.open();
+    }
+
+    if ( events.mFds.size() > 0 )
+    {
+        // PERF_FORMAT_GROUP: number of events followed by the values
+
+        uint64_t buffer[MAX_EVENTS + 1];
+
+        ssize_t size = ::read( events.mFds[0], buffer, sizeof( buffer ) );
+
+        if ( size > 0 && buffer[0] == static_cast<uint64_t>( numEvents ) )
+        {
+            for ( int i = 0; i < numEvents; ++i )
+            {
+                values[i] = buffer[i + 1];
+            }
+
+            return;
+        }
+    }
+
+#endif
+
+    for ( int i = 0; i < numEvents; ++i )
+    {
+        values[i] = 0;
+    }
+}
+
+} /* end namespace tracing */
+
+} /* end namespace scai */
@@ -0,0 +1,114 @@
+/**
+ * @file HardwareCounters.hpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Access to hardware performance counters via the Linux perf_event interface.
+ * @author Thomas Brandes
+ * @date 19.10.2018
+ */
+
+#pragma once
+
+// for dll_import
+#include <scai/common/config.hpp>
+
+// internal scai libraries
+#include <scai/logging.hpp>
+
+// std
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace scai
+{
+
+namespace tracing
+{
+
+/**
+ *  @brief Static class that provides the values of hardware performance counters for the calling thread.
+ *
+ *  The counters are selected by a list of event names separated by '+' (',' is already used
+ *  in environment variables to give different values for the processes):
+ *
+ *   - cycles, instructions, llc_misses, branch_misses are the generic hardware events of perf_event
+ *   - page_faults is a software event (available also if hardware counters are not)
+ *   - flops/<hex> is a raw hardware event (model specific) that counts floating point operations
+ *
+ *  Events that cannot be opened (e.g. no PMU in a virtual machine, insufficient permissions by
+ *  perf_event_paranoid) are skipped with a warning, so tracing works also without counters.
+ *
+ *  The events of a thread are opened as one group with the first read in the thread, so all
+ *  values are read by one system call.
+ */
+class COMMON_DLL_IMPORTEXPORT HardwareCounters
+{
+public:
+
+    /** Maximal number of hardware events that can be counted. */
+
+    static const int MAX_EVENTS = 5;
+
+    /** Select the events to count.
+     *
+     *  @param[in] eventList is a list of event names separated by '+', e.g. cycles+instructions
+     *  @returns number of events that are available 
+     *
+     *  This method must be called before any values are read.
+     */
+    static int configure( const std::string& eventList );
+
+    /** Number of events that are counted. */
+
+    static int getNumEvents()
+    {
+        return numEvents;
+    }
+
+    /** Get the name of a counted event. */
+
+    static const char* getEventName( const int i );
+
+    /** Get the position of an event by its name, -1 if not counted. */
+
+    static int findEvent( const char* name );
+
+    /** Read the current values of all events for the calling thread.
+     *
+     *  @param[out] values array with getNumEvents() entries 
+     *
+     *  The values are zero if the counters could not be opened for the calling thread.
+     */
+    static void read( uint64_t values[] );
+
+private:
+
+    static int numEvents;   // number of events successfully configured
+
+    SCAI_LOG_DECL_STATIC_LOGGER( logger )
+};
+
+} /* end namespace tracing */
+
+} /* end namespace scai */
@@ -29,6 +29,9 @@
 
 #pragma once
 
+// local library
+#include <scai/tracing/Counters.hpp>
+
 // std
 #include <string>
 #include <fstream>
@@ -58,6 +61,8 @@ public:
         mExclusiveTime = 0.0;
         mCalls = 0;
         mVTId = 0;
+        mFile = NULL;
+        mLine = 0;
         mFirst = true;    // for first access
     }
 
@@ -120,6 +125,13 @@ public:
         return is;
     }
 
+    /** add the counter values of a call, i.e. difference between values at exit and at entry */
+
+    void addCounters( const CounterArray& costs )
+    {
+        mCounters += costs;
+    }
+
     /** subtract time of called regions to get exlusive time. */
 
     void subRegionCall( double spentTime )
@@ -144,6 +156,54 @@ public:
         outfile << std::endl;
     }
 
+    /** Print the (inclusive) values of the hardware counters and the derived metrics.
+     *
+     *  The memory traffic is estimated by the number of last level cache misses, each one
+     *  transfers one cache line.
+     */
+    void printCounters( std::ostream& outfile ) const
+    {
+        static const uint64_t CACHE_LINE_SIZE = 64;
+
+        outfile << "Counters " << mName << " : ";
+
+        for ( int i = 0; i < HardwareCounters::getNumEvents(); ++i )
+        {
+            outfile << ( i == 0 ? "" : ", " ) << HardwareCounters::getEventName( i ) << " = " << mCounters.getEventValue( i );
+        }
+
+        const int cycles       = HardwareCounters::findEvent( "cycles" );
+        const int instructions = HardwareCounters::findEvent( "instructions" );
+        const int misses       = HardwareCounters::findEvent( "llc_misses" );
+        const int flops        = HardwareCounters::findEvent( "flops" );
+
+        outfile << std::fixed << std::setprecision( 3 );
+
+        if ( cycles >= 0 && instructions >= 0 && mCounters.getEventValue( cycles ) > 0 )
+        {
+            outfile << ", IPC = " << double( mCounters.getEventValue( instructions ) ) / double( mCounters.getEventValue( cycles ) );
+        }
+
+        if ( misses >= 0 )
+        {
+            const uint64_t bytes = mCounters.getEventValue( misses ) * CACHE_LINE_SIZE;
+
+            outfile << ", bytes = " << bytes;
+
+            if ( mInclusiveTime > 0.0 )
+            {
+                outfile << ", GB/s = " << double( bytes ) / mInclusiveTime * 1e-9;
+            }
+
+            if ( flops >= 0 && mCounters.getEventValue( flops ) > 0 )
+            {
+                outfile << ", bytes/flop = " << double( bytes ) / double( mCounters.getEventValue( flops ) );
+            }
+        }
+
+        outfile << std::endl;
+    }
+
     /*
     virtual void writeAt( std::ostream& outfile ) const
     {
@@ -160,6 +220,8 @@ private:
     double mInclusiveTime; //!< time totally spent in a region
     double mExclusiveTime; //!< time exclusively spent in a region
 
+    CounterArray mCounters; //!< inclusive values of the hardware counters
+
     bool mFirst;           //!< only true for first access
 };
 
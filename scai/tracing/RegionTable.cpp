@@ -36,10 +36,13 @@
 // internal scai libraries
 #include <scai/common/Walltime.hpp>
 #include <scai/common/macros/throw.hpp>
+#include <scai/common/macros/assert.hpp>
 
 // std
 #include <cstdio>
 #include <cstdlib>
+#include <map>
+#include <mutex>
 
 using namespace std;
 
@@ -55,6 +58,43 @@ SCAI_LOG_DEF_LOGGER( RegionTable::logger, "RegionTable" )
 
 /* ---------------------------------------------------------------------- */
 
+namespace
+{
+
+/** Data of a region that is the same for all threads. */
+
+struct RegionInfo
+{
+    std::string mName;
+    const char* mFile;
+    int mLine;
+};
+
+/** Global registry of all regions, access is protected by a mutex. 
+ *
+ *  Note: function with static variable instead of a static variable as regions
+ *        might be defined during static initialization. The registry is never freed
+ *        as region names are still needed when the trace files are written at program exit.
+ */
+struct RegionRegistry
+{
+    std::mutex mMutex;
+
+    std::map<std::string, int> mIds;
+
+    std::vector<RegionInfo> mRegions;
+
+    static RegionRegistry& get()
+    {
+        static RegionRegistry* registry = new RegionRegistry();
+        return *registry;
+    }
+};
+
+}
+
+/* ---------------------------------------------------------------------- */
+
 RegionTable::RegionTable( const char* threadName )
 {
     // threadName can be NULL if tracing is only for main thread
@@ -104,56 +144,117 @@ double RegionTable::elapsed( int regionId )
 
 /* ---------------------------------------------------------------------- */
 
-int RegionTable::getRegionId( const char* regionName, const char* file, int scl )
+int RegionTable::defineRegion( const char* regionName, const char* file, int scl )
 {
-    MapRegion::iterator it = mapTimer.find( regionName );
+    RegionRegistry& registry = RegionRegistry::get();
 
-    if ( it == mapTimer.end() )
-    {
-        int regionId = array.size();
-        array.push_back( RegionEntry() );
-        RegionEntry& entry = array[regionId];
-        entry.mName = regionName;
-        entry.mFile = file;
-        entry.mLine = scl;
-        VTInterface::define( entry );
-        // do not use this: mapTimer[regionName] = regionId; // causes problems with composed strings
-        mapTimer.insert( std::pair<const char*, int>( entry.mName.c_str(), regionId ) );
-        SCAI_LOG_DEBUG( logger,
-                        "Added region " << regionId << "( " << array[regionId].mName << ") for region " << regionName )
-        return static_cast<int>( regionId );
-    }
-    else
+    std::unique_lock<std::mutex> lock( registry.mMutex );
+
+    std::map<std::string, int>::const_iterator it = registry.mIds.find( regionName );
+
+    if ( it != registry.mIds.end() )
     {
-        // alread defined
-        return it->second;
+        return it->second;   // already defined
     }
+
+    int regionId = static_cast<int>( registry.mRegions.size() );
+
+    RegionInfo info;
+    info.mName = regionName;
+    info.mFile = file;
+    info.mLine = scl;
+
+    registry.mRegions.push_back( info );
+    registry.mIds.insert( std::pair<std::string, int>( info.mName, regionId ) );
+
+    SCAI_LOG_DEBUG( logger, "Defined region " << regionId << " ( " << regionName << " )" )
+
+    return regionId;
 }
 
 /* ---------------------------------------------------------------------- */
 
-int RegionTable::getRegionId( const char* regionName )
+int RegionTable::findRegion( const char* regionName )
+{
+    RegionRegistry& registry = RegionRegistry::get();
+
+    std::unique_lock<std::mutex> lock( registry.mMutex );
+
+    std::map<std::string, int>::const_iterator it = registry.mIds.find( regionName );
+
+    return it == registry.mIds.end() ? -1 : it->second;
+}
+
+/* ---------------------------------------------------------------------- */
+
+std::string RegionTable::getRegionName( int regionId )
 {
-    MapRegion::iterator it = mapTimer.find( regionName );
+    RegionRegistry& registry = RegionRegistry::get();
+
+    std::unique_lock<std::mutex> lock( registry.mMutex );
+
+    SCAI_ASSERT_VALID_INDEX( regionId, static_cast<int>( registry.mRegions.size() ), "illegal region id" )
+
+    return registry.mRegions[regionId].mName;
+}
+
+/* ---------------------------------------------------------------------- */
 
-    if ( it == mapTimer.end() )
+void RegionTable::initRegion( int regionId )
+{
+    if ( static_cast<size_t>( regionId ) >= array.size() )
     {
-        COMMON_THROWEXCEPTION( "Region " << regionName << " never defined" )
+        array.resize( regionId + 1 );
     }
-    else
+
+    RegionEntry& entry = array[regionId];
+
     {
-        // already defined
-        return it->second;
+        RegionRegistry& registry = RegionRegistry::get();
+
+        std::unique_lock<std::mutex> lock( registry.mMutex );
+
+        const RegionInfo& info = registry.mRegions[regionId];
+
+        entry.mName = info.mName;
+        entry.mFile = info.mFile;
+        entry.mLine = info.mLine;
     }
+
+    VTInterface::define( entry );
+
+    SCAI_LOG_DEBUG( logger, "Added region " << regionId << "( " << entry.mName << ") for thread " << mThreadName )
 }
 
 /* ---------------------------------------------------------------------- */
 
-RegionEntry& RegionTable::getRegion( int regionId )
+int RegionTable::getRegionId( const char* regionName, const char* file, int scl )
 {
-    return array[regionId];
+    int regionId = defineRegion( regionName, file, scl );
+
+    getRegion( regionId );   // make sure that the entry is available in this table
+
+    return regionId;
 }
 
+/* ---------------------------------------------------------------------- */
+
+int RegionTable::getRegionId( const char* regionName )
+{
+    int regionId = findRegion( regionName );
+
+    if ( regionId < 0 )
+    {
+        COMMON_THROWEXCEPTION( "Region " << regionName << " never defined" )
+    }
+
+    getRegion( regionId );
+
+    return regionId;
+}
+
+/* ---------------------------------------------------------------------- */
+
 const RegionEntry& RegionTable::getRegion( int regionId ) const
 {
     return array[regionId];
@@ -178,14 +279,29 @@ void RegionTable::printTimer( ostream& outfile )
         outfile << "=========================================" << endl;
     }
 
-    // use map iterator for alphabetical output
-    MapRegion::iterator it;
+    // alphabetical output of all regions used by this thread
 
-    for ( it = mapTimer.begin(); it != mapTimer.end(); it++ )
+    std::map<std::string, int> sortedRegions;
+
+    for ( size_t i = 0; i < array.size(); ++i )
+    {
+        if ( !array[i].mName.empty() )
+        {
+            sortedRegions.insert( std::pair<std::string, int>( array[i].mName, static_cast<int>( i ) ) );
+        }
+    }
+
+    std::map<std::string, int>::const_iterator it;
+
+    for ( it = sortedRegions.begin(); it != sortedRegions.end(); it++ )
     {
-        int regionId = it->second;
-        const RegionEntry& region = array[regionId];
+        const RegionEntry& region = array[it->second];
         region.printTime( outfile );
+
+        if ( HardwareCounters::getNumEvents() > 0 )
+        {
+            region.printCounters( outfile );
+        }
     }
 }
 
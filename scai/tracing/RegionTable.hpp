@@ -42,7 +42,7 @@
 #include <cstring>
 #include <cstdio>
 #include <vector>
-#include <map>
+#include <string>
 #include <fstream>
 
 namespace scai
@@ -51,7 +51,12 @@ namespace scai
 namespace tracing
 {
 
-/** Class that manages all regions in a table */
+/** Class that manages all regions in a table 
+ *
+ *  The ids of the regions are global, i.e. a region has the same id in the tables of all threads.
+ *  So the id of a region can be determined once for each call site and the table of a thread
+ *  is just an array indexed by the region id.
+ */
 
 class COMMON_DLL_IMPORTEXPORT RegionTable
 {
@@ -70,6 +75,25 @@ public:
 
     ~RegionTable();
 
+    /** Define a region, returns the global id of the region.
+     *
+     *  @param[in] name   is the name of the region
+     *  @param[in] file   is the name of the source file where region is defined
+     *  @param[in] lno    is the line number of the region in the source file
+     *
+     *  This method is thread-safe but involves a lock and a lookup by the name. Therefore
+     *  the region id should be determined only once for each call site.
+     */
+    static int defineRegion( const char* name, const char* file, int lno );
+
+    /** Get the global id of a region by its name, returns -1 if region has never been defined. */
+
+    static int findRegion( const char* name );
+
+    /** Get the name of a region by its global id. */
+
+    static std::string getRegionName( int regionId );
+
     /** Get the id of a region, creates a new entry if region is not available yet.
      *
      *  @param[in] name   is the name of the region
@@ -89,9 +113,17 @@ public:
 
     double elapsed( int regionId );
 
-    /** Get full region record by its id. */
+    /** Get full region record by its id, the entry in this table is set up with the first access. */
+
+    RegionEntry& getRegion( int regionId )
+    {
+        if ( static_cast<size_t>( regionId ) >= array.size() || array[regionId].mName.empty() )
+        {
+            initRegion( regionId );
+        }
 
-    RegionEntry& getRegion( int regionId );
+        return array[regionId];
+    }
 
     /** Get full region record by its id. */
 
@@ -105,18 +137,11 @@ private:
 
     SCAI_LOG_DECL_STATIC_LOGGER( logger )
 
-    // CallStack callStack;
+    /** Set up the entry for a region in this table by the global region data. */
 
-    std::vector<RegionEntry> array; //!<  Entries for all timers
-
-    typedef std::map<std::string, int> MapRegion;
-
-    /** Map of region strings to region ids that are the indexes to array.
-     *
-     *  Timer strings are stored as std::string and not as const char*
-     */
+    void initRegion( int regionId );
 
-    MapRegion mapTimer;
+    std::vector<RegionEntry> array; //!<  Entries for all timers, indexed by global region id
 
     std::string mThreadName;
 };
@@ -33,6 +33,8 @@
 // local library
 #include <scai/tracing/VTInterface.hpp>
 #include <scai/tracing/TraceData.hpp>
+#include <scai/tracing/TraceEvents.hpp>
+#include <scai/tracing/HardwareCounters.hpp>
 
 #include <scai/common/macros/throw.hpp>
 #include <scai/common/Settings.hpp>
@@ -91,6 +93,10 @@ void TraceConfig::setKey( const std::string& key, const std::string& value )
     {
         mTraceFilePrefix = value;
     }
+    else if ( key == "COUNTERS" )
+    {
+        HardwareCounters::configure( value );
+    }
     else
     {
         SCAI_LOG_WARN( logger, key << " is unknown key for TRACE configuration" )
@@ -138,6 +144,15 @@ void TraceConfig::setParam( const std::string& param )
     {
         mCallTreeEnabled = true;
     }
+    else if ( param == "EVENTS" )
+    {
+        mEventTraceEnabled = true;
+    }
+    else if ( param == "CHROME" )
+    {
+        mEventTraceEnabled = true;
+        mChromeFormat = true;
+    }
     else
     {
         SCAI_LOG_WARN( logger, param << " is unknown option for TRACE" )
@@ -153,6 +168,8 @@ TraceConfig::TraceConfig()
     mVampirTraceEnabled = false;
     mTimeTraceEnabled = false;
     mCallTreeEnabled = false;
+    mEventTraceEnabled = false;
+    mChromeFormat = false;
     mTraceFilePrefix = "_";
     // value of environmentvariable:  param1:param2=valx:param3:param4=valy
     std::vector<std::string> values;
@@ -196,7 +213,7 @@ TraceConfig::TraceConfig()
     {
         SCAI_LOG_WARN( logger,
                        SCAI_ENV_TRACE_CONFIG << " not set, tracing is disabled."
-                       << " Enable by " << SCAI_ENV_TRACE_CONFIG << "=time|ct[:vt][:thread]" )
+                       << " Enable by " << SCAI_ENV_TRACE_CONFIG << "=time|ct|events|chrome[:vt][:thread]" )
     }
 
     // enable/disable VampirTrace, action needed now
@@ -227,6 +244,12 @@ TraceConfig::TraceConfig()
 #endif
     }
 
+    if ( mEnabled && mEventTraceEnabled )
+    {
+        EventFormat format = mChromeFormat ? EventFormat::CHROME : EventFormat::TEXT;
+        mEventWriter.reset( new EventWriter( mTraceFilePrefix.c_str(), format ) );
+    }
+
     // save id of this main thread
     mMaster = std::this_thread::get_id();
     SCAI_LOG_INFO( logger, "ThreadConfig: enabled = " << mEnabled )
@@ -289,6 +312,17 @@ TraceConfig::~TraceConfig()
 
 /* -------------------------------------------------------------------------- */
 
+void TraceConfig::setClockOffset( const int64_t offset )
+{
+    if ( mEventWriter.get() != NULL )
+    {
+        SCAI_LOG_INFO( logger, "set clock offset for events = " << offset )
+        mEventWriter->setClockOffset( offset );
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+
 static std::mutex mapMutex; // needed to avoid conflicts for accesses on mTraceDataMap
 
 /* -------------------------------------------------------------------------- */
@@ -328,7 +362,8 @@ TraceData* TraceConfig::getTraceData( std::thread::id threadId )
         // this thread calls the first time a region
         try
         {
-            traceData.reset( new TraceData( mTraceFilePrefix.c_str(), threadId, mThreadEnabled, mCallTreeEnabled ) );
+            traceData.reset( new TraceData( mTraceFilePrefix.c_str(), threadId, mThreadEnabled, mCallTreeEnabled,
+                                            mEventWriter.get() ) );
         }
         catch ( common::Exception& ex )
         {
@@ -348,6 +383,36 @@ TraceData* TraceConfig::getTraceData( std::thread::id threadId )
 
 /* -------------------------------------------------------------------------- */
 
+/** Trace context of each thread, set up with the first traced region of the thread. 
+ *
+ *  Note: the context does not keep a shared pointer to the configuration as OpenMP threads
+ *        might never terminate.
+ */
+static thread_local TraceConfig::ThreadContext threadContext;
+
+const TraceConfig::ThreadContext& TraceConfig::getThreadContext()
+{
+    TraceConfig::ThreadContext& context = threadContext;
+
+    if ( context.mConfig != NULL && context.mConfig == config.get() )
+    {
+        return context;
+    }
+
+    TraceConfig& traceConfig = getInstance();
+
+    context.mConfig      = &traceConfig;
+    context.mTraceData   = traceConfig.getTraceData();
+    context.mTimeTrace   = traceConfig.mTimeTraceEnabled;
+    context.mCallTree    = traceConfig.mCallTreeEnabled;
+    context.mVampirTrace = traceConfig.mVampirTraceEnabled;
+    context.mEventTrace  = traceConfig.mEventTraceEnabled;
+
+    return context;
+}
+
+/* -------------------------------------------------------------------------- */
+
 TraceConfig::TraceScope::TraceScope( bool flag )
 {
     saveFlag = TraceConfig::globalTraceFlag;
@@ -42,6 +42,7 @@
 #include <string>
 #include <map>
 #include <memory>
+#include <cstdint>
 
 namespace scai
 {
@@ -50,6 +51,7 @@ namespace tracing
 {
 
 class TraceData;
+class EventWriter;
 
 /** Name of environment variable used to specify trace configuration. */
 
@@ -123,6 +125,19 @@ public:
         return mCallTreeEnabled;
     }
 
+    bool isEventTraceEnabled()
+    {
+        return mEventTraceEnabled;
+    }
+
+    /** 
+     *  Set the offset that is added to all time stamps of recorded events.
+     *
+     *  This method is used to align the clocks of different processes, e.g. by a communicator
+     *  at startup. It has no effect if events are not recorded.
+     */
+    void setClockOffset( const int64_t offset );
+
     const char* getFilePrefix() const
     {
         return getInstance().mTraceFilePrefix.c_str();
@@ -137,6 +152,27 @@ public:
 
     void traceOff();
 
+    /** 
+     *  Structure with all settings that are needed by a thread to trace a region.
+     */
+    struct ThreadContext
+    {
+        TraceConfig* mConfig = NULL;     //!< configuration for which context has been set up
+        TraceData* mTraceData = NULL;    //!< trace data of the thread, NULL if thread is not traced
+        bool mTimeTrace = false;
+        bool mCallTree = false;
+        bool mVampirTrace = false;
+        bool mEventTrace = false;
+    };
+
+    /** 
+     *  Get the trace context of the calling thread.
+     *
+     *  The context is kept in thread-local storage and set up only with the first call
+     *  of a thread, so later calls require neither a lock nor a lookup by the thread id.
+     */
+    static const ThreadContext& getThreadContext();
+
     /** Helper class for setting global trace flag in a scope
      *  (Constructor sets global flag, destructor resets it)
      */
@@ -177,12 +213,22 @@ private:
 
     bool mVampirTraceEnabled;
 
+    bool mEventTraceEnabled;
+
+    bool mChromeFormat;  //!< if true events are written in the chrome trace event format
+
     void enableVampirTrace( bool flag ); // switch trace on / off
 
     bool mThreadEnabled; //!< true if trace should also be done for threads
 
     std::string mTraceFilePrefix;
 
+    /** Writes the recorded events of all threads, must be declared before the map with the
+     *  trace data so that it is destroyed after the event buffers have been flushed.
+     */
+
+    std::unique_ptr<EventWriter> mEventWriter;
+
     /** Each thread will have its own table for region timing.
      *  Use of shared pointer for entry in map
      */
@@ -104,6 +104,11 @@ void TraceData::leave( const int regionId, RegionEntry& region )
 
     region.addCall( spentTime );
 
+    if ( enabledCounters() > 1 )
+    {
+        region.addCounters( costs );
+    }
+
     SCAI_LOG_DEBUG( logger, "Region " << regionId << ": spent time = " << spentTime )
 
     if ( mCallTreeTable.get() != NULL )
@@ -155,7 +160,7 @@ int TraceData::getCurrentRegionId( const char* regionName )
     return regionId;
 }
 
-TraceData::TraceData( const char* prefix, ThreadId threadId, bool mThreadEnabled, bool callTreeFlag ) :
+TraceData::TraceData( const char* prefix, ThreadId threadId, bool mThreadEnabled, bool callTreeFlag, EventWriter* eventWriter ) :
     mThreadId( threadId ),
     mRegionTable( mThreadEnabled ? common::thread::getThreadName( threadId )->c_str() : NULL )
 {
@@ -166,9 +171,22 @@ TraceData::TraceData( const char* prefix, ThreadId threadId, bool mThreadEnabled
         mCallTreeTable.reset( new CallTreeTable( prefix, threadName ) );
     }
 
+    if ( eventWriter != NULL )
+    {
+        mEventBuffer.reset( new EventBuffer( *eventWriter, common::thread::getThreadName( threadId )->c_str() ) );
+    }
+
     SCAI_LOG_DEBUG( logger, "TraceData for thread " << threadId )
 }
 
+void TraceData::flushEvents()
+{
+    if ( mEventBuffer.get() != NULL )
+    {
+        mEventBuffer->flush();
+    }
+}
+
 TraceData::~TraceData()
 {
     SCAI_LOG_DEBUG( logger, "~TraceData for thread " << mThreadId )
@@ -33,6 +33,8 @@
 #include <scai/tracing/RegionTable.hpp>
 #include <scai/tracing/CallStack.hpp>
 #include <scai/tracing/CallTreeTable.hpp>
+#include <scai/tracing/TraceEvents.hpp>
+#include <scai/tracing/Counters.hpp>
 
 #include <scai/common/thread.hpp>
 
@@ -58,9 +60,10 @@ public:
      *  @param[in] threadId  id of the thread to which data belongs
      *  @param[in] threadEnabled if true tracing is done for all threads
      *  @param[in] callTreeFlag if true call tree trace file will be generated
+     *  @param[in] eventWriter if not NULL all enter and leave events are recorded and written by it
      */
 
-    TraceData( const char* prefix, ThreadId threadId, bool threadEnabled, bool callTreeFlag );
+    TraceData( const char* prefix, ThreadId threadId, bool threadEnabled, bool callTreeFlag, EventWriter* eventWriter );
 
     /** Destructor. */
 
@@ -87,6 +90,19 @@ public:
      */
     void leave( const int regionId, RegionEntry& region );
 
+    /** Record an enter or leave event of a region with the current time stamp. 
+     *
+     *  Only allowed if trace data has been constructed with an event writer.
+     */
+    void addEvent( const int regionId, const EventKind kind )
+    {
+        mEventBuffer->add( regionId, kind, timestamp() );
+    }
+
+    /** Hand over all recorded events to the event writer. */
+
+    void flushEvents();
+
     /** Get the id of a region, creates a new entry if region is not available yet.
      *
      *  @param[in] regionName is the name of the region
@@ -124,6 +140,8 @@ private:
 
     std::unique_ptr<CallTreeTable> mCallTreeTable;   // generates call tree trace file
 
+    std::unique_ptr<EventBuffer> mEventBuffer;       // records enter and leave events
+
 protected:
 
     SCAI_LOG_DECL_STATIC_LOGGER( logger )
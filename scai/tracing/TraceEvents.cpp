@@ -0,0 +1,397 @@
+/**
+ * @file TraceEvents.cpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Implementation of the per-thread trace event buffers and their asynchronous writer.
+ * @author Thomas Brandes
+ * @date 18.10.2018
+ */
+
+// hpp
+#include <scai/tracing/TraceEvents.hpp>
+
+// local library
+#include <scai/tracing/RegionTable.hpp>
+#include <scai/tracing/Counters.hpp>
+
+// internal scai libraries
+#include <scai/common/Settings.hpp>
+
+// std
+#include <sstream>
+#include <string>
+
+namespace scai
+{
+
+namespace tracing
+{
+
+/* -------------------------------------------------------------------------- */
+
+SCAI_LOG_DEF_LOGGER( EventWriter::logger, "EventWriter" )
+
+/* -------------------------------------------------------------------------- */
+
+EventWriter::EventWriter( const char* prefix, const EventFormat format ) :
+
+    mPrefix( prefix ),
+    mFormat( format ),
+    mRank( 0 ),
+    mStop( false ),
+    mNumThreads( 0 ),
+    mClockOffset( 0 )
+{
+    mThread = std::thread( &EventWriter::run, this );
+}
+
+/* -------------------------------------------------------------------------- */
+
+EventWriter::~EventWriter()
+{
+    {
+        std::unique_lock<std::mutex> lock( mMutex );
+        mStop = true;
+    }
+
+    mNotify.notify_one();
+
+    mThread.join();
+
+    if ( mOutFile.is_open() )
+    {
+        if ( mFormat == EventFormat::CHROME )
+        {
+            mOutFile << std::endl << "]}" << std::endl;
+        }
+
+        mOutFile.close();
+    }
+
+    SCAI_LOG_DEBUG( logger, "~EventWriter finished" )
+}
+
+/* -------------------------------------------------------------------------- */
+
+int EventWriter::newThread()
+{
+    std::unique_lock<std::mutex> lock( mMutex );
+    return mNumThreads++;
+}
+
+/* -------------------------------------------------------------------------- */
+
+void EventWriter::setClockOffset( const int64_t offset )
+{
+    std::unique_lock<std::mutex> lock( mMutex );
+    mClockOffset = offset;
+}
+
+/* -------------------------------------------------------------------------- */
+
+void EventWriter::write( EventChunk& chunk )
+{
+    {
+        std::unique_lock<std::mutex> lock( mMutex );
+
+        mQueue.push_back( EventChunk() );
+
+        EventChunk& newChunk = mQueue.back();
+
+        newChunk.mThread = chunk.mThread;
+        newChunk.mThreadName = chunk.mThreadName;
+        newChunk.mEvents.swap( chunk.mEvents );
+    }
+
+    mNotify.notify_one();
+}
+
+/* -------------------------------------------------------------------------- */
+
+void EventWriter::run()
+{
+    std::unique_lock<std::mutex> lock( mMutex );
+
+    while ( true )
+    {
+        mNotify.wait( lock, [this] { return mStop || !mQueue.empty(); } );
+
+        while ( !mQueue.empty() )
+        {
+            EventChunk chunk = std::move( mQueue.front() );
+            mQueue.pop_front();
+
+            const int64_t clockOffset = mClockOffset;
+
+            // the recording threads can continue while the chunk is written
+
+            lock.unlock();
+            writeChunk( chunk, clockOffset );
+            lock.lock();
+        }
+
+        if ( mStop )
+        {
+            break;
+        }
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+
+/** Append the decimal representation of an unsigned number to a string. */
+
+static inline void appendNumber( std::string& s, uint64_t val )
+{
+    char digits[24];
+
+    int n = 0;
+
+    do
+    {
+        digits[n++] = static_cast<char>( '0' + val % 10 );
+        val /= 10;
+    }
+    while ( val > 0 );
+
+    while ( n > 0 )
+    {
+        s += digits[--n];
+    }
+}
+
+/* -------------------------------------------------------------------------- */
+
+bool EventWriter::openFile()
+{
+    std::ostringstream fileName;
+
+    fileName << mPrefix << ( mFormat == EventFormat::CHROME ? ".json" : ".events" );
+
+    if ( common::Settings::getEnvironment( mRank, "SCAI_RANK" ) )
+    {
+        fileName << "." << mRank;
+    }
+    else
+    {
+        mRank = 0;
+    }
+
+    mOutFile.open( fileName.str().c_str(), std::ios::out );
+
+    if ( mOutFile.fail() )
+    {
+        SCAI_LOG_ERROR( logger, "Could not open " << fileName.str() << " for writing trace events." )
+        return false;
+    }
+
+    SCAI_LOG_INFO( logger, "write trace events into file " << fileName.str() )
+
+    if ( mFormat == EventFormat::CHROME )
+    {
+        mOutFile << "{\"traceEvents\":[" << std::endl;
+        mOutFile << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << mRank 
+                 << ",\"tid\":0,\"args\":{\"name\":\"rank " << mRank << "\"}}";
+    }
+    else
+    {
+        mOutFile << "# SCAI trace events: <thread> B|E <region> <timestamp>" << std::endl;
+        mOutFile << "rate " << timerate() << std::endl;
+    }
+
+    return true;
+}
+
+/* -------------------------------------------------------------------------- */
+
+/** Escape a string so that it can be used as string value in JSON. */
+
+static std::string jsonString( const std::string& s )
+{
+    std::string result;
+
+    for ( size_t i = 0; i < s.length(); ++i )
+    {
+        const char c = s[i];
+
+        if ( c == '"' || c == '\\' )
+        {
+            result += '\\';
+            result += c;
+        }
+        else if ( static_cast<unsigned char>( c ) >= 0x20 )
+        {
+            result += c;
+        }
+    }
+
+    return result;
+}
+
+/* -------------------------------------------------------------------------- */
+
+void EventWriter::writeChunk( const EventChunk& chunk, const int64_t clockOffset )
+{
+    if ( !mOutFile.is_open() && !openFile() )
+    {
+        return;
+    }
+
+    if ( static_cast<size_t>( chunk.mThread ) >= mThreadWritten.size() )
+    {
+        mThreadWritten.resize( chunk.mThread + 1, false );
+    }
+
+    const bool isChrome = mFormat == EventFormat::CHROME;
+
+    if ( !mThreadWritten[chunk.mThread] )
+    {
+        if ( isChrome )
+        {
+            mOutFile << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << mRank << ",\"tid\":" << chunk.mThread
+                     << ",\"args\":{\"name\":\"" << jsonString( chunk.mThreadName ) << "\"}}";
+        }
+        else
+        {
+            mOutFile << "thread " << chunk.mThread << " " << chunk.mThreadName << std::endl;
+        }
+
+        mThreadWritten[chunk.mThread] = true;
+    }
+
+    // events are formatted in a local buffer as stream output for each event is too slow
+
+    std::string buffer;
+
+    buffer.reserve( chunk.mEvents.size() * ( isChrome ? 64 : 32 ) );
+
+    std::string threadPrefix = std::to_string( chunk.mThread );
+
+    // chrome trace events have time stamps in microseconds
+
+    const double nsPerTick = 1e9 / static_cast<double>( timerate() );
+
+    for ( size_t i = 0; i < chunk.mEvents.size(); ++i )
+    {
+        const TraceEvent& event = chunk.mEvents[i];
+
+        if ( static_cast<size_t>( event.mRegionId ) >= mRegionNames.size() )
+        {
+            mRegionNames.resize( event.mRegionId + 1 );
+        }
+
+        std::string& regionName = mRegionNames[event.mRegionId];
+
+        if ( regionName.empty() )
+        {
+            regionName = RegionTable::getRegionName( event.mRegionId );
+
+            if ( isChrome )
+            {
+                regionName = jsonString( regionName );
+            }
+            else
+            {
+                buffer += "region " + std::to_string( event.mRegionId ) + " " + regionName + "\n";
+            }
+        }
+
+        int64_t ts = static_cast<int64_t>( event.mTimestamp ) + clockOffset;
+
+        if ( ts < 0 )
+        {
+            ts = 0;  // might only happen for events before clocks have been synchronized
+        }
+
+        if ( isChrome )
+        {
+            uint64_t ns = nsPerTick == 1.0 ? ts : static_cast<uint64_t>( ts * nsPerTick );
+
+            buffer += ",\n{\"name\":\"";
+            buffer += regionName;
+            buffer += event.mKind == EventKind::ENTER ? "\",\"ph\":\"B\",\"pid\":" : "\",\"ph\":\"E\",\"pid\":";
+            appendNumber( buffer, mRank );
+            buffer += ",\"tid\":";
+            buffer += threadPrefix;
+            buffer += ",\"ts\":";
+            appendNumber( buffer, ns / 1000 );
+            buffer += '.';
+            buffer += static_cast<char>( '0' + ( ns / 100 ) % 10 );
+            buffer += static_cast<char>( '0' + ( ns / 10 ) % 10 );
+            buffer += static_cast<char>( '0' + ns % 10 );
+            buffer += '}';
+        }
+        else
+        {
+            buffer += threadPrefix;
+            buffer += event.mKind == EventKind::ENTER ? " B " : " E ";
+            appendNumber( buffer, static_cast<uint64_t>( event.mRegionId ) );
+            buffer += ' ';
+            appendNumber( buffer, ts );
+            buffer += '\n';
+        }
+    }
+
+    mOutFile.write( buffer.c_str(), buffer.size() );
+}
+
+/* -------------------------------------------------------------------------- */
+
+EventBuffer::EventBuffer( EventWriter& writer, const char* threadName ) :
+
+    mWriter( writer )
+{
+    mChunk.mThread = writer.newThread();
+
+    if ( threadName != NULL )
+    {
+        mChunk.mThreadName = threadName;
+    }
+
+    mChunk.mEvents.reserve( CHUNK_SIZE );
+}
+
+/* -------------------------------------------------------------------------- */
+
+EventBuffer::~EventBuffer()
+{
+    flush();
+}
+
+/* -------------------------------------------------------------------------- */
+
+void EventBuffer::flush()
+{
+    if ( mChunk.mEvents.empty() )
+    {
+        return;
+    }
+
+    mWriter.write( mChunk );
+
+    mChunk.mEvents.reserve( CHUNK_SIZE );
+}
+
+} /* end namespace tracing */
+
+} /* end namespace scai */
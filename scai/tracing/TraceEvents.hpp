@@ -0,0 +1,222 @@
+/**
+ * @file TraceEvents.hpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Definition of append-only per-thread buffers for trace events and their asynchronous writer.
+ * @author Thomas Brandes
+ * @date 18.10.2018
+ */
+
+#pragma once
+
+// for dll_import
+#include <scai/common/config.hpp>
+
+// base classes
+#include <scai/common/NonCopyable.hpp>
+
+// internal scai libraries
+#include <scai/logging.hpp>
+
+// std
+#include <string>
+#include <vector>
+#include <deque>
+#include <fstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+
+namespace scai
+{
+
+namespace tracing
+{
+
+/** Kind of a trace event. */
+
+enum class EventKind : int
+{
+    ENTER,   //!< entering a region
+    LEAVE    //!< leaving a region
+};
+
+/** Format of the file written for the trace events. */
+
+enum class EventFormat : int
+{
+    TEXT,    //!< one line for each event, <prefix>.events
+    CHROME   //!< trace event JSON format as used by chrome://tracing or Perfetto, <prefix>.json
+};
+
+/** Structure for a single trace event, time stamp as given by tracing::timestamp() */
+
+struct TraceEvent
+{
+    uint64_t  mTimestamp;
+    int       mRegionId;
+    EventKind mKind;
+};
+
+/** A chunk of events of one thread that is handed over to the writer. */
+
+struct EventChunk
+{
+    int mThread;                       //!< number of the thread that has recorded the events
+    std::string mThreadName;           //!< name of the thread, might be empty
+    std::vector<TraceEvent> mEvents;
+};
+
+/** 
+ *  @brief Class that writes chunks of trace events into a file by a background thread.
+ *
+ *  The threads that record events only hand over full chunks so they are never blocked
+ *  by file output. The file is opened with the first chunk written, so the rank of the 
+ *  process (environment variable SCAI_RANK) is known when the file name is built.
+ *
+ *  In the CHROME format the rank is used as process id and the thread number as thread id,
+ *  time stamps are given in microseconds.
+ */
+class COMMON_DLL_IMPORTEXPORT EventWriter : private common::NonCopyable
+{
+public:
+
+    /** Constructor starts the background thread.
+     *
+     *  @param[in] prefix is the first part of the file name
+     *  @param[in] format specifies the format of the output file
+     */
+    EventWriter( const char* prefix, const EventFormat format );
+
+    /** Destructor writes all pending chunks and stops the background thread. */
+
+    ~EventWriter();
+
+    /** Hand over a chunk of events, will be written asynchronously. */
+
+    void write( EventChunk& chunk );
+
+    /** Set an offset that is added to all time stamps when they are written.
+     *
+     *  The offset is used to align the clocks of different processes. It is applied
+     *  to all chunks written after this call, so it should be set at program start.
+     */
+
+    void setClockOffset( const int64_t offset );
+
+    /** Get a new unique number for a thread that records events. */
+
+    int newThread();
+
+private:
+
+    /** Routine executed by the background thread. */
+
+    void run();
+
+    /** Open the output file and write the header, returns false if file cannot be opened. */
+
+    bool openFile();
+
+    /** Write one chunk into the output file. */
+
+    void writeChunk( const EventChunk& chunk, const int64_t clockOffset );
+
+    std::string mPrefix;
+
+    EventFormat mFormat;
+
+    int mRank;                          // rank of this process, used as pid for CHROME format
+
+    std::ofstream mOutFile;
+
+    std::vector<bool> mThreadWritten;   // set for threads whose name has been written
+    std::vector<std::string> mRegionNames;  // names of regions already written, escaped for CHROME
+
+    std::deque<EventChunk> mQueue;      // chunks not written yet
+
+    std::mutex mMutex;                  // protects mQueue, mStop, mNumThreads, mClockOffset
+
+    std::condition_variable mNotify;
+
+    bool mStop;
+
+    int mNumThreads;
+
+    int64_t mClockOffset;
+
+    std::thread mThread;
+
+    SCAI_LOG_DECL_STATIC_LOGGER( logger )
+};
+
+/** 
+ *  @brief Append-only buffer for the trace events of one thread.
+ *
+ *  An event is just appended to a preallocated array, only full arrays are handed
+ *  over to the writer. Therefore the buffer must only be used by one thread.
+ */
+class COMMON_DLL_IMPORTEXPORT EventBuffer : private common::NonCopyable
+{
+public:
+
+    /** Constructor of a buffer for the calling thread 
+     *
+     *  @param[in] writer is used to write the full chunks
+     *  @param[in] threadName is the name of the thread (might be NULL)
+     */
+    EventBuffer( EventWriter& writer, const char* threadName );
+
+    /** Destructor flushes all recorded events */
+
+    ~EventBuffer();
+
+    /** Add a new event, time stamp is taken here. */
+
+    void add( const int regionId, const EventKind kind, const uint64_t timestamp )
+    {
+        mChunk.mEvents.push_back( TraceEvent( { timestamp, regionId, kind } ) );
+
+        if ( mChunk.mEvents.size() == CHUNK_SIZE )
+        {
+            flush();
+        }
+    }
+
+    /** Hand over all recorded events to the writer. */
+
+    void flush();
+
+private:
+
+    static const size_t CHUNK_SIZE = 65536;   // number of events handed over at once
+
+    EventWriter& mWriter;
+
+    EventChunk mChunk;
+};
+
+} /* end namespace tracing */
+
+} /* end namespace scai */
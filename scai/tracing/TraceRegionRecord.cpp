@@ -63,21 +63,19 @@ void TraceRegionRecord::initSettings()
         return;
     }
 
-    mTraceConfig = TraceConfig::getInstancePtr();
+    // thread context is set up only once for each thread, so no lock is needed here
 
-    if ( !mTraceConfig->isEnabled() )
-    {
-        return;
-    }
+    const TraceConfig::ThreadContext& context = TraceConfig::getThreadContext();
 
-    mTraceData = mTraceConfig->getTraceData();
+    mTraceData = context.mTraceData;
 
     if ( mTraceData )
     {
         // get detailed info about what to trace
-        mTimeTrace   = mTraceConfig->isTimeTraceEnabled();
-        mCallTree    = mTraceConfig->isCallTreeEnabled();
-        mVampirTrace = mTraceConfig->isVampirTraceEnabled();
+        mTimeTrace   = context.mTimeTrace;
+        mCallTree    = context.mCallTree;
+        mVampirTrace = context.mVampirTrace;
+        mEventTrace  = context.mEventTrace;
     }
 }
 
@@ -97,6 +95,22 @@ TraceRegionRecord::TraceRegionRecord( const char* regionName, const char* file,
 
 /* -------------------------------------------------------------------------- */
 
+TraceRegionRecord::TraceRegionRecord( const int regionId )
+{
+    initSettings();
+
+    mRegionId = regionId;
+}
+
+/* -------------------------------------------------------------------------- */
+
+int TraceRegionRecord::defineRegion( const char* regionName, const char* file, int lno )
+{
+    return RegionTable::defineRegion( regionName, file, lno );
+}
+
+/* -------------------------------------------------------------------------- */
+
 TraceRegionRecord::TraceRegionRecord( const char* regionName )
 {
     initSettings();
@@ -157,6 +171,11 @@ void TraceRegionRecord::enter()
         mTraceData->enter( mRegionId, regionEntry );
     }
 
+    if ( mEventTrace )
+    {
+        mTraceData->addEvent( mRegionId, EventKind::ENTER );
+    }
+
     if ( mVampirTrace )
     {
         VTInterface::enter( regionEntry );
@@ -180,6 +199,11 @@ void TraceRegionRecord::leave()
         mTraceData->leave( mRegionId, regionEntry );
     }
 
+    if ( mEventTrace )
+    {
+        mTraceData->addEvent( mRegionId, EventKind::LEAVE );
+    }
+
     if ( mVampirTrace )
     {
         VTInterface::leave( regionEntry );
@@ -197,6 +221,14 @@ void TraceRegionRecord::start( const char* regionName, const char* file, int lno
 
 /* -------------------------------------------------------------------------- */
 
+void TraceRegionRecord::start( const int regionId )
+{
+    TraceRegionRecord record( regionId );
+    record.enter();
+}
+
+/* -------------------------------------------------------------------------- */
+
 void TraceRegionRecord::stop( const char* regionName )
 {
     // static version has to build a new record
@@ -208,7 +240,7 @@ void TraceRegionRecord::stop( const char* regionName )
 
 double TraceRegionRecord::spentLast( const char* name )
 {
-    TraceData* traceData = TraceConfig::getInstance().getTraceData();
+    TraceData* traceData = TraceConfig::getThreadContext().mTraceData;
 
     if ( !traceData )
     {
@@ -36,7 +36,6 @@
 // internal scai libraries
 #include <scai/logging.hpp>
 
-#include <memory>
 
 namespace scai
 {
@@ -67,6 +66,13 @@ public:
 
     TraceRegionRecord( const char* regionName, const char* fileName, int lno );
 
+    /** Constructor of a tracer object for a region that has already been defined.
+     *
+     *  @param[in] regionId is the global id of the region as returned by defineRegion
+     */
+
+    TraceRegionRecord( const int regionId );
+
     /** Same as before but additional integer value that is used as suffix for region name.
      */
 
@@ -91,10 +97,22 @@ public:
      */
     static double spentLast( const char* regionName );
 
+    /** Define a region and return its global id.
+     *
+     *  This method involves a lock, so the id should be determined only once for
+     *  each call site, e.g. by a static variable.
+     */
+
+    static int defineRegion( const char* regionName, const char* file, int lno );
+
     /** Generate only a 'start region' entry in trace file. */
 
     static void start( const char* regionName, const char* file, int lno );
 
+    /** Same as before but for a region that has already been defined. */
+
+    static void start( const int regionId );
+
     /** Generate only a 'end region' entry in trace file. */
 
     static void stop( const char* regionName );
@@ -113,13 +131,6 @@ private:
 
     void initSettings();
 
-    /** Each region timing keeps a shared pointer to the configuration.
-     *  By this way it is guaranteed that timer information is only printed
-     *  when all timings even of running threads are finished.
-     */
-
-    std::shared_ptr<class TraceConfig> mTraceConfig;
-
     class TraceData* mTraceData; // pointer to all trace data of the thread
 
     int mRegionId;// Reference id of region in region table.
@@ -127,6 +138,7 @@ private:
     bool mTimeTrace;//!< set to true if timing should be done
     bool mCallTree;//!< set to true if calltree tracing should be done
     bool mVampirTrace;//!< set to true if Vampir trace should be done
+    bool mEventTrace;//!< set to true if events should be recorded
 
     double mStartTime;//!< walltime of region start
 };
@@ -135,6 +147,15 @@ class ScopedTraceRecord : private TraceRegionRecord
 {
 public:
 
+    ScopedTraceRecord( const int regionId ) :
+
+        TraceRegionRecord( regionId )
+
+    {
+        SCAI_LOG_DEBUG( logger, "ScopedTraceRecord" )
+        enter();
+    }
+
     ScopedTraceRecord( const char* regionName, const char* fileName, int lno ) :
 
         TraceRegionRecord( regionName, fileName, lno )
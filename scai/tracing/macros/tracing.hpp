@@ -34,9 +34,23 @@
 #include <scai/tracing/TraceRegionRecord.hpp>
 #include <scai/tracing/TraceConfig.hpp>
 
-#define SCAI_REGION( name ) scai::tracing::ScopedTraceRecord SCAI_Trc__( name, __FILE__, __LINE__ );
+/*
+ * The id of a region is determined only once for each call site and cached in a
+ * static variable, so name must be a constant string for SCAI_REGION and SCAI_REGION_START.
+ */
+
+#define SCAI_REGION( name )                                                                       \
+    static const int SCAI_RegionId__ = scai::tracing::TraceRegionRecord::defineRegion( name, __FILE__, __LINE__ ); \
+    scai::tracing::ScopedTraceRecord SCAI_Trc__( SCAI_RegionId__ );
+
 #define SCAI_REGION_N( name, n ) scai::tracing::ScopedTraceRecord SCAI_Trc__( name, n, __FILE__, __LINE__ );
-#define SCAI_REGION_START( name ) scai::tracing::TraceRegionRecord::start( name, __FILE__, __LINE__ );
+
+#define SCAI_REGION_START( name )                                                                 \
+    {                                                                                             \
+        static const int SCAI_RegionId__ = scai::tracing::TraceRegionRecord::defineRegion( name, __FILE__, __LINE__ ); \
+        scai::tracing::TraceRegionRecord::start( SCAI_RegionId__ );                               \
+    }
+
 #define SCAI_REGION_END( name ) scai::tracing::TraceRegionRecord::stop( name );
 #define SCAI_TRACE_SCOPE( flag ) scai::tracing::TraceConfig::TraceScope SCAI_Scp__( flag );
 
@@ -55,8 +55,8 @@ struct FFTKernelTrait
          *
          *  @param[in,out] array used for input and output, size is k x n
          *  @param[in] k is the number of vectors
-         *  @param[in] n is the length of each vector, must be power of 2
-         *  @param[in] m is the log of n, so that n == 2**m
+         *  @param[in] n is the length of each vector, any positive number
+         *  @param[in] m is the log of n rounded up, so that 2**(m-1) < n <= 2**m
          *  @param[in] direction is either 1 (forward) or -1 (backward)
          *
          *  The vectors are stored continguously.
@@ -74,6 +74,55 @@ struct FFTKernelTrait
         }
     };
 
+    template <typename ValueType>
+    struct fft_r2c
+    {
+        /** @brief one dimensional forward fft of multiple real vectors
+         *
+         *  @param[out] result is the array with the transformed vectors, size is k x ( n / 2 + 1 )
+         *  @param[in] x is the array with the real input vectors, size is k x n
+         *  @param[in] k is the number of vectors
+         *  @param[in] n is the length of each input vector, any positive number
+         *
+         *  The result of a real vector is Hermitian, i.e. result[n-j] = conj( result[j] ), so
+         *  only the first n / 2 + 1 values of each transformed vector are computed (Hermitian-packed).
+         */
+        typedef void ( *FuncType ) ( 
+            common::Complex<ValueType> result[],
+            const ValueType x[],
+            const IndexType k,
+            const IndexType n );
+
+        static const char* getId()
+        {
+            return "FFTKernel.fft_r2c";
+        }
+    };
+
+    template <typename ValueType>
+    struct fft_c2r
+    {
+        /** @brief one dimensional backward fft of multiple Hermitian vectors with real result
+         *
+         *  @param[out] result is the array with the real result vectors, size is k x n
+         *  @param[in] x is the array with the Hermitian-packed input vectors, size is k x ( n / 2 + 1 )
+         *  @param[in] k is the number of vectors
+         *  @param[in] n is the length of each result vector, any positive number
+         *
+         *  This is the inverse of fft_r2c, the result is not normalized, i.e. scaled by n.
+         */
+        typedef void ( *FuncType ) ( 
+            ValueType result[],
+            const common::Complex<ValueType> x[],
+            const IndexType k,
+            const IndexType n );
+
+        static const char* getId()
+        {
+            return "FFTKernel.fft_c2r";
+        }
+    };
+
 #endif
 
 };
@@ -36,6 +36,7 @@
 #include <scai/utilskernel/SectionKernelTrait.hpp>
 
 #include <scai/common/macros/loop.hpp>
+#include <scai/common/Math.hpp>
 
 namespace scai
 {
@@ -53,20 +54,6 @@ using common::Complex;
 
 /* --------------------------------------------------------------------------- */
 
-static void pow2( IndexType& m, IndexType& n2, const IndexType n )
-{
-    m  = 0;
-    n2 = 1;
-
-    while ( n2 < n )
-    {
-        m  += 1;
-        n2 = n2 << 1;
-    }
-}
-
-/* --------------------------------------------------------------------------- */
-
 template<typename ValueType>
 void FFTUtils::fftcall(
     HArray<Complex<RealType<ValueType>>>& data, 
@@ -80,7 +67,7 @@ void FFTUtils::fftcall(
 
     static LAMAKernel<FFTKernelTrait::fft<RealType<ValueType>>> fft;
 
-    SCAI_ASSERT_EQ_ERROR( ( IndexType( 1 ) << m ), n, "n = " << n << " != 2 ** m = " << m )
+    SCAI_ASSERT_EQ_ERROR( common::Math::nextpow2( n ), m, "n = " << n << " does not fit to 2 ** m, m = " << m )
     SCAI_ASSERT_EQ_ERROR( k * n, data.size(), "size of data must be " << n << " x " << k )
 
     if ( !loc )
@@ -110,15 +97,11 @@ void FFTUtils::fft_many(
 {
     typedef Complex<RealType<ValueType>> FFTType;
 
-    IndexType ncols2;
-    IndexType m;
- 
-    pow2( m, ncols2, ncols );
-
-    SCAI_ASSERT_EQ_ERROR( ncols2, ncols, "not supported yet" )
+    const IndexType ncols2 = ncols;
+    const IndexType m = common::Math::nextpow2( ncols );
 
     SCAI_LOG_INFO( logger, "fft_many<" << common::TypeTraits<ValueType>::id() 
-                     << ">( array[ " << many << " x " << ncols << "], " << ncols2 << " = 2 ** " << m << ", dir = " << direction )
+                     << ">( array[ " << many << " x " << ncols << "], dir = " << direction )
  
     // copy input array x into result array and pad the rows with 0
 
@@ -182,6 +165,280 @@ void FFTUtils::fft_many(
 
 /* --------------------------------------------------------------------------- */
 
+/** Help routine that considers a grid as three-dimensional grid nBefore x n x nAfter */
+
+static void splitGrid( IndexType& nBefore, IndexType& nAfter, const common::Grid& grid, const IndexType dim )
+{
+    nBefore = 1;
+    nAfter  = 1;
+
+    for ( IndexType i = 0; i < dim; ++i )
+    {
+        nBefore *= grid.size( i );
+    }
+
+    for ( IndexType i = dim + 1; i < grid.nDims(); ++i )
+    {
+        nAfter *= grid.size( i );
+    }
+}
+
+/** Help routine to copy a three-dimensional section, tDist and sDist are the distances of 
+ *  the elements in each dimension for target and source array, used for the transposes.
+ */
+template<typename TargetType, typename SourceType>
+static void copyGrid3( 
+    HArray<TargetType>& target, 
+    const IndexType tDist[], 
+    const HArray<SourceType>& source,
+    const IndexType sDist[], 
+    const IndexType sizes[],
+    ContextPtr loc )
+{
+    static LAMAKernel<SectionKernelTrait::unaryOp<TargetType, SourceType> > unaryOp;
+
+    unaryOp.getSupportedContext( loc );
+
+    SCAI_CONTEXT_ACCESS( loc )
+
+    ReadAccess<SourceType> rSource( source, loc );
+    WriteOnlyAccess<TargetType> wTarget( target, loc, sizes[0] * sizes[1] * sizes[2] );
+
+    unaryOp[loc]( wTarget.get(), 3, sizes, tDist, rSource.get(), sDist, common::UnaryOp::COPY );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void FFTUtils::fftGrid(
+    HArray<Complex<RealType<ValueType>>>& data,
+    const common::Grid& grid,
+    const IndexType dim,
+    const int direction,
+    const ContextPtr context )
+{
+    typedef Complex<RealType<ValueType>> FFTType;
+
+    SCAI_ASSERT_VALID_INDEX_ERROR( dim, grid.nDims(), "illegal dim for FFT on grid " << grid )
+    SCAI_ASSERT_EQ_ERROR( data.size(), grid.size(), "size of data does not match grid " << grid )
+
+    // grid is considered as 3-dimensional grid nBefore x n x nAfter
+
+    const IndexType n = grid.size( dim );
+
+    IndexType nBefore;
+    IndexType nAfter;
+
+    splitGrid( nBefore, nAfter, grid, dim );
+
+    SCAI_LOG_INFO( logger, "fftGrid<" << common::TypeTraits<ValueType>::id() << ">( " << grid << ", dim = " << dim
+                           << " ), " << nBefore << " x " << n << " x " << nAfter << ", dir = " << direction )
+
+    if ( n <= 1 || data.size() == 0 )
+    {
+        return;
+    }
+
+    const IndexType m = common::Math::nextpow2( n );
+
+    if ( nAfter == 1 )
+    {
+        // vectors are contiguous
+
+        fftcall<ValueType>( data, nBefore, n, m, direction, context );
+        return;
+    }
+
+    ContextPtr loc = context ? context : data.getValidContext();
+
+    // transpose nBefore x n x nAfter -> nBefore x nAfter x n
+
+    IndexType sizes[3]     = { nBefore, n, nAfter };
+    IndexType gridDist[3]  = { n * nAfter, nAfter, 1 };
+    IndexType transDist[3] = { nAfter * n, 1, n };
+
+    HArray<FFTType> tmp;
+
+    copyGrid3( tmp, transDist, data, gridDist, sizes, loc );
+
+    fftcall<ValueType>( tmp, nBefore * nAfter, n, m, direction, loc );
+
+    copyGrid3( data, gridDist, tmp, transDist, sizes, loc );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void FFTUtils::fft_r2c(
+    HArray<Complex<ValueType>>& result,
+    const HArray<ValueType>& x,
+    const IndexType many,
+    const IndexType n,
+    const ContextPtr context )
+{
+    SCAI_ASSERT_EQ_ERROR( many * n, x.size(), "size of real data must be " << many << " x " << n )
+
+    static LAMAKernel<FFTKernelTrait::fft_r2c<ValueType>> fft_r2c;
+
+    ContextPtr loc = context ? context : x.getValidContext();
+
+    fft_r2c.getSupportedContext( loc );
+
+    SCAI_CONTEXT_ACCESS( loc )
+
+    ReadAccess<ValueType> rX( x, loc );
+    WriteOnlyAccess<Complex<ValueType>> wResult( result, loc, many * ( n / 2 + 1 ) );
+
+    fft_r2c[loc]( wResult.get(), rX.get(), many, n );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void FFTUtils::fft_c2r(
+    HArray<ValueType>& result,
+    const HArray<Complex<ValueType>>& x,
+    const IndexType many,
+    const IndexType n,
+    const ContextPtr context )
+{
+    SCAI_ASSERT_EQ_ERROR( many * ( n / 2 + 1 ), x.size(), "size of packed data must be " << many << " x " << ( n / 2 + 1 ) )
+
+    static LAMAKernel<FFTKernelTrait::fft_c2r<ValueType>> fft_c2r;
+
+    ContextPtr loc = context ? context : x.getValidContext();
+
+    fft_c2r.getSupportedContext( loc );
+
+    SCAI_CONTEXT_ACCESS( loc )
+
+    ReadAccess<Complex<ValueType>> rX( x, loc );
+    WriteOnlyAccess<ValueType> wResult( result, loc, many * n );
+
+    fft_c2r[loc]( wResult.get(), rX.get(), many, n );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void FFTUtils::fftGrid_r2c(
+    HArray<Complex<ValueType>>& result,
+    const HArray<ValueType>& x,
+    const common::Grid& grid,
+    const IndexType dim,
+    const ContextPtr context )
+{
+    SCAI_ASSERT_VALID_INDEX_ERROR( dim, grid.nDims(), "illegal dim for FFT on grid " << grid )
+    SCAI_ASSERT_EQ_ERROR( x.size(), grid.size(), "size of data does not match grid " << grid )
+
+    IndexType nBefore;
+    IndexType nAfter;
+
+    splitGrid( nBefore, nAfter, grid, dim );
+
+    const IndexType n  = grid.size( dim );
+    const IndexType nc = n / 2 + 1;
+
+    SCAI_LOG_INFO( logger, "fftGrid_r2c<" << common::TypeTraits<ValueType>::id() << ">( " << grid << ", dim = " << dim
+                           << " ), " << nBefore << " x " << n << " x " << nAfter )
+
+    if ( nAfter == 1 )
+    {
+        fft_r2c( result, x, nBefore, n, context );
+        return;
+    }
+
+    ContextPtr loc = context ? context : x.getValidContext();
+
+    // transpose nBefore x n x nAfter -> nBefore x nAfter x n, real data
+
+    HArray<ValueType> tmp;
+
+    {
+        IndexType sizes[3] = { nBefore, n, nAfter };
+        IndexType gridDist[3]  = { n * nAfter, nAfter, 1 };
+        IndexType transDist[3] = { nAfter * n, 1, n };
+
+        copyGrid3( tmp, transDist, x, gridDist, sizes, loc );
+    }
+
+    HArray<Complex<ValueType>> tmpResult;
+
+    fft_r2c( tmpResult, tmp, nBefore * nAfter, n, loc );
+
+    tmp.clear();
+
+    // transpose back nBefore x nAfter x nc -> nBefore x nc x nAfter
+
+    IndexType sizes[3] = { nBefore, nc, nAfter };
+    IndexType gridDist[3]  = { nc * nAfter, nAfter, 1 };
+    IndexType transDist[3] = { nAfter * nc, 1, nc };
+
+    copyGrid3( result, gridDist, tmpResult, transDist, sizes, loc );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void FFTUtils::fftGrid_c2r(
+    HArray<ValueType>& result,
+    const HArray<Complex<ValueType>>& x,
+    const common::Grid& grid,
+    const IndexType dim,
+    const ContextPtr context )
+{
+    SCAI_ASSERT_VALID_INDEX_ERROR( dim, grid.nDims(), "illegal dim for FFT on grid " << grid )
+
+    IndexType nBefore;
+    IndexType nAfter;
+
+    splitGrid( nBefore, nAfter, grid, dim );
+
+    const IndexType n  = grid.size( dim );
+    const IndexType nc = n / 2 + 1;
+
+    SCAI_ASSERT_EQ_ERROR( x.size(), nBefore * nc * nAfter, "size of packed data does not match grid " << grid )
+
+    SCAI_LOG_INFO( logger, "fftGrid_c2r<" << common::TypeTraits<ValueType>::id() << ">( " << grid << ", dim = " << dim
+                           << " ), " << nBefore << " x " << n << " x " << nAfter )
+
+    if ( nAfter == 1 )
+    {
+        fft_c2r( result, x, nBefore, n, context );
+        return;
+    }
+
+    ContextPtr loc = context ? context : x.getValidContext();
+
+    // transpose nBefore x nc x nAfter -> nBefore x nAfter x nc
+
+    HArray<Complex<ValueType>> tmp;
+
+    {
+        IndexType sizes[3] = { nBefore, nc, nAfter };
+        IndexType gridDist[3]  = { nc * nAfter, nAfter, 1 };
+        IndexType transDist[3] = { nAfter * nc, 1, nc };
+
+        copyGrid3( tmp, transDist, x, gridDist, sizes, loc );
+    }
+
+    HArray<ValueType> tmpResult;
+
+    fft_c2r( tmpResult, tmp, nBefore * nAfter, n, loc );
+
+    tmp.clear();
+
+    // transpose back nBefore x nAfter x n -> nBefore x n x nAfter
+
+    IndexType sizes[3] = { nBefore, n, nAfter };
+    IndexType gridDist[3]  = { n * nAfter, nAfter, 1 };
+    IndexType transDist[3] = { nAfter * n, 1, n };
+
+    copyGrid3( result, gridDist, tmpResult, transDist, sizes, loc );
+}
+
+/* --------------------------------------------------------------------------- */
+
 #define FFTUTILS_SPECIFIER( ValueType )                     \
     template void FFTUtils::fftcall<ValueType>(             \
         hmemo::HArray<Complex<RealType<ValueType>>>&,       \
@@ -196,12 +453,48 @@ void FFTUtils::fft_many(
         const IndexType,                                    \
         const IndexType,                                    \
         const int,                                          \
-        hmemo::ContextPtr);                    
+        hmemo::ContextPtr);                                 \
+    template void FFTUtils::fftGrid<ValueType>(             \
+        hmemo::HArray<Complex<RealType<ValueType>>>&,       \
+        const common::Grid&,                                \
+        const IndexType,                                    \
+        const int,                                          \
+        hmemo::ContextPtr);
 
     SCAI_COMMON_LOOP( FFTUTILS_SPECIFIER, SCAI_FFT_TYPES_HOST )
 
 #undef FFTUTILS_SPECIFIER
 
+#define FFTUTILS_REAL_SPECIFIER( ValueType )                \
+    template void FFTUtils::fft_r2c<ValueType>(             \
+        hmemo::HArray<Complex<ValueType>>&,                 \
+        const hmemo::HArray<ValueType>&,                    \
+        const IndexType,                                    \
+        const IndexType,                                    \
+        hmemo::ContextPtr);                                 \
+    template void FFTUtils::fft_c2r<ValueType>(             \
+        hmemo::HArray<ValueType>&,                          \
+        const hmemo::HArray<Complex<ValueType>>&,           \
+        const IndexType,                                    \
+        const IndexType,                                    \
+        hmemo::ContextPtr);                                 \
+    template void FFTUtils::fftGrid_r2c<ValueType>(         \
+        hmemo::HArray<Complex<ValueType>>&,                 \
+        const hmemo::HArray<ValueType>&,                    \
+        const common::Grid&,                                \
+        const IndexType,                                    \
+        hmemo::ContextPtr);                                 \
+    template void FFTUtils::fftGrid_c2r<ValueType>(         \
+        hmemo::HArray<ValueType>&,                          \
+        const hmemo::HArray<Complex<ValueType>>&,           \
+        const common::Grid&,                                \
+        const IndexType,                                    \
+        hmemo::ContextPtr);
+
+    SCAI_COMMON_LOOP( FFTUTILS_REAL_SPECIFIER, SCAI_REAL_TYPES_HOST )
+
+#undef FFTUTILS_REAL_SPECIFIER
+
 #endif
 
 } /* end namespace utilskernel */
@@ -30,6 +30,7 @@
 
 #include <scai/hmemo/HArray.hpp>
 #include <scai/common/SCAITypes.hpp>
+#include <scai/common/Grid.hpp>
 
 namespace scai
 {
@@ -64,6 +65,94 @@ static void fft_many(
     const int direction,
     const hmemo::ContextPtr ctx = hmemo::ContextPtr() );
 
+/** Apply the FFT along one dimension of a multidimensional array
+ *
+ *  @param[in,out] data is the array with the values of a grid, size is grid.size()
+ *  @param[in]     grid is the shape of the data
+ *  @param[in]     dim is the dimension along which the FFT is applied
+ *  @param[in]     direction must be either 1 (forward) or -1 (backward, inverse)
+ *  @param[in]     ctx preferred context for execution
+ *
+ *  The FFT is applied to all vectors in the dimension dim. If dim is not the
+ *  last dimension, the data is transposed before and after the FFT.
+ */
+template<typename ValueType>
+static void fftGrid(
+    hmemo::HArray<common::Complex<RealType<ValueType>>>& data,
+    const common::Grid& grid,
+    const IndexType dim,
+    const int direction,
+    const hmemo::ContextPtr ctx = hmemo::ContextPtr() );
+
+/** Compute the FFT of multiple real vectors, only the non-redundant half of each result is computed
+ *
+ *  @param[out] result is the result array, size will be many * ( n / 2 + 1 )
+ *  @param[in]  x is the array with the real vectors, size must be many * n
+ *  @param[in]  many is the number of vectors
+ *  @param[in]  n is the size of each real vector
+ *  @param[in]  ctx preferred context for execution   
+ *
+ *  This is always a forward transform. As the FFT of a real vector is Hermitian, i.e. result[n-j] = conj( result[j] ),
+ *  the other values of the complex transform can be derived from the packed result.
+ */
+template<typename ValueType>
+static void fft_r2c(
+    hmemo::HArray<common::Complex<ValueType>>& result, 
+    const hmemo::HArray<ValueType>& x, 
+    const IndexType many,
+    const IndexType n, 
+    const hmemo::ContextPtr ctx = hmemo::ContextPtr() );
+
+/** Compute the backward FFT of multiple Hermitian-packed vectors with real result, inverse of fft_r2c
+ *
+ *  @param[out] result is the result array with the real vectors, size will be many * n
+ *  @param[in]  x is the array with the packed vectors, size must be many * ( n / 2 + 1 )
+ *  @param[in]  many is the number of vectors
+ *  @param[in]  n is the size of each real result vector
+ *  @param[in]  ctx preferred context for execution   
+ *
+ *  Like the complex backward FFT the result is not normalized, i.e. it is scaled by n.
+ */
+template<typename ValueType>
+static void fft_c2r(
+    hmemo::HArray<ValueType>& result, 
+    const hmemo::HArray<common::Complex<ValueType>>& x, 
+    const IndexType many,
+    const IndexType n, 
+    const hmemo::ContextPtr ctx = hmemo::ContextPtr() );
+
+/** Apply the real-to-complex FFT along one dimension of a multidimensional array
+ *
+ *  @param[out] result is the transformed grid, same shape as grid but size n / 2 + 1 in dimension dim
+ *  @param[in]  x is the array with the real values of a grid, size is grid.size()
+ *  @param[in]  grid is the shape of the real data
+ *  @param[in]  dim is the dimension along which the FFT is applied
+ *  @param[in]  ctx preferred context for execution
+ */
+template<typename ValueType>
+static void fftGrid_r2c(
+    hmemo::HArray<common::Complex<ValueType>>& result,
+    const hmemo::HArray<ValueType>& x,
+    const common::Grid& grid,
+    const IndexType dim,
+    const hmemo::ContextPtr ctx = hmemo::ContextPtr() );
+
+/** Apply the complex-to-real FFT along one dimension of a multidimensional array, inverse of fftGrid_r2c
+ *
+ *  @param[out] result is the array with the real values of the grid, size is grid.size()
+ *  @param[in]  x is the Hermitian-packed grid, same shape as grid but size n / 2 + 1 in dimension dim
+ *  @param[in]  grid is the shape of the real result
+ *  @param[in]  dim is the dimension along which the FFT is applied
+ *  @param[in]  ctx preferred context for execution
+ */
+template<typename ValueType>
+static void fftGrid_c2r(
+    hmemo::HArray<ValueType>& result,
+    const hmemo::HArray<common::Complex<ValueType>>& x,
+    const common::Grid& grid,
+    const IndexType dim,
+    const hmemo::ContextPtr ctx = hmemo::ContextPtr() );
+
 template<typename ValueType>
 static void fftcall(
     hmemo::HArray<common::Complex<RealType<ValueType>>>& data,
@@ -47,6 +47,8 @@
 #include <scai/common/Settings.hpp>
 #include <scai/common/macros/unused.hpp>
 
+#include <vector>
+
 
 namespace scai
 {
@@ -86,6 +88,71 @@ void FFTW3::fft( common::Complex<ValueType> x[], IndexType nb, IndexType n, Inde
     }
 }
 
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void FFTW3::fft_r2c( common::Complex<ValueType> result[], const ValueType x[], IndexType nb, IndexType n )
+{
+    SCAI_REGION( "FFTW3.fft_r2c" )
+
+    SCAI_LOG_INFO( logger, "fft_r2c<" << common::TypeTraits<ValueType>::id() << "> @ FFTW, " << nb << " x " << n )
+
+    typedef typename FFTW3Wrapper<ValueType>::FFTW3PlanType PlanType;
+    typedef typename FFTW3Wrapper<ValueType>::FFTW3IndexType FFTW3IndexType;
+
+    // one plan for all vectors, FFTW_ESTIMATE does not overwrite the arrays during planning
+
+    PlanType p = FFTW3Wrapper<ValueType>::plan_many_dft_r2c( static_cast<FFTW3IndexType>( n ), 
+                                                             static_cast<FFTW3IndexType>( nb ), 
+                                                             x, result, FFTW_ESTIMATE );
+
+    SCAI_ASSERT_ERROR( p != NULL, "FFTW: no plan for r2c, n = " << n << ", many = " << nb )
+
+    FFTW3Wrapper<ValueType>::execute( p );
+
+    FFTW3Wrapper<ValueType>::destroy_plan( p );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void FFTW3::fft_c2r( ValueType result[], const common::Complex<ValueType> x[], IndexType nb, IndexType n )
+{
+    SCAI_REGION( "FFTW3.fft_c2r" )
+
+    SCAI_LOG_INFO( logger, "fft_c2r<" << common::TypeTraits<ValueType>::id() << "> @ FFTW, " << nb << " x " << n )
+
+    typedef typename FFTW3Wrapper<ValueType>::FFTW3PlanType PlanType;
+    typedef typename FFTW3Wrapper<ValueType>::FFTW3IndexType FFTW3IndexType;
+
+    // c2r transforms of FFTW overwrite the input array by default, but x is read-only here
+
+    PlanType p = FFTW3Wrapper<ValueType>::plan_many_dft_c2r( static_cast<FFTW3IndexType>( n ), 
+                                                             static_cast<FFTW3IndexType>( nb ), 
+                                                             x, result, FFTW_ESTIMATE | FFTW_PRESERVE_INPUT );
+
+    if ( p == NULL )
+    {
+        // no algorithm that preserves the input, so use a copy
+
+        std::vector<common::Complex<ValueType> > xCopy( x, x + nb * ( n / 2 + 1 ) );
+
+        p = FFTW3Wrapper<ValueType>::plan_many_dft_c2r( static_cast<FFTW3IndexType>( n ), 
+                                                        static_cast<FFTW3IndexType>( nb ), 
+                                                        xCopy.data(), result, FFTW_ESTIMATE );
+
+        SCAI_ASSERT_ERROR( p != NULL, "FFTW: no plan for c2r, n = " << n << ", many = " << nb )
+
+        FFTW3Wrapper<ValueType>::execute( p );
+    }
+    else
+    {
+        FFTW3Wrapper<ValueType>::execute( p );
+    }
+
+    FFTW3Wrapper<ValueType>::destroy_plan( p );
+}
+
 /* --------------------------------------------------------------------------- */
 /*     Template instantiations via registration routine                        */
 /* --------------------------------------------------------------------------- */
@@ -106,6 +173,8 @@ void FFTW3::RegistratorV<ValueType>::registerKernels( kregistry::KernelRegistry:
     SCAI_LOG_INFO( logger,
                    "register FFTW3-routines for Host at kernel registry [" << flag << " --> " << common::getScalarType<ValueType>() << "]" )
     KernelRegistry::set<FFTKernelTrait::fft<ValueType> >( fft, ctx, flag );
+    KernelRegistry::set<FFTKernelTrait::fft_r2c<ValueType> >( fft_r2c, ctx, flag );
+    KernelRegistry::set<FFTKernelTrait::fft_c2r<ValueType> >( fft_c2r, ctx, flag );
 }
 
 /* --------------------------------------------------------------------------- */
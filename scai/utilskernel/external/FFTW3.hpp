@@ -63,6 +63,24 @@ public:
         const IndexType m,
         const int direction );
 
+    /** Implementation for FFTKernelTrait::fft_r2c using FFTW library */
+
+    template<typename ValueType>
+    static void fft_r2c(
+        common::Complex<ValueType> result[],
+        const ValueType x[],
+        const IndexType nb,
+        const IndexType n );
+
+    /** Implementation for FFTKernelTrait::fft_c2r using FFTW library */
+
+    template<typename ValueType>
+    static void fft_c2r(
+        ValueType result[],
+        const common::Complex<ValueType> x[],
+        const IndexType nb,
+        const IndexType n );
+
 private:
 
     /** Struct for registration of methods with one template argument.
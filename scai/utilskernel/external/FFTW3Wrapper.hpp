@@ -74,6 +74,31 @@ class COMMON_DLL_IMPORTEXPORT FFTW3Wrapper;
             return FFTW3_NAME( plan_dft_1d, prefix )( n, in_, out_, direction, type );                          \
         }                                                                                                       \
                                                                                                                 \
+        static FFTW3PlanType plan_many_dft_r2c( const FFTW3IndexType n,                                         \
+            const FFTW3IndexType howmany,                                                                       \
+            const ValueType in[],                                                                               \
+            common::Complex<ValueType> out[],                                                                   \
+            const FFTW3FlagType type )                                                                          \
+        {                                                                                                       \
+            ValueType* in_ = const_cast<ValueType*>( in );                                                      \
+            ComplexType* out_ = reinterpret_cast<ComplexType*>( out );                                          \
+            return FFTW3_NAME( plan_many_dft_r2c, prefix )( 1, &n, howmany, in_, NULL, 1, n,                    \
+                                                            out_, NULL, 1, n / 2 + 1, type );                   \
+        }                                                                                                       \
+                                                                                                                \
+        static FFTW3PlanType plan_many_dft_c2r( const FFTW3IndexType n,                                         \
+            const FFTW3IndexType howmany,                                                                       \
+            const common::Complex<ValueType> in[],                                                              \
+            ValueType out[],                                                                                    \
+            const FFTW3FlagType type )                                                                          \
+        {                                                                                                       \
+            typedef common::Complex<ValueType> SCAIComplex;                                                     \
+            SCAIComplex* n_in = const_cast<SCAIComplex*>( in );                                                 \
+            ComplexType* in_ = reinterpret_cast<ComplexType*>( n_in );                                          \
+            return FFTW3_NAME( plan_many_dft_c2r, prefix )( 1, &n, howmany, in_, NULL, 1, n / 2 + 1,            \
+                                                            out, NULL, 1, n, type );                            \
+        }                                                                                                       \
+                                                                                                                \
         static void execute( FFTW3PlanType p )                                                                  \
         {                                                                                                       \
             FFTW3_NAME( execute, prefix )( p );                                                                 \
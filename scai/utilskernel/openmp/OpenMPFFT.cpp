@@ -30,6 +30,7 @@
 // hpp
 #include <scai/utilskernel/openmp/OpenMPFFT.hpp>
 #include <scai/utilskernel/FFTKernelTrait.hpp>
+#include <scai/utilskernel/openmp/OpenMPFFTPlan.hpp>
 
 // internal scai libraries
 #include <scai/kregistry/KernelRegistry.hpp>
@@ -43,6 +44,10 @@
 #include <scai/common/SCAITypes.hpp>
 #include <scai/common/macros/unused.hpp>
 
+#include <vector>
+#include <memory>
+#include <cmath>
+
 namespace scai
 {
 
@@ -60,83 +65,308 @@ SCAI_LOG_DEF_LOGGER( OpenMPFFT::logger, "OpenMP.FFT" )
 using common::Complex;
 
 template<typename ValueType>
-void OpenMPFFT::fft1( Complex<ValueType> x[], IndexType n, IndexType m, int dir )
+void OpenMPFFT::fft( Complex<ValueType> x[], IndexType k, IndexType n, IndexType m, int dir )
 {
-    IndexType i, i1, i2, j, k, l, l1, l2;
-    Complex<ValueType> tx, t1, u, c;
+    SCAI_REGION( "OpenMP.fft" )
+
+    SCAI_LOG_INFO( logger, "fft<" << common::TypeTraits<ValueType>::id() << "> @ OpenMP, "
+                     << k << " x " << n << ", m = " << m << ", dir = " << dir )
+
+    SCAI_ASSERT_GE_DEBUG( n, 1, "illegal size for FFT" )
 
-    /* Do the bit reversal */
+    // the plan is computed only once for each size and direction
 
-    i2 = n >> 1;
-    j = 0;
+    std::shared_ptr<const OpenMPFFTPlan<ValueType>> plan = OpenMPFFTPlan<ValueType>::get( n, dir );
 
-    for ( i = 0; i < n - 1 ; i++ )
+    const IndexType workSize = plan->workSize();
+
+    if ( k >= omp_get_max_threads() || n < 1024 )
     {
-        if ( i < j )
+        // enough vectors, each thread applies the FFT to a subset of the vectors
+
+        #pragma omp parallel
         {
-            std::swap( x[i], x[j] );
+            std::vector<Complex<ValueType>> work( workSize );
+
+            #pragma omp for
+            for ( IndexType i = 0; i < k; ++i )
+            {
+                plan->execute( x + i * n, work.data(), false );
+            }
         }
+    }
+    else
+    {
+        // few large vectors, the threads work together on each vector
 
-        k = i2;
+        std::vector<Complex<ValueType>> work( workSize );
 
-        while ( k <= j )
+        for ( IndexType i = 0; i < k; ++i )
         {
-            j -= k;
-            k >>= 1;
+            plan->execute( x + i * n, work.data(), true );
         }
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void OpenMPFFT::halfRoots( std::vector<Complex<ValueType> >& roots, const IndexType n )
+{
+    const long double PI_2 = 6.283185307179586476925286766559005768L;
+
+    roots.resize( n / 2 );
+
+    #pragma omp parallel for
+    for ( IndexType j = 0; j < n / 2; ++j )
+    {
+        const long double angle = PI_2 * static_cast<long double>( j ) / static_cast<long double>( n );
+
+        roots[j] = Complex<ValueType>( static_cast<ValueType>( std::cos( angle ) ),
+                                       static_cast<ValueType>( -std::sin( angle ) ) );
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void OpenMPFFT::r2cEven(
+    Complex<ValueType> result[],
+    const ValueType x[],
+    const IndexType h,
+    const OpenMPFFTPlan<ValueType>& plan,
+    const Complex<ValueType> roots[],
+    Complex<ValueType> z[],
+    Complex<ValueType> work[],
+    const bool parallel )
+{
+    // z[j] = x[2j] + i * x[2j+1], so FFT( z ) = E + i * O, E, O are the FFTs of the even/odd values
+
+    #pragma omp parallel for if ( parallel )
+    for ( IndexType j = 0; j < h; ++j )
+    {
+        z[j] = Complex<ValueType>( x[2 * j], x[2 * j + 1] );
+    }
+
+    plan.execute( z, work, parallel );
+
+    // E and O are Hermitian, so E[j] = ( z[j] + conj( z[h-j] ) ) / 2, O[j] = ( z[j] - conj( z[h-j] ) ) / 2i
+
+    result[0] = Complex<ValueType>( z[0].real() + z[0].imag(), 0 );
+    result[h] = Complex<ValueType>( z[0].real() - z[0].imag(), 0 );
+
+    const Complex<ValueType> half( ValueType( 0.5 ), 0 );
+    const Complex<ValueType> minusHalfI( 0, ValueType( -0.5 ) );
+
+    #pragma omp parallel for if ( parallel )
+    for ( IndexType j = 1; j < h; ++j )
+    {
+        const Complex<ValueType> a = z[j];
+        const Complex<ValueType> b = common::Math::conj( z[h - j] );
+
+        const Complex<ValueType> e = half * ( a + b );
+        const Complex<ValueType> o = minusHalfI * ( a - b );
+
+        result[j] = e + roots[j] * o;
+    }
+}
 
-        j += k;
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void OpenMPFFT::c2rEven(
+    ValueType result[],
+    const Complex<ValueType> x[],
+    const IndexType h,
+    const OpenMPFFTPlan<ValueType>& plan,
+    const Complex<ValueType> roots[],
+    Complex<ValueType> z[],
+    Complex<ValueType> work[],
+    const bool parallel )
+{
+    // z[j] = 2 * ( E[j] + i * O[j] ), E[j] = ( x[j] + conj( x[h-j] ) ) / 2, O[j] = ( x[j] - conj( x[h-j] ) ) / 2 * w^-j
+
+    const Complex<ValueType> imagUnit( 0, 1 );
+
+    #pragma omp parallel for if ( parallel )
+    for ( IndexType j = 0; j < h; ++j )
+    {
+        const Complex<ValueType> a = x[j];
+        const Complex<ValueType> b = common::Math::conj( x[h - j] );
+
+        z[j] = ( a + b ) + imagUnit * ( a - b ) * common::Math::conj( roots[j] );
     }
 
-    /* Compute the FFT */
-    c = Complex<ValueType>( -1, 0 );
-    l2 = 1;
+    plan.execute( z, work, parallel );
 
-    for ( l = 0; l < m; l++ )
+    #pragma omp parallel for if ( parallel )
+    for ( IndexType j = 0; j < h; ++j )
     {
-        l1 = l2;
-        l2 <<= 1;
-        u.real( 1.0 );
-        u.imag( 0.0 );
+        result[2 * j]     = z[j].real();
+        result[2 * j + 1] = z[j].imag();
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void OpenMPFFT::fft_r2c( Complex<ValueType> result[], const ValueType x[], IndexType k, IndexType n )
+{
+    SCAI_REGION( "OpenMP.fft_r2c" )
 
-        for ( j = 0; j < l1; j++ )
+    SCAI_LOG_INFO( logger, "fft_r2c<" << common::TypeTraits<ValueType>::id() << "> @ OpenMP, " << k << " x " << n )
+
+    SCAI_ASSERT_GE_DEBUG( n, 1, "illegal size for FFT" )
+
+    const IndexType nc = n / 2 + 1;
+
+    if ( n % 2 == 1 )
+    {
+        // odd size: complex FFT of the full vector, only the first half of the result is kept
+
+        std::shared_ptr<const OpenMPFFTPlan<ValueType>> plan = OpenMPFFTPlan<ValueType>::get( n, 1 );
+
+        #pragma omp parallel
         {
-            for ( i = j; i < n; i += l2 )
+            std::vector<Complex<ValueType>> z( n );
+            std::vector<Complex<ValueType>> work( plan->workSize() );
+
+            #pragma omp for
+            for ( IndexType i = 0; i < k; ++i )
             {
-                i1 = i + l1;
-                t1 = u * x[i1];
-                x[i1] = x[i] - t1;
-                x[i] += t1;
-            }
+                for ( IndexType j = 0; j < n; ++j )
+                {
+                    z[j] = Complex<ValueType>( x[i * n + j], 0 );
+                }
 
-            u = u * c;
+                plan->execute( z.data(), work.data(), false );
+
+                for ( IndexType j = 0; j < nc; ++j )
+                {
+                    result[i * nc + j] = z[j];
+                }
+            }
         }
 
-        c.imag( common::Math::sqrt( ( 1.0 - c.real() ) / 2.0 ) );
+        return;
+    }
+
+    const IndexType h = n / 2;
+
+    std::shared_ptr<const OpenMPFFTPlan<ValueType>> plan = OpenMPFFTPlan<ValueType>::get( h, 1 );
+
+    std::vector<Complex<ValueType>> roots;
+
+    halfRoots( roots, n );
 
-        if ( dir == 1 )
+    if ( k >= omp_get_max_threads() || h < 1024 )
+    {
+        #pragma omp parallel
         {
-            c.imag( -c.imag() );
+            std::vector<Complex<ValueType>> z( h );
+            std::vector<Complex<ValueType>> work( plan->workSize() );
+
+            #pragma omp for
+            for ( IndexType i = 0; i < k; ++i )
+            {
+                r2cEven( result + i * nc, x + i * n, h, *plan, roots.data(), z.data(), work.data(), false );
+            }
         }
+    }
+    else
+    {
+        std::vector<Complex<ValueType>> z( h );
+        std::vector<Complex<ValueType>> work( plan->workSize() );
 
-        c.real( common::Math::sqrt( ( 1.0 + c.real() ) / 2.0 ) );
+        for ( IndexType i = 0; i < k; ++i )
+        {
+            r2cEven( result + i * nc, x + i * n, h, *plan, roots.data(), z.data(), work.data(), true );
+        }
     }
 }
 
+/* --------------------------------------------------------------------------- */
+
 template<typename ValueType>
-void OpenMPFFT::fft( Complex<ValueType> x[], IndexType k, IndexType n, IndexType m, int dir )
+void OpenMPFFT::fft_c2r( ValueType result[], const Complex<ValueType> x[], IndexType k, IndexType n )
 {
-    SCAI_REGION( "OpenMP.fft" )
+    SCAI_REGION( "OpenMP.fft_c2r" )
 
-    SCAI_ASSERT_EQ_DEBUG( ( 1 << m ), n , " 2 ** m ( " << m << " ) != " << n << " = n" )
+    SCAI_LOG_INFO( logger, "fft_c2r<" << common::TypeTraits<ValueType>::id() << "> @ OpenMP, " << k << " x " << n )
 
-    SCAI_LOG_INFO( logger, "fft<" << common::TypeTraits<ValueType>::id() << "> @ OpenMP, "
-                     << k << " x " << n << " = 2 ** " << m )
+    SCAI_ASSERT_GE_DEBUG( n, 1, "illegal size for FFT" )
 
-    #pragma omp parallel for
-    for ( IndexType i = 0; i < k; ++i )
+    const IndexType nc = n / 2 + 1;
+
+    if ( n % 2 == 1 )
     {
-        OpenMPFFT::fft1( x + i * n, n, m, dir );
+        // odd size: complete the Hermitian vector and apply the complex FFT
+
+        std::shared_ptr<const OpenMPFFTPlan<ValueType>> plan = OpenMPFFTPlan<ValueType>::get( n, -1 );
+
+        #pragma omp parallel
+        {
+            std::vector<Complex<ValueType>> z( n );
+            std::vector<Complex<ValueType>> work( plan->workSize() );
+
+            #pragma omp for
+            for ( IndexType i = 0; i < k; ++i )
+            {
+                const Complex<ValueType>* xi = x + i * nc;
+
+                for ( IndexType j = 0; j < nc; ++j )
+                {
+                    z[j] = xi[j];
+                }
+
+                for ( IndexType j = nc; j < n; ++j )
+                {
+                    z[j] = common::Math::conj( xi[n - j] );
+                }
+
+                plan->execute( z.data(), work.data(), false );
+
+                for ( IndexType j = 0; j < n; ++j )
+                {
+                    result[i * n + j] = z[j].real();
+                }
+            }
+        }
+
+        return;
+    }
+
+    const IndexType h = n / 2;
+
+    std::shared_ptr<const OpenMPFFTPlan<ValueType>> plan = OpenMPFFTPlan<ValueType>::get( h, -1 );
+
+    std::vector<Complex<ValueType>> roots;
+
+    halfRoots( roots, n );
+
+    if ( k >= omp_get_max_threads() || h < 1024 )
+    {
+        #pragma omp parallel
+        {
+            std::vector<Complex<ValueType>> z( h );
+            std::vector<Complex<ValueType>> work( plan->workSize() );
+
+            #pragma omp for
+            for ( IndexType i = 0; i < k; ++i )
+            {
+                c2rEven( result + i * n, x + i * nc, h, *plan, roots.data(), z.data(), work.data(), false );
+            }
+        }
+    }
+    else
+    {
+        std::vector<Complex<ValueType>> z( h );
+        std::vector<Complex<ValueType>> work( plan->workSize() );
+
+        for ( IndexType i = 0; i < k; ++i )
+        {
+            c2rEven( result + i * n, x + i * nc, h, *plan, roots.data(), z.data(), work.data(), true );
+        }
     }
 }
 
@@ -152,6 +382,8 @@ void OpenMPFFT::RegistratorV<ValueType>::registerKernels( kregistry::KernelRegis
     SCAI_LOG_INFO( logger,
                    "register OpenMPFFT-routines for Host at kernel registry [" << flag << " --> " << common::getScalarType<ValueType>() << "]" )
     KernelRegistry::set<FFTKernelTrait::fft<RealType<ValueType>> >( fft, ctx, flag );
+    KernelRegistry::set<FFTKernelTrait::fft_r2c<RealType<ValueType>> >( fft_r2c, ctx, flag );
+    KernelRegistry::set<FFTKernelTrait::fft_c2r<RealType<ValueType>> >( fft_c2r, ctx, flag );
 }
 
 #endif
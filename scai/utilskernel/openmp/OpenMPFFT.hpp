@@ -41,6 +41,10 @@
 
 #include <scai/kregistry/mepr/Registrator.hpp>
 
+#include <scai/utilskernel/openmp/OpenMPFFTPlan.hpp>
+
+#include <vector>
+
 namespace scai
 {
 
@@ -55,7 +59,10 @@ public:
 
 #ifdef SCAI_COMPLEX_SUPPORTED
 
-    /** OpenMP implementation for FFTKernelTrait::fft */
+    /** OpenMP implementation for FFTKernelTrait::fft
+     *
+     *  Uses a cached plan (OpenMPFFTPlan) for the size n, so n can be any positive number.
+     */
 
     template<typename ValueType>
     static void fft(
@@ -65,22 +72,74 @@ public:
         const IndexType m,
         const int direction );
 
+    /** OpenMP implementation for FFTKernelTrait::fft_r2c
+     *
+     *  For even n the real vector is packed into a complex vector of size n / 2 to which
+     *  the complex FFT is applied, the result is split into the FFTs of the even and odd values.
+     */
+
+    template<typename ValueType>
+    static void fft_r2c(
+        common::Complex<ValueType> result[],
+        const ValueType x[],
+        const IndexType k,
+        const IndexType n );
+
+    /** OpenMP implementation for FFTKernelTrait::fft_c2r, inverse of fft_r2c */
+
+    template<typename ValueType>
+    static void fft_c2r(
+        ValueType result[],
+        const common::Complex<ValueType> x[],
+        const IndexType k,
+        const IndexType n );
+
 #endif
 
 private:
 
 #ifdef SCAI_COMPLEX_SUPPORTED
 
+    /** Real-to-complex FFT of one vector with even size n = 2 * h.
+     *
+     *  @param[out] result contains h + 1 values of the FFT
+     *  @param[in] x is the real input vector, size is 2 * h
+     *  @param[in] h is half the size of the input vector
+     *  @param[in] plan is the forward plan for size h
+     *  @param[in] roots contains exp( -2 pi i j / n ) for j < h
+     *  @param[in,out] z, work are work arrays of size h and plan.workSize()
+     *  @param[in] parallel if true OpenMP threads work together on this vector
+     */
     template<typename ValueType>
-    static void fft1(
-        common::Complex<ValueType> array[],
-        const IndexType n,
-        const IndexType m,
-        const int direction );
+    static void r2cEven(
+        common::Complex<ValueType> result[],
+        const ValueType x[],
+        const IndexType h,
+        const OpenMPFFTPlan<ValueType>& plan,
+        const common::Complex<ValueType> roots[],
+        common::Complex<ValueType> z[],
+        common::Complex<ValueType> work[],
+        const bool parallel );
+
+    /** Complex-to-real FFT of one vector with even size n = 2 * h, inverse of r2cEven. */
 
-#endif
+    template<typename ValueType>
+    static void c2rEven(
+        ValueType result[],
+        const common::Complex<ValueType> x[],
+        const IndexType h,
+        const OpenMPFFTPlan<ValueType>& plan,
+        const common::Complex<ValueType> roots[],
+        common::Complex<ValueType> z[],
+        common::Complex<ValueType> work[],
+        const bool parallel );
+
+    /** Compute the roots exp( -2 pi i j / n ) for j < n / 2 */
 
-    /** OpenMP implementation for FFTKernelTrait::fft_n */
+    template<typename ValueType>
+    static void halfRoots( std::vector<common::Complex<ValueType> >& roots, const IndexType n );
+
+#endif
 
     /** Struct for registration of methods with one template argument.
      *
@@ -0,0 +1,681 @@
+/**
+ * @file OpenMPFFTPlan.cpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Implementation of mixed-radix and Bluestein FFT plans
+ * @author Thomas Brandes
+ * @date 18.10.2018
+ */
+
+// hpp
+#include <scai/utilskernel/openmp/OpenMPFFTPlan.hpp>
+
+// internal scai libraries
+#include <scai/tracing.hpp>
+
+#include <scai/common/macros/assert.hpp>
+#include <scai/common/macros/instantiate.hpp>
+#include <scai/common/TypeTraits.hpp>
+#include <scai/common/OpenMP.hpp>
+
+// std
+#include <map>
+#include <mutex>
+#include <cmath>
+#include <cstdint>
+
+namespace scai
+{
+
+namespace utilskernel
+{
+
+#ifdef SCAI_COMPLEX_SUPPORTED
+
+using common::Complex;
+
+SCAI_LOG_DEF_TEMPLATE_LOGGER( template<typename ValueType>, OpenMPFFTPlan<ValueType>::logger, "OpenMP.FFTPlan" )
+
+/* --------------------------------------------------------------------------- */
+/*   Butterflies                                                               */
+/* --------------------------------------------------------------------------- */
+
+/** Multiplication of z with -i * dir */
+
+template<typename ValueType>
+static inline Complex<ValueType> mulMinusI( const Complex<ValueType>& z, const int dir )
+{
+    return Complex<ValueType>( dir * z.imag(), -dir * z.real() );
+}
+
+/** In-place DFT of size R for the values v[0], ..., v[R-1], W = exp( -2 pi i dir / R ) */
+
+template<typename ValueType, int R>
+struct Butterfly;
+
+template<typename ValueType>
+struct Butterfly<ValueType, 2>
+{
+    static inline void apply( Complex<ValueType> v[], const int )
+    {
+        const Complex<ValueType> t = v[0];
+        v[0] = t + v[1];
+        v[1] = t - v[1];
+    }
+};
+
+template<typename ValueType>
+struct Butterfly<ValueType, 3>
+{
+    static inline void apply( Complex<ValueType> v[], const int dir )
+    {
+        const ValueType s3 = static_cast<ValueType>( 0.866025403784438646763723170752936183L );  // sqrt( 3 ) / 2
+
+        const Complex<ValueType> t = v[1] + v[2];
+        const Complex<ValueType> d = mulMinusI( v[1] - v[2], dir ) * s3;
+        const Complex<ValueType> m = v[0] - t * ValueType( 0.5 );
+
+        v[0] = v[0] + t;
+        v[1] = m + d;
+        v[2] = m - d;
+    }
+};
+
+template<typename ValueType>
+struct Butterfly<ValueType, 4>
+{
+    static inline void apply( Complex<ValueType> v[], const int dir )
+    {
+        const Complex<ValueType> t0 = v[0] + v[2];
+        const Complex<ValueType> t1 = v[0] - v[2];
+        const Complex<ValueType> t2 = v[1] + v[3];
+        const Complex<ValueType> t3 = mulMinusI( v[1] - v[3], dir );
+
+        v[0] = t0 + t2;
+        v[1] = t1 + t3;
+        v[2] = t0 - t2;
+        v[3] = t1 - t3;
+    }
+};
+
+template<typename ValueType>
+struct Butterfly<ValueType, 5>
+{
+    static inline void apply( Complex<ValueType> v[], const int dir )
+    {
+        const ValueType c1 = static_cast<ValueType>( 0.309016994374947424102293417182819059L );   // cos( 2 pi / 5 )
+        const ValueType c2 = static_cast<ValueType>( -0.809016994374947424102293417182819059L );  // cos( 4 pi / 5 )
+        const ValueType s1 = static_cast<ValueType>( 0.951056516295153572116439333379382143L );   // sin( 2 pi / 5 )
+        const ValueType s2 = static_cast<ValueType>( 0.587785252292473129168705954639072769L );   // sin( 4 pi / 5 )
+
+        const Complex<ValueType> t1 = v[1] + v[4];
+        const Complex<ValueType> t2 = v[2] + v[3];
+        const Complex<ValueType> t3 = v[1] - v[4];
+        const Complex<ValueType> t4 = v[2] - v[3];
+
+        const Complex<ValueType> a1 = v[0] + t1 * c1 + t2 * c2;
+        const Complex<ValueType> a2 = v[0] + t1 * c2 + t2 * c1;
+        const Complex<ValueType> b1 = mulMinusI( t3 * s1 + t4 * s2, dir );
+        const Complex<ValueType> b2 = mulMinusI( t3 * s2 - t4 * s1, dir );
+
+        v[0] = v[0] + t1 + t2;
+        v[1] = a1 + b1;
+        v[2] = a2 + b2;
+        v[3] = a2 - b2;
+        v[4] = a1 - b1;
+    }
+};
+
+template<typename ValueType>
+struct Butterfly<ValueType, 8>
+{
+    static inline void apply( Complex<ValueType> v[], const int dir )
+    {
+        const ValueType r2 = static_cast<ValueType>( 0.707106781186547524400844362104849039L );  // 1 / sqrt( 2 )
+
+        Complex<ValueType> e[4] = { v[0], v[2], v[4], v[6] };
+        Complex<ValueType> o[4] = { v[1], v[3], v[5], v[7] };
+
+        Butterfly<ValueType, 4>::apply( e, dir );
+        Butterfly<ValueType, 4>::apply( o, dir );
+
+        // o[k] *= W^k, W = ( 1 - i dir ) / sqrt( 2 )
+
+        o[1] = Complex<ValueType>( ( o[1].real() + dir * o[1].imag() ) * r2, ( o[1].imag() - dir * o[1].real() ) * r2 );
+        o[2] = mulMinusI( o[2], dir );
+        o[3] = Complex<ValueType>( ( dir * o[3].imag() - o[3].real() ) * r2, ( -o[3].imag() - dir * o[3].real() ) * r2 );
+
+        for ( int k = 0; k < 4; ++k )
+        {
+            v[k] = e[k] + o[k];
+            v[k + 4] = e[k] - o[k];
+        }
+    }
+};
+
+/* --------------------------------------------------------------------------- */
+/*   Stages                                                                    */
+/* --------------------------------------------------------------------------- */
+
+/** One butterfly of a stage, inputs are multiplied with the twiddle factors tw[(q-1) * m + k] */
+
+template<typename ValueType, int R>
+static inline void butterfly( Complex<ValueType> x[], const Complex<ValueType> tw[], const IndexType k, const IndexType m, const int dir )
+{
+    Complex<ValueType> v[R];
+
+    v[0] = x[k];
+
+    for ( int q = 1; q < R; ++q )
+    {
+        v[q] = x[k + q * m] * tw[( q - 1 ) * m + k];
+    }
+
+    Butterfly<ValueType, R>::apply( v, dir );
+
+    for ( int p = 0; p < R; ++p )
+    {
+        x[k + p * m] = v[p];
+    }
+}
+
+/** One stage of the mixed-radix FFT with a fixed radix R for numBlocks blocks of size R * m */
+
+template<typename ValueType, int R>
+static void stage(
+    Complex<ValueType> x[],
+    const Complex<ValueType> tw[],
+    const IndexType m,
+    const IndexType numBlocks,
+    const int dir,
+    const bool parallel )
+{
+    const IndexType len = R * m;
+
+    if ( parallel && numBlocks < m )
+    {
+        // few large blocks, parallelize the butterflies within one block
+
+        #pragma omp parallel
+        {
+            for ( IndexType b = 0; b < numBlocks; ++b )
+            {
+                #pragma omp for
+                for ( IndexType k = 0; k < m; ++k )
+                {
+                    butterfly<ValueType, R>( x + b * len, tw, k, m, dir );
+                }
+            }
+        }
+    }
+    else
+    {
+        #pragma omp parallel for if ( parallel )
+        for ( IndexType b = 0; b < numBlocks; ++b )
+        {
+            for ( IndexType k = 0; k < m; ++k )
+            {
+                butterfly<ValueType, R>( x + b * len, tw, k, m, dir );
+            }
+        }
+    }
+}
+
+/** One stage of the mixed-radix FFT with a small prime radix r, roots[j] = W^j */
+
+template<typename ValueType>
+static void stageGeneric(
+    Complex<ValueType> x[],
+    const Complex<ValueType> tw[],
+    const Complex<ValueType> roots[],
+    const IndexType r,
+    const IndexType m,
+    const IndexType numBlocks,
+    const bool parallel )
+{
+    const IndexType MAX_RADIX = 16;
+
+    const IndexType len = r * m;
+
+    #pragma omp parallel for if ( parallel )
+    for ( IndexType b = 0; b < numBlocks; ++b )
+    {
+        Complex<ValueType> v[MAX_RADIX];
+
+        Complex<ValueType>* xb = x + b * len;
+
+        for ( IndexType k = 0; k < m; ++k )
+        {
+            v[0] = xb[k];
+
+            for ( IndexType q = 1; q < r; ++q )
+            {
+                v[q] = xb[k + q * m] * tw[( q - 1 ) * m + k];
+            }
+
+            for ( IndexType p = 0; p < r; ++p )
+            {
+                Complex<ValueType> sum = v[0];
+
+                for ( IndexType q = 1; q < r; ++q )
+                {
+                    sum += v[q] * roots[( p * q ) % r];
+                }
+
+                xb[k + p * m] = sum;
+            }
+        }
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+/*   Plan                                                                      */
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+std::shared_ptr<const OpenMPFFTPlan<ValueType> > OpenMPFFTPlan<ValueType>::get( const IndexType n, const int direction )
+{
+    typedef std::pair<IndexType, int> Key;
+
+    static std::mutex cacheMutex;
+    static std::map<Key, std::shared_ptr<const OpenMPFFTPlan> > cache;
+
+    const Key key( n, direction );
+
+    {
+        std::unique_lock<std::mutex> lock( cacheMutex );
+
+        auto it = cache.find( key );
+
+        if ( it != cache.end() )
+        {
+            return it->second;
+        }
+    }
+
+    // plan is computed without holding the lock, a Bluestein plan gets the plans for its convolution
+
+    std::shared_ptr<const OpenMPFFTPlan> plan( new OpenMPFFTPlan( n, direction ) );
+
+    std::unique_lock<std::mutex> lock( cacheMutex );
+
+    // if another thread has been faster, its plan is taken
+
+    return cache.emplace( key, plan ).first->second;
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+OpenMPFFTPlan<ValueType>::OpenMPFFTPlan( const IndexType n, const int direction ) :
+
+    mN( n ),
+    mDirection( direction ),
+    mConvN( 0 )
+{
+    SCAI_REGION( "OpenMP.fftPlan" )
+
+    SCAI_ASSERT_GE_ERROR( n, 1, "illegal size for FFT plan" )
+    SCAI_ASSERT_ERROR( direction == 1 || direction == -1, "illegal direction " << direction << " for FFT, must be 1 or -1" )
+
+    if ( factorize( mFactors, n ) )
+    {
+        setupMixedRadix();
+    }
+    else
+    {
+        setupBluestein();
+    }
+
+    SCAI_LOG_INFO( logger, "new FFT plan<" << common::TypeTraits<ValueType>::id() << ">, n = " << n << ", dir = " << direction
+                           << ( isBluestein() ? ", Bluestein" : ", mixed-radix" ) << ", #stages = " << mFactors.size() )
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+bool OpenMPFFTPlan<ValueType>::factorize( std::vector<IndexType>& factors, IndexType n )
+{
+    factors.clear();
+
+    while ( n % 8 == 0 )
+    {
+        factors.push_back( 8 );
+        n /= 8;
+    }
+
+    if ( n % 4 == 0 )
+    {
+        factors.push_back( 4 );
+        n /= 4;
+    }
+
+    if ( n % 2 == 0 )
+    {
+        factors.push_back( 2 );
+        n /= 2;
+    }
+
+    // other primes for which the generic butterfly is still cheaper than Bluestein
+
+    const IndexType primes[] = { 3, 5, 7, 11, 13 };
+
+    for ( IndexType p : primes )
+    {
+        while ( n % p == 0 )
+        {
+            factors.push_back( p );
+            n /= p;
+        }
+    }
+
+    return n == 1;
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+Complex<ValueType> OpenMPFFTPlan<ValueType>::root( const IndexType k, const IndexType n ) const
+{
+    // computed in highest precision, k is always smaller than n
+
+    const long double PI_2 = 6.283185307179586476925286766559005768L;
+
+    const long double angle = PI_2 * static_cast<long double>( k ) / static_cast<long double>( n );
+
+    return ComplexType( static_cast<ValueType>( std::cos( angle ) ),
+                        static_cast<ValueType>( -mDirection * std::sin( angle ) ) );
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void OpenMPFFTPlan<ValueType>::setupMixedRadix()
+{
+    const IndexType nStages = static_cast<IndexType>( mFactors.size() );
+
+    // digit reversal: input x[idx] with idx = d0 + r0 * ( d1 + r1 * ( d2 + ... ) ) is moved
+    // to position pos = d0 * n / r0 + d1 * n / ( r0 * r1 ) + ...
+
+    mPerm.resize( mN );
+
+    for ( IndexType idx = 0; idx < mN; ++idx )
+    {
+        IndexType rest = idx;
+        IndexType m    = mN;
+        IndexType pos  = 0;
+
+        for ( IndexType l = 0; l < nStages; ++l )
+        {
+            const IndexType r = mFactors[l];
+            m /= r;
+            pos += ( rest % r ) * m;
+            rest /= r;
+        }
+
+        mPerm[pos] = idx;
+    }
+
+    // twiddles of stage l that combines r blocks of size m to one block of size len = r * m
+
+    mTwiddles.resize( nStages );
+    mRoots.resize( nStages );
+
+    IndexType len = mN;
+
+    for ( IndexType l = 0; l < nStages; ++l )
+    {
+        const IndexType r = mFactors[l];
+        const IndexType m = len / r;
+
+        std::vector<ComplexType>& tw = mTwiddles[l];
+
+        tw.resize( ( r - 1 ) * m );
+
+        for ( IndexType q = 1; q < r; ++q )
+        {
+            for ( IndexType k = 0; k < m; ++k )
+            {
+                tw[( q - 1 ) * m + k] = root( ( q * k ) % len, len );
+            }
+        }
+
+        if ( r != 2 && r != 3 && r != 4 && r != 5 && r != 8 )
+        {
+            mRoots[l].resize( r );
+
+            for ( IndexType j = 0; j < r; ++j )
+            {
+                mRoots[l][j] = root( j, r );
+            }
+        }
+
+        len = m;
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void OpenMPFFTPlan<ValueType>::setupBluestein()
+{
+    mFactors.clear();
+
+    mConvN = 1;
+
+    while ( mConvN < 2 * mN - 1 )
+    {
+        mConvN <<= 1;
+    }
+
+    // chirp[j] = exp( -pi i dir j^2 / n ) = W_2n^( j^2 mod 2n ), avoids loss of precision for large j
+
+    mChirp.resize( mN );
+
+    const uint64_t n2 = 2 * static_cast<uint64_t>( mN );
+
+    for ( IndexType j = 0; j < mN; ++j )
+    {
+        const uint64_t jj = static_cast<uint64_t>( j ) * static_cast<uint64_t>( j );
+        mChirp[j] = root( static_cast<IndexType>( jj % n2 ), static_cast<IndexType>( n2 ) );
+    }
+
+    mConvForward  = get( mConvN, 1 );
+    mConvBackward = get( mConvN, -1 );
+
+    // kernel b[j] = conj( chirp[ |j| ] ) for -n < j < n, cyclic
+
+    mKernel.assign( mConvN, ComplexType( 0 ) );
+
+    for ( IndexType j = 0; j < mN; ++j )
+    {
+        const ComplexType c( mChirp[j].real(), -mChirp[j].imag() );
+
+        mKernel[j] = c;
+
+        if ( j > 0 )
+        {
+            mKernel[mConvN - j] = c;
+        }
+    }
+
+    std::vector<ComplexType> work( mConvForward->workSize() );
+
+    mConvForward->execute( mKernel.data(), work.data(), false );
+
+    // scaling of the backward FFT is already done here
+
+    const ValueType scale = ValueType( 1 ) / static_cast<ValueType>( mConvN );
+
+    for ( IndexType j = 0; j < mConvN; ++j )
+    {
+        mKernel[j] *= scale;
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+IndexType OpenMPFFTPlan<ValueType>::workSize() const
+{
+    if ( isBluestein() )
+    {
+        return mConvN + mConvForward->workSize();
+    }
+    else
+    {
+        return mN;
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void OpenMPFFTPlan<ValueType>::execute( ComplexType x[], ComplexType work[], const bool parallel ) const
+{
+    if ( isBluestein() )
+    {
+        executeBluestein( x, work, parallel );
+    }
+    else
+    {
+        executeMixedRadix( x, work, parallel );
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void OpenMPFFTPlan<ValueType>::executeMixedRadix( ComplexType x[], ComplexType work[], const bool parallel ) const
+{
+    const IndexType n = mN;
+
+    if ( n == 1 )
+    {
+        return;
+    }
+
+    // digit reversal by the precomputed permutation
+
+    const IndexType* perm = mPerm.data();
+
+    #pragma omp parallel if ( parallel )
+    {
+        #pragma omp for
+        for ( IndexType i = 0; i < n; ++i )
+        {
+            work[i] = x[i];
+        }
+
+        #pragma omp for
+        for ( IndexType i = 0; i < n; ++i )
+        {
+            x[i] = work[perm[i]];
+        }
+    }
+
+    // stages from the smallest blocks to the full vector
+
+    const IndexType nStages = static_cast<IndexType>( mFactors.size() );
+
+    IndexType m = 1;
+
+    for ( IndexType l = nStages - 1; l >= 0; --l )
+    {
+        const IndexType r = mFactors[l];
+        const IndexType numBlocks = n / ( r * m );
+        const ComplexType* tw = mTwiddles[l].data();
+
+        switch ( r )
+        {
+            case 2:
+                stage<ValueType, 2>( x, tw, m, numBlocks, mDirection, parallel );
+                break;
+            case 3:
+                stage<ValueType, 3>( x, tw, m, numBlocks, mDirection, parallel );
+                break;
+            case 4:
+                stage<ValueType, 4>( x, tw, m, numBlocks, mDirection, parallel );
+                break;
+            case 5:
+                stage<ValueType, 5>( x, tw, m, numBlocks, mDirection, parallel );
+                break;
+            case 8:
+                stage<ValueType, 8>( x, tw, m, numBlocks, mDirection, parallel );
+                break;
+            default:
+                stageGeneric( x, tw, mRoots[l].data(), r, m, numBlocks, parallel );
+        }
+
+        m *= r;
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+template<typename ValueType>
+void OpenMPFFTPlan<ValueType>::executeBluestein( ComplexType x[], ComplexType work[], const bool parallel ) const
+{
+    const IndexType n  = mN;
+    const IndexType nc = mConvN;
+
+    ComplexType* a = work;
+    ComplexType* convWork = work + nc;
+
+    const ComplexType* chirp = mChirp.data();
+    const ComplexType* kernel = mKernel.data();
+
+    #pragma omp parallel for if ( parallel )
+    for ( IndexType j = 0; j < nc; ++j )
+    {
+        a[j] = j < n ? x[j] * chirp[j] : ComplexType( 0 );
+    }
+
+    // cyclic convolution of a with the kernel
+
+    mConvForward->execute( a, convWork, parallel );
+
+    #pragma omp parallel for if ( parallel )
+    for ( IndexType j = 0; j < nc; ++j )
+    {
+        a[j] *= kernel[j];
+    }
+
+    mConvBackward->execute( a, convWork, parallel );
+
+    #pragma omp parallel for if ( parallel )
+    for ( IndexType k = 0; k < n; ++k )
+    {
+        x[k] = a[k] * chirp[k];
+    }
+}
+
+/* --------------------------------------------------------------------------- */
+
+SCAI_COMMON_INST_CLASS( OpenMPFFTPlan, SCAI_REAL_TYPES_HOST )
+
+#endif
+
+} /* end namespace utilskernel */
+
+} /* end namespace scai */
@@ -0,0 +1,162 @@
+/**
+ * @file OpenMPFFTPlan.hpp
+ *
+ * @license
+ * Copyright (c) 2009-2018
+ * Fraunhofer Institute for Algorithms and Scientific Computing SCAI
+ * for Fraunhofer-Gesellschaft
+ *
+ * This file is part of the SCAI framework LAMA.
+ *
+ * LAMA is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your option)
+ * any later version.
+ *
+ * LAMA is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with LAMA. If not, see <http://www.gnu.org/licenses/>.
+ * @endlicense
+ *
+ * @brief Plan for the FFT of a certain size with precomputed twiddle factors
+ * @author Thomas Brandes
+ * @date 18.10.2018
+ */
+
+#pragma once
+
+// for dll_import
+#include <scai/common/config.hpp>
+
+// internal scai libraries
+#include <scai/logging.hpp>
+
+#include <scai/common/SCAITypes.hpp>
+
+#include <vector>
+#include <memory>
+
+namespace scai
+{
+
+namespace utilskernel
+{
+
+#ifdef SCAI_COMPLEX_SUPPORTED
+
+/** A plan contains all data needed to compute the FFT of a vector with a given size and direction.
+ *
+ *  - If the size n is a product of small primes (2, 3, 5, 7, 11, 13) a mixed-radix Cooley-Tukey algorithm
+ *    is used, with special butterflies for radix 2, 3, 4, 5 and 8.
+ *  - Otherwise the Bluestein algorithm is used that computes the FFT by a convolution of size
+ *    2**m >= 2 * n - 1, that is done itself by mixed-radix FFTs.
+ *
+ *  The plan contains the permutation (digit reversal) of the input vector and the twiddle factors
+ *  of all stages. As the computation of a plan is rather expensive, plans are cached and
+ *  should be queried by the static method get.
+ *
+ *  \code
+ *      auto plan = OpenMPFFTPlan<double>::get( n, 1 );
+ *      std::vector<Complex<double>> work( plan->workSize() );
+ *      plan->execute( x, work.data(), false );
+ *  \endcode
+ */
+template<typename ValueType>
+class COMMON_DLL_IMPORTEXPORT OpenMPFFTPlan
+{
+public:
+
+    typedef common::Complex<ValueType> ComplexType;
+
+    /** Get a plan for a certain size and direction, from the cache if it has been computed before.
+     *
+     *  @param[in] n is the size of the vectors
+     *  @param[in] direction is either 1 (forward) or -1 (backward)
+     */
+    static std::shared_ptr<const OpenMPFFTPlan> get( const IndexType n, const int direction );
+
+    /** Constructor of a new plan, does all the precomputation. */
+
+    OpenMPFFTPlan( const IndexType n, const int direction );
+
+    /** Size of the vectors to which this plan can be applied. */
+
+    IndexType size() const
+    {
+        return mN;
+    }
+
+    /** Size of the work array required for execute. */
+
+    IndexType workSize() const;
+
+    /** Query if this plan uses the Bluestein algorithm. */
+
+    bool isBluestein() const
+    {
+        return mConvN > 0;
+    }
+
+    /** Apply the FFT in-place to one vector.
+     *
+     *  @param[in,out] x is the vector, size is n
+     *  @param[in,out] work is a work array with at least workSize() entries
+     *  @param[in] parallel if true the stages of the FFT are computed in parallel by OpenMP threads
+     */
+    void execute( ComplexType x[], ComplexType work[], const bool parallel ) const;
+
+private:
+
+    /** Factorization of n, returns false if n has a prime factor for which no butterfly is available. */
+
+    static bool factorize( std::vector<IndexType>& factors, IndexType n );
+
+    void setupMixedRadix();
+
+    void setupBluestein();
+
+    void executeMixedRadix( ComplexType x[], ComplexType work[], const bool parallel ) const;
+
+    void executeBluestein( ComplexType x[], ComplexType work[], const bool parallel ) const;
+
+    /** Twiddle factor exp( -2 pi i direction * k / n ) */
+
+    ComplexType root( const IndexType k, const IndexType n ) const;
+
+    IndexType mN;
+
+    int mDirection;
+
+    // data for mixed-radix FFT
+
+    std::vector<IndexType> mFactors;                   // mFactors[0] is the radix of the last stage
+
+    std::vector<IndexType> mPerm;                      // digit reversal permutation of the input
+
+    std::vector<std::vector<ComplexType> > mTwiddles;  // twiddles for each stage, [(q-1) * m + k]
+
+    std::vector<std::vector<ComplexType> > mRoots;     // roots of unity for stages with a generic radix
+
+    // data for Bluestein FFT
+
+    IndexType mConvN;                                  // size of the convolution, 0 if not used
+
+    std::vector<ComplexType> mChirp;                   // chirp exp( -pi i direction * j^2 / n )
+
+    std::vector<ComplexType> mKernel;                  // FFT of the convolution kernel, scaled by 1 / mConvN
+
+    std::shared_ptr<const OpenMPFFTPlan> mConvForward;
+    std::shared_ptr<const OpenMPFFTPlan> mConvBackward;
+
+    SCAI_LOG_DECL_STATIC_LOGGER( logger )
+};
+
+#endif
+
+} /* end namespace utilskernel */
+
+} /* end namespace scai */
@@ -195,6 +195,214 @@ BOOST_AUTO_TEST_CASE_TEMPLATE( fftTest, ValueType, scai_fft_test_types )
     }
 }
 
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( fftAnySizeTest, ValueType, scai_fft_test_types )
+{
+    ContextPtr loc = Context::getContextPtr();
+
+    typedef common::Complex<RealType<ValueType>> ComplexType;
+
+    // mixed radix sizes and primes that are computed by the Bluestein algorithm
+
+    const IndexType sizes[] = { 1, 6, 12, 15, 40, 49, 143, 17, 34, 97 };
+
+    const IndexType many = 3;
+
+    for ( IndexType n : sizes )
+    {
+        for ( int dir = -1; dir <= 1; dir += 2 )
+        {
+            HArray<ComplexType> in( many * n );
+
+            HArrayUtils::fillRandom( in, 2, 1.0f, loc );
+            HArrayUtils::compute( in, in, common::BinaryOp::SUB, ComplexType( 1, 1 ) );
+
+            HArray<ComplexType> outFFT( in );
+
+            FFTUtils::fftcall<ValueType>( outFFT, many, n, common::Math::nextpow2( n ), dir, loc );
+
+            HArray<ComplexType> outDFT;
+
+            {
+                auto rIn = hostReadAccess( in );
+                auto wOut = hostWriteOnlyAccess( outDFT, many * n );
+
+                for ( IndexType i = 0; i < many; ++i )
+                {
+                    discreteFourierTransform( wOut.get() + i * n, rIn.get() + i * n, n, dir );
+                }
+            }
+
+            RealType<ValueType> eps = common::TypeTraits<ComplexType>::small() * n;
+
+            SCAI_CHECK_SMALL_ARRAY_DIFF( outFFT, outDFT, eps )
+        }
+    }
+}
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( fftInverseTest, ValueType, scai_fft_test_types )
+{
+    ContextPtr loc = Context::getContextPtr();
+
+    typedef common::Complex<RealType<ValueType>> ComplexType;
+
+    // forward and backward FFT give the original vector scaled by n
+
+    const IndexType sizes[] = { 360, 1000, 1009 };
+
+    for ( IndexType n : sizes )
+    {
+        HArray<ComplexType> in( n );
+
+        HArrayUtils::fillRandom( in, 2, 1.0f, loc );
+
+        HArray<ComplexType> out( in );
+
+        const IndexType m = common::Math::nextpow2( n );
+
+        FFTUtils::fftcall<ValueType>( out, 1, n, m, 1, loc );
+        FFTUtils::fftcall<ValueType>( out, 1, n, m, -1, loc );
+
+        HArrayUtils::compute( out, out, common::BinaryOp::DIVIDE, ComplexType( n ) );
+
+        RealType<ValueType> eps = common::TypeTraits<ComplexType>::small() * m;
+
+        SCAI_CHECK_SMALL_ARRAY_DIFF( out, in, eps )
+    }
+}
+
+/* --------------------------------------------------------------------- */
+
+typedef boost::mpl::list<SCAI_REAL_TYPES_HOST> scai_fft_real_test_types;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( fftRealTest, ValueType, scai_fft_real_test_types )
+{
+    ContextPtr loc = Context::getContextPtr();
+
+    typedef common::Complex<ValueType> ComplexType;
+
+    // even sizes use the packing into a complex vector of half size, odd sizes the complex FFT
+
+    const IndexType sizes[] = { 1, 2, 7, 16, 30, 45, 2050 };
+
+    const IndexType many = 3;
+
+    for ( IndexType n : sizes )
+    {
+        const IndexType nc = n / 2 + 1;
+
+        HArray<ValueType> in( many * n );
+
+        HArrayUtils::fillRandom( in, 2, 1.0f, loc );
+        HArrayUtils::compute( in, in, common::BinaryOp::SUB, ValueType( 1 ), loc );
+
+        HArray<ComplexType> out;
+
+        FFTUtils::fft_r2c( out, in, many, n, loc );
+
+        BOOST_REQUIRE_EQUAL( out.size(), many * nc );
+
+        // compare with the first half of the complex FFT
+
+        HArray<ComplexType> outComplex;
+
+        FFTUtils::fft_many( outComplex, in, many, n, 1, loc );
+
+        HArray<ComplexType> expOut;
+
+        {
+            auto rComplex = hostReadAccess( outComplex );
+            auto wExp = hostWriteOnlyAccess( expOut, many * nc );
+
+            for ( IndexType i = 0; i < many; ++i )
+            {
+                for ( IndexType j = 0; j < nc; ++j )
+                {
+                    wExp[i * nc + j] = rComplex[i * n + j];
+                }
+            }
+        }
+
+        ValueType eps = common::TypeTraits<ValueType>::small() * n;
+
+        SCAI_CHECK_SMALL_ARRAY_DIFF( out, expOut, eps )
+
+        // backward transform gives the original vectors scaled by n
+
+        HArray<ValueType> back;
+
+        FFTUtils::fft_c2r( back, out, many, n, loc );
+
+        HArrayUtils::compute( back, back, common::BinaryOp::DIVIDE, ValueType( n ), loc );
+
+        SCAI_CHECK_SMALL_ARRAY_DIFF( back, in, eps )
+    }
+}
+
+/* --------------------------------------------------------------------- */
+
+BOOST_AUTO_TEST_CASE_TEMPLATE( fftGridRealTest, ValueType, scai_fft_real_test_types )
+{
+    ContextPtr loc = Context::getContextPtr();
+
+    typedef common::Complex<ValueType> ComplexType;
+
+    const common::Grid3D grid( 4, 6, 5 );
+
+    HArray<ValueType> in( grid.size() );
+
+    HArrayUtils::fillRandom( in, 2, 1.0f, loc );
+
+    for ( IndexType dim = 0; dim < grid.nDims(); ++dim )
+    {
+        HArray<ComplexType> out;
+
+        FFTUtils::fftGrid_r2c( out, in, grid, dim, loc );
+
+        common::Grid3D packedGrid( grid );
+        packedGrid.setSize( dim, grid.size( dim ) / 2 + 1 );
+
+        BOOST_REQUIRE_EQUAL( out.size(), packedGrid.size() );
+
+        // compare with the complex FFT along the same dimension
+
+        HArray<ComplexType> outComplex;
+
+        HArrayUtils::setArray( outComplex, in, common::BinaryOp::COPY, loc );
+
+        FFTUtils::fftGrid<ComplexType>( outComplex, grid, dim, 1, loc );
+
+        {
+            auto rOut = hostReadAccess( out );
+            auto rComplex = hostReadAccess( outComplex );
+
+            ValueType eps = common::TypeTraits<ValueType>::small() * 10;
+
+            IndexType pos[3];
+
+            for ( IndexType i = 0; i < packedGrid.size(); ++i )
+            {
+                packedGrid.gridPos( pos, i );
+                ComplexType diff = rOut[i] - rComplex[grid.linearPos( pos )];
+                BOOST_CHECK( common::Math::abs( diff ) < eps );
+            }
+        }
+
+        HArray<ValueType> back;
+
+        FFTUtils::fftGrid_c2r( back, out, grid, dim, loc );
+
+        HArrayUtils::compute( back, back, common::BinaryOp::DIVIDE, ValueType( grid.size( dim ) ), loc );
+
+        ValueType eps = common::TypeTraits<ValueType>::small() * 10;
+
+        SCAI_CHECK_SMALL_ARRAY_DIFF( back, in, eps )
+    }
+}
+
 #endif
 
 /* --------------------------------------------------------------------- */